@@ -42,6 +42,7 @@ namespace fuzzylite {
         std::vector<std::vector<scalar> > _expected;
         std::vector<std::vector<scalar> > _obtained;
         std::vector<scalar> _times;
+        std::vector<scalar> _samples;
         scalar _tolerance;
 
       public:
@@ -65,6 +66,15 @@ namespace fuzzylite {
          */
         enum ErrorType { NonFinite, Accuracy, All };
 
+        /**
+         Evaluation of the engine in the runs: Interpreted processes the
+         Engine, whereas DoublePrecision and SinglePrecision process the engine
+         compiled as `BasicCompiledEngine<double>` and
+         `BasicCompiledEngine<float>`, respectively
+         @since 7.1
+         */
+        enum Evaluation { Interpreted, DoublePrecision, SinglePrecision };
+
         explicit Benchmark(
             const std::string& name = "", Engine* engine = fl::null, scalar tolerance = fuzzylite::macheps()
         );
@@ -134,6 +144,41 @@ namespace fuzzylite {
          */
         const std::vector<scalar>& getTimes() const;
 
+        /**
+         Sets the vector of the number of membership function values computed
+         by the integral defuzzifier of each output variable across the runs
+         (see Benchmark::setCountingSamples())
+         @param samples is the vector of the number of membership function
+         values computed by the integral defuzzifier of each output variable
+         */
+        void setSamples(const std::vector<scalar>& samples);
+        /**
+         Gets the vector of the number of membership function values computed
+         by the integral defuzzifier of each output variable across the runs
+         @return the vector of the number of membership function values
+         computed by the integral defuzzifier of each output variable
+         */
+        const std::vector<scalar>& getSamples() const;
+
+        /**
+         Sets whether to count the membership function values computed by the
+         integral defuzzifiers in the runs, which defuzzifies the output
+         variables again after each evaluation outside of the time measured.
+         The samples are only counted when the evaluation is
+         Benchmark::Interpreted, and are cleared by the runs that do not count
+         them, so they are reported only when every run counted them.
+         @param countingSamples indicates whether to count the samples
+         @since 7.1
+         */
+        void setCountingSamples(bool countingSamples);
+        /**
+         Indicates whether to count the membership function values computed by
+         the integral defuzzifiers in the runs
+         @return whether to count the samples
+         @since 7.1
+         */
+        bool isCountingSamples() const;
+
         /**
          Sets the tolerance above which the difference between an expected and
          obtained value from the engine is considered an error
@@ -149,6 +194,23 @@ namespace fuzzylite {
          */
         scalar getTolerance() const;
 
+        /**
+         Sets the evaluation of the engine in the runs, where the engine is
+         compiled at the beginning of each call to Benchmark::run() when the
+         evaluation is not Benchmark::Interpreted. The accuracy of the single
+         precision is measured against the expected values, which can be the
+         values obtained from a run in double precision.
+         @param evaluation is the evaluation of the engine in the runs
+         @since 7.1
+         */
+        void setEvaluation(Evaluation evaluation);
+        /**
+         Gets the evaluation of the engine in the runs
+         @return the evaluation of the engine in the runs
+         @since 7.1
+         */
+        Evaluation getEvaluation() const;
+
         /**
          Produces and loads into memory the set of expected values from the
          engine
@@ -372,7 +434,10 @@ namespace fuzzylite {
         results(const OutputVariable* outputVariable, TimeUnit timeUnit = NanoSeconds, bool includeTimes = true) const;
 
         /**
-         Formats the results
+         Formats the results. The column of the samples is always present,
+         so the tables of different benchmarks have the same columns, and its
+         value is `nan` when the samples were not counted (see
+         Benchmark::setCountingSamples())
          @param results is the vector of results
          @param shape is the shape to present the table of results
          @param contents indicates the information to include in the table of results
@@ -382,6 +447,10 @@ namespace fuzzylite {
         virtual std::string format(
             std::vector<Result> results, TableShape shape, TableContents contents, const std::string& delimiter = "\t"
         ) const;
+
+      private:
+        Evaluation _evaluation;
+        bool _countingSamples;
     };
 
 }
@@ -0,0 +1,438 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_COMPILEDENGINE_H
+#define FL_COMPILEDENGINE_H
+
+#include <map>
+#include <vector>
+
+#include "fuzzylite/Engine.h"
+#include "fuzzylite/EvaluationContext.h"
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    class Term;
+    class Function;
+    class Hedge;
+    class Norm;
+    class Defuzzifier;
+    class Expression;
+
+    /**
+      The BasicCompiledEngine class is a flattened snapshot of an Engine that is
+      optimized for repeated evaluation. Upon compilation, the engine is
+      cloned and its structure is resolved into contiguous arrays: the
+      parameters of the terms are stored by kind, the antecedents of the rules
+      are flattened into postfix instructions that refer to variables and
+      terms by index, and the operators are resolved into kinds that are
+      computed without virtual dispatch. Components that cannot be flattened
+      (e.g., user-defined terms) are evaluated through their objects in the
+      snapshot.
+
+      The results of CompiledEngine::process() are identical to those of
+      Engine::process() on the engine at the time of compilation. Changes
+      made to the engine after compilation are not reflected until the engine
+      is compiled again.
+
+      The compiled engine is a template on the floating-point type `T` in
+      which it stores the parameters and computes the values, and it is
+      instantiated for `float` and `double`. The CompiledEngine evaluates in
+      the precision of fl::scalar, whereas `BasicCompiledEngine<float>` and
+      `BasicCompiledEngine<double>` evaluate any engine in single or double
+      precision within the same program, regardless of fl::scalar. The
+      components evaluated through their objects compute their values in
+      fl::scalar, which are then converted to `T`.
+
+      The state of the evaluation is kept in a BasicEvaluationContext, and the
+      methods that take a context leave the compiled engine unmodified, so a
+      single compiled engine can be evaluated concurrently by multiple threads
+      using one context per thread. The methods that do not take a context
+      use a context owned by the compiled engine.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see Engine
+      @since 7.1
+     */
+    template <typename T>
+    class FL_API BasicCompiledEngine {
+      private:
+        friend class BasicEvaluationContext<T>;
+
+        enum TermKind {
+            TermObject,
+            TermTriangle,
+            TermTrapezoid,
+            TermRectangle,
+            TermGaussian,
+            TermGaussianProduct,
+            TermBell,
+            TermSigmoid,
+            TermSShape,
+            TermZShape,
+            TermPiShape,
+            TermRamp,
+            TermConcave,
+            TermCosine,
+            TermSpike,
+            TermSigmoidDifference,
+            TermSigmoidProduct,
+            TermBinary,
+            TermConstant,
+            TermLinear,
+            TermFunction
+        };
+
+        enum HedgeKind { HedgeObject, HedgeAny, HedgeNot, HedgeVery, HedgeSomewhat, HedgeExtremely, HedgeSeldom };
+
+        enum NormKind {
+            NormNone,
+            NormObject,
+            NormMinimum,
+            NormAlgebraicProduct,
+            NormBoundedDifference,
+            NormDrasticProduct,
+            NormEinsteinProduct,
+            NormHamacherProduct,
+            NormNilpotentMinimum,
+            NormMaximum,
+            NormAlgebraicSum,
+            NormBoundedSum,
+            NormDrasticSum,
+            NormEinsteinSum,
+            NormHamacherSum,
+            NormNilpotentMaximum,
+            NormNormalizedSum,
+            NormUnboundedSum
+        };
+
+        enum ActivationKind {
+            ActivationGeneral,
+            ActivationFirst,
+            ActivationLast,
+            ActivationHighest,
+            ActivationLowest,
+            ActivationProportional,
+            ActivationThreshold
+        };
+
+        enum DefuzzifierKind {
+            DefuzzifierNone,
+            DefuzzifierObject,
+            DefuzzifierCentroid,
+            DefuzzifierBisector,
+            DefuzzifierMeanOfMaximum,
+            DefuzzifierSmallestOfMaximum,
+            DefuzzifierLargestOfMaximum,
+            DefuzzifierWeightedAverage,
+            DefuzzifierWeightedSum
+        };
+
+        enum OpCode { OpConstant, OpInput, OpOutput, OpAnd, OpOr };
+
+        struct CompiledTerm {
+            TermKind kind;
+            std::size_t offset;
+            std::size_t size;
+            T height;
+            const Term* term;
+            std::size_t group;
+            int type;
+            std::size_t position;
+            std::size_t function;
+        };
+
+        struct CompiledArgument {
+            bool output;
+            std::size_t variable;
+        };
+
+        struct CompiledFunction {
+            Function* function;
+            std::size_t argumentBegin;
+            std::size_t argumentEnd;
+        };
+
+        struct CompiledHedge {
+            HedgeKind kind;
+            const Hedge* hedge;
+        };
+
+        struct CompiledNorm {
+            NormKind kind;
+            const Norm* norm;
+        };
+
+        struct Instruction {
+            OpCode opcode;
+            std::size_t variable;
+            std::size_t term;
+            std::size_t hedgeBegin;
+            std::size_t hedgeEnd;
+            T value;
+        };
+
+        struct Conclusion {
+            std::size_t output;
+            std::size_t term;
+            std::size_t hedgeBegin;
+            std::size_t hedgeEnd;
+        };
+
+        struct CompiledRule {
+            bool enabled;
+            T weight;
+            std::size_t codeBegin;
+            std::size_t codeEnd;
+            std::size_t conclusionBegin;
+            std::size_t conclusionEnd;
+        };
+
+        struct CompiledRuleBlock {
+            ActivationKind activation;
+            int numberOfRules;
+            T threshold;
+            int comparison;
+            CompiledNorm conjunction;
+            CompiledNorm disjunction;
+            CompiledNorm implication;
+            std::size_t ruleBegin;
+            std::size_t ruleEnd;
+        };
+
+        struct CompiledOutput {
+            bool enabled;
+            T minimum;
+            T maximum;
+            T defaultValue;
+            bool lockPreviousValue;
+            bool lockValueInRange;
+            CompiledNorm aggregation;
+            DefuzzifierKind defuzzifier;
+            int resolution;
+            int weightedType;
+            std::size_t groups;
+            std::size_t samples;
+        };
+
+        typedef typename BasicEvaluationContext<T>::ActivatedTerm ActivatedTerm;
+
+        FL_unique_ptr<Engine> _engine;
+
+        std::vector<T> _parameters;
+        std::vector<CompiledTerm> _terms;
+        std::vector<CompiledFunction> _functions;
+        std::vector<CompiledArgument> _arguments;
+        std::vector<CompiledHedge> _hedges;
+        std::vector<Instruction> _code;
+        std::vector<Conclusion> _conclusions;
+        std::vector<CompiledRule> _rules;
+        std::vector<CompiledRuleBlock> _ruleBlocks;
+        std::vector<CompiledOutput> _outputs;
+
+        std::vector<T> _inputValues;
+        std::vector<T> _inputMinimum;
+        std::vector<T> _inputMaximum;
+        std::vector<bool> _inputLockValueInRange;
+        std::vector<T> _outputValues;
+        std::vector<T> _previousValues;
+        std::vector<T> _samples;
+        std::size_t _numberOfGroups;
+        std::size_t _resolution;
+        std::size_t _generation;
+        BasicEvaluationContext<T> _context;
+
+        std::size_t compileTerm(const Term* term, std::map<const Term*, std::size_t>& slots);
+        std::size_t compileFunction(const Function* function);
+        std::size_t compileHedges(const std::vector<Hedge*>& hedges);
+        CompiledNorm compileNorm(const Norm* norm) const;
+        void compileExpression(
+            const Expression* node,
+            const CompiledRuleBlock& ruleBlock,
+            const std::string& text,
+            std::map<const Term*, std::size_t>& slots
+        );
+        void clear();
+        void initialize(BasicEvaluationContext<T>& context) const;
+        T boundInputValue(std::size_t index, T value) const;
+        void checkContext(const BasicEvaluationContext<T>& context) const;
+
+        T membership(const BasicEvaluationContext<T>& context, std::size_t term, T x) const;
+        void membership(
+            const BasicEvaluationContext<T>& context, std::size_t term, const T* x, T* y, std::size_t n
+        ) const;
+        T hedge(std::size_t begin, std::size_t end, T x) const;
+        T compute(const CompiledNorm& norm, T a, T b) const;
+        template <typename B>
+        void compute(const CompiledNorm& norm, const T* a, B b, T* y, std::size_t n) const;
+        T activationDegree(const BasicEvaluationContext<T>& context, std::size_t output, std::size_t term) const;
+        void aggregate(BasicEvaluationContext<T>& context, std::size_t output, const T* x, T* y, std::size_t n) const;
+        T evaluate(
+            BasicEvaluationContext<T>& context, const CompiledRule& rule, const CompiledRuleBlock& ruleBlock
+        ) const;
+        void trigger(BasicEvaluationContext<T>& context, std::size_t ruleBlock, std::size_t rule) const;
+        void activate(BasicEvaluationContext<T>& context, std::size_t ruleBlock) const;
+        T defuzzify(BasicEvaluationContext<T>& context, std::size_t output) const;
+        T integralDefuzzify(BasicEvaluationContext<T>& context, std::size_t output) const;
+        T weightedDefuzzify(BasicEvaluationContext<T>& context, std::size_t output) const;
+        T defuzzifyObject(BasicEvaluationContext<T>& context, std::size_t output) const;
+
+      public:
+        explicit BasicCompiledEngine(const Engine* engine = fl::null);
+        virtual ~BasicCompiledEngine();
+        FL_DISABLE_COPY(BasicCompiledEngine)
+
+        /**
+          Compiles a snapshot of the given engine, replacing any previous
+          compilation. The values of the input and output variables are
+          copied from the engine.
+          @param engine is the engine to compile
+          @throws fl::Exception if the engine cannot be compiled, that is,
+          if the engine would throw the exception upon processing
+         */
+        virtual void compile(const Engine* engine);
+        /**
+          Indicates whether an engine has been compiled
+          @return whether an engine has been compiled
+         */
+        virtual bool isCompiled() const;
+        /**
+          Gets the snapshot of the engine that was compiled
+          @return the snapshot of the engine that was compiled
+         */
+        virtual const Engine* getEngine() const;
+
+        /**
+          Gets the number of input variables
+          @return the number of input variables
+         */
+        virtual std::size_t numberOfInputVariables() const;
+        /**
+          Gets the number of output variables
+          @return the number of output variables
+         */
+        virtual std::size_t numberOfOutputVariables() const;
+
+        /**
+          Sets the value of the input variable at the given index, bounding
+          the value to its range if the input variable locks its value in
+          range
+          @param index is the index of the input variable
+          @param value is the value of the input variable
+         */
+        virtual void setInputValue(std::size_t index, T value);
+        /**
+          Gets the value of the input variable at the given index
+          @param index is the index of the input variable
+          @return the value of the input variable
+         */
+        virtual T getInputValue(std::size_t index) const;
+        /**
+          Gets the value of the output variable at the given index
+          @param index is the index of the output variable
+          @return the value of the output variable
+         */
+        virtual T getOutputValue(std::size_t index) const;
+        /**
+          Gets the previous value of the output variable at the given index
+          @param index is the index of the output variable
+          @return the previous value of the output variable
+          @see OutputVariable::getPreviousValue()
+         */
+        virtual T getPreviousOutputValue(std::size_t index) const;
+
+        /**
+          Processes the compiled engine with the current values of the input
+          variables in the same manner as Engine::process()
+          @see Engine::process()
+         */
+        virtual void process();
+        /**
+          Processes the compiled engine with the values of the input variables
+          in the given context, storing the results in the context. The
+          compiled engine is not modified, so it can be shared by multiple
+          threads as long as each thread processes its own context.
+          @param context is the context of the evaluation
+          @throws fl::Exception if the context does not evaluate this engine,
+          or was created before the engine was last compiled
+          @see BasicEvaluationContext
+         */
+        virtual void process(BasicEvaluationContext<T>& context) const;
+
+        /**
+          Processes the given rows of input values, writing the values of the
+          output variables of each row to the outputs, in the same manner as
+          setting the input values of each row, calling
+          BasicCompiledEngine::process(), and getting the output values. After
+          processing, the input and output values are those of the last row.
+          If processing a row throws an exception, its output values are
+          written and the exception is rethrown without processing the
+          remaining rows.
+          @param inputs is the buffer of `rows * numberOfInputVariables()`
+          input values
+          @param rows is the number of rows to process
+          @param outputs is the buffer of `rows * numberOfOutputVariables()`
+          output values
+          @param layout is the layout of the values in both buffers
+          @see Engine::processBatch()
+         */
+        virtual void processBatch(
+            const T* inputs, std::size_t rows, T* outputs, Engine::Layout layout = Engine::RowMajor
+        );
+        /**
+          Processes the given rows of input values with the given context in
+          the same manner as BasicCompiledEngine::processBatch(), leaving the
+          compiled engine unmodified
+          @param context is the context of the evaluation
+          @param inputs is the buffer of `rows * numberOfInputVariables()`
+          input values
+          @param rows is the number of rows to process
+          @param outputs is the buffer of `rows * numberOfOutputVariables()`
+          output values
+          @param layout is the layout of the values in both buffers
+          @throws fl::Exception if the context does not evaluate this engine,
+          or was created before the engine was last compiled
+         */
+        virtual void processBatch(
+            BasicEvaluationContext<T>& context,
+            const T* inputs,
+            std::size_t rows,
+            T* outputs,
+            Engine::Layout layout = Engine::RowMajor
+        ) const;
+
+        /**
+          Restarts the compiled engine by setting the values of the input
+          variables and output variables to fl::nan
+          @see Engine::restart()
+         */
+        virtual void restart();
+
+        /**
+          Creates a context to evaluate the compiled engine, starting from the
+          values of the variables at the time of compilation
+          @return a context to evaluate the compiled engine
+         */
+        virtual BasicEvaluationContext<T>* createContext() const;
+    };
+
+    /**CompiledEngine is the compiled engine that evaluates in the precision of fl::scalar*/
+    typedef BasicCompiledEngine<scalar> CompiledEngine;
+}
+
+#endif /* FL_COMPILEDENGINE_H */
@@ -21,7 +21,10 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include <string>
 #include <vector>
 
+#include "fuzzylite/IncrementalEvaluator.h"
+#include "fuzzylite/NameIndex.h"
 #include "fuzzylite/fuzzylite.h"
+#include "fuzzylite/rule/RuleBlockScheduler.h"
 
 namespace fuzzylite {
 
@@ -34,6 +37,9 @@ namespace fuzzylite {
     class SNorm;
     class Defuzzifier;
     class Activation;
+    template <typename T>
+    class BasicCompiledEngine;
+    typedef BasicCompiledEngine<scalar> CompiledEngine;
 
     /**
       The Engine class is the core class of the library as it groups the
@@ -51,9 +57,18 @@ namespace fuzzylite {
         std::string _description;
         std::vector<InputVariable*> _inputVariables;
         std::vector<OutputVariable*> _outputVariables;
+        NameIndex _inputIndex;
+        NameIndex _outputIndex;
         std::vector<RuleBlock*> _ruleBlocks;
+        bool _incremental;
+        IncrementalEvaluator _incrementalEvaluator;
+        std::size_t _numberOfThreads;
+        mutable RuleBlockScheduler _ruleBlockScheduler;
+        mutable bool _functionsResolved;
 
         void copyFrom(const Engine& source);
+        void updateValues(const CompiledEngine& compiled);
+        void resolveFunctions();
 
       protected:
         void updateReferences() const;
@@ -129,14 +144,106 @@ namespace fuzzylite {
 
         /**
           Processes the engine in its current state as follows: (a) Clears the
-          aggregated fuzzy output variables, (b) Activates the rule blocks, and
-          (c) Defuzzifies the output variables
+          aggregated fuzzy output variables, (b) Activates the rule blocks in
+          the order of their dependencies (see RuleBlockScheduler), and (c)
+          Defuzzifies the output variables. In incremental mode, only the
+          rules that depend on the input variables whose values have changed
+          since the last evaluation are activated, and only the output
+          variables that depend on those rules are aggregated and defuzzified
+          again.
           @see Aggregated::clear()
           @see RuleBlock::activate()
           @see OutputVariable::defuzzify()
+          @see Engine::setIncremental()
          */
         virtual void process();
 
+        /**
+          Sets whether the engine is processed incrementally, that is,
+          re-evaluating only the rules whose antecedents refer to the input
+          variables whose values have changed since the last evaluation. The
+          results are identical to those of processing the engine fully, but
+          the changes to the parameters of the components of the engine are
+          not tracked (see IncrementalEvaluator), so Engine::rebuildIndexes()
+          must be called after such changes to discard the state of the last
+          evaluation.
+          @param incremental indicates whether to process the engine
+          incrementally
+          @see IncrementalEvaluator
+         */
+        virtual void setIncremental(bool incremental);
+        /**
+          Indicates whether the engine is processed incrementally
+          @return whether the engine is processed incrementally
+         */
+        virtual bool isIncremental() const;
+        /**
+          Gets the evaluator that processes the engine incrementally
+          @return the evaluator that processes the engine incrementally
+         */
+        virtual const IncrementalEvaluator& incrementalEvaluator() const;
+
+        /**
+          Sets the number of threads to activate the independent rule blocks
+          in parallel, where one (default) activates the rule blocks in the
+          calling thread, and zero uses the number of threads supported by
+          the hardware. The rule blocks are activated in parallel only if
+          their dependencies allow it (see RuleBlockScheduler::isConcurrent()),
+          in which case the terms, hedges, and operators must be safe to use
+          from multiple threads, and the memberships of the input variables
+          are not cached.
+          @param numberOfThreads is the number of threads to activate the
+          rule blocks
+         */
+        virtual void setNumberOfThreads(std::size_t numberOfThreads);
+        /**
+          Gets the number of threads to activate the independent rule blocks
+          in parallel
+          @return the number of threads to activate the independent rule
+          blocks in parallel
+         */
+        virtual std::size_t getNumberOfThreads() const;
+        /**
+          Gets the scheduler of the rule blocks, which is built again
+          whenever the rule blocks or their rules change
+          @return the scheduler of the current rule blocks
+         */
+        virtual const RuleBlockScheduler& ruleBlockScheduler() const;
+
+        /**
+          Layout of the values of the variables in the buffers of
+          Engine::processBatch()
+         */
+        enum Layout {
+            /**RowMajor: the values of each row are contiguous, that is, the
+            value of variable `v` in row `r` is at `r * numberOfVariables + v`*/
+            RowMajor,
+            /**ColumnMajor: the values of each variable are contiguous, that is,
+            the value of variable `v` in row `r` is at `v * rows + r`*/
+            ColumnMajor
+        };
+
+        /**
+          Processes the given rows of input values in a single call, writing
+          the values of the output variables of each row to the outputs. The
+          results are the same as setting the input values of each row,
+          calling Engine::process(), and getting the output values, but the
+          engine is compiled once and the cost of processing is amortised
+          across the rows. After processing, the input and output variables
+          hold the values of the last row, and the fuzzy outputs are cleared.
+          If processing a row throws an exception, its output values are
+          written and the exception is rethrown without processing the
+          remaining rows.
+          @param inputs is the buffer of `rows * numberOfInputVariables()`
+          input values
+          @param rows is the number of rows to process
+          @param outputs is the buffer of `rows * numberOfOutputVariables()`
+          output values
+          @param layout is the layout of the values in both buffers
+          @see CompiledEngine::processBatch()
+         */
+        virtual void processBatch(const scalar* inputs, std::size_t rows, scalar* outputs, Layout layout = RowMajor);
+
         /**
           Restarts the engine by setting the values of the input variables to
           fl::nan and clearing the output variables
@@ -169,8 +276,9 @@ namespace fuzzylite {
 
         /**
           Sets the value of the given input variable.
-          The cost of this method is O(n), where n is the number of
-          input variables in the engine. For performance, please get the
+          The input variable is found by name in constant time using an index
+          of the input variables (see NameIndex), which the engine updates when
+          it modifies the input variables. For performance, please get the
           variables by index.
           @param name is the name of the input variable
           @param value is the value for the input variable
@@ -178,8 +286,9 @@ namespace fuzzylite {
         virtual void setInputValue(const std::string& name, scalar value);
         /**
           Gets the value of the given output variable.
-          The cost of this method is O(n), where n is the number of
-          output variables in the engine. For performance, please get the
+          The output variable is found by name in constant time using an index
+          of the output variables (see NameIndex), which the engine updates when
+          it modifies the output variables. For performance, please get the
           variables by index.
           @param name is the name of the output variable
           @return the value of the given output variable
@@ -231,11 +340,21 @@ namespace fuzzylite {
         virtual Type type(std::string* name = fl::null, std::string* reason = fl::null) const;
 
         /**
-          Creates a clone of the engine
+          Creates a clone of the engine. The loaded rules are copied from their
+          antecedents and consequents referencing the variables and terms of
+          the clone, such that only the rules that are not loaded are loaded
+          from their text
           @return a clone of the engine
          */
         virtual Engine* clone() const;
 
+        /**
+          Creates a compiled snapshot of the engine for faster processing
+          @return a compiled snapshot of the engine
+          @see CompiledEngine
+         */
+        virtual CompiledEngine* compile() const;
+
         /**
           Returns a vector that contains the input variables followed by the
           output variables in the order of insertion
@@ -245,6 +364,26 @@ namespace fuzzylite {
          */
         virtual std::vector<Variable*> variables() const;
 
+        /**
+          Rebuilds the indexes of the input and output variables by name, and
+          the indexes of their terms (see Variable::rebuildIndex()), which is
+          needed after renaming the variables or terms or modifying the
+          mutable vectors of variables or terms, as otherwise finding those
+          components by name takes linear time. The indexes of the rules in
+          the rule blocks are also rebuilt (see RuleBlock::rebuildIndex()),
+          which is needed after changing the parameters of the terms in the
+          antecedents of the rules or loading the rules directly. The sources
+          of the variables read by the Function terms of the engine are
+          resolved again (see Function::membership()), which the engine
+          otherwise does once on the next Engine::process() after it modifies
+          its variables. Lastly, the state of the last incremental evaluation
+          is discarded (see Engine::setIncremental())
+          @see NameIndex
+          @see RuleIndex
+          @see IncrementalEvaluator
+         */
+        virtual void rebuildIndexes();
+
         /**
           Adds the input variable
           @param inputVariable is the input variable
@@ -272,10 +411,10 @@ namespace fuzzylite {
          */
         virtual InputVariable* getInputVariable(std::size_t index) const;
         /**
-          Gets the input variable of the given name after iterating the input
-          variables. The cost of this method is O(n), where n is the number of
-          input variables in the engine. For performance, please get the
-          variables by index.
+          Gets the input variable of the given name, which is found in constant
+          time using an index of the input variables (see NameIndex) that the
+          engine updates when it modifies the input variables. For
+          performance, please get the variables by index.
           @param name is the name of the input variable
           @return input variable of the given name
           @throws fl::Exception if there is no variable with the given name
@@ -319,7 +458,9 @@ namespace fuzzylite {
          */
         virtual void setInputVariables(const std::vector<InputVariable*>& inputVariables);
         /**
-          Returns a mutable vector of input variables
+          Returns a mutable vector of input variables. After modifying the
+          vector or renaming its variables, the indexes must be rebuilt (see
+          Engine::rebuildIndexes())
           @return a mutable vector of input variables
          */
         virtual std::vector<InputVariable*>& inputVariables();
@@ -350,10 +491,10 @@ namespace fuzzylite {
          */
         virtual OutputVariable* getOutputVariable(std::size_t index) const;
         /**
-          Gets the output variable of the given name after iterating the output
-          variables. The cost of this method is O(n), where n is the number of
-          output variables in the engine. For performance, please get the
-          variables by index.
+          Gets the output variable of the given name, which is found in constant
+          time using an index of the output variables (see NameIndex) that the
+          engine updates when it modifies the output variables. For
+          performance, please get the variables by index.
           @param name is the name of the output variable
           @return output variable of the given name
           @throws fl::Exception if there is no variable with the given name
@@ -398,7 +539,9 @@ namespace fuzzylite {
          */
         virtual void setOutputVariables(const std::vector<OutputVariable*>& outputVariables);
         /**
-          Returns a mutable vector of output variables
+          Returns a mutable vector of output variables. After modifying the
+          vector or renaming its variables, the indexes must be rebuilt (see
+          Engine::rebuildIndexes())
           @return a mutable vector of output variables
          */
         virtual std::vector<OutputVariable*>& outputVariables();
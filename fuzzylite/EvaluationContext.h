@@ -0,0 +1,151 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_EVALUATIONCONTEXT_H
+#define FL_EVALUATIONCONTEXT_H
+
+#include <vector>
+
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    template <typename T>
+    class BasicCompiledEngine;
+    class Engine;
+
+    /**
+      The BasicEvaluationContext class holds the state of the evaluation of a
+      BasicCompiledEngine, that is, the values of the input and output
+      variables, the activation degrees of the rules, the activated terms of
+      the output variables, and the buffers used to defuzzify them. A
+      compiled engine is not modified by
+      BasicCompiledEngine::process(BasicEvaluationContext&) const, so a single
+      compiled engine can be shared by any number of threads as long as each
+      thread processes its own context.
+
+      The context is a template on the floating-point type `T` of the values,
+      which is the same type of the compiled engine it evaluates, and it is
+      instantiated for `float` and `double`.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see BasicCompiledEngine
+      @since 7.1
+     */
+    template <typename T>
+    class FL_API BasicEvaluationContext {
+      private:
+        friend class BasicCompiledEngine<T>;
+
+        struct ActivatedTerm {
+            std::size_t term;
+            T degree;
+            std::size_t ruleBlock;
+        };
+
+        const BasicCompiledEngine<T>* _engine;
+        std::size_t _generation;
+        FL_unique_ptr<Engine> _snapshot;
+        std::vector<T> _inputValues;
+        std::vector<T> _outputValues;
+        std::vector<T> _previousValues;
+        std::vector<T> _activationDegrees;
+        std::vector<std::vector<ActivatedTerm> > _activatedTerms;
+        std::vector<T> _groupDegrees;
+        std::vector<std::size_t> _groupTerms;
+        std::vector<T> _stack;
+        std::vector<T> _memberships;
+        std::vector<T> _aggregated;
+        mutable std::vector<scalar> _arguments;
+
+        void copyFrom(const BasicEvaluationContext& source);
+
+      public:
+        /**
+          Creates a context to evaluate the given compiled engine, starting
+          from the values of the variables at the time of compilation
+          @param engine is the compiled engine to evaluate
+         */
+        explicit BasicEvaluationContext(const BasicCompiledEngine<T>* engine = fl::null);
+        BasicEvaluationContext(const BasicEvaluationContext& other);
+        BasicEvaluationContext& operator=(const BasicEvaluationContext& other);
+        virtual ~BasicEvaluationContext();
+
+        /**
+          Binds the context to the given compiled engine and sets the values
+          of the variables to those at the time of compilation
+          @param engine is the compiled engine to evaluate
+         */
+        virtual void reset(const BasicCompiledEngine<T>* engine);
+        /**
+          Gets the compiled engine evaluated by the context
+          @return the compiled engine evaluated by the context
+         */
+        virtual const BasicCompiledEngine<T>* getEngine() const;
+
+        /**
+          Gets the number of input values
+          @return the number of input values
+         */
+        virtual std::size_t numberOfInputValues() const;
+        /**
+          Gets the number of output values
+          @return the number of output values
+         */
+        virtual std::size_t numberOfOutputValues() const;
+
+        /**
+          Sets the value of the input variable at the given index, bounding
+          the value to its range if the input variable locks its value in
+          range
+          @param index is the index of the input variable
+          @param value is the value of the input variable
+         */
+        virtual void setInputValue(std::size_t index, T value);
+        /**
+          Gets the value of the input variable at the given index
+          @param index is the index of the input variable
+          @return the value of the input variable
+         */
+        virtual T getInputValue(std::size_t index) const;
+        /**
+          Gets the value of the output variable at the given index
+          @param index is the index of the output variable
+          @return the value of the output variable
+         */
+        virtual T getOutputValue(std::size_t index) const;
+        /**
+          Gets the previous value of the output variable at the given index
+          @param index is the index of the output variable
+          @return the previous value of the output variable
+          @see OutputVariable::getPreviousValue()
+         */
+        virtual T getPreviousOutputValue(std::size_t index) const;
+
+        /**
+          Restarts the context by setting the values of the input variables
+          and output variables to fl::nan
+          @see Engine::restart()
+         */
+        virtual void restart();
+    };
+
+    /**EvaluationContext is the context of the CompiledEngine, which evaluates in the precision of fl::scalar*/
+    typedef BasicEvaluationContext<scalar> EvaluationContext;
+}
+
+#endif /* FL_EVALUATIONCONTEXT_H */
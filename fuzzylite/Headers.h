@@ -25,10 +25,17 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
  */
 
 #include "fuzzylite/Benchmark.h"
+#include "fuzzylite/CompiledEngine.h"
 #include "fuzzylite/Console.h"
 #include "fuzzylite/Engine.h"
+#include "fuzzylite/EvaluationContext.h"
+#include "fuzzylite/IncrementalEvaluator.h"
+#include "fuzzylite/NameIndex.h"
+#include "fuzzylite/Kernels.h"
 #include "fuzzylite/Exception.h"
 #include "fuzzylite/Operation.h"
+#include "fuzzylite/ParallelEvaluator.h"
+#include "fuzzylite/StaticEngine.h"
 #include "fuzzylite/activation/Activation.h"
 #include "fuzzylite/activation/First.h"
 #include "fuzzylite/activation/General.h"
@@ -66,6 +73,9 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include "fuzzylite/hedge/Seldom.h"
 #include "fuzzylite/hedge/Somewhat.h"
 #include "fuzzylite/hedge/Very.h"
+#include "fuzzylite/imex/BinaryExporter.h"
+#include "fuzzylite/imex/BinaryImporter.h"
+#include "fuzzylite/imex/CompiledCppExporter.h"
 #include "fuzzylite/imex/CppExporter.h"
 #include "fuzzylite/imex/FclExporter.h"
 #include "fuzzylite/imex/FclImporter.h"
@@ -102,6 +112,10 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include "fuzzylite/rule/Expression.h"
 #include "fuzzylite/rule/Rule.h"
 #include "fuzzylite/rule/RuleBlock.h"
+#include "fuzzylite/rule/RuleBlockScheduler.h"
+#include "fuzzylite/rule/RuleBuilder.h"
+#include "fuzzylite/rule/RuleIndex.h"
+#include "fuzzylite/rule/Tokenizer.h"
 #include "fuzzylite/term/Activated.h"
 #include "fuzzylite/term/Aggregated.h"
 #include "fuzzylite/term/Bell.h"
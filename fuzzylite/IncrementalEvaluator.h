@@ -0,0 +1,156 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_INCREMENTALEVALUATOR_H
+#define FL_INCREMENTALEVALUATOR_H
+
+#include <map>
+#include <vector>
+
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    class Engine;
+    class InputVariable;
+    class OutputVariable;
+    class RuleBlock;
+    class Rule;
+
+    /**
+      The IncrementalEvaluator class processes an Engine re-evaluating only
+      the rules whose antecedents refer to the input variables whose values
+      have changed since the last evaluation. The other rules keep their
+      activation degrees, and only the output variables that depend on the
+      re-evaluated rules are aggregated and defuzzified again, so the results
+      are identical to those of a full Engine::process(). The output variables
+      that have Linear or Function terms, which read the values of the
+      variables, are aggregated and defuzzified again whenever any input
+      variable changes.
+
+      The evaluator records the structure of the engine after a full
+      evaluation, that is, the variables and rule blocks (and whether they
+      are enabled), the aggregation operators and defuzzifiers of the output
+      variables, the operators and activation methods of the rule blocks,
+      and their rules. If the structure changes, such as when any of those
+      components is replaced, or any rule of the engine is loaded or
+      unloaded (see RuleBlock::revision()), the engine is processed fully.
+      However, the following changes are not tracked, in which case the
+      evaluator must be cleared before processing the engine (see
+      Engine::rebuildIndexes()):
+
+      - the parameters of the terms (including their height),
+      - the parameters of the defuzzifiers (e.g., the resolution),
+      - the parameters of the norms (e.g., the formula of TNormFunction),
+      - the weights and the enabled state of the rules, and
+      - the range, default value, and locks of the output variables.
+
+      The changes to the expressions of the rules, such as their hedges, take
+      effect when the rules are loaded again, which is tracked.
+
+      Engines whose rule blocks do not use the General activation method, or
+      whose antecedents refer to output variables (e.g., chained rule
+      blocks) or to Function terms, cannot be processed incrementally and are
+      always processed fully.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see Engine::setIncremental()
+      @since 7.1
+     */
+    class FL_API IncrementalEvaluator {
+      private:
+        struct Entry {
+            RuleBlock* ruleBlock;
+            Rule* rule;
+            std::size_t component;
+        };
+
+        bool _recorded;
+        bool _supported;
+        std::vector<const void*> _structure;
+        std::vector<int> _enabled;
+        std::vector<std::size_t> _revisions;
+        std::vector<scalar> _inputValues;
+        std::vector<Entry> _rules;
+        std::vector<int> _active;
+        std::map<const Rule*, std::size_t> _ruleIds;
+        std::vector<std::size_t> _blockRules;
+        std::vector<std::vector<std::size_t> > _dependents;
+        std::vector<std::vector<std::size_t> > _componentRules;
+        std::vector<std::vector<std::size_t> > _componentOutputs;
+        std::vector<std::size_t> _outputComponents;
+        std::vector<int> _changeSensitive;
+        std::size_t _evaluatedRules;
+        std::vector<const void*> _currentStructure;
+        std::vector<int> _currentEnabled;
+        std::vector<std::size_t> _currentRevisions;
+        std::vector<int> _dirty;
+        std::vector<int> _affected;
+        std::vector<Rule*> _candidates;
+
+        void snapshot(
+            const Engine* engine,
+            std::vector<const void*>& structure,
+            std::vector<int>& enabled,
+            std::vector<std::size_t>& revisions
+        ) const;
+
+      public:
+        IncrementalEvaluator();
+        virtual ~IncrementalEvaluator();
+        FL_DEFAULT_COPY_AND_MOVE(IncrementalEvaluator)
+
+        /**
+          Records the state of the engine after it has been processed fully
+          @param engine is the engine that has been processed
+         */
+        virtual void record(const Engine* engine);
+
+        /**
+          Processes the engine incrementally from the recorded state
+          @param engine is the engine to process
+          @return whether the engine was processed, which is false if there
+          is no recorded state, the structure of the engine has changed, or
+          the engine cannot be processed incrementally, in which case the
+          engine must be processed fully
+          @throws fl::Exception if processing the engine throws an exception,
+          in which case the recorded state is cleared
+         */
+        virtual bool process(Engine* engine);
+
+        /**
+          Clears the recorded state, so the next evaluation is a full one
+         */
+        virtual void clear();
+
+        /**
+          Indicates whether the state of an engine has been recorded
+          @return whether the state of an engine has been recorded
+         */
+        virtual bool isRecorded() const;
+
+        /**
+          Gets the number of rules evaluated by the last incremental
+          evaluation
+          @return the number of rules evaluated by the last incremental
+          evaluation
+         */
+        virtual std::size_t numberOfEvaluatedRules() const;
+    };
+}
+
+#endif /* FL_INCREMENTALEVALUATOR_H */
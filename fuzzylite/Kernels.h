@@ -0,0 +1,527 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_KERNELS_H
+#define FL_KERNELS_H
+
+#include <cmath>
+
+#include "fuzzylite/Operation.h"
+
+namespace fuzzylite {
+
+    /**
+      The kernel namespace contains the inline functions that compute the
+      membership functions of the terms, the norms, and the hedges, which are
+      shared by their classes, the CompiledEngine, and the StaticEngine so that
+      all of them compute exactly the same values. The functions are templates
+      on the floating-point type of the values, so the same kernels compute
+      the values in `float` and in `double`.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see Term
+      @see Norm
+      @see Hedge
+      @since 7.1
+     */
+    namespace kernel {
+
+        /**
+          Computes the membership function of the Triangle term
+          @see Triangle::membership()
+         */
+        template <typename T>
+        inline T triangle(T a, T b, T c, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (Op::isLt(x, a) or Op::isGt(x, c))
+                return height * T(0.0);
+            if (Op::isEq(x, b))
+                return height * T(1.0);
+            if (Op::isLt(x, b)) {
+                if (a == -fl::inf)
+                    return height * T(1.0);
+                return height * (x - a) / (b - a);
+            }
+            if (c == fl::inf)
+                return height * T(1.0);
+            return height * (c - x) / (c - b);
+        }
+
+        /**
+          Computes the membership function of the Trapezoid term
+          @see Trapezoid::membership()
+         */
+        template <typename T>
+        inline T trapezoid(T a, T b, T c, T d, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (Op::isLt(x, a) or Op::isGt(x, d))
+                return height * T(0.0);
+            if (Op::isLt(x, b)) {
+                if (a == -fl::inf)
+                    return height * T(1.0);
+                return height * Op::min(T(1.0), (x - a) / (b - a));
+            }
+            if (Op::isLE(x, c))
+                return height * T(1.0);
+            if (Op::isLt(x, d)) {
+                if (d == fl::inf)
+                    return height * T(1.0);
+                return height * (d - x) / (d - c);
+            }
+            if (d == fl::inf)
+                return height * T(1.0);
+            return height * T(0.0);
+        }
+
+        /**
+          Computes the membership function of the Rectangle term
+          @see Rectangle::membership()
+         */
+        template <typename T>
+        inline T rectangle(T start, T end, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (Op::isGE(x, start) and Op::isLE(x, end))
+                return height * T(1.0);
+            return height * T(0.0);
+        }
+
+        /**
+          Computes the membership function of the Gaussian term
+          @see Gaussian::membership()
+         */
+        template <typename T>
+        inline T gaussian(T mean, T standardDeviation, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            return height * std::exp((-(x - mean) * (x - mean)) / (T(2.0) * standardDeviation * standardDeviation));
+        }
+
+        /**
+          Computes the membership function of the GaussianProduct term
+          @see GaussianProduct::membership()
+         */
+        template <typename T>
+        inline T gaussianProduct(T meanA, T standardDeviationA, T meanB, T standardDeviationB, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            T a = T(1.0), b = T(1.0);
+            if (Op::isLt(x, meanA))
+                a = std::exp((-(x - meanA) * (x - meanA)) / (T(2.0) * standardDeviationA * standardDeviationA));
+            if (Op::isGt(x, meanB))
+                b = std::exp((-(x - meanB) * (x - meanB)) / (T(2.0) * standardDeviationB * standardDeviationB));
+            return height * a * b;
+        }
+
+        /**
+          Computes the membership function of the Bell term
+          @see Bell::membership()
+         */
+        template <typename T>
+        inline T bell(T center, T width, T slope, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            return height * (T(1.0) / (T(1.0) + std::pow(std::abs((x - center) / width), T(2.0) * slope)));
+        }
+
+        /**
+          Computes the membership function of the Sigmoid term
+          @see Sigmoid::membership()
+         */
+        template <typename T>
+        inline T sigmoid(T inflection, T slope, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            return height * T(1.0) / (T(1.0) + std::exp(-slope * (x - inflection)));
+        }
+
+        /**
+          Computes the membership function of the SShape term
+          @see SShape::membership()
+         */
+        template <typename T>
+        inline T sShape(T start, T end, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (Op::isLE(x, start))
+                return height * T(0.0);
+            if (Op::isLE(x, T(0.5) * (start + end)))
+                return height * (T(2.0) * std::pow((x - start) / (end - start), 2));
+            if (Op::isLt(x, end))
+                return height * (T(1.0) - T(2.0) * std::pow((x - end) / (end - start), 2));
+            return height * T(1.0);
+        }
+
+        /**
+          Computes the membership function of the ZShape term
+          @see ZShape::membership()
+         */
+        template <typename T>
+        inline T zShape(T start, T end, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (Op::isLE(x, start))
+                return height * T(1.0);
+            if (Op::isLE(x, T(0.5) * (start + end)))
+                return height * (T(1.0) - T(2.0) * std::pow((x - start) / (end - start), 2));
+            if (Op::isLt(x, end))
+                return height * (T(2.0) * std::pow((x - end) / (end - start), 2));
+            return height * T(0.0);
+        }
+
+        /**
+          Computes the membership function of the PiShape term
+          @see PiShape::membership()
+         */
+        template <typename T>
+        inline T piShape(T bottomLeft, T topLeft, T topRight, T bottomRight, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            T sshape;
+            if (Op::isLE(x, bottomLeft))
+                sshape = T(0.0);
+            else if (Op::isLE(x, T(0.5) * (bottomLeft + topLeft)))
+                sshape = T(2.0) * std::pow((x - bottomLeft) / (topLeft - bottomLeft), 2);
+            else if (Op::isLt(x, topLeft))
+                sshape = T(1.0) - T(2.0) * std::pow((x - topLeft) / (topLeft - bottomLeft), 2);
+            else
+                sshape = T(1.0);
+
+            T zshape;
+            if (Op::isLE(x, topRight))
+                zshape = T(1.0);
+            else if (Op::isLE(x, T(0.5) * (topRight + bottomRight)))
+                zshape = T(1.0) - T(2.0) * std::pow((x - topRight) / (bottomRight - topRight), 2);
+            else if (Op::isLt(x, bottomRight))
+                zshape = T(2.0) * std::pow((x - bottomRight) / (bottomRight - topRight), 2);
+            else
+                zshape = T(0.0);
+            return height * sshape * zshape;
+        }
+
+        /**
+          Computes the membership function of the Ramp term
+          @see Ramp::membership()
+         */
+        template <typename T>
+        inline T ramp(T start, T end, T height, T x) {
+            if (Op::isNaN(x) or Op::isEq(start, end))
+                return fl::nan;
+            if (Op::isLt(start, end)) {
+                if (Op::isLE(x, start))
+                    return height * T(0.0);
+                if (Op::isGE(x, end))
+                    return height * T(1.0);
+                return height * (x - start) / (end - start);
+            }
+            if (Op::isGE(x, start))
+                return height * T(0.0);
+            if (Op::isLE(x, end))
+                return height * T(1.0);
+            return height * (start - x) / (start - end);
+        }
+
+        /**
+          Computes the membership function of the Concave term
+          @see Concave::membership()
+         */
+        template <typename T>
+        inline T concave(T inflection, T end, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (Op::isLE(inflection, end)) {  // Concave increasing
+                if (Op::isLt(x, end))
+                    return height * (end - inflection) / (T(2.0) * end - inflection - x);
+            } else {  // Concave decreasing
+                if (Op::isGt(x, end))
+                    return height * (inflection - end) / (inflection - T(2.0) * end + x);
+            }
+            return height * T(1.0);
+        }
+
+        /**
+          Computes the membership function of the Cosine term
+          @see Cosine::membership()
+         */
+        template <typename T>
+        inline T cosine(T center, T width, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (Op::isLt(x, center - T(0.5) * width) or Op::isGt(x, center + T(0.5) * width))
+                return height * T(0.0);
+            const T pi = T(4.0) * std::atan(T(1.0));
+            return height * (T(0.5) * (T(1.0) + std::cos(T(2.0) / width * pi * (x - center))));
+        }
+
+        /**
+          Computes the membership function of the Spike term
+          @see Spike::membership()
+         */
+        template <typename T>
+        inline T spike(T center, T width, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            return height * std::exp(-std::abs(T(10.0) / width * (x - center)));
+        }
+
+        /**
+          Computes the membership function of the SigmoidDifference term
+          @see SigmoidDifference::membership()
+         */
+        template <typename T>
+        inline T sigmoidDifference(T left, T rising, T falling, T right, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            const T a = T(1.0) / (T(1.0) + std::exp(-rising * (x - left)));
+            const T b = T(1.0) / (T(1.0) + std::exp(-falling * (x - right)));
+            return height * std::abs(a - b);
+        }
+
+        /**
+          Computes the membership function of the SigmoidProduct term
+          @see SigmoidProduct::membership()
+         */
+        template <typename T>
+        inline T sigmoidProduct(T left, T rising, T falling, T right, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            const T a = T(1.0) + std::exp(-rising * (x - left));
+            const T b = T(1.0) + std::exp(-falling * (x - right));
+            return height * T(1.0) / (a * b);
+        }
+
+        /**
+          Computes the membership function of the Binary term
+          @see Binary::membership()
+         */
+        template <typename T>
+        inline T binary(T start, T direction, T height, T x) {
+            if (Op::isNaN(x))
+                return fl::nan;
+            if (direction > start and Op::isGE(x, start))
+                return height * T(1.0);
+            if (direction < start and Op::isLE(x, start))
+                return height * T(1.0);
+            return height * T(0.0);
+        }
+
+        /**
+          Computes the Minimum norm
+          @see Minimum::compute()
+         */
+        template <typename T>
+        inline T minimum(T a, T b) {
+            return Op::min(a, b);
+        }
+
+        /**
+          Computes the AlgebraicProduct norm
+          @see AlgebraicProduct::compute()
+         */
+        template <typename T>
+        inline T algebraicProduct(T a, T b) {
+            return a * b;
+        }
+
+        /**
+          Computes the BoundedDifference norm
+          @see BoundedDifference::compute()
+         */
+        template <typename T>
+        inline T boundedDifference(T a, T b) {
+            return Op::max(T(0.0), a + b - T(1.0));
+        }
+
+        /**
+          Computes the DrasticProduct norm
+          @see DrasticProduct::compute()
+         */
+        template <typename T>
+        inline T drasticProduct(T a, T b) {
+            if (Op::isEq(Op::max(a, b), T(1.0)))
+                return Op::min(a, b);
+            return T(0.0);
+        }
+
+        /**
+          Computes the EinsteinProduct norm
+          @see EinsteinProduct::compute()
+         */
+        template <typename T>
+        inline T einsteinProduct(T a, T b) {
+            return (a * b) / (T(2.0) - (a + b - a * b));
+        }
+
+        /**
+          Computes the HamacherProduct norm
+          @see HamacherProduct::compute()
+         */
+        template <typename T>
+        inline T hamacherProduct(T a, T b) {
+            if (Op::isEq(a + b, T(0.0)))
+                return T(0.0);
+            return (a * b) / (a + b - a * b);
+        }
+
+        /**
+          Computes the NilpotentMinimum norm
+          @see NilpotentMinimum::compute()
+         */
+        template <typename T>
+        inline T nilpotentMinimum(T a, T b) {
+            if (Op::isGt(a + b, T(1.0)))
+                return Op::min(a, b);
+            return T(0.0);
+        }
+
+        /**
+          Computes the Maximum norm
+          @see Maximum::compute()
+         */
+        template <typename T>
+        inline T maximum(T a, T b) {
+            return Op::max(a, b);
+        }
+
+        /**
+          Computes the AlgebraicSum norm
+          @see AlgebraicSum::compute()
+         */
+        template <typename T>
+        inline T algebraicSum(T a, T b) {
+            return a + b - (a * b);
+        }
+
+        /**
+          Computes the BoundedSum norm
+          @see BoundedSum::compute()
+         */
+        template <typename T>
+        inline T boundedSum(T a, T b) {
+            return Op::min(T(1.0), a + b);
+        }
+
+        /**
+          Computes the DrasticSum norm
+          @see DrasticSum::compute()
+         */
+        template <typename T>
+        inline T drasticSum(T a, T b) {
+            if (Op::isEq(Op::min(a, b), T(0.0)))
+                return Op::max(a, b);
+            return T(1.0);
+        }
+
+        /**
+          Computes the EinsteinSum norm
+          @see EinsteinSum::compute()
+         */
+        template <typename T>
+        inline T einsteinSum(T a, T b) {
+            return (a + b) / (T(1.0) + a * b);
+        }
+
+        /**
+          Computes the HamacherSum norm
+          @see HamacherSum::compute()
+         */
+        template <typename T>
+        inline T hamacherSum(T a, T b) {
+            if (Op::isEq(a * b, T(1.0)))
+                return T(1.0);
+            return (a + b - T(2.0) * a * b) / (T(1.0) - a * b);
+        }
+
+        /**
+          Computes the NilpotentMaximum norm
+          @see NilpotentMaximum::compute()
+         */
+        template <typename T>
+        inline T nilpotentMaximum(T a, T b) {
+            if (Op::isLt(a + b, T(1.0)))
+                return Op::max(a, b);
+            return T(1.0);
+        }
+
+        /**
+          Computes the NormalizedSum norm
+          @see NormalizedSum::compute()
+         */
+        template <typename T>
+        inline T normalizedSum(T a, T b) {
+            return (a + b) / Op::max(T(1.0), a + b);
+        }
+
+        /**
+          Computes the UnboundedSum norm
+          @see UnboundedSum::compute()
+         */
+        template <typename T>
+        inline T unboundedSum(T a, T b) {
+            return a + b;
+        }
+
+        /**
+          Computes the Not hedge
+          @see Not::hedge()
+         */
+        template <typename T>
+        inline T negate(T x) {
+            return T(1.0) - x;
+        }
+
+        /**
+          Computes the Very hedge
+          @see Very::hedge()
+         */
+        template <typename T>
+        inline T very(T x) {
+            return x * x;
+        }
+
+        /**
+          Computes the Somewhat hedge
+          @see Somewhat::hedge()
+         */
+        template <typename T>
+        inline T somewhat(T x) {
+            return std::sqrt(x);
+        }
+
+        /**
+          Computes the Extremely hedge
+          @see Extremely::hedge()
+         */
+        template <typename T>
+        inline T extremely(T x) {
+            return Op::isLE(x, T(0.5)) ? T(2.0) * x * x : (T(1.0) - T(2.0) * (T(1.0) - x) * (T(1.0) - x));
+        }
+
+        /**
+          Computes the Seldom hedge
+          @see Seldom::hedge()
+         */
+        template <typename T>
+        inline T seldom(T x) {
+            return Op::isLE(x, T(0.5)) ? std::sqrt(T(0.5) * x) : (T(1.0) - std::sqrt(T(0.5) * (T(1.0) - x)));
+        }
+    }
+}
+
+#endif /* FL_KERNELS_H */
@@ -0,0 +1,164 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_NAMEINDEX_H
+#define FL_NAMEINDEX_H
+
+#include <string>
+#include <vector>
+
+#ifdef FL_CPP98
+#include <map>
+#else
+#include <unordered_map>
+#endif
+
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    /**
+      The NameIndex class maps the names of a sequence of named components
+      (e.g., the variables of an Engine or the terms of a Variable) to their
+      positions in the sequence, such that finding a component by name takes
+      constant time (logarithmic time in C++98) instead of a linear scan.
+
+      The index is kept by the owner of the sequence, which updates it
+      whenever it modifies the sequence (see NameIndex::add() and
+      NameIndex::rebuild()). Finding a component never modifies the index,
+      so multiple threads can find components at the same time. The
+      component found at an indexed position is checked to have the name
+      searched, and a name missing from the index is trusted to be missing
+      from the sequence while the index is up to date. The index is out of
+      date after a named component is renamed (see
+      NameIndex::componentRenamed()), after components are added or removed
+      directly in the sequence, or after a component is indexed without a
+      name, and then the components are found by a linear scan until the
+      index is rebuilt (see Engine::rebuildIndexes() and
+      Variable::rebuildIndex()). The components reordered directly in the
+      sequence are still found by a linear scan, but the components replaced
+      directly in the sequence are only found after rebuilding the index.
+      When the index is up to date, the first component of a name takes
+      precedence over the other components of the same name.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see Engine
+      @see Variable
+      @since 7.1
+     */
+    class FL_API NameIndex {
+      private:
+#ifdef FL_CPP98
+        typedef std::map<std::string, std::size_t> Positions;
+#else
+        typedef std::unordered_map<std::string, std::size_t> Positions;
+#endif
+        Positions _positions;
+        std::size_t _size;
+        std::size_t _renamings;
+        bool _unnamed;
+
+        static std::size_t _renamedComponents;
+
+        bool isUpToDate(std::size_t size) const;
+
+      public:
+        NameIndex();
+        virtual ~NameIndex();
+        FL_DEFAULT_COPY_AND_MOVE(NameIndex)
+
+        /**
+          Indexes the last component of the sequence, or rebuilds the index
+          if it does not contain the previous components
+          @param components is the sequence of components indexed by name
+         */
+        template <typename T>
+        void add(const std::vector<T*>& components);
+
+        /**
+          Rebuilds the index from the sequence of components
+          @param components is the sequence of components indexed by name
+         */
+        template <typename T>
+        void rebuild(const std::vector<T*>& components);
+
+        /**
+          Finds the first component of the given name in the sequence
+          @param components is the sequence of components indexed by name
+          @param name is the name of the component
+          @return the first component of the given name, or `fl::null` if
+          there is none
+         */
+        template <typename T>
+        T* find(const std::vector<T*>& components, const std::string& name) const;
+
+        /**
+          Notifies the indexes that a named component was renamed, which
+          makes every index out of date until it is rebuilt
+         */
+        static void componentRenamed();
+    };
+
+    inline bool NameIndex::isUpToDate(std::size_t size) const {
+        return _size == size and _renamings == _renamedComponents and not _unnamed;
+    }
+
+    template <typename T>
+    inline void NameIndex::add(const std::vector<T*>& components) {
+        if (components.empty() or not isUpToDate(components.size() - 1)) {
+            rebuild(components);
+            return;
+        }
+        const std::string name = components.back()->getName();
+        _positions.insert(typename Positions::value_type(name, _size));
+        _unnamed = name.empty();
+        ++_size;
+    }
+
+    template <typename T>
+    inline void NameIndex::rebuild(const std::vector<T*>& components) {
+        _positions.clear();
+        _unnamed = false;
+        for (std::size_t i = 0; i < components.size(); ++i) {
+            const std::string name = components.at(i)->getName();
+            _positions.insert(typename Positions::value_type(name, i));
+            _unnamed = _unnamed or name.empty();
+        }
+        _size = components.size();
+        _renamings = _renamedComponents;
+    }
+
+    template <typename T>
+    inline T* NameIndex::find(const std::vector<T*>& components, const std::string& name) const {
+        const typename Positions::const_iterator it = _positions.find(name);
+        if (it != _positions.end()) {
+            if (it->second < components.size() and components.at(it->second)->getName() == name)
+                return components.at(it->second);
+        } else if (isUpToDate(components.size())) {
+            return fl::null;
+        }
+        // the index is out of date
+        for (std::size_t i = 0; i < components.size(); ++i) {
+            if (components.at(i)->getName() == name)
+                return components.at(i);
+        }
+        return fl::null;
+    }
+
+}
+
+#endif /* FL_NAMEINDEX_H */
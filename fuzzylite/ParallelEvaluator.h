@@ -0,0 +1,167 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_PARALLELEVALUATOR_H
+#define FL_PARALLELEVALUATOR_H
+
+#include <vector>
+
+#include "fuzzylite/Engine.h"
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    template <typename T>
+    class BasicCompiledEngine;
+    typedef BasicCompiledEngine<scalar> CompiledEngine;
+
+    /**
+      The ParallelEvaluator class processes many rows of input values using
+      a pool of worker threads. The rows are split into chunks of consecutive
+      rows, the chunks are distributed among the workers, and the workers
+      that run out of chunks steal the remaining chunks of the other workers.
+      The engine is compiled once and shared by the workers, each of which
+      processes its chunks with its own EvaluationContext.
+
+      Each chunk is processed from the state of the engine at the time of
+      compilation, and the rows within a chunk are processed in order, so the
+      results depend on the chunk size but not on the number of threads nor
+      on the scheduling of the workers. Hence, the results are identical to
+      those of Engine::processBatch() when the chunk size is at least the
+      number of rows, or when the rows do not depend on the previous values
+      of the output variables.
+
+      If the library is built with `-DFL_CPP98`, the rows are processed in
+      the calling thread.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see CompiledEngine
+      @see EvaluationContext
+      @since 7.1
+     */
+    class FL_API ParallelEvaluator {
+      private:
+        std::size_t _numberOfThreads;
+        std::size_t _chunkSize;
+
+      public:
+        /**
+          Creates a parallel evaluator
+          @param numberOfThreads is the number of worker threads, where zero
+          uses the number of threads supported by the hardware
+          @param chunkSize is the number of consecutive rows processed by a
+          worker at a time
+         */
+        explicit ParallelEvaluator(std::size_t numberOfThreads = 0, std::size_t chunkSize = 256);
+        virtual ~ParallelEvaluator();
+        FL_DEFAULT_COPY_AND_MOVE(ParallelEvaluator)
+
+        /**
+          Sets the number of worker threads, where zero uses the number of
+          threads supported by the hardware
+          @param numberOfThreads is the number of worker threads
+         */
+        virtual void setNumberOfThreads(std::size_t numberOfThreads);
+        /**
+          Gets the number of worker threads, where zero uses the number of
+          threads supported by the hardware
+          @return the number of worker threads
+         */
+        virtual std::size_t getNumberOfThreads() const;
+
+        /**
+          Sets the number of consecutive rows processed by a worker at a time
+          @param chunkSize is the number of consecutive rows processed by a
+          worker at a time
+         */
+        virtual void setChunkSize(std::size_t chunkSize);
+        /**
+          Gets the number of consecutive rows processed by a worker at a time
+          @return the number of consecutive rows processed by a worker at a
+          time
+         */
+        virtual std::size_t getChunkSize() const;
+
+        /**
+          Gets the number of threads supported by the hardware
+          @return the number of threads supported by the hardware, or one if
+          it cannot be determined
+         */
+        static std::size_t hardwareConcurrency();
+
+        /**
+          Processes the rows of input values with the compiled engine, writing
+          the values of the output variables of each row to the outputs. The
+          compiled engine is not modified.
+          @param engine is the compiled engine
+          @param inputs is the buffer of `rows * numberOfInputVariables()`
+          input values
+          @param rows is the number of rows to process
+          @param outputs is the buffer of `rows * numberOfOutputVariables()`
+          output values
+          @param layout is the layout of the values in both buffers
+          @throws fl::Exception if processing any row throws an exception, in
+          which case the exception of the first row that failed is rethrown
+          after all the chunks have been processed
+         */
+        virtual void process(
+            const CompiledEngine* engine,
+            const scalar* inputs,
+            std::size_t rows,
+            scalar* outputs,
+            Engine::Layout layout = Engine::RowMajor
+        ) const;
+
+        /**
+          Processes the rows of input values with a compiled snapshot of the
+          engine, writing the values of the output variables of each row to
+          the outputs. The engine is not modified.
+          @param engine is the engine
+          @param inputs is the buffer of `rows * numberOfInputVariables()`
+          input values
+          @param rows is the number of rows to process
+          @param outputs is the buffer of `rows * numberOfOutputVariables()`
+          output values
+          @param layout is the layout of the values in both buffers
+         */
+        virtual void process(
+            const Engine* engine,
+            const scalar* inputs,
+            std::size_t rows,
+            scalar* outputs,
+            Engine::Layout layout = Engine::RowMajor
+        ) const;
+
+        /**
+          Processes the rows of input values with a compiled snapshot of the
+          engine, storing the values of the output variables of each row in
+          the output rows
+          @param engine is the engine
+          @param inputRows contains the values of the input variables of each
+          row
+          @param outputRows is resized to the number of input rows and stores
+          the values of the output variables of each row
+         */
+        virtual void process(
+            const Engine* engine,
+            const std::vector<std::vector<scalar> >& inputRows,
+            std::vector<std::vector<scalar> >& outputRows
+        ) const;
+    };
+}
+
+#endif /* FL_PARALLELEVALUATOR_H */
@@ -0,0 +1,1246 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_STATICENGINE_H
+#define FL_STATICENGINE_H
+
+#include "fuzzylite/fuzzylite.h"
+
+#ifndef FL_CPP98
+
+#include <cstddef>
+#include <type_traits>
+
+#include "fuzzylite/Kernels.h"
+#include "fuzzylite/Operation.h"
+#include "fuzzylite/activation/Threshold.h"
+
+namespace fuzzylite {
+
+    /**
+      The statics namespace contains a header-only layer of templates to
+      define engines whose structure is fixed at compile time, where the
+      terms, hedges, norms, activation methods, and defuzzifiers are template
+      parameters and the parameters of the terms are types with a static
+      `value()` (e.g., Value).
+
+      @code
+      using namespace fl::statics;
+      typedef StaticEngine<
+          Inputs<Input<Triangle<Value<0>, Value<25, 100>, Value<50, 100> >,
+                       Triangle<Value<25, 100>, Value<50, 100>, Value<75, 100> >,
+                       Triangle<Value<50, 100>, Value<75, 100>, Value<1> > > >,
+          Outputs<Output<Value<0>, Value<1>, Centroid<200>, Maximum,
+                         Triangle<Value<0>, Value<25, 100>, Value<50, 100> >,
+                         Triangle<Value<25, 100>, Value<50, 100>, Value<75, 100> >,
+                         Triangle<Value<50, 100>, Value<75, 100>, Value<1> > > >,
+          Rules<Minimum, Maximum, Minimum, General,
+                Rule<Is<0, 0>, Then<0, 2> >,
+                Rule<Is<0, 1>, Then<0, 1> >,
+                Rule<Is<0, 2>, Then<0, 0> > > >
+          SimpleDimmer;
+
+      scalar output;
+      SimpleDimmer::process(&input, &output);
+      @endcode
+
+      The engine is evaluated by the static StaticEngine::process(), which the
+      compiler can inline entirely because it involves neither virtual calls
+      nor dynamic memory. The terms, norms, and hedges compute their values
+      with the same kernels as their classes in the library, and the engine
+      follows the semantics of Engine::process(), except that the weighted
+      defuzzifiers group the activated terms by their index instead of their
+      name, which only changes the rounding errors of their sums.
+
+      The layer requires C++11, and it does not support Discrete and Function
+      terms, propositions on output variables, rule weights, Tsukamoto
+      defuzzification, or locking the values of the variables.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see CompiledEngine
+      @see CompiledCppExporter
+      @see Kernels.h
+      @since 7.1
+     */
+    namespace statics {
+
+        /**
+          The Value class is a constant @f$\frac{N}{D}@f$ that represents the
+          parameters of the terms, where the decimal literals are exactly
+          represented by a numerator and a power of ten (e.g., `0.25` is
+          `Value<25, 100>`)
+         */
+        template <long long Numerator, long long Denominator = 1>
+        struct Value {
+            static scalar value() {
+                return scalar(Numerator) / scalar(Denominator);
+            }
+        };
+
+        /**the constant @f$\infty@f$*/
+        struct Infinity {
+            static scalar value() {
+                return fl::inf;
+            }
+        };
+
+        /**the constant @f$-\infty@f$*/
+        struct NegativeInfinity {
+            static scalar value() {
+                return -fl::inf;
+            }
+        };
+
+        namespace detail {
+            template <typename... Types>
+            struct List {
+                static const std::size_t size = sizeof...(Types);
+            };
+
+            template <std::size_t Index, typename Types>
+            struct At;
+
+            template <typename Head, typename... Tail>
+            struct At<0, List<Head, Tail...> > {
+                typedef Head type;
+            };
+
+            template <std::size_t Index, typename Head, typename... Tail>
+            struct At<Index, List<Head, Tail...> > {
+                static_assert(Index <= sizeof...(Tail), "index out of range");
+                typedef typename At<Index - 1, List<Tail...> >::type type;
+            };
+
+            template <typename A, typename B>
+            struct Concat;
+
+            template <typename... A, typename... B>
+            struct Concat<List<A...>, List<B...> > {
+                typedef List<A..., B...> type;
+            };
+
+            template <typename... Hedges>
+            struct Hedged {
+                static scalar hedge(scalar x) {
+                    return x;
+                }
+            };
+
+            // the hedges are applied from right to left, as in Proposition
+            template <typename Head, typename... Tail>
+            struct Hedged<Head, Tail...> {
+                static scalar hedge(scalar x) {
+                    return Head::hedge(Hedged<Tail...>::hedge(x));
+                }
+            };
+        }
+
+        //Terms
+
+        /**the Triangle term, where the parameters are values in the order of fuzzylite::Triangle*/
+        template <typename A, typename B, typename C, typename Height = Value<1> >
+        struct Triangle {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::triangle(A::value(), B::value(), C::value(), Height::value(), x);
+            }
+        };
+
+        /**the Trapezoid term, where the parameters are values in the order of fuzzylite::Trapezoid*/
+        template <typename A, typename B, typename C, typename D, typename Height = Value<1> >
+        struct Trapezoid {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::trapezoid(A::value(), B::value(), C::value(), D::value(), Height::value(), x);
+            }
+        };
+
+        /**the Rectangle term, where the parameters are values in the order of fuzzylite::Rectangle*/
+        template <typename Start, typename End, typename Height = Value<1> >
+        struct Rectangle {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::rectangle(Start::value(), End::value(), Height::value(), x);
+            }
+        };
+
+        /**the Gaussian term, where the parameters are values in the order of fuzzylite::Gaussian*/
+        template <typename Mean, typename StandardDeviation, typename Height = Value<1> >
+        struct Gaussian {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::gaussian(Mean::value(), StandardDeviation::value(), Height::value(), x);
+            }
+        };
+
+        /**the GaussianProduct term, where the parameters are values in the order of fuzzylite::GaussianProduct*/
+        template <
+            typename MeanA, typename StandardDeviationA, typename MeanB, typename StandardDeviationB,
+            typename Height = Value<1> >
+        struct GaussianProduct {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::gaussianProduct(
+                    MeanA::value(),
+                    StandardDeviationA::value(),
+                    MeanB::value(),
+                    StandardDeviationB::value(),
+                    Height::value(),
+                    x
+                );
+            }
+        };
+
+        /**the Bell term, where the parameters are values in the order of fuzzylite::Bell*/
+        template <typename Center, typename Width, typename Slope, typename Height = Value<1> >
+        struct Bell {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::bell(Center::value(), Width::value(), Slope::value(), Height::value(), x);
+            }
+        };
+
+        /**the Sigmoid term, where the parameters are values in the order of fuzzylite::Sigmoid*/
+        template <typename Inflection, typename Slope, typename Height = Value<1> >
+        struct Sigmoid {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::sigmoid(Inflection::value(), Slope::value(), Height::value(), x);
+            }
+        };
+
+        /**the SShape term, where the parameters are values in the order of fuzzylite::SShape*/
+        template <typename Start, typename End, typename Height = Value<1> >
+        struct SShape {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::sShape(Start::value(), End::value(), Height::value(), x);
+            }
+        };
+
+        /**the ZShape term, where the parameters are values in the order of fuzzylite::ZShape*/
+        template <typename Start, typename End, typename Height = Value<1> >
+        struct ZShape {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::zShape(Start::value(), End::value(), Height::value(), x);
+            }
+        };
+
+        /**the PiShape term, where the parameters are values in the order of fuzzylite::PiShape*/
+        template <
+            typename BottomLeft, typename TopLeft, typename TopRight, typename BottomRight,
+            typename Height = Value<1> >
+        struct PiShape {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::piShape(
+                    BottomLeft::value(), TopLeft::value(), TopRight::value(), BottomRight::value(), Height::value(), x
+                );
+            }
+        };
+
+        /**the Ramp term, where the parameters are values in the order of fuzzylite::Ramp*/
+        template <typename Start, typename End, typename Height = Value<1> >
+        struct Ramp {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::ramp(Start::value(), End::value(), Height::value(), x);
+            }
+        };
+
+        /**the Concave term, where the parameters are values in the order of fuzzylite::Concave*/
+        template <typename Inflection, typename End, typename Height = Value<1> >
+        struct Concave {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::concave(Inflection::value(), End::value(), Height::value(), x);
+            }
+        };
+
+        /**the Cosine term, where the parameters are values in the order of fuzzylite::Cosine*/
+        template <typename Center, typename Width, typename Height = Value<1> >
+        struct Cosine {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::cosine(Center::value(), Width::value(), Height::value(), x);
+            }
+        };
+
+        /**the Spike term, where the parameters are values in the order of fuzzylite::Spike*/
+        template <typename Center, typename Width, typename Height = Value<1> >
+        struct Spike {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::spike(Center::value(), Width::value(), Height::value(), x);
+            }
+        };
+
+        /**the SigmoidDifference term, where the parameters are values in the order of fuzzylite::SigmoidDifference*/
+        template <typename Left, typename Rising, typename Falling, typename Right, typename Height = Value<1> >
+        struct SigmoidDifference {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::sigmoidDifference(
+                    Left::value(), Rising::value(), Falling::value(), Right::value(), Height::value(), x
+                );
+            }
+        };
+
+        /**the SigmoidProduct term, where the parameters are values in the order of fuzzylite::SigmoidProduct*/
+        template <typename Left, typename Rising, typename Falling, typename Right, typename Height = Value<1> >
+        struct SigmoidProduct {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::sigmoidProduct(
+                    Left::value(), Rising::value(), Falling::value(), Right::value(), Height::value(), x
+                );
+            }
+        };
+
+        /**the Binary term, where the parameters are values in the order of fuzzylite::Binary*/
+        template <typename Start, typename Direction, typename Height = Value<1> >
+        struct Binary {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(inputs);
+                return kernel::binary(Start::value(), Direction::value(), Height::value(), x);
+            }
+        };
+
+        /**the Constant term*/
+        template <typename Parameter>
+        struct Constant {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(x);
+                FL_IUNUSED(inputs);
+                return Parameter::value();
+            }
+        };
+
+        /**
+          The Linear term, where the coefficients of the input variables are
+          followed by the constant (e.g., `Linear<C0, C1, Constant>` for
+          @f$c_0 x_0 + c_1 x_1 + k@f$)
+         */
+        template <typename... Coefficients>
+        struct Linear;
+
+        template <typename Intercept>
+        struct Linear<Intercept> {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(x);
+                FL_IUNUSED(inputs);
+                return scalar(0.0) + Intercept::value();
+            }
+
+            static scalar polynomial(const scalar* inputs, scalar result) {
+                FL_IUNUSED(inputs);
+                return result + Intercept::value();
+            }
+        };
+
+        template <typename Coefficient, typename... Coefficients>
+        struct Linear<Coefficient, Coefficients...> {
+            static scalar membership(scalar x, const scalar* inputs) {
+                FL_IUNUSED(x);
+                return polynomial(inputs, 0.0);
+            }
+
+            // the products are summed from left to right, as in fuzzylite::Linear
+            static scalar polynomial(const scalar* inputs, scalar result) {
+                return Linear<Coefficients...>::polynomial(inputs + 1, result + Coefficient::value() * inputs[0]);
+            }
+        };
+
+        //Norms
+
+        /**
+          The None operator represents the absence of a norm (i.e., `none` in
+          the FLL format), which fails to compile where the norm is required,
+          except for the aggregation of a WeightedDefuzzifier, which sums the
+          activation degrees as in Aggregated
+         */
+        struct None {};
+
+        /**the Minimum norm*/
+        struct Minimum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::minimum(a, b);
+            }
+        };
+
+        /**the AlgebraicProduct norm*/
+        struct AlgebraicProduct {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::algebraicProduct(a, b);
+            }
+        };
+
+        /**the BoundedDifference norm*/
+        struct BoundedDifference {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::boundedDifference(a, b);
+            }
+        };
+
+        /**the DrasticProduct norm*/
+        struct DrasticProduct {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::drasticProduct(a, b);
+            }
+        };
+
+        /**the EinsteinProduct norm*/
+        struct EinsteinProduct {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::einsteinProduct(a, b);
+            }
+        };
+
+        /**the HamacherProduct norm*/
+        struct HamacherProduct {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::hamacherProduct(a, b);
+            }
+        };
+
+        /**the NilpotentMinimum norm*/
+        struct NilpotentMinimum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::nilpotentMinimum(a, b);
+            }
+        };
+
+        /**the Maximum norm*/
+        struct Maximum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::maximum(a, b);
+            }
+        };
+
+        /**the AlgebraicSum norm*/
+        struct AlgebraicSum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::algebraicSum(a, b);
+            }
+        };
+
+        /**the BoundedSum norm*/
+        struct BoundedSum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::boundedSum(a, b);
+            }
+        };
+
+        /**the DrasticSum norm*/
+        struct DrasticSum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::drasticSum(a, b);
+            }
+        };
+
+        /**the EinsteinSum norm*/
+        struct EinsteinSum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::einsteinSum(a, b);
+            }
+        };
+
+        /**the HamacherSum norm*/
+        struct HamacherSum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::hamacherSum(a, b);
+            }
+        };
+
+        /**the NilpotentMaximum norm*/
+        struct NilpotentMaximum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::nilpotentMaximum(a, b);
+            }
+        };
+
+        /**the NormalizedSum norm*/
+        struct NormalizedSum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::normalizedSum(a, b);
+            }
+        };
+
+        /**the UnboundedSum norm*/
+        struct UnboundedSum {
+            static scalar compute(scalar a, scalar b) {
+                return kernel::unboundedSum(a, b);
+            }
+        };
+
+        //Hedges
+
+        /**the Not hedge*/
+        struct Not {
+            static scalar hedge(scalar x) {
+                return kernel::negate(x);
+            }
+        };
+
+        /**the Very hedge*/
+        struct Very {
+            static scalar hedge(scalar x) {
+                return kernel::very(x);
+            }
+        };
+
+        /**the Somewhat hedge*/
+        struct Somewhat {
+            static scalar hedge(scalar x) {
+                return kernel::somewhat(x);
+            }
+        };
+
+        /**the Extremely hedge*/
+        struct Extremely {
+            static scalar hedge(scalar x) {
+                return kernel::extremely(x);
+            }
+        };
+
+        /**the Seldom hedge*/
+        struct Seldom {
+            static scalar hedge(scalar x) {
+                return kernel::seldom(x);
+            }
+        };
+
+        //Rules
+
+        /**
+          The proposition `input is [hedges] term`, where the hedges are
+          applied from right to left
+         */
+        template <std::size_t InputVariable, std::size_t Term, typename... Hedges>
+        struct Is {
+            template <typename Inputs, typename Block>
+            static scalar activationDegree(const scalar* inputs) {
+                typedef typename detail::At<InputVariable, typename Inputs::variables>::type Variable;
+                typedef typename detail::At<Term, typename Variable::terms>::type Membership;
+                return detail::Hedged<Hedges...>::hedge(Membership::membership(inputs[InputVariable], inputs));
+            }
+        };
+
+        /**the conjunction of the antecedents using the conjunction operator of the rule block*/
+        template <typename Left, typename Right>
+        struct And {
+            template <typename Inputs, typename Block>
+            static scalar activationDegree(const scalar* inputs) {
+                return Block::Conjunction::compute(
+                    Left::template activationDegree<Inputs, Block>(inputs),
+                    Right::template activationDegree<Inputs, Block>(inputs)
+                );
+            }
+        };
+
+        /**the disjunction of the antecedents using the disjunction operator of the rule block*/
+        template <typename Left, typename Right>
+        struct Or {
+            template <typename Inputs, typename Block>
+            static scalar activationDegree(const scalar* inputs) {
+                return Block::Disjunction::compute(
+                    Left::template activationDegree<Inputs, Block>(inputs),
+                    Right::template activationDegree<Inputs, Block>(inputs)
+                );
+            }
+        };
+
+        /**the conclusion `output is [hedges] term`*/
+        template <std::size_t OutputVariable, std::size_t Term, typename... Hedges>
+        struct Then {
+            static const std::size_t output = OutputVariable;
+            static const std::size_t term = Term;
+
+            static scalar hedge(scalar x) {
+                return detail::Hedged<Hedges...>::hedge(x);
+            }
+        };
+
+        /**the rule `if antecedent then conclusions`*/
+        template <typename Antecedent, typename... Conclusions>
+        struct Rule {
+            typedef Antecedent antecedent;
+            typedef detail::List<Conclusions...> conclusions;
+        };
+
+        /**
+          The Rules class is the rule block whose rules are activated with the
+          given activation method
+         */
+        template <
+            typename Conjunction_,
+            typename Disjunction_,
+            typename Implication_,
+            typename Activation_,
+            typename... Rules_>
+        struct Rules {
+            typedef Conjunction_ Conjunction;
+            typedef Disjunction_ Disjunction;
+            typedef Implication_ Implication;
+            typedef Activation_ Activation;
+            typedef detail::List<Rules_...> rules;
+        };
+
+        //Activations, which modify the activation degrees of the rules before they are triggered, where the rules
+        //are triggered when their activation degrees are greater than zero, as in Rule::trigger()
+
+        /**the General activation, which triggers all the rules*/
+        struct General {
+            template <std::size_t NumberOfRules>
+            static void activate(scalar* degrees) {
+                FL_IUNUSED(degrees);
+            }
+        };
+
+        /**the Proportional activation, which normalizes the activation degrees of the rules*/
+        struct Proportional {
+            template <std::size_t NumberOfRules>
+            static void activate(scalar* degrees) {
+                scalar sum = 0.0;
+                for (std::size_t i = 0; i < NumberOfRules; ++i)
+                    sum += degrees[i];
+                for (std::size_t i = 0; i < NumberOfRules; ++i)
+                    degrees[i] = degrees[i] / sum;
+            }
+        };
+
+        /**the First activation, which triggers the first rules whose activation degrees reach the threshold*/
+        template <int Rules = 1, typename Threshold_ = Value<0> >
+        struct First {
+            template <std::size_t NumberOfRules>
+            static void activate(scalar* degrees) {
+                int activated = 0;
+                for (std::size_t i = 0; i < NumberOfRules; ++i) {
+                    if (activated < Rules and Op::isGt(degrees[i], 0.0) and Op::isGE(degrees[i], Threshold_::value()))
+                        ++activated;
+                    else
+                        degrees[i] = 0.0;
+                }
+            }
+        };
+
+        /**the Last activation, which triggers the last rules whose activation degrees reach the threshold*/
+        template <int Rules = 1, typename Threshold_ = Value<0> >
+        struct Last {
+            template <std::size_t NumberOfRules>
+            static void activate(scalar* degrees) {
+                int activated = 0;
+                for (std::size_t i = NumberOfRules; i-- > 0;) {
+                    if (activated < Rules and Op::isGt(degrees[i], 0.0) and Op::isGE(degrees[i], Threshold_::value()))
+                        ++activated;
+                    else
+                        degrees[i] = 0.0;
+                }
+            }
+        };
+
+        namespace detail {
+            // triggers the rules with the highest (or lowest) activation degrees greater than zero
+            template <int Rules, bool Highest>
+            struct Selection {
+                template <std::size_t NumberOfRules>
+                static void activate(scalar* degrees) {
+                    bool selected[NumberOfRules] = {};
+                    for (int n = 0; n < Rules; ++n) {
+                        std::size_t best = NumberOfRules;
+                        for (std::size_t i = 0; i < NumberOfRules; ++i) {
+                            if (not selected[i] and Op::isGt(degrees[i], 0.0)
+                                and (best == NumberOfRules
+                                     or (Highest ? degrees[i] > degrees[best] : degrees[i] < degrees[best])))
+                                best = i;
+                        }
+                        if (best == NumberOfRules)
+                            break;
+                        selected[best] = true;
+                    }
+                    for (std::size_t i = 0; i < NumberOfRules; ++i)
+                        if (not selected[i])
+                            degrees[i] = 0.0;
+                }
+            };
+        }
+
+        /**the Highest activation, which triggers the rules with the highest activation degrees*/
+        template <int Rules = 1>
+        struct Highest : detail::Selection<Rules, true> {};
+
+        /**the Lowest activation, which triggers the rules with the lowest activation degrees*/
+        template <int Rules = 1>
+        struct Lowest : detail::Selection<Rules, false> {};
+
+        /**the Threshold activation, which triggers the rules whose activation degrees satisfy the comparison*/
+        template <fl::Threshold::Comparison Comparison, typename Threshold_>
+        struct Threshold {
+            template <std::size_t NumberOfRules>
+            static void activate(scalar* degrees) {
+                const scalar threshold = Threshold_::value();
+                for (std::size_t i = 0; i < NumberOfRules; ++i) {
+                    bool satisfies = false;
+                    switch (Comparison) {
+                        case fl::Threshold::LessThan:
+                            satisfies = Op::isLt(degrees[i], threshold);
+                            break;
+                        case fl::Threshold::LessThanOrEqualTo:
+                            satisfies = Op::isLE(degrees[i], threshold);
+                            break;
+                        case fl::Threshold::EqualTo:
+                            satisfies = Op::isEq(degrees[i], threshold);
+                            break;
+                        case fl::Threshold::NotEqualTo:
+                            satisfies = not Op::isEq(degrees[i], threshold);
+                            break;
+                        case fl::Threshold::GreaterThanOrEqualTo:
+                            satisfies = Op::isGE(degrees[i], threshold);
+                            break;
+                        case fl::Threshold::GreaterThan:
+                            satisfies = Op::isGt(degrees[i], threshold);
+                            break;
+                    }
+                    if (not satisfies)
+                        degrees[i] = 0.0;
+                }
+            }
+        };
+
+        //Variables
+
+        /**the input variable with the given terms*/
+        template <typename... Terms>
+        struct Input {
+            typedef detail::List<Terms...> terms;
+        };
+
+        /**the input variables of the engine*/
+        template <typename... Variables>
+        struct Inputs {
+            typedef detail::List<Variables...> variables;
+        };
+
+        /**
+          The output variable in the range [Minimum, Maximum] with the given
+          terms, whose fuzzy output is aggregated with the Aggregation operator
+          and defuzzified with the Defuzzifier
+         */
+        template <typename Minimum_, typename Maximum_, typename Defuzzifier_, typename Aggregation_, typename... Terms>
+        struct Output {
+            typedef Minimum_ Minimum;
+            typedef Maximum_ Maximum;
+            typedef Defuzzifier_ Defuzzifier;
+            typedef Aggregation_ Aggregation;
+            typedef detail::List<Terms...> terms;
+        };
+
+        /**the output variables of the engine*/
+        template <typename... Variables>
+        struct Outputs {
+            typedef detail::List<Variables...> variables;
+        };
+
+        //Defuzzifiers, which sample the fuzzy output at the midpoints of the resolution, as in
+        //IntegralDefuzzifier::statistics()
+
+        /**the Centroid defuzzifier*/
+        template <int Resolution = 100>
+        struct Centroid {
+            static_assert(Resolution > 0, "the resolution must be positive");
+
+            template <typename Fuzzy>
+            static scalar defuzzify(const Fuzzy& fuzzy, scalar minimum, scalar maximum) {
+                if (not Op::isFinite(minimum + maximum))
+                    return fl::nan;
+                const scalar dx = (maximum - minimum) / Resolution;
+                scalar area = 0.0, moment = 0.0;
+                for (int i = 0; i < Resolution; ++i) {
+                    const scalar x = minimum + (i + 0.5) * dx;
+                    const scalar y = fuzzy.membership(x);
+                    area += y;
+                    moment += y * x;
+                }
+                return moment / area;
+            }
+        };
+
+        /**the Bisector defuzzifier*/
+        template <int Resolution = 100>
+        struct Bisector {
+            static_assert(Resolution > 0, "the resolution must be positive");
+
+            template <typename Fuzzy>
+            static scalar defuzzify(const Fuzzy& fuzzy, scalar minimum, scalar maximum) {
+                if (not Op::isFinite(minimum + maximum))
+                    return fl::nan;
+                const scalar dx = (maximum - minimum) / Resolution;
+                scalar cumulative[Resolution];
+                scalar finiteArea = 0.0;
+                for (int i = 0; i < Resolution; ++i) {
+                    const scalar y = fuzzy.membership(minimum + (i + 0.5) * dx);
+                    if (Op::isFinite(y))
+                        finiteArea += y;
+                    cumulative[i] = finiteArea;
+                }
+                // all x closest to half of the area are bisectors
+                scalar closest = fl::inf, bisectorSum = 0.0, bisectors = 0.0;
+                for (int i = 0; i < Resolution; ++i) {
+                    const scalar distance = std::abs(cumulative[i] / finiteArea - scalar(0.5));
+                    if (distance < closest) {
+                        closest = distance;
+                        bisectorSum = 0.0;
+                        bisectors = 0.0;
+                    }
+                    if (distance == closest) {
+                        bisectorSum += minimum + (i + 0.5) * dx;
+                        bisectors += 1.0;
+                    }
+                }
+                return bisectorSum / bisectors;
+            }
+        };
+
+        namespace detail {
+            enum Maxima { SmallestOfMaxima, MeanOfMaxima, LargestOfMaxima };
+
+            template <Maxima Statistic, int Resolution>
+            struct Maximum {
+                static_assert(Resolution > 0, "the resolution must be positive");
+
+                template <typename Fuzzy>
+                static scalar defuzzify(const Fuzzy& fuzzy, scalar minimum, scalar maximum) {
+                    if (not Op::isFinite(minimum + maximum))
+                        return fl::nan;
+                    const scalar dx = (maximum - minimum) / Resolution;
+                    scalar ymax = -fl::inf, smallest = fl::nan, largest = fl::nan, maximaSum = 0.0;
+                    std::size_t maxima = 0;
+                    for (int i = 0; i < Resolution; ++i) {
+                        const scalar x = minimum + (i + 0.5) * dx;
+                        const scalar y = fuzzy.membership(x);
+                        if (y >= ymax) {
+                            largest = x;
+                            if (y > ymax) {
+                                smallest = x;
+                                maximaSum = 0.0;
+                                maxima = 0;
+                                ymax = y;
+                            }
+                            maximaSum += x;
+                            ++maxima;
+                        }
+                    }
+                    if (Statistic == SmallestOfMaxima)
+                        return smallest;
+                    if (Statistic == LargestOfMaxima)
+                        return largest;
+                    return maximaSum / maxima;
+                }
+            };
+        }
+
+        /**the SmallestOfMaximum defuzzifier*/
+        template <int Resolution = 100>
+        struct SmallestOfMaximum : detail::Maximum<detail::SmallestOfMaxima, Resolution> {};
+
+        /**the MeanOfMaximum defuzzifier*/
+        template <int Resolution = 100>
+        struct MeanOfMaximum : detail::Maximum<detail::MeanOfMaxima, Resolution> {};
+
+        /**the LargestOfMaximum defuzzifier*/
+        template <int Resolution = 100>
+        struct LargestOfMaximum : detail::Maximum<detail::LargestOfMaxima, Resolution> {};
+
+        /**the WeightedAverage defuzzifier of Takagi-Sugeno terms*/
+        struct WeightedAverage {
+            template <typename Fuzzy>
+            static scalar defuzzify(const Fuzzy& fuzzy, scalar minimum, scalar maximum) {
+                FL_IUNUSED(minimum);
+                FL_IUNUSED(maximum);
+                scalar sum = 0.0, weights = 0.0;
+                fuzzy.weigh(sum, weights);
+                return sum / weights;
+            }
+        };
+
+        /**the WeightedSum defuzzifier of Takagi-Sugeno terms*/
+        struct WeightedSum {
+            template <typename Fuzzy>
+            static scalar defuzzify(const Fuzzy& fuzzy, scalar minimum, scalar maximum) {
+                FL_IUNUSED(minimum);
+                FL_IUNUSED(maximum);
+                scalar sum = 0.0, weights = 0.0;
+                fuzzy.weigh(sum, weights);
+                return sum;
+            }
+        };
+
+        namespace detail {
+            template <typename Aggregation>
+            struct Grouping {
+                static scalar compute(scalar a, scalar b) {
+                    return Aggregation::compute(a, b);
+                }
+            };
+
+            // the activation degrees are summed without an aggregation operator
+            template <>
+            struct Grouping<None> {
+                static scalar compute(scalar a, scalar b) {
+                    return a + b;
+                }
+            };
+
+            // the conclusion of a rule stored at the given index of the activation degrees
+            template <std::size_t Index, typename Implication_, typename Conclusion>
+            struct Slot {
+                static const std::size_t index = Index;
+                static const std::size_t output = Conclusion::output;
+                static const std::size_t term = Conclusion::term;
+                typedef Implication_ Implication;
+                typedef Conclusion conclusion;
+            };
+
+            template <std::size_t Offset, typename Implication, typename Conclusions>
+            struct Slots;
+
+            template <std::size_t Offset, typename Implication>
+            struct Slots<Offset, Implication, List<> > {
+                typedef List<> type;
+            };
+
+            template <std::size_t Offset, typename Implication, typename Head, typename... Tail>
+            struct Slots<Offset, Implication, List<Head, Tail...> > {
+                typedef typename Concat<
+                    List<Slot<Offset, Implication, Head> >,
+                    typename Slots<Offset + 1, Implication, List<Tail...> >::type>::type type;
+            };
+
+            template <std::size_t Output, typename Slots>
+            struct ForOutput;
+
+            template <std::size_t Output>
+            struct ForOutput<Output, List<> > {
+                typedef List<> type;
+            };
+
+            template <std::size_t Output, typename Head, typename... Tail>
+            struct ForOutput<Output, List<Head, Tail...> > {
+                typedef typename Concat<
+                    typename std::conditional<Head::output == Output, List<Head>, List<> >::type,
+                    typename ForOutput<Output, List<Tail...> >::type>::type type;
+            };
+
+            template <std::size_t Term, typename Slots>
+            struct ForTerm;
+
+            template <std::size_t Term>
+            struct ForTerm<Term, List<> > {
+                typedef List<> type;
+            };
+
+            template <std::size_t Term, typename Head, typename... Tail>
+            struct ForTerm<Term, List<Head, Tail...> > {
+                typedef typename Concat<
+                    typename std::conditional<Head::term == Term, List<Head>, List<> >::type,
+                    typename ForTerm<Term, List<Tail...> >::type>::type type;
+            };
+
+            // the conclusions of the rules in the order they are triggered
+            template <typename Slots>
+            struct Conclusions;
+
+            template <>
+            struct Conclusions<List<> > {
+                // the hedges modify the activation degree for the next conclusions, as in Consequent::modify()
+                static void trigger(scalar degree, scalar* degrees, bool* activated) {
+                    FL_IUNUSED(degree);
+                    FL_IUNUSED(degrees);
+                    FL_IUNUSED(activated);
+                }
+
+                static bool isActivated(const bool* activated) {
+                    FL_IUNUSED(activated);
+                    return false;
+                }
+
+                template <typename Variable>
+                static scalar
+                membership(scalar x, const scalar* inputs, const scalar* degrees, const bool* activated, scalar y) {
+                    FL_IUNUSED(x);
+                    FL_IUNUSED(inputs);
+                    FL_IUNUSED(degrees);
+                    FL_IUNUSED(activated);
+                    return y;
+                }
+
+                template <typename Aggregation>
+                static bool group(const scalar* degrees, const bool* activated, scalar& degree, bool grouped) {
+                    FL_IUNUSED(degrees);
+                    FL_IUNUSED(activated);
+                    FL_IUNUSED(degree);
+                    return grouped;
+                }
+            };
+
+            template <typename Head, typename... Tail>
+            struct Conclusions<List<Head, Tail...> > {
+                typedef Conclusions<List<Tail...> > Next;
+
+                static void trigger(scalar degree, scalar* degrees, bool* activated) {
+                    degree = Head::conclusion::hedge(degree);
+                    degrees[Head::index] = degree;
+                    activated[Head::index] = true;
+                    Next::trigger(degree, degrees, activated);
+                }
+
+                static bool isActivated(const bool* activated) {
+                    return activated[Head::index] or Next::isActivated(activated);
+                }
+
+                // the membership of the aggregated fuzzy output, as in Aggregated::membership()
+                template <typename Variable>
+                static scalar
+                membership(scalar x, const scalar* inputs, const scalar* degrees, const bool* activated, scalar y) {
+                    typedef typename At<Head::term, typename Variable::terms>::type Term;
+                    if (activated[Head::index]) {
+                        y = Variable::Aggregation::compute(
+                            y, Head::Implication::compute(Term::membership(x, inputs), degrees[Head::index])
+                        );
+                    }
+                    return Next::template membership<Variable>(x, inputs, degrees, activated, y);
+                }
+
+                // the activation degree of the group of conclusions, as in Aggregated::groupedTerms()
+                template <typename Aggregation>
+                static bool group(const scalar* degrees, const bool* activated, scalar& degree, bool grouped) {
+                    if (activated[Head::index]) {
+                        degree = grouped ? Grouping<Aggregation>::compute(degree, degrees[Head::index])
+                                         : degrees[Head::index];
+                        grouped = true;
+                    }
+                    return Next::template group<Aggregation>(degrees, activated, degree, grouped);
+                }
+            };
+
+            template <typename Variable, typename Slots, std::size_t Term, std::size_t NumberOfTerms>
+            struct Groups {
+                static void weigh(
+                    const scalar* inputs, const scalar* degrees, const bool* activated, scalar& sum, scalar& weights
+                ) {
+                    typedef Conclusions<typename ForTerm<Term, Slots>::type> Group;
+                    scalar w = 0.0;
+                    if (Group::template group<typename Variable::Aggregation>(degrees, activated, w, false)) {
+                        const scalar z = At<Term, typename Variable::terms>::type::membership(w, inputs);
+                        sum += w * z;
+                        weights += w;
+                    }
+                    Groups<Variable, Slots, Term + 1, NumberOfTerms>::weigh(inputs, degrees, activated, sum, weights);
+                }
+            };
+
+            template <typename Variable, typename Slots, std::size_t NumberOfTerms>
+            struct Groups<Variable, Slots, NumberOfTerms, NumberOfTerms> {
+                static void weigh(
+                    const scalar* inputs, const scalar* degrees, const bool* activated, scalar& sum, scalar& weights
+                ) {
+                    FL_IUNUSED(inputs);
+                    FL_IUNUSED(degrees);
+                    FL_IUNUSED(activated);
+                    FL_IUNUSED(sum);
+                    FL_IUNUSED(weights);
+                }
+            };
+
+            // the fuzzy output of the variable given the conclusions of the rules on it
+            template <typename Variable, typename Slots>
+            struct Aggregated {
+                const scalar* inputs;
+                const scalar* degrees;
+                const bool* activated;
+
+                bool isEmpty() const {
+                    return not Conclusions<Slots>::isActivated(activated);
+                }
+
+                scalar membership(scalar x) const {
+                    return Conclusions<Slots>::template membership<Variable>(x, inputs, degrees, activated, 0.0);
+                }
+
+                void weigh(scalar& sum, scalar& weights) const {
+                    Groups<Variable, Slots, 0, Variable::terms::size>::weigh(inputs, degrees, activated, sum, weights);
+                }
+            };
+
+            template <typename Inputs, typename Block, std::size_t Position, std::size_t Offset, typename Rules>
+            struct RuleSequence;
+
+            template <typename Inputs, typename Block, std::size_t Position, std::size_t Offset>
+            struct RuleSequence<Inputs, Block, Position, Offset, List<> > {
+                static const std::size_t conclusions = 0;
+                typedef List<> slots;
+
+                static void activationDegrees(const scalar* inputs, scalar* rules) {
+                    FL_IUNUSED(inputs);
+                    FL_IUNUSED(rules);
+                }
+
+                static void trigger(const scalar* rules, scalar* degrees, bool* activated) {
+                    FL_IUNUSED(rules);
+                    FL_IUNUSED(degrees);
+                    FL_IUNUSED(activated);
+                }
+            };
+
+            template <
+                typename Inputs,
+                typename Block,
+                std::size_t Position,
+                std::size_t Offset,
+                typename Head,
+                typename... Tail>
+            struct RuleSequence<Inputs, Block, Position, Offset, List<Head, Tail...> > {
+                typedef typename Slots<Offset, typename Block::Implication, typename Head::conclusions>::type head;
+                typedef RuleSequence<Inputs, Block, Position + 1, Offset + Head::conclusions::size, List<Tail...> >
+                    Next;
+                static const std::size_t conclusions = Head::conclusions::size + Next::conclusions;
+                typedef typename Concat<head, typename Next::slots>::type slots;
+
+                static void activationDegrees(const scalar* inputs, scalar* rules) {
+                    rules[Position] = Head::antecedent::template activationDegree<Inputs, Block>(inputs);
+                    Next::activationDegrees(inputs, rules);
+                }
+
+                // the rule is triggered as in Rule::trigger()
+                static void trigger(const scalar* rules, scalar* degrees, bool* activated) {
+                    if (Op::isGt(rules[Position], 0.0))
+                        Conclusions<head>::trigger(rules[Position], degrees, activated);
+                    Next::trigger(rules, degrees, activated);
+                }
+            };
+
+            template <typename Inputs, std::size_t Offset, typename Blocks>
+            struct BlockSequence;
+
+            template <typename Inputs, std::size_t Offset>
+            struct BlockSequence<Inputs, Offset, List<> > {
+                static const std::size_t conclusions = 0;
+                typedef List<> slots;
+
+                static void activate(const scalar* inputs, scalar* degrees, bool* activated) {
+                    FL_IUNUSED(inputs);
+                    FL_IUNUSED(degrees);
+                    FL_IUNUSED(activated);
+                }
+            };
+
+            template <typename Inputs, std::size_t Offset, typename Head, typename... Tail>
+            struct BlockSequence<Inputs, Offset, List<Head, Tail...> > {
+                static_assert(Head::rules::size > 0, "the rule block must contain rules");
+                typedef RuleSequence<Inputs, Head, 0, Offset, typename Head::rules> Rules;
+                typedef BlockSequence<Inputs, Offset + Rules::conclusions, List<Tail...> > Next;
+                static const std::size_t conclusions = Rules::conclusions + Next::conclusions;
+                typedef typename Concat<typename Rules::slots, typename Next::slots>::type slots;
+
+                static void activate(const scalar* inputs, scalar* degrees, bool* activated) {
+                    scalar rules[Head::rules::size];
+                    Rules::activationDegrees(inputs, rules);
+                    Head::Activation::template activate<Head::rules::size>(rules);
+                    Rules::trigger(rules, degrees, activated);
+                    Next::activate(inputs, degrees, activated);
+                }
+            };
+
+            template <std::size_t Index, typename Slots, typename Variables>
+            struct OutputSequence;
+
+            template <std::size_t Index, typename Slots>
+            struct OutputSequence<Index, Slots, List<> > {
+                static void
+                defuzzify(const scalar* inputs, const scalar* degrees, const bool* activated, scalar* outputs) {
+                    FL_IUNUSED(inputs);
+                    FL_IUNUSED(degrees);
+                    FL_IUNUSED(activated);
+                    FL_IUNUSED(outputs);
+                }
+            };
+
+            template <std::size_t Index, typename Slots, typename Head, typename... Tail>
+            struct OutputSequence<Index, Slots, List<Head, Tail...> > {
+                // the output variable is defuzzified as in OutputVariable::defuzzify()
+                static void
+                defuzzify(const scalar* inputs, const scalar* degrees, const bool* activated, scalar* outputs) {
+                    const Aggregated<Head, typename ForOutput<Index, Slots>::type> fuzzy = {inputs, degrees, activated};
+                    if (fuzzy.isEmpty())
+                        outputs[Index] = fl::nan;
+                    else
+                        outputs[Index]
+                            = Head::Defuzzifier::defuzzify(fuzzy, Head::Minimum::value(), Head::Maximum::value());
+                    OutputSequence<Index + 1, Slots, List<Tail...> >::defuzzify(inputs, degrees, activated, outputs);
+                }
+            };
+        }
+
+        /**
+          The StaticEngine class is an engine whose input variables, output
+          variables, and rule blocks are fixed at compile time
+
+          @author Juan Rada-Vilela, Ph.D.
+          @see Engine
+          @since 7.1
+         */
+        template <typename InputVariables, typename OutputVariables, typename... RuleBlocks>
+        class StaticEngine {
+          private:
+            typedef detail::BlockSequence<InputVariables, 0, detail::List<RuleBlocks...> > Blocks;
+
+          public:
+            /**the number of input variables*/
+            static const std::size_t numberOfInputVariables = InputVariables::variables::size;
+            /**the number of output variables*/
+            static const std::size_t numberOfOutputVariables = OutputVariables::variables::size;
+
+            /**
+              Processes the engine in its current state as in
+              Engine::process(), where the values of the output variables
+              without activated terms are `nan`
+              @param inputs are the values of the input variables
+              @param outputs are the values of the output variables
+             */
+            static void process(const scalar* inputs, scalar* outputs) {
+                // the activation degrees and the activation flags of the conclusions of all the rules
+                scalar degrees[Blocks::conclusions > 0 ? Blocks::conclusions : 1] = {};
+                bool activated[Blocks::conclusions > 0 ? Blocks::conclusions : 1] = {};
+                Blocks::activate(inputs, degrees, activated);
+                detail::OutputSequence<0, typename Blocks::slots, typename OutputVariables::variables>::defuzzify(
+                    inputs, degrees, activated, outputs
+                );
+            }
+        };
+
+        template <typename InputVariables, typename OutputVariables, typename... RuleBlocks>
+        const std::size_t StaticEngine<InputVariables, OutputVariables, RuleBlocks...>::numberOfInputVariables;
+
+        template <typename InputVariables, typename OutputVariables, typename... RuleBlocks>
+        const std::size_t StaticEngine<InputVariables, OutputVariables, RuleBlocks...>::numberOfOutputVariables;
+    }
+}
+
+#endif /* FL_CPP98 */
+
+#endif /* FL_STATICENGINE_H */
@@ -26,6 +26,9 @@ namespace fuzzylite {
     /**
       The General class is a RuleBlock Activation method that activates every
       rule following the order in which the rules were added to the rule block.
+      The rules that cannot be activated by the current values of the input
+      variables (see RuleBlock::candidateRules()) are deactivated without
+      evaluating their antecedents.
 
       @author Juan Rada-Vilela, Ph.D.
       @see Rule
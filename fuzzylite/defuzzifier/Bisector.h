@@ -26,6 +26,10 @@ namespace fuzzylite {
       The Bisector class is an IntegralDefuzzifier that computes the bisector
       of a fuzzy set represented in a Term.
 
+      When given a positive tolerance (e.g., `Bisector adaptive 1e-6` in FLL),
+      the fuzzy set is integrated by adaptive quadrature instead of sampling
+      it at the resolution (see IntegralDefuzzifier::adaptiveStatistics()).
+
       @author Juan Rada-Vilela, Ph.D.
       @see Centroid
       @see IntegralDefuzzifier
@@ -33,18 +37,37 @@ namespace fuzzylite {
       @since 4.0
      */
     class FL_API Bisector : public IntegralDefuzzifier {
+      private:
+        scalar _tolerance;
+
       public:
-        explicit Bisector(int resolution = defaultResolution());
+        explicit Bisector(
+            int resolution = defaultResolution(), scalar tolerance = 0.0, bool restrictedToSupport = false
+        );
         virtual ~Bisector() FL_IOVERRIDE;
         FL_DEFAULT_COPY_AND_MOVE(Bisector)
 
         virtual std::string className() const FL_IOVERRIDE;
 
+        /**
+          Sets the tolerance of the adaptive quadrature, which integrates the
+          fuzzy set adaptively when positive, and at the resolution otherwise
+          @param tolerance is the tolerance of the adaptive quadrature
+         */
+        virtual void setTolerance(scalar tolerance);
+        /**
+          Gets the tolerance of the adaptive quadrature, which integrates the
+          fuzzy set adaptively when positive, and at the resolution otherwise
+          @return the tolerance of the adaptive quadrature
+         */
+        virtual scalar getTolerance() const;
+
         /**
           Computes the bisector of a fuzzy set. The defuzzification process
           integrates over the fuzzy set utilizing the boundaries given as
           parameters. The integration algorithm is the midpoint rectangle
-          method (https://en.wikipedia.org/wiki/Rectangle_method).
+          method (https://en.wikipedia.org/wiki/Rectangle_method), unless the
+          tolerance is positive and the fuzzy set is integrated adaptively.
 
           @param term is the fuzzy set
           @param minimum is the minimum value of the fuzzy set
@@ -52,6 +75,16 @@ namespace fuzzylite {
           @return the @f$x@f$-coordinate of the bisector of the fuzzy set
          */
         virtual scalar defuzzify(const Term* term, scalar minimum, scalar maximum) const FL_IOVERRIDE;
+        /**
+          Computes the bisector of the fuzzy set, adaptively if the tolerance
+          is positive
+          @param term is the fuzzy set
+          @param minimum is the minimum value of the fuzzy set
+          @param maximum is the maximum value of the fuzzy set
+          @return the statistics of the fuzzy set, where only the bisector is
+          computed
+         */
+        virtual Statistics defuzzification(const Term* term, scalar minimum, scalar maximum) const FL_IOVERRIDE;
         virtual Bisector* clone() const FL_IOVERRIDE;
 
         static Defuzzifier* constructor();
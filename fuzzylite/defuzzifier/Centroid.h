@@ -26,6 +26,19 @@ namespace fuzzylite {
       The Centroid class is an IntegralDefuzzifier that computes the centroid
       of a fuzzy set represented in a Term.
 
+      By default, the centroid is computed by sampling the fuzzy set at the
+      given resolution. When set to be exact (e.g., `Centroid exact` in FLL),
+      the centroid of the fuzzy sets that are piecewise linear is computed in
+      closed form, that is, the Triangle, Trapezoid, Rectangle, Ramp,
+      Discrete, and Constant terms, and the Aggregated terms whose
+      aggregation operator is Maximum and whose Activated terms are such
+      terms modified by the Minimum or AlgebraicProduct implication operators.
+      The centroid of any other fuzzy set is computed by sampling.
+
+      When given a positive tolerance (e.g., `Centroid adaptive 1e-6` in FLL),
+      the fuzzy set is integrated by adaptive quadrature instead of sampling
+      it at the resolution (see IntegralDefuzzifier::adaptiveStatistics()).
+
       @author Juan Rada-Vilela, Ph.D.
       @see BiSector
       @see IntegralDefuzzifier
@@ -33,18 +46,57 @@ namespace fuzzylite {
       @since 4.0
      */
     class FL_API Centroid : public IntegralDefuzzifier {
+      private:
+        bool _exact;
+        scalar _tolerance;
+
       public:
-        explicit Centroid(int resolution = defaultResolution());
+        explicit Centroid(
+            int resolution = defaultResolution(),
+            bool exact = false,
+            scalar tolerance = 0.0,
+            bool restrictedToSupport = false
+        );
         virtual ~Centroid() FL_IOVERRIDE;
         FL_DEFAULT_COPY_AND_MOVE(Centroid)
 
         virtual std::string className() const FL_IOVERRIDE;
 
+        /**
+          Sets whether the centroid of the piecewise-linear fuzzy sets is
+          computed in closed form instead of by sampling
+          @param exact indicates whether to compute the centroid of the
+          piecewise-linear fuzzy sets in closed form
+         */
+        virtual void setExact(bool exact);
+        /**
+          Indicates whether the centroid of the piecewise-linear fuzzy sets is
+          computed in closed form instead of by sampling
+          @return whether the centroid of the piecewise-linear fuzzy sets is
+          computed in closed form
+         */
+        virtual bool isExact() const;
+
+        /**
+          Sets the tolerance of the adaptive quadrature, which integrates the
+          fuzzy set adaptively when positive, and at the resolution otherwise
+          @param tolerance is the tolerance of the adaptive quadrature
+         */
+        virtual void setTolerance(scalar tolerance);
+        /**
+          Gets the tolerance of the adaptive quadrature, which integrates the
+          fuzzy set adaptively when positive, and at the resolution otherwise
+          @return the tolerance of the adaptive quadrature
+         */
+        virtual scalar getTolerance() const;
+
         /**
           Computes the centroid of a fuzzy set. The defuzzification process
           integrates over the fuzzy set utilizing the boundaries given as
           parameters. The integration algorithm is the midpoint rectangle
-          method (https://en.wikipedia.org/wiki/Rectangle_method).
+          method (https://en.wikipedia.org/wiki/Rectangle_method), unless the
+          centroid is exact and the fuzzy set is piecewise linear, or the
+          tolerance is positive and the fuzzy set is integrated adaptively.
 
           @param term is the fuzzy set
           @param minimum is the minimum value of the fuzzy set
@@ -52,6 +104,37 @@ namespace fuzzylite {
           @return the @f$x@f$-coordinate of the centroid of the fuzzy set
          */
         virtual scalar defuzzify(const Term* term, scalar minimum, scalar maximum) const FL_IOVERRIDE;
+        /**
+          Computes the centroid of the fuzzy set as in Centroid::defuzzify(),
+          where no membership function values are computed if the centroid is
+          exact
+          @param term is the fuzzy set
+          @param minimum is the minimum value of the fuzzy set
+          @param maximum is the maximum value of the fuzzy set
+          @return the statistics of the fuzzy set, where only the centroid is
+          computed
+         */
+        virtual Statistics defuzzification(const Term* term, scalar minimum, scalar maximum) const FL_IOVERRIDE;
+
+        /**
+          Computes the centroid and the area of a piecewise-linear fuzzy set
+          in closed form by integrating the linear segments between the
+          vertices of the terms, the points where the terms are clipped by the
+          implication operator, and the points where the aggregated terms
+          intersect.
+
+          @param term is the fuzzy set
+          @param minimum is the minimum value of the fuzzy set
+          @param maximum is the maximum value of the fuzzy set
+          @param centroid is the @f$x@f$-coordinate of the centroid of the
+          fuzzy set
+          @param area is the area of the fuzzy set
+          @return whether the fuzzy set is piecewise linear, otherwise the
+          centroid and area are not computed
+         */
+        virtual bool exactCentroid(
+            const Term* term, scalar minimum, scalar maximum, scalar& centroid, scalar& area
+        ) const;
         virtual Centroid* clone() const FL_IOVERRIDE;
 
         static Defuzzifier* constructor();
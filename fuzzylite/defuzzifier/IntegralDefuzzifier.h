@@ -18,6 +18,9 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #ifndef FL_INTEGRALDEFUZZIFIER_H
 #define FL_INTEGRALDEFUZZIFIER_H
 
+#include <utility>
+#include <vector>
+
 #include "fuzzylite/defuzzifier/Defuzzifier.h"
 
 namespace fuzzylite {
@@ -26,17 +29,76 @@ namespace fuzzylite {
       The IntegralDefuzzifier class is the base class for defuzzifiers which integrate
       over the fuzzy set.
 
+      The fuzzy set is sampled once at the midpoints of the resolution, from
+      which IntegralDefuzzifier::statistics() derives the requested
+      statistics at once.
+
+      When the defuzzifier is restricted to the support, the fuzzy set is
+      integrated only over the union of the supports of its activated terms
+      within the range, over which the resolution is redistributed, because
+      the membership function is zero elsewhere.
+
       @author Juan Rada-Vilela, Ph.D.
       @since 4.0
      */
     class FL_API IntegralDefuzzifier : public Defuzzifier {
+      public:
+        /**
+          The Statistic enum contains the flags of the statistics computed by
+          IntegralDefuzzifier::statistics()
+         */
+        enum Statistic {
+            /**area under the fuzzy set*/
+            AreaStatistic = 1,
+            /**x-coordinate of the centroid (see Centroid)*/
+            CentroidStatistic = 2,
+            /**x-coordinate of the bisector (see Bisector)*/
+            BisectorStatistic = 4,
+            /**smallest x-coordinate of the maximum (see SmallestOfMaximum)*/
+            SmallestOfMaximumStatistic = 8,
+            /**mean x-coordinate of the maximum (see MeanOfMaximum)*/
+            MeanOfMaximumStatistic = 16,
+            /**largest x-coordinate of the maximum (see LargestOfMaximum)*/
+            LargestOfMaximumStatistic = 32,
+            /**all of the statistics*/
+            AllStatistics = 63
+        };
+
+        /**
+          The Statistics struct contains the statistics of a fuzzy set
+          sampled at the midpoints of the resolution, where the statistics
+          that were not requested are `fl::nan`
+
+          @author Juan Rada-Vilela, Ph.D.
+          @since 7.1
+         */
+        struct FL_API Statistics {
+            /**area under the fuzzy set*/
+            scalar area;
+            /**x-coordinate of the centroid*/
+            scalar centroid;
+            /**x-coordinate of the bisector*/
+            scalar bisector;
+            /**smallest x-coordinate of the maximum*/
+            scalar smallestOfMaximum;
+            /**mean x-coordinate of the maximum*/
+            scalar meanOfMaximum;
+            /**largest x-coordinate of the maximum*/
+            scalar largestOfMaximum;
+            /**number of membership function values computed*/
+            std::size_t samples;
+
+            Statistics();
+        };
+
       private:
         static int _defaultResolution;
 
         int _resolution;
+        bool _restrictedToSupport;
 
       public:
-        explicit IntegralDefuzzifier(int resolution = defaultResolution());
+        explicit IntegralDefuzzifier(int resolution = defaultResolution(), bool restrictedToSupport = false);
         virtual ~IntegralDefuzzifier() FL_IOVERRIDE;
         FL_DEFAULT_COPY_AND_MOVE(IntegralDefuzzifier)
 
@@ -57,6 +119,76 @@ namespace fuzzylite {
          */
         virtual int getResolution() const;
 
+        /**
+          Sets whether the defuzzifier integrates only over the union of the
+          supports of the activated terms within the range `[minimum,maximum]`
+          @param restrictedToSupport whether the defuzzifier integrates only
+          over the union of the supports of the activated terms
+         */
+        virtual void setRestrictedToSupport(bool restrictedToSupport);
+        /**
+          Gets whether the defuzzifier integrates only over the union of the
+          supports of the activated terms within the range `[minimum,maximum]`
+          @return whether the defuzzifier integrates only over the union of
+          the supports of the activated terms
+         */
+        virtual bool isRestrictedToSupport() const;
+
+        /**
+          Computes the requested statistics of the fuzzy set sampled once at
+          the midpoints of the resolution in the range `[minimum,maximum]`,
+          or in the union of the supports within the range if the defuzzifier
+          is restricted to the support
+
+          @param term is the fuzzy set
+          @param minimum is the minimum value of the range
+          @param maximum is the maximum value of the range
+          @param requested is the bitwise-or of the Statistic flags to compute
+          @return the statistics of the fuzzy set, where the statistics not
+          requested are `fl::nan`, and all of them are `fl::nan` if the range
+          is not finite
+         */
+        virtual Statistics
+        statistics(const Term* term, scalar minimum, scalar maximum, int requested = AllStatistics) const;
+
+        /**
+          Computes the requested area, centroid, and bisector of the fuzzy set
+          utilizing adaptive Simpson quadrature in the range
+          `[minimum,maximum]`. The range is first split at the boundaries of
+          the supports of the terms, and then each interval is subdivided
+          until the estimated errors of the integrals of the area and the
+          moment are within the tolerance, which places the samples near the
+          edges and kinks of the fuzzy set. The bisector is found on the
+          quadratic interpolations of the intervals, without further sampling.
+          If the defuzzifier is restricted to the support, the intervals
+          outside the union of the supports are not integrated.
+
+          @param term is the fuzzy set
+          @param minimum is the minimum value of the range
+          @param maximum is the maximum value of the range
+          @param tolerance is the tolerance of the integrals per unit of the
+          range
+          @param requested is the bitwise-or of the Statistic flags to compute
+          @return the statistics of the fuzzy set, where the statistics not
+          requested and those of the maximum are `fl::nan`
+         */
+        virtual Statistics adaptiveStatistics(
+            const Term* term, scalar minimum, scalar maximum, scalar tolerance, int requested = AllStatistics
+        ) const;
+
+        /**
+          Computes the statistics of the fuzzy set that the defuzzifier
+          utilizes to defuzzify it, which include the number of membership
+          function values computed. By default, all of the statistics are
+          computed by IntegralDefuzzifier::statistics()
+
+          @param term is the fuzzy set
+          @param minimum is the minimum value of the range
+          @param maximum is the maximum value of the range
+          @return the statistics of the fuzzy set utilized to defuzzify it
+         */
+        virtual Statistics defuzzification(const Term* term, scalar minimum, scalar maximum) const;
+
         /**
           Sets the default resolution for integral-based defuzzifiers
           @param defaultResolution is the default resolution for integral-based defuzzifiers
@@ -36,7 +36,7 @@ namespace fuzzylite {
      */
     class FL_API LargestOfMaximum : public IntegralDefuzzifier {
       public:
-        explicit LargestOfMaximum(int resolution = defaultResolution());
+        explicit LargestOfMaximum(int resolution = defaultResolution(), bool restrictedToSupport = false);
         virtual ~LargestOfMaximum() FL_IOVERRIDE;
         FL_DEFAULT_COPY_AND_MOVE(LargestOfMaximum)
 
@@ -55,6 +55,15 @@ namespace fuzzylite {
           function value in the fuzzy set
          */
         virtual scalar defuzzify(const Term* term, scalar minimum, scalar maximum) const FL_IOVERRIDE;
+        /**
+          Computes the largest value of the maximum of the fuzzy set
+          @param term is the fuzzy set
+          @param minimum is the minimum value of the fuzzy set
+          @param maximum is the maximum value of the fuzzy set
+          @return the statistics of the fuzzy set, where only the largest value of the maximum is
+          computed
+         */
+        virtual Statistics defuzzification(const Term* term, scalar minimum, scalar maximum) const FL_IOVERRIDE;
         virtual LargestOfMaximum* clone() const FL_IOVERRIDE;
 
         static Defuzzifier* constructor();
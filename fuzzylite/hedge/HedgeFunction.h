@@ -68,7 +68,9 @@ namespace fuzzylite {
 
         /**
           Computes the hedge for the membership function value @f$x@f$ utilizing
-          the given function via HedgeFunction::setFormula()
+          the given function via HedgeFunction::setFormula(), without modifying
+          the function, such that it can be computed concurrently from
+          multiple threads
           @param x is a membership function value
           @return the evaluation of the function
          */
@@ -0,0 +1,136 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_BINARYEXPORTER_H
+#define FL_BINARYEXPORTER_H
+
+#include "fuzzylite/imex/Exporter.h"
+
+namespace fuzzylite {
+    /**
+      The BinaryExporter class is an Exporter that serializes a loaded Engine
+      into a versioned binary format, which the BinaryImporter loads without
+      tokenizing text, looking up the terms by name, or parsing the rules.
+
+      The binary engine starts with the magic bytes `FLBN`, the version of the
+      format, and the value `1234.5` in the byte order of the platform, which
+      the BinaryImporter checks before reading any further. Integers are
+      written as four bytes in little-endian order, scalars as eight bytes in
+      IEEE 754 double precision, and strings as their length followed by
+      their bytes. The engine follows the same order as the FuzzyLite
+      Language, except that:
+
+      - the terms are written as a BinaryExporter::TermCode followed by their
+      parameters as scalars, and the hedges as a BinaryExporter::HedgeCode,
+      except for the user-defined terms and hedges, which are written by name
+      and configured from their parameters in text,
+
+      - the antecedents of the loaded rules are written in postfix order as a
+      sequence of BinaryExporter::InstructionCode, where the propositions refer
+      to the variables and the terms by their indices in the engine, and the
+      conclusions of the consequents likewise refer to the output variables
+      and their terms by indices.
+
+      The rules that are not loaded are written in text only, and the
+      BinaryImporter loads them from text as the FllImporter does.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see BinaryImporter
+      @see FllExporter
+      @see Exporter
+      @since 7.1
+     */
+    class FL_API BinaryExporter : public Exporter {
+      public:
+        /**
+          Codes of the terms in the binary format, whose values must not change
+          across versions of the format
+         */
+        enum TermCode {
+            TermByName = 0,
+            TermBell,
+            TermBinary,
+            TermConcave,
+            TermConstant,
+            TermCosine,
+            TermDiscrete,
+            TermGaussian,
+            TermGaussianProduct,
+            TermLinear,
+            TermPiShape,
+            TermRamp,
+            TermRectangle,
+            TermSShape,
+            TermSigmoid,
+            TermSigmoidDifference,
+            TermSigmoidProduct,
+            TermSpike,
+            TermTrapezoid,
+            TermTriangle,
+            TermZShape
+        };
+
+        /**
+          Codes of the hedges in the binary format, whose values must not
+          change across versions of the format
+         */
+        enum HedgeCode { HedgeByName = 0, HedgeAny, HedgeExtremely, HedgeNot, HedgeSeldom, HedgeSomewhat, HedgeVery };
+
+        /**
+          Codes of the instructions of the antecedents in the binary format,
+          whose values must not change across versions of the format
+         */
+        enum InstructionCode { InstructionInput = 0, InstructionOutput, InstructionAnd, InstructionOr };
+
+        BinaryExporter();
+        virtual ~BinaryExporter() FL_IOVERRIDE;
+        FL_DEFAULT_COPY_AND_MOVE(BinaryExporter)
+
+        virtual std::string name() const FL_IOVERRIDE;
+
+        /**
+          Returns the magic bytes that start a binary engine
+          @return the magic bytes that start a binary engine
+         */
+        static std::string magic();
+
+        /**
+          Returns the version of the binary format written by the exporter
+          @return the version of the binary format written by the exporter
+         */
+        static int version();
+
+        /**
+          Returns the engine serialized in the binary format
+          @param engine is the engine to export
+          @return the bytes of the engine serialized in the binary format
+         */
+        virtual std::string toString(const Engine* engine) const FL_IOVERRIDE;
+
+        /**
+          Writes the engine serialized in the binary format to the file,
+          without the trailing new line of Exporter::toFile()
+          @param path is the full path of the file
+          @param engine is the engine to export
+         */
+        virtual void toFile(const std::string& path, const Engine* engine) const FL_IOVERRIDE;
+
+        virtual BinaryExporter* clone() const FL_IOVERRIDE;
+    };
+}
+
+#endif /* FL_BINARYEXPORTER_H */
@@ -0,0 +1,85 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_BINARYIMPORTER_H
+#define FL_BINARYIMPORTER_H
+
+#include "fuzzylite/imex/Importer.h"
+
+namespace fuzzylite {
+
+    /**
+      The BinaryImporter class is an Importer that loads an Engine from the
+      binary format written by the BinaryExporter.
+
+      The terms and hedges are constructed from their codes and parameters,
+      and the rules are loaded from their antecedents in postfix order and
+      their conclusions, whose variables and terms are resolved by index,
+      such that the rules are loaded without parsing their text. Only the
+      user-defined terms and hedges are constructed by name from the
+      FactoryManager (the norms, activation methods, and defuzzifiers too,
+      which are few per engine), and only the rules that were not loaded when
+      exported are loaded from their text.
+
+      The engine is read directly from the bytes in memory, such that
+      BinaryImporter::fromFile() maps the file into memory (on Unix) instead
+      of reading it into a string. The binary engines exported in a different
+      byte order or in an unsupported version of the format throw an
+      fl::Exception.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see BinaryExporter
+      @see FllImporter
+      @see Importer
+      @since 7.1
+     */
+    class FL_API BinaryImporter : public Importer {
+      public:
+        BinaryImporter();
+        virtual ~BinaryImporter() FL_IOVERRIDE;
+        FL_DEFAULT_COPY_AND_MOVE(BinaryImporter)
+
+        virtual std::string name() const FL_IOVERRIDE;
+
+        /**
+          Imports the engine from the bytes of the binary format
+          @param binary is the engine in the binary format
+          @return the engine loaded from the binary format
+         */
+        virtual Engine* fromString(const std::string& binary) const FL_IOVERRIDE;
+
+        /**
+          Imports the engine from the bytes of the binary format in memory
+          @param data is the pointer to the engine in the binary format
+          @param size is the number of bytes of the engine
+          @return the engine loaded from the binary format
+         */
+        virtual Engine* fromMemory(const char* data, std::size_t size) const;
+
+        /**
+          Imports the engine from the file in the binary format, which is
+          mapped into memory on Unix
+          @param path is the full path of the file
+          @return the engine loaded from the file
+         */
+        virtual Engine* fromFile(const std::string& path) const FL_IOVERRIDE;
+
+        virtual BinaryImporter* clone() const FL_IOVERRIDE;
+    };
+}
+
+#endif /* FL_BINARYIMPORTER_H */
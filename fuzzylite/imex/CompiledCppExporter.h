@@ -0,0 +1,95 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_COMPILEDCPPEXPORTER_H
+#define FL_COMPILEDCPPEXPORTER_H
+
+#include "fuzzylite/imex/Exporter.h"
+
+namespace fuzzylite {
+
+    /**
+      The CompiledCppExporter class is an Exporter that translates an Engine
+      into a self-contained function in the `C++` programming language that
+      evaluates the engine without the `fuzzylite` library:
+
+      @code
+      void evaluate(const double* in, double* out);
+      @endcode
+
+      where `in` contains the values of the input variables and `out` the
+      values of the output variables, both in the order of the engine. The
+      terms, hedges, norms, rules, and defuzzifiers are translated into
+      straight-line code with their parameters as constants, and the fuzzy
+      sets of the integral defuzzifiers are sampled at the midpoints of the
+      resolution in a single loop per output variable.
+
+      Upon entry, `out` must contain the values of the output variables from
+      the previous evaluation (or `nan`), which are used as the values of the
+      output variables that are disabled, that lock their previous values,
+      or that are referenced by the formulas of Function terms, as in
+      Engine::process(). The generated function is re-entrant.
+
+      The results of the generated function are the same as those of
+      Engine::process() up to the rounding errors of aggregating the activated
+      terms in a different order. The engines that cannot be translated
+      (e.g., with user-defined terms, hedges, or norms, or with exact, adaptive,
+      or restricted integral defuzzifiers) throw an fl::Exception.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see CppExporter
+      @see CompiledEngine
+      @see Exporter
+      @since 7.1
+     */
+    class FL_API CompiledCppExporter : public Exporter {
+      private:
+        std::string _functionName;
+
+      public:
+        explicit CompiledCppExporter(const std::string& functionName = "evaluate");
+        virtual ~CompiledCppExporter() FL_IOVERRIDE;
+        FL_DEFAULT_COPY_AND_MOVE(CompiledCppExporter)
+
+        virtual std::string name() const FL_IOVERRIDE;
+
+        /**
+          Returns the source code of a self-contained function that evaluates
+          the engine
+          @param engine is the engine to export
+          @return the source code of a self-contained function that evaluates
+          the engine
+          @throws fl::Exception if the engine cannot be translated
+         */
+        virtual std::string toString(const Engine* engine) const FL_IOVERRIDE;
+
+        /**
+          Sets the name of the generated function
+          @param functionName is the name of the generated function
+         */
+        virtual void setFunctionName(const std::string& functionName);
+        /**
+          Gets the name of the generated function
+          @return the name of the generated function
+         */
+        virtual std::string getFunctionName() const;
+
+        virtual CompiledCppExporter* clone() const FL_IOVERRIDE;
+    };
+}
+
+#endif /* FL_COMPILEDCPPEXPORTER_H */
@@ -28,6 +28,8 @@ namespace fuzzylite {
     class Activation;
     class Term;
     class Defuzzifier;
+    template <typename T>
+    class BasicCompiledEngine;
 
     /**
       The FllImporter class is an Importer that configures an Engine and its
@@ -64,6 +66,27 @@ namespace fuzzylite {
         virtual std::string name() const FL_IOVERRIDE;
         virtual Engine* fromString(const std::string& fll) const FL_IOVERRIDE;
 
+        /**
+          Imports the engine from the given FLL and compiles it to be
+          evaluated in the precision of `T`, which is `float` or `double`
+          @param fll is the engine in the FuzzyLite Language
+          @return the engine compiled in the precision of `T`
+          @see BasicCompiledEngine
+          @since 7.1
+         */
+        template <typename T>
+        BasicCompiledEngine<T>* compileFromString(const std::string& fll) const;
+        /**
+          Imports the engine from the given file and compiles it to be
+          evaluated in the precision of `T`, which is `float` or `double`
+          @param path is the path of the file containing the FLL of the engine
+          @return the engine compiled in the precision of `T`
+          @see BasicCompiledEngine
+          @since 7.1
+         */
+        template <typename T>
+        BasicCompiledEngine<T>* compileFromFile(const std::string& path) const;
+
         virtual FllImporter* clone() const FL_IOVERRIDE;
 
       protected:
@@ -26,6 +26,9 @@ namespace fuzzylite {
     /**
      The SNormFunction class is a customizable SNorm via Function, which
      computes any function based on the @f$a@f$ and @f$b@f$ values.
+     The values are bound to the arguments `a` and `b` of the function, such
+     that the norm is computed without modifying the function and can be
+     computed concurrently from multiple threads.
      This SNorm is not registered with the SNormFactory.
 
      @author Juan Rada-Vilela, Ph.D.
@@ -64,8 +67,8 @@ namespace fuzzylite {
 
         /**
           Computes the S-Norm utilizing the given function via
-          SNormFunction::setFormula(), which automatically assigns the values
-          of @f$a@f$ and @f$b@f$.
+          SNormFunction::setFormula(), which reads the values of @f$a@f$ and
+          @f$b@f$ from its arguments.
 
           @param a is a membership function value
           @param b is a membership function value
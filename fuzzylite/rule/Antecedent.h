@@ -19,6 +19,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #define FL_ANTECEDENT_H
 
 #include <string>
+#include <vector>
 
 #include "fuzzylite/fuzzylite.h"
 
@@ -28,6 +29,9 @@ namespace fuzzylite {
     class TNorm;
     class SNorm;
     class Expression;
+    class Variable;
+    class Term;
+    class Hedge;
 
     /**
       The Antecedent class is an expression tree that represents and evaluates
@@ -39,6 +43,16 @@ namespace fuzzylite {
       where `*`-marked elements may appear zero or more times, elements in
       brackets are optional, and elements in parentheses are compulsory.
 
+      Upon loading, the expression tree is compiled into a sequence of
+      instructions in postfix order, where the variables, terms, hedges, and
+      operators are resolved, such that the activation degree is computed
+      without recursion nor comparison of strings. The instructions are
+      evaluated on a stack local to each computation, sized from the maximum
+      depth of the instructions, so the activation degree can be computed
+      concurrently. Changes made to the
+      expression tree after loading are not reflected until the antecedent
+      is loaded again.
+
       @author Juan Rada-Vilela, Ph.D.
       @see Consequent
       @see Rule
@@ -46,8 +60,25 @@ namespace fuzzylite {
      */
     class FL_API Antecedent {
       private:
+        enum OpCode { OpInput, OpOutput, OpNone, OpAny, OpAnd, OpOr };
+
+        struct Instruction {
+            OpCode opcode;
+            Variable* variable;
+            const Term* term;
+            std::size_t termIndex;
+            std::size_t hedgeBegin;
+            std::size_t hedgeEnd;
+        };
+
         std::string _text;
         FL_unique_ptr<Expression> _expression;
+        std::vector<Instruction> _code;
+        std::vector<const Hedge*> _hedges;
+        std::size_t _depth;
+        std::size_t _revision;
+
+        bool compile(const Expression* node);
 
       public:
         Antecedent();
@@ -59,7 +90,9 @@ namespace fuzzylite {
          */
         virtual void setText(const std::string& text);
         /**
-          Gets the antecedent in text
+          Gets the antecedent in text. The text of an antecedent loaded without
+          text (see Antecedent::setExpression()) is produced from its expression
+          tree with the parentheses required to load it back
           @return the antecedent in text
          */
         virtual std::string getText() const;
@@ -76,6 +109,15 @@ namespace fuzzylite {
          */
         virtual void setExpression(Expression* expression);
 
+        /**
+          Gets the number of times the expression tree of the antecedent has
+          been set, which changes whenever the antecedent is loaded or
+          unloaded
+          @return the number of times the expression tree of the antecedent
+          has been set
+         */
+        virtual std::size_t revision() const;
+
         /**
           Indicates whether the antecedent is loaded
           @return whether the antecedent is loaded
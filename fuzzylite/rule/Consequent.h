@@ -62,7 +62,8 @@ namespace fuzzylite {
          */
         virtual void setText(const std::string& text);
         /**
-          Gets the text of the consequent
+          Gets the text of the consequent. The text of a consequent loaded
+          without text is produced from its conclusions
           @return the text of the consequent
          */
         virtual std::string getText() const;
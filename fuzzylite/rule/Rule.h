@@ -71,6 +71,7 @@ namespace fuzzylite {
         bool _triggered;
         FL_unique_ptr<Antecedent> _antecedent;
         FL_unique_ptr<Consequent> _consequent;
+        std::size_t _revision;
 
       public:
         explicit Rule(const std::string& text = "", scalar weight = 1.0);
@@ -99,7 +100,9 @@ namespace fuzzylite {
          */
         virtual void setText(const std::string& text);
         /**
-          Gets the text of the rule
+          Gets the text of the rule. The text of a rule loaded without text
+          (e.g., built with the RuleBuilder) is produced from its antecedent,
+          consequent, and weight, and is kept when the rule is unloaded
           @return the text of the rule
          */
         virtual std::string getText() const;
@@ -182,6 +185,14 @@ namespace fuzzylite {
          */
         virtual std::string toString() const;
 
+        /**
+          Gets the revision of the rule, which changes whenever the rule or its
+          antecedent are loaded or unloaded (see Antecedent::revision()), or
+          its antecedent or consequent are replaced
+          @return the revision of the rule
+         */
+        virtual std::size_t revision() const;
+
         /**
           Indicates whether the rule is loaded
           @return whether the rule is loaded
@@ -23,6 +23,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/activation/Activation.h"
 #include "fuzzylite/fuzzylite.h"
+#include "fuzzylite/rule/RuleIndex.h"
 
 namespace fuzzylite {
 
@@ -52,6 +53,9 @@ namespace fuzzylite {
         FL_unique_ptr<SNorm> _disjunction;
         FL_unique_ptr<TNorm> _implication;
         FL_unique_ptr<Activation> _activation;
+        RuleIndex _ruleIndex;
+        std::vector<Rule*> _candidates;
+        std::size_t _revision;
 
         void copyFrom(const RuleBlock& source);
 
@@ -209,11 +213,54 @@ namespace fuzzylite {
          */
         virtual const std::vector<Rule*>& rules() const;
         /**
-          Returns a mutable vector of the rules added to the rule block
+          Returns a mutable vector of the rules added to the rule block, and
+          clears the RuleIndex of the rule block as the rules may be modified
           @return a mutable vector of the rules added to the rule block
          */
         virtual std::vector<Rule*>& rules();
 
+        /**
+          Gets the revision of the rule block, which changes whenever rules
+          are added, inserted, removed, or set, and whenever any of its rules
+          is loaded or unloaded (see Rule::revision()). The revision is
+          computed in @f$O(n)@f$ for @f$n@f$ rules
+          @return the revision of the rule block
+         */
+        virtual std::size_t revision() const;
+
+        /**
+          Returns the rules that can be activated by the current values of the
+          input variables, that is, the rules whose antecedents are not known
+          to be zero according to the RuleIndex of the rule block. The index
+          is cleared whenever the rules are added, inserted, removed, set, or
+          loaded through the rule block, the mutable vector of rules is
+          accessed, or the conjunction and disjunction operators are set, in
+          which case it is rebuilt here, and otherwise only the buffer is
+          modified. The index must be rebuilt after changing the parameters
+          of the terms in the antecedents of the rules or loading the rules
+          directly (see RuleBlock::rebuildIndex())
+          @param buffer is the vector to fill with the candidate rules
+          @return the rules that can be activated by the current values of the
+          input variables, in the order of the rule block
+         */
+        virtual const std::vector<Rule*>& candidateRules(std::vector<Rule*>& buffer);
+        /**
+          Returns the rules that can be activated by the current values of the
+          input variables using the buffer of the rule block, which is reused
+          across activations (see RuleBlock::candidateRules(std::vector<Rule*>&))
+          @return the rules that can be activated by the current values of the
+          input variables, in the order of the rule block
+         */
+        virtual const std::vector<Rule*>& candidateRules();
+
+        /**
+          Rebuilds the RuleIndex of the rule block, which is needed after
+          changing the parameters of the terms in the antecedents of the rules
+          or loading the rules directly, and is otherwise done when needed by
+          RuleBlock::candidateRules()
+         */
+        virtual void rebuildIndex();
+
         /**
           Creates a clone of the rule block without the rules being loaded
           @return a clone of the rule block without the rules being loaded
@@ -0,0 +1,156 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_RULEBLOCKSCHEDULER_H
+#define FL_RULEBLOCKSCHEDULER_H
+
+#include <vector>
+
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    class Engine;
+    class RuleBlock;
+    class Rule;
+
+    /**
+      The RuleBlockScheduler class determines the order in which the rule
+      blocks of an Engine are activated from the dependencies between the
+      rule blocks and the output variables.
+
+      A rule block depends on another when its antecedents refer to an output
+      variable that the other rule block modifies in its consequents (e.g.,
+      chained rule blocks), in which case it is activated after the other
+      rule block has aggregated its conclusions. The rule blocks that modify
+      the same output variable are activated in the order they are declared,
+      and the rule blocks that do not depend on each other are activated in
+      any order, possibly in parallel. The rule blocks are activated in
+      topological order of the dependencies, where the ties are broken by
+      the order of declaration, so the engines whose rule blocks are declared
+      after their dependencies are activated in the order of declaration.
+
+      If the dependencies form a cycle, the cycle is reported by
+      RuleBlockScheduler::cycles() and the rule blocks are activated in the
+      order of declaration.
+
+      Only the enabled rule blocks are scheduled.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see Engine::process()
+      @see Engine::setNumberOfThreads()
+      @since 7.1
+     */
+    class FL_API RuleBlockScheduler {
+      private:
+        std::vector<RuleBlock*> _ruleBlocks;
+        std::vector<int> _enabled;
+        std::vector<std::vector<Rule*> > _rules;
+        std::vector<std::size_t> _revisions;
+        std::vector<const void*> _outputVariables;
+        std::vector<std::size_t> _order;
+        std::vector<std::vector<std::size_t> > _dependencies;
+        std::vector<std::vector<std::size_t> > _dependents;
+        std::vector<std::vector<std::size_t> > _cycles;
+        std::size_t _width;
+
+        void activateInOrder() const;
+        void activateInParallel(std::size_t numberOfThreads) const;
+
+      public:
+        RuleBlockScheduler();
+        virtual ~RuleBlockScheduler();
+        FL_DEFAULT_COPY_AND_MOVE(RuleBlockScheduler)
+
+        /**
+          Builds the schedule of the rule blocks of the engine
+          @param engine is the engine
+         */
+        virtual void build(const Engine* engine);
+        /**
+          Indicates whether the schedule corresponds to the engine, that is,
+          whether it was built for the same output variables and the same
+          rules of the same enabled rule blocks, and no rule of the enabled
+          rule blocks has been loaded or unloaded since (see
+          RuleBlock::revision())
+          @param engine is the engine
+          @return whether the schedule corresponds to the engine
+         */
+        virtual bool isBuiltFor(const Engine* engine) const;
+        /**
+          Clears the schedule
+         */
+        virtual void clear();
+
+        /**
+          Gets the indexes of the enabled rule blocks in the order of
+          activation
+          @return the indexes of the enabled rule blocks in the order of
+          activation
+         */
+        virtual const std::vector<std::size_t>& order() const;
+        /**
+          Gets the indexes of the rule blocks that must be activated before
+          the given rule block
+          @param ruleBlock is the index of the rule block in the engine
+          @return the indexes of the rule blocks that must be activated
+          before the given rule block
+         */
+        virtual const std::vector<std::size_t>& dependencies(std::size_t ruleBlock) const;
+        /**
+          Gets the cycles in the dependencies, where each cycle contains the
+          indexes of the rule blocks that depend on each other
+          @return the cycles in the dependencies
+         */
+        virtual const std::vector<std::vector<std::size_t> >& cycles() const;
+        /**
+          Gets the maximum number of rule blocks that can be activated in
+          parallel, that is, the largest number of rule blocks at the same
+          depth of the dependencies
+          @return the maximum number of rule blocks that can be activated in
+          parallel
+         */
+        virtual std::size_t width() const;
+
+        /**
+          Indicates whether the rule blocks are activated concurrently with
+          the given number of threads, which requires more than one thread,
+          independent rule blocks, and no cycles in the dependencies. When
+          the rule blocks are activated concurrently, the terms, hedges, and
+          operators shared by the rule blocks must be safe to use from
+          multiple threads.
+          @param numberOfThreads is the number of threads
+          @return whether the rule blocks are activated concurrently
+         */
+        virtual bool isConcurrent(std::size_t numberOfThreads) const;
+
+
+        /**
+          Activates the enabled rule blocks following the schedule
+          @param numberOfThreads is the number of threads to activate the
+          independent rule blocks in parallel, where one activates the rule
+          blocks in the calling thread
+          @throws fl::Exception if activating a rule block throws an
+          exception, in which case the exception of the first rule block in
+          the order of activation that failed is rethrown after the running
+          rule blocks have finished
+         */
+        virtual void activate(std::size_t numberOfThreads = 1) const;
+    };
+}
+
+#endif /* FL_RULEBLOCKSCHEDULER_H */
@@ -0,0 +1,200 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_RULEBUILDER_H
+#define FL_RULEBUILDER_H
+
+#include <string>
+#include <vector>
+
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    class Expression;
+    class Proposition;
+    class Operator;
+    class Rule;
+    class Variable;
+    class OutputVariable;
+    class Term;
+    class Hedge;
+
+    /**
+      The RuleBuilder class creates rules from their variables, hedges, and
+      terms, such that the rules are loaded without rendering them to text
+      and parsing the text back (see Rule::parse()). The antecedent is an
+      expression tree of propositions connected by conjunctions and
+      disjunctions, and the consequent is a sequence of propositions of
+      output variables, for example:
+
+      @code
+      Rule* rule = RuleBuilder()
+                       .when(service, poor)
+                       .orWhen(RuleBuilder::proposition(food, new Very, rancid))
+                       .then(tip, cheap)
+                       .with(0.5)
+                       .build();
+      @endcode
+
+      The operands of RuleBuilder::andWhen() and RuleBuilder::orWhen() are
+      combined from left to right with the antecedent built so far, and
+      other groupings are built with RuleBuilder::conjunction() and
+      RuleBuilder::disjunction(). The text of the rules built is produced
+      from their antecedents and consequents only when needed (e.g., when
+      exporting the rules, see Rule::getText()).
+
+      The builder owns the expressions, propositions, and hedges given until
+      the rule is built, after which they are owned by the rule.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see Rule
+      @see Antecedent
+      @see Consequent
+      @see Expression
+      @since 7.1
+     */
+    class FL_API RuleBuilder {
+      private:
+        Expression* _antecedent;
+        std::vector<Proposition*> _conclusions;
+        scalar _weight;
+
+        void combine(const std::string& name, Expression* expression);
+
+      public:
+        RuleBuilder();
+        virtual ~RuleBuilder();
+
+        /**
+          Creates the proposition `variable is [hedge]* term`
+          @param variable is the variable of the proposition
+          @param term is the term of the proposition, which is `fl::null` if
+          the last hedge is Any
+          @param hedges are the hedges of the proposition, owned by the
+          proposition
+          @return the proposition `variable is [hedge]* term`
+         */
+        static Proposition*
+        proposition(Variable* variable, Term* term, const std::vector<Hedge*>& hedges = std::vector<Hedge*>());
+        /**
+          Creates the proposition `variable is hedge term`
+          @param variable is the variable of the proposition
+          @param hedge is the hedge of the proposition, owned by the proposition
+          @param term is the term of the proposition, which is `fl::null` if
+          the hedge is Any
+          @return the proposition `variable is hedge term`
+         */
+        static Proposition* proposition(Variable* variable, Hedge* hedge, Term* term);
+        /**
+          Creates the conjunction `left and right`
+          @param left is the left operand, owned by the operator
+          @param right is the right operand, owned by the operator
+          @return the conjunction `left and right`
+         */
+        static Operator* conjunction(Expression* left, Expression* right);
+        /**
+          Creates the disjunction `left or right`
+          @param left is the left operand, owned by the operator
+          @param right is the right operand, owned by the operator
+          @return the disjunction `left or right`
+         */
+        static Operator* disjunction(Expression* left, Expression* right);
+
+        /**
+          Sets the antecedent of the rule, replacing the antecedent built so far
+          @param expression is the antecedent, owned by the builder
+          @return the builder
+         */
+        virtual RuleBuilder& when(Expression* expression);
+        /**
+          Sets the antecedent of the rule to `variable is term`, replacing the
+          antecedent built so far
+          @param variable is the variable of the proposition
+          @param term is the term of the proposition
+          @return the builder
+         */
+        virtual RuleBuilder& when(Variable* variable, Term* term);
+        /**
+          Conjoins the antecedent built so far with the given expression
+          @param expression is the expression, owned by the builder
+          @return the builder
+         */
+        virtual RuleBuilder& andWhen(Expression* expression);
+        /**
+          Conjoins the antecedent built so far with `variable is term`
+          @param variable is the variable of the proposition
+          @param term is the term of the proposition
+          @return the builder
+         */
+        virtual RuleBuilder& andWhen(Variable* variable, Term* term);
+        /**
+          Disjoins the antecedent built so far with the given expression
+          @param expression is the expression, owned by the builder
+          @return the builder
+         */
+        virtual RuleBuilder& orWhen(Expression* expression);
+        /**
+          Disjoins the antecedent built so far with `variable is term`
+          @param variable is the variable of the proposition
+          @param term is the term of the proposition
+          @return the builder
+         */
+        virtual RuleBuilder& orWhen(Variable* variable, Term* term);
+
+        /**
+          Adds the conclusion to the consequent of the rule
+          @param conclusion is the proposition of an output variable, owned by
+          the builder
+          @return the builder
+         */
+        virtual RuleBuilder& then(Proposition* conclusion);
+        /**
+          Adds the conclusion `variable is term` to the consequent of the rule
+          @param variable is the output variable of the conclusion
+          @param term is the term of the conclusion
+          @return the builder
+         */
+        virtual RuleBuilder& then(OutputVariable* variable, Term* term);
+
+        /**
+          Sets the weight of the rule
+          @param weight is the weight of the rule
+          @return the builder
+         */
+        virtual RuleBuilder& with(scalar weight);
+
+        /**
+          Builds the loaded rule from the antecedent, conclusions, and weight
+          given, and clears the builder to build the next rule
+          @return the loaded rule
+          @throws fl::Exception if the antecedent or the consequent are
+          missing or incomplete, in which case the builder is not cleared
+         */
+        virtual Rule* build();
+
+        /**
+          Clears the builder, deleting the antecedent and conclusions given
+         */
+        virtual void clear();
+
+      private:
+        FL_DISABLE_COPY(RuleBuilder)
+    };
+}
+
+#endif /* FL_RULEBUILDER_H */
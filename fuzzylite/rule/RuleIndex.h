@@ -0,0 +1,130 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_RULEINDEX_H
+#define FL_RULEINDEX_H
+
+#include <vector>
+
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    class RuleBlock;
+    class Rule;
+    class InputVariable;
+    class TNorm;
+    class SNorm;
+
+    /**
+      The RuleIndex class indexes the rules of a RuleBlock by the supports of
+      the terms of the input variables in their antecedents (see
+      Term::support()), such that the rules that cannot be activated by the
+      current values of the input variables are not evaluated.
+
+      A rule is considered for indexing when its antecedent is built from
+      propositions of input variables whose hedges preserve a membership
+      degree of zero (i.e., `very`, `somewhat`, `extremely`, and `seldom`)
+      combined with the conjunction and disjunction operators of the
+      library (excluding TNormFunction and SNormFunction). The rule is then a
+      candidate for activation only if the value of every input variable
+      falls within the interval where the antecedent can be non-zero.
+      Propositions of output variables and propositions with other hedges
+      do not constrain the rule, and the rules that cannot be indexed are
+      always candidates. For each input variable, the index partitions the
+      real line at the bounds of the supports and stores the candidate rules
+      of each partition as a bitset, so the candidates for the current input
+      values are the intersection of one bitset per input variable.
+
+      The index assumes the membership degrees of the propositions are in
+      @f$[0, 1]@f$, in which case the rules that are not candidates would
+      have an activation degree of zero.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see RuleBlock
+      @see Term::support()
+      @since 7.1
+     */
+    class FL_API RuleIndex {
+      private:
+        typedef unsigned long Word;
+
+        struct Dimension {
+            const InputVariable* variable;
+            std::vector<scalar> bounds;
+            std::vector<Word> masks;
+        };
+
+        bool _built;
+        const TNorm* _conjunction;
+        const SNorm* _disjunction;
+        scalar _macheps;
+        std::vector<Rule*> _rules;
+        std::vector<Dimension> _dimensions;
+        std::size_t _numberOfWords;
+        std::size_t _numberOfIndexedRules;
+
+      public:
+        RuleIndex();
+        virtual ~RuleIndex();
+        FL_DEFAULT_COPY_AND_MOVE(RuleIndex)
+
+        /**
+          Builds the index of the rules in the rule block
+          @param ruleBlock is the rule block to index
+         */
+        virtual void build(const RuleBlock* ruleBlock);
+        /**
+          Indicates whether the index corresponds to the rule block, that is,
+          whether the index was built and not cleared since, for the same
+          conjunction and disjunction operators and the same machine epsilon.
+          The rules are not compared, as the rule block clears its index
+          whenever its rules change, and neither are the supports of the
+          terms, so the index must be rebuilt after loading the rules
+          directly or changing the parameters of the terms in the antecedents
+          of the rules (see RuleBlock::rebuildIndex())
+          @param ruleBlock is the rule block
+          @return whether the index corresponds to the rule block
+         */
+        virtual bool isBuiltFor(const RuleBlock* ruleBlock) const;
+        /**
+          Clears the index
+         */
+        virtual void clear();
+
+        /**
+          Gets the number of rules constrained by the index, that is, the
+          rules that are not always candidates
+          @return the number of rules constrained by the index
+         */
+        virtual std::size_t numberOfIndexedRules() const;
+
+        /**
+          Gets the rules that can be activated by the current values of the
+          input variables, in the order of the rule block. The index is not
+          modified, so it can be queried from multiple threads.
+          @param buffer is the vector to fill with the candidate rules when
+          the index constrains them
+          @return the buffer with the rules that can be activated by the
+          current values of the input variables, or the rules of the index if
+          none of them is constrained
+         */
+        virtual const std::vector<Rule*>& candidates(std::vector<Rule*>& buffer) const;
+    };
+}
+
+#endif /* FL_RULEINDEX_H */
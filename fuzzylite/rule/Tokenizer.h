@@ -0,0 +1,93 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_TOKENIZER_H
+#define FL_TOKENIZER_H
+
+#include <string>
+
+#include "fuzzylite/fuzzylite.h"
+
+namespace fuzzylite {
+
+    /**
+      The Tokenizer class splits a range of a text into the tokens separated
+      by whitespace, optionally splitting the parentheses into tokens of
+      their own, without copying the text. The tokens are given as positions
+      and sizes within the text, or are assigned to a buffer reused by the
+      caller, such that a rule is tokenized without allocating memory for
+      each token.
+
+      The text must outlive the tokenizer.
+
+      @author Juan Rada-Vilela, Ph.D.
+      @see Rule
+      @see Antecedent
+      @see Consequent
+      @since 7.1
+     */
+    class FL_API Tokenizer {
+      private:
+        const std::string* _text;
+        std::size_t _position;
+        std::size_t _end;
+        bool _splitParentheses;
+
+      public:
+        /**
+          Creates a tokenizer for the given range of the text
+          @param text is the text to tokenize
+          @param begin is the position of the text where the range begins
+          @param end is the position of the text where the range ends
+          (exclusive), which is clipped to the size of the text
+          @param splitParentheses indicates whether the parentheses are tokens
+          of their own
+         */
+        explicit Tokenizer(
+            const std::string& text,
+            std::size_t begin = 0,
+            std::size_t end = std::string::npos,
+            bool splitParentheses = false
+        );
+        virtual ~Tokenizer();
+        FL_DEFAULT_COPY_AND_MOVE(Tokenizer)
+
+        /**
+          Finds the next token in the range of the text
+          @param begin is the position of the next token within the text
+          @param size is the number of characters of the next token
+          @return whether there is a next token
+         */
+        virtual bool next(std::size_t& begin, std::size_t& size);
+
+        /**
+          Assigns the next token in the range of the text to the given buffer
+          @param token is the buffer where the next token is assigned
+          @return whether there is a next token
+         */
+        virtual bool next(std::string& token);
+
+        /**
+          Indicates whether the character separates the tokens
+          @param c is the character
+          @return whether the character is whitespace
+         */
+        static bool isSeparator(char c);
+    };
+}
+
+#endif /* FL_TOKENIZER_H */
@@ -64,6 +64,12 @@ namespace fuzzylite {
           @return @f$d \otimes \mu(x)@f$, where @f$d@f$ is the activation degree
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        /**
+          Computes the support of the activated term, which is the support of
+          the term because the implication of a zero membership is zero
+          @return the support of the term
+         */
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
         virtual std::string toString() const FL_IOVERRIDE;
         virtual std::string getName() const FL_IOVERRIDE;
         virtual bool isMonotonic() const FL_IOVERRIDE;
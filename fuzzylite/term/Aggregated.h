@@ -18,9 +18,14 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #ifndef FL_AGGREGATED_H
 #define FL_AGGREGATED_H
 
-#include <map>
 #include <vector>
 
+#ifdef FL_CPP98
+#include <map>
+#else
+#include <unordered_map>
+#endif
+
 #include "fuzzylite/term/Activated.h"
 #include "fuzzylite/term/Term.h"
 
@@ -37,6 +42,18 @@ namespace fuzzylite {
       therefore their destructors will be called upon destruction of this term
       (or calling Aggregated::clear()).
 
+      The activated terms are accumulated when they are added into a slot per
+      term, found by an index of the terms, and into a group per name of term.
+      The OutputVariable assigns a slot to each of its terms whenever its
+      terms change (see Aggregated::indexTerms()), and Aggregated::clear()
+      only resets the degrees of the slots and the groups, so the activated
+      terms are accumulated without allocating memory. The other terms are
+      assigned a slot when they are first activated, which is released by
+      Aggregated::clear(). Hence, the activation degree of a term and the
+      grouped terms are obtained without scanning all the activated terms,
+      and without modifying the fuzzy set, so multiple threads can read the
+      same fuzzy set concurrently.
+
       @author Juan Rada-Vilela, Ph.D.
       @see Antecedent
       @see Rule
@@ -51,7 +68,31 @@ namespace fuzzylite {
         FL_unique_ptr<SNorm> _aggregation;
         std::vector<Activated> _terms;
 
+        struct Slot {
+            const Term* term;
+            std::size_t rank;  // of the name of the term among the names of the slots
+            scalar degree;
+        };
+
+#ifdef FL_CPP98
+        typedef std::map<const Term*, std::size_t> SlotIndex;
+#else
+        typedef std::unordered_map<const Term*, std::size_t> SlotIndex;
+#endif
+        std::vector<Slot> _slots;
+        SlotIndex _slotIndex;
+        std::size_t _indexedSlots;
+        std::vector<std::size_t> _ranks;
+        std::vector<Activated> _groups;
+        std::size_t _lastSlot;
+        bool _synchronized;
+
         void copyFrom(const Aggregated& source);
+        std::size_t addSlot(const Term* term);
+        void reset();
+        void synchronize();
+        void accumulate(const Activated& activated);
+        void group(const std::vector<Activated>& terms, std::vector<Activated>& result) const;
 
       public:
         explicit Aggregated(
@@ -87,6 +128,14 @@ namespace fuzzylite {
           @return @f$\sum_i{\mu_i(x)}, i \in \mbox{terms}@f$
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        /**
+          Computes the support of the aggregated terms, that is, the smallest
+          interval that contains the supports of the activated terms
+          @return the smallest interval that contains the supports of the
+          activated terms, which is @f$(\infty, -\infty)@f$ if there are no
+          activated terms
+         */
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
         /**
           Computes the aggregated activation degree for the given term.
           If the same term is present multiple times, the aggregation operator
@@ -105,7 +154,39 @@ namespace fuzzylite {
          */
         virtual Activated highestActivatedTerm() const;
 
+        /**
+          Gets the activated terms grouped by name in alphabetical order,
+          where the activation degrees of the terms with the same name are
+          aggregated utilizing the aggregation operator (or a regular sum if
+          the aggregation operator is fl::null), and each group keeps the term
+          and implication of its first activation
+          @return the activated terms grouped by name
+         */
         virtual std::vector<Activated> groupedTerms() const;
+        /**
+          Gets the activated terms grouped by name (see
+          Aggregated::groupedTerms()) without copying the groups, unless the
+          activated terms have been accessed through the mutable
+          Aggregated::terms() since the last modification of the fuzzy set by
+          other means, in which case the groups are computed into the buffer
+          @param buffer is where the groups are computed if needed
+          @return the activated terms grouped by name, which are valid until
+          the next modification of the fuzzy set or the buffer
+         */
+        virtual const std::vector<Activated>& groupedTerms(std::vector<Activated>& buffer) const;
+
+        /**
+          Assigns a slot to each of the given terms, such that their activated
+          terms are accumulated without allocating memory, and keeps the slots
+          after Aggregated::clear(). The slots of other terms are released,
+          and the activated terms are accumulated again upon the next
+          modification of the fuzzy set. The terms must be indexed again after
+          they are modified or deleted by other means (see
+          OutputVariable::rebuildIndex())
+          @param terms are the terms that can be activated, usually the terms
+          of the OutputVariable
+         */
+        virtual void indexTerms(const std::vector<Term*>& terms);
 
         virtual std::string toString() const FL_IOVERRIDE;
 
@@ -197,7 +278,9 @@ namespace fuzzylite {
          */
         virtual const std::vector<Activated>& terms() const;
         /**
-          Returns a mutable vector of activated terms
+          Returns a mutable vector of activated terms. Until the next
+          modification of the fuzzy set by other means, the activation degrees
+          and grouped terms are computed by scanning the activated terms
           @return a mutable vector of activated terms
          */
         virtual std::vector<Activated>& terms();
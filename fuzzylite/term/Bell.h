@@ -73,6 +73,7 @@ namespace fuzzylite {
                 @f$s@f$ is the slope of the Bell
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
 
         /**
           Sets the center of the bell curve
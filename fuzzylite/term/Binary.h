@@ -86,6 +86,8 @@ namespace fuzzylite {
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
 
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
+
         /**
          Sets the start of the binary edge
          @param start is the start of the binary edge
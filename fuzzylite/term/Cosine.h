@@ -70,6 +70,8 @@ namespace fuzzylite {
                 @f$w@f$ is the width of the Cosine
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
         /**
           Sets the center of the cosine
           @param center is the center of the cosine
@@ -93,6 +93,8 @@ namespace fuzzylite {
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
 
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
+
         /**
           Sets the vector of pairs defining the discrete membership function
           @param pairs is the vector of pairs defining the discrete membership function
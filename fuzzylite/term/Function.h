@@ -20,6 +20,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "fuzzylite/term/Term.h"
 
@@ -34,17 +35,24 @@ namespace fuzzylite {
       fl::scalar values, which are utilized to replace the variable names for
       their respective values in the given formula whenever the function
       @f$f@f$ is evaluated. Specifically, when the method
-      Function::membership() is called, the name and value of the variable
-      @f$x@f$ are automatically loaded into the map. Furthermore, if an Engine
-      is given, the names of its InputVariable%s and OutputVariable%s will also
-      be automatically loaded into the map linking to their respective input
+      Function::membership() is called, the variable @f$x@f$ takes the given
+      value. Furthermore, if an Engine is given, the names of its
+      InputVariable%s and OutputVariable%s refer to their respective input
       values and (previously defuzzified) output values. The
       Function::variables need to be manually loaded whenever variables other
       than @f$x@f$, input variables, and output variables, are expressed in the
-      given formula, always having in mind that (a) the map replaces existing
-      keys, and (b) the variable @f$x@f$, and input variables and output
-      variables of an engine will automatically be replaced and will also take
-      precedence over previously loaded variables.
+      given formula, always having in mind that the variable @f$x@f$, and
+      input variables and output variables of an engine take precedence over
+      previously loaded variables.
+
+      Upon loading, the expression tree is compiled into a program of
+      instructions in postfix order (see Function::Instruction), where the
+      operations on constants are folded, the multiplications and divisions
+      by one and the subtractions of zero are removed, and the subexpressions
+      that appear more than once are computed once. Function::membership()
+      runs the program on a stack of fixed size, and the tree is kept to
+      export the formula. The elements of the formula are assumed to be pure
+      functions.
 
       Besides the use of Function as a linguistic Term, it is also utilized to
       convert the text of the Antecedent of a Rule, expressed in infix
@@ -147,6 +155,24 @@ namespace fuzzylite {
           a constant value.
          */
         struct FL_API Node {
+            /**
+              Determines where the value of a variable is read from when
+              computing the membership function, which is resolved when the
+              formula is loaded
+             */
+            enum Source {
+                /**the value is looked up by name in the map of variables*/
+                Map,
+                /**the value is the @f$x@f$ given to the membership function*/
+                X,
+                /**the value is that of the input variable at the index in the engine*/
+                Input,
+                /**the value is that of the output variable at the index in the engine*/
+                Output,
+                /**the value is the argument at the index (see Function::setArguments())*/
+                Argument
+            };
+
             /**The node takes an operation or a function*/
             FL_unique_ptr<Element> element;
             /**The node can have an expression tree on the left*/
@@ -157,6 +183,10 @@ namespace fuzzylite {
             std::string variable;
             /**The node can take an arbitrary floating-point value*/
             scalar constant;
+            /**The node can read the value of its variable from a source other than the map*/
+            Source source;
+            /**The node can read the value of its variable at this index of the source*/
+            std::size_t index;
 
             explicit Node(Element* element, Node* left = fl::null, Node* right = fl::null);
             explicit Node(const std::string& variable);
@@ -183,6 +213,30 @@ namespace fuzzylite {
              */
             virtual scalar evaluate(const std::map<std::string, scalar>* variables = fl::null) const;
 
+            /**
+              Evaluates the node and substitutes the variables therein for the
+              values read from their sources, which are the arguments, @f$x@f$,
+              and the input and output variables of the engine, and otherwise
+              for the values passed in the map. The expression tree is
+              evaluated recursively.
+
+              @param x is the value of the variable @f$x@f$
+              @param engine is the engine whose variables are read by index
+              @param variables is a map of substitutions of variable names for
+              fl::scalar%s, for the variables whose source is the map
+              @param arguments is the array of arguments read by index, or
+              `fl::null` to look up the arguments in the map
+
+              @return a fl::scalar indicating the result of the evaluation of
+              the node
+             */
+            virtual scalar evaluate(
+                scalar x,
+                const Engine* engine,
+                const std::map<std::string, scalar>* variables,
+                const scalar* arguments = fl::null
+            ) const;
+
             /**
              Computes the size of the subtree under the given node. The complexity
              of calling this method is O(n).
@@ -247,6 +301,61 @@ namespace fuzzylite {
             void copyFrom(const Node& source);
         };
 
+        /**
+          The Instruction struct is an instruction of the program compiled from
+          the expression tree, which operates on a stack of values
+         */
+        struct FL_API Instruction {
+            /**
+              Determines the operation of the instruction
+             */
+            enum OpCode {
+                /**pushes the constant*/
+                OpConstant,
+                /**pushes the value of @f$x@f$*/
+                OpX,
+                /**pushes the value of the input variable at the index*/
+                OpInput,
+                /**pushes the value of the output variable at the index*/
+                OpOutput,
+                /**pushes the value of the argument at the index*/
+                OpArgument,
+                /**pushes the value of the variable in the map of variables*/
+                OpVariable,
+                /**replaces the value at the top with the unary function of it*/
+                OpUnary,
+                /**replaces the two values at the top with the binary function of them*/
+                OpBinary,
+                /**copies the value at the top into the temporary at the index*/
+                OpStore,
+                /**pushes the value of the temporary at the index*/
+                OpLoad
+            };
+
+            /**The operation of the instruction*/
+            OpCode opcode;
+            /**The constant to push*/
+            scalar constant;
+            /**The index of the variable in the engine, or of the temporary*/
+            std::size_t index;
+            /**The name of the variable, or of the element of the function*/
+            std::string name;
+            /**The unary function*/
+            Unary unary;
+            /**The binary function*/
+            Binary binary;
+
+            explicit Instruction(OpCode opcode = OpConstant, scalar constant = fl::nan, std::size_t index = 0);
+
+            /**
+              Returns a string with the constant, the name of the variable or
+              element, or the operation on the temporary, accordingly.
+              @return a string with the constant, the name of the variable or
+              element, or the operation on the temporary, accordingly.
+             */
+            std::string toString() const;
+        };
+
         /******************************
          * Term
          ******************************/
@@ -255,6 +364,10 @@ namespace fuzzylite {
         FL_unique_ptr<Node> _root;
         std::string _formula;
         const Engine* _engine;
+        std::vector<std::string> _arguments;
+        std::vector<Instruction> _program;
+
+        bool compile();
 
       public:
         /**A map of variables and substitution values**/
@@ -285,9 +398,15 @@ namespace fuzzylite {
 
         /**
           Computes the membership function value of @f$x@f$ at the root node.
-          If the engine has been set, the current values of the input variables
-          and output variables are added to the map of Function::variables. In
-          addition, the variable @f$x@f$ will also be added to the map.
+          The variable @f$x@f$ and the input and output variables of the
+          engine are read directly from the sources resolved when the formula
+          was loaded, and only the other variables are looked up in the map of
+          Function::variables. After its variables are added, inserted,
+          removed or set, the engine resolves the sources again on the next
+          Engine::process() or Engine::rebuildIndexes(), as long as the
+          function is a term of its variables. Otherwise, the sources must be
+          resolved again after the variables of the engine change (see
+          Function::setEngine()).
           @param x
           @return the membership function value of @f$x@f$ at the root node
          */
@@ -305,6 +424,19 @@ namespace fuzzylite {
         virtual scalar evaluate(const std::map<std::string, scalar>* variables) const;
         virtual scalar evaluate(const std::map<std::string, scalar>& variables = std::map<std::string, scalar>()) const;
 
+        /**
+          Computes the function value of @f$x@f$ and the given arguments
+          without modifying the function, such that it can be called
+          concurrently from multiple threads as long as the function, its
+          map of variables, and its engine are not modified meanwhile.
+          @param x is the value of the variable @f$x@f$
+          @param arguments is the array of values of the arguments in the
+          order given to Function::setArguments(), or `fl::null` to look up
+          the arguments in the map of variables
+          @return the function value of @f$x@f$ and the given arguments
+         */
+        virtual scalar evaluate(scalar x, const scalar* arguments) const;
+
         virtual std::string className() const FL_IOVERRIDE;
         /**
           Returns the parameters of the term as `formula`
@@ -329,7 +461,8 @@ namespace fuzzylite {
         virtual std::string getFormula() const;
 
         /**
-          Sets the engine to which the formula can refer
+          Sets the engine to which the formula can refer, and resolves the
+          sources of the variables of the formula if it is loaded
           @param engine is the engine to which the formula can refer
          */
         virtual void setEngine(const Engine* engine);
@@ -339,6 +472,20 @@ namespace fuzzylite {
          */
         virtual const Engine* getEngine() const;
 
+        /**
+          Sets the names of the arguments of the function, which are read by
+          their index from the array given to Function::evaluate() and take
+          precedence over the other variables, and resolves the sources of
+          the variables of the formula if it is loaded
+          @param arguments is the vector of names of the arguments
+         */
+        virtual void setArguments(const std::vector<std::string>& arguments);
+        /**
+          Gets the names of the arguments of the function
+          @return the names of the arguments of the function
+         */
+        virtual const std::vector<std::string>& getArguments() const;
+
         /**
           Gets the root node of the expression tree defining the Function. The
           root is `fl::null` if the formula has not been loaded.
@@ -347,6 +494,14 @@ namespace fuzzylite {
          */
         virtual Node* root() const;
 
+        /**
+          Gets the program compiled from the expression tree, which is empty
+          if the formula has not been loaded or could not be compiled, in
+          which case the expression tree is evaluated
+          @return the program compiled from the expression tree
+         */
+        virtual const std::vector<Instruction>& program() const;
+
         /**
           Indicates whether the formula is loaded
           @return whether the formula is loaded
@@ -404,6 +559,16 @@ namespace fuzzylite {
          */
         virtual std::string space(const std::string& formula) const;
 
+        /**
+          Resolves the sources of the variables in the expression tree under
+          the given node, where the arguments take precedence over @f$x@f$,
+          which takes precedence over the output
+          variables of the engine, which take precedence over its input
+          variables, which take precedence over the map of variables
+          @param node is the root of the expression tree
+         */
+        virtual void resolve(Node* node) const;
+
         virtual void updateReference(const Engine* engine) FL_IOVERRIDE;
 
         virtual Function* clone() const FL_IOVERRIDE;
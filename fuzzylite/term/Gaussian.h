@@ -67,6 +67,7 @@ namespace fuzzylite {
                 @f$\sigma@f$ is the standard deviation of the Gaussian
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
 
         /**
           Sets the mean of the Gaussian curve
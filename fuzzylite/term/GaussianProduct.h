@@ -86,6 +86,7 @@ namespace fuzzylite {
                 &\mbox{otherwise}\end{cases}@f$
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
 
         /**
           Sets the mean of the first %Gaussian curve
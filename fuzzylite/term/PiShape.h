@@ -85,6 +85,9 @@ namespace fuzzylite {
                 @f$b_r@f$ is the bottom right of the PiShape,
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
+
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
 
         /**
           Sets the bottom-left value of the curve
@@ -89,6 +89,9 @@ namespace fuzzylite {
                 @f$e@f$ is the end of the Ramp
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
+
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
 
         /**
         Computes the tsukamoto value of the monotonic term for activation degree @f$y@f$.
@@ -70,6 +70,8 @@ namespace fuzzylite {
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
 
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
+
         /**
           Sets the start of the rectangle
           @param start is the start of the rectangle
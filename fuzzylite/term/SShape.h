@@ -71,6 +71,9 @@ namespace fuzzylite {
                 @f$e@f$ is the end of the SShape.
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
+
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
 
         /**
         Compute the tsukamoto value of the monotonic term for activation degree @f$y@f$.
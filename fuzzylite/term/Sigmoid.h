@@ -77,6 +77,7 @@ namespace fuzzylite {
                 @f$i@f$ is the inflection of the Sigmoid
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
 
         /**
         Compute the tsukamoto value of the monotonic term for activation degree @f$y@f$.
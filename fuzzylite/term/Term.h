@@ -20,6 +20,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include <cmath>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "fuzzylite/Operation.h"
@@ -121,6 +122,29 @@ namespace fuzzylite {
          */
         virtual scalar membership(scalar x) const = 0;
 
+        /**
+          Computes the membership function values at the given values of
+          @f$x@f$, that is, `y[i] = membership(x[i])` for each @f$i < n@f$.
+          The terms override this method to compute the values in a loop
+          free of virtual calls over the kernel shared with
+          Term::membership(), and otherwise the values are computed one at a
+          time. The arrays `x` and `y` can be the same array
+          @param x is the array of @f$n@f$ values
+          @param y is the array where the @f$n@f$ membership function values
+          are stored
+          @param n is the number of values
+         */
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const;
+
+        /**
+          Computes the support of the term, that is, the interval
+          @f$[a, b]@f$ outside of which the membership function is zero. The
+          interval may be wider than the actual support, but never narrower.
+          @return the support of the term as the pair @f$(a, b)@f$, which is
+          @f$(-\infty, \infty)@f$ unless the term overrides this method
+         */
+        virtual std::pair<scalar, scalar> support() const;
+
         /**
           Creates a clone of the term
           @return a clone of the term
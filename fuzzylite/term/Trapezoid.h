@@ -79,6 +79,9 @@ namespace fuzzylite {
                 @f$d@f$ is the fourth vertex of the Trapezoid
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
+
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
 
         /**
           Sets the first vertex of the trapezoid
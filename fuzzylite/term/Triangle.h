@@ -78,6 +78,9 @@ namespace fuzzylite {
                 @f$c@f$ is the third vertex of the Triangle
          */
         virtual scalar membership(scalar x) const FL_IOVERRIDE;
+        virtual void membershipBatch(const scalar* x, scalar* y, std::size_t n) const FL_IOVERRIDE;
+
+        virtual std::pair<scalar, scalar> support() const FL_IOVERRIDE;
 
         /**
           Sets the first vertex of the triangle
@@ -33,11 +33,75 @@ namespace fuzzylite {
       @since 4.0
      */
     class FL_API InputVariable : public Variable {
+      private:
+        bool _caching;
+        scalar _cachedValue;
+        std::vector<scalar> _cachedMemberships;
+        std::vector<bool> _cached;
+        std::size_t _savedMembershipCalls;
+
       public:
         explicit InputVariable(const std::string& name = "", scalar minimum = -fl::inf, scalar maximum = fl::inf);
         virtual ~InputVariable() FL_IOVERRIDE;
         FL_DEFAULT_COPY_AND_MOVE(InputVariable)
 
+        /**
+          Starts caching the membership values of the terms for the current
+          input value, such that InputVariable::membership() evaluates the
+          membership function of each term at most once until the cache is
+          cleared. The Engine caches the memberships of the enabled input
+          variables while activating the rule blocks in Engine::process().
+          @see InputVariable::clearMembershipCache()
+         */
+        virtual void cacheMemberships();
+        /**
+          Stops caching the membership values of the terms and clears the
+          cache
+         */
+        virtual void clearMembershipCache();
+        /**
+          Indicates whether the membership values of the terms are being
+          cached
+          @return whether the membership values of the terms are being cached
+         */
+        virtual bool isCachingMemberships() const;
+
+        /**
+          Computes the membership function of the given term for the current
+          input value. If the memberships are being cached and the term belongs
+          to the variable, the membership function is evaluated only the first
+          time and the cached value is returned thereafter.
+          @param term is the term
+          @return the membership function of the term for the current input
+          value
+         */
+        virtual scalar membership(const Term* term);
+        /**
+          Computes the membership function of the given term for the current
+          input value as in InputVariable::membership(const Term*), where the
+          cached value is found at the given position of the term in the
+          variable, which is otherwise searched for if the terms have changed
+          since the position was resolved (e.g., by a loaded Antecedent)
+          @param term is the term
+          @param index is the position of the term in the variable
+          @return the membership function of the term for the current input
+          value
+         */
+        virtual scalar membership(const Term* term, std::size_t index);
+
+        /**
+          Gets the number of evaluations of membership functions that were
+          saved by returning cached values
+          @return the number of evaluations of membership functions that were
+          saved by returning cached values
+         */
+        virtual std::size_t getSavedMembershipCalls() const;
+        /**
+          Resets the number of evaluations of membership functions that were
+          saved by returning cached values
+         */
+        virtual void resetSavedMembershipCalls();
+
         /**
           Evaluates the membership function of the current input value @f$x@f$
           for each term @f$i@f$, resulting in a fuzzy input value in the form
@@ -110,6 +110,38 @@ namespace fuzzylite {
         virtual void setMinimum(scalar minimum) FL_IOVERRIDE;
         virtual void setMaximum(scalar maximum) FL_IOVERRIDE;
 
+        /**
+          Adds the term to the variable and assigns it a slot in the fuzzy
+          output value (see Aggregated::indexTerms())
+          @param term is the term to add
+         */
+        virtual void addTerm(Term* term) FL_IOVERRIDE;
+        /**
+          Inserts the term in the variable and assigns it a slot in the fuzzy
+          output value (see Aggregated::indexTerms())
+          @param term is the term to insert
+          @param index is the index where the term will be inserted
+         */
+        virtual void insertTerm(Term* term, std::size_t index) FL_IOVERRIDE;
+        /**
+          Removes the term at the given index and releases its slot in the
+          fuzzy output value (see Aggregated::indexTerms())
+          @param index the index of the term to remove
+          @return the removed term
+         */
+        virtual Term* removeTerm(std::size_t index) FL_IOVERRIDE;
+        /**
+          Sets the terms of the variable and assigns them a slot in the fuzzy
+          output value (see Aggregated::indexTerms())
+          @param terms is a vector of terms
+         */
+        virtual void setTerms(const std::vector<Term*>& terms) FL_IOVERRIDE;
+        /**
+          Rebuilds the index of the terms by name and assigns the terms a
+          slot in the fuzzy output value (see Aggregated::indexTerms())
+         */
+        virtual void rebuildIndex() FL_IOVERRIDE;
+
         /**
           Sets the defuzzifier of the output variable
           @param defuzzifier is the defuzzifier of the output variable
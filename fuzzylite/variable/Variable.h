@@ -21,6 +21,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include <string>
 #include <vector>
 
+#include "fuzzylite/NameIndex.h"
 #include "fuzzylite/defuzzifier/Centroid.h"
 #include "fuzzylite/fuzzylite.h"
 
@@ -54,6 +55,8 @@ namespace fuzzylite {
         bool _lockValueInRange;
 
       private:
+        NameIndex _termIndex;
+
         void copyFrom(const Variable& source);
 
       public:
@@ -239,7 +242,9 @@ namespace fuzzylite {
          */
         virtual Term* getTerm(std::size_t index) const;
         /**
-          Gets the term of the given name.
+          Gets the term of the given name, which is found in constant time
+          using an index of the terms (see NameIndex) that the variable updates
+          when it modifies the terms
           @param name is the name of the term to retrieve
           @return the term of the given name
           @throws Exception if the term is not found
@@ -273,10 +278,18 @@ namespace fuzzylite {
          */
         virtual const std::vector<Term*>& terms() const;
         /**
-          Gets a mutable vector of the terms
+          Gets a mutable vector of the terms. After modifying the vector or
+          renaming its terms, the index of the terms must be rebuilt (see
+          Variable::rebuildIndex())
           @return a mutable vector of terms
          */
         virtual std::vector<Term*>& terms();
+        /**
+          Rebuilds the index of the terms by name (see NameIndex), which is
+          needed after renaming the terms or modifying the mutable vector of
+          terms, as otherwise finding those terms by name takes linear time
+         */
+        virtual void rebuildIndex();
         /**
           Creates a clone of the variable
           @return a clone of the variable
@@ -17,8 +17,10 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/Benchmark.h"
 
+#include "fuzzylite/CompiledEngine.h"
 #include "fuzzylite/Engine.h"
 #include "fuzzylite/Operation.h"
+#include "fuzzylite/defuzzifier/IntegralDefuzzifier.h"
 #include "fuzzylite/rule/Rule.h"
 #include "fuzzylite/rule/RuleBlock.h"
 #include "fuzzylite/variable/InputVariable.h"
@@ -35,7 +37,9 @@ namespace fuzzylite {
     Benchmark::Benchmark(const std::string& name, Engine* engine, scalar tolerance) :
         _name(name),
         _engine(engine),
-        _tolerance(tolerance) {}
+        _tolerance(tolerance),
+        _evaluation(Interpreted),
+        _countingSamples(false) {}
 
     Benchmark::~Benchmark() {}
 
@@ -79,6 +83,22 @@ namespace fuzzylite {
         return this->_times;
     }
 
+    void Benchmark::setSamples(const std::vector<scalar>& samples) {
+        this->_samples = samples;
+    }
+
+    const std::vector<scalar>& Benchmark::getSamples() const {
+        return this->_samples;
+    }
+
+    void Benchmark::setCountingSamples(bool countingSamples) {
+        this->_countingSamples = countingSamples;
+    }
+
+    bool Benchmark::isCountingSamples() const {
+        return this->_countingSamples;
+    }
+
     void Benchmark::setTolerance(scalar tolerance) {
         this->_tolerance = tolerance;
     }
@@ -87,6 +107,14 @@ namespace fuzzylite {
         return this->_tolerance;
     }
 
+    void Benchmark::setEvaluation(Evaluation evaluation) {
+        this->_evaluation = evaluation;
+    }
+
+    Benchmark::Evaluation Benchmark::getEvaluation() const {
+        return this->_evaluation;
+    }
+
     void Benchmark::prepare(int values, FldExporter::ScopeOfValues scope) {
         if (not _engine)
             throw Exception("[benchmark error] engine not set before preparing for values and scope", FL_AT);
@@ -136,6 +164,23 @@ namespace fuzzylite {
         }
     }
 
+    namespace {
+        // processes the compiled engine with the input values of the expected values as in Benchmark::run()
+        template <typename T>
+        void process(
+            BasicCompiledEngine<T>* compiled, const std::vector<scalar>& expected, std::vector<scalar>& obtained
+        ) {
+            const std::size_t offset = compiled->numberOfInputVariables();
+            for (std::size_t i = 0; i < offset; ++i) {
+                compiled->setInputValue(i, T(expected[i]));
+                obtained[i] = expected[i];
+            }
+            compiled->process();
+            for (std::size_t i = 0; i < compiled->numberOfOutputVariables(); ++i)
+                obtained[i + offset] = compiled->getOutputValue(i);
+        }
+    }
+
     scalar Benchmark::runOnce() {
         return run(1).front();
     }
@@ -145,15 +190,40 @@ namespace fuzzylite {
             throw Exception("[benchmark error] engine not set for benchmark", FL_AT);
         std::vector<scalar> runTimes(times, fl::nan);
         const std::size_t offset(_engine->inputVariables().size());
+        // the compiled engines do not report their samples, so they are not counted
+        const bool countingSamples = _countingSamples and _evaluation == Interpreted;
+        std::vector<const IntegralDefuzzifier*> integrals;
+        if (not countingSamples) {
+            _samples.clear();
+        } else {
+            integrals.resize(_engine->outputVariables().size());
+            for (std::size_t i = 0; i < integrals.size(); ++i)
+                integrals.at(i)
+                    = dynamic_cast<const IntegralDefuzzifier*>(_engine->getOutputVariable(i)->getDefuzzifier());
+            if (_samples.size() != integrals.size())
+                _samples = std::vector<scalar>(integrals.size(), 0.0);
+        }
+        FL_unique_ptr<BasicCompiledEngine<double> > doublePrecision;
+        FL_unique_ptr<BasicCompiledEngine<float> > singlePrecision;
+        if (_evaluation == DoublePrecision)
+            doublePrecision.reset(new BasicCompiledEngine<double>(_engine));
+        else if (_evaluation == SinglePrecision)
+            singlePrecision.reset(new BasicCompiledEngine<float>(_engine));
         for (int t = 0; t < times; ++t) {
             _obtained
                 = std::vector<std::vector<scalar> >(_expected.size(), std::vector<scalar>(_engine->variables().size()));
             _engine->restart();
+            if (doublePrecision.get())
+                doublePrecision->restart();
+            if (singlePrecision.get())
+                singlePrecision->restart();
 
 #ifdef FL_CPP98
             // ignore timing
 #else
             auto start = std::chrono::high_resolution_clock::now();
+            // the samples are counted by defuzzifying again, which is excluded from the time
+            std::chrono::high_resolution_clock::duration excluded(0);
 #endif
 
             for (std::size_t evaluation = 0; evaluation < _expected.size(); ++evaluation) {
@@ -170,6 +240,14 @@ namespace fuzzylite {
                        << _engine->inputVariables().size() << "> in the engine";
                     throw Exception(ex.str());
                 }
+                if (doublePrecision.get()) {
+                    process(doublePrecision.get(), expectedValues, obtainedValues);
+                    continue;
+                }
+                if (singlePrecision.get()) {
+                    process(singlePrecision.get(), expectedValues, obtainedValues);
+                    continue;
+                }
                 for (std::size_t i = 0; i < _engine->inputVariables().size(); ++i) {
                     _engine->getInputVariable(i)->setValue(expectedValues[i]);
                     obtainedValues[i] = expectedValues[i];
@@ -179,13 +257,34 @@ namespace fuzzylite {
 
                 for (std::size_t i = 0; i < _engine->outputVariables().size(); ++i)
                     obtainedValues[i + offset] = _engine->getOutputVariable(i)->getValue();
+
+                if (not countingSamples)
+                    continue;
+#ifndef FL_CPP98
+                auto counting = std::chrono::high_resolution_clock::now();
+#endif
+                for (std::size_t i = 0; i < _engine->outputVariables().size(); ++i) {
+                    const OutputVariable* outputVariable = _engine->getOutputVariable(i);
+                    // the defuzzifier is not utilized when the fuzzy output is empty
+                    if (integrals[i] and outputVariable->isEnabled() and not outputVariable->fuzzyOutput()->isEmpty())
+                        _samples[i] += integrals[i]
+                                           ->defuzzification(
+                                               outputVariable->fuzzyOutput(),
+                                               outputVariable->getMinimum(),
+                                               outputVariable->getMaximum()
+                                           )
+                                           .samples;
+                }
+#ifndef FL_CPP98
+                excluded += std::chrono::high_resolution_clock::now() - counting;
+#endif
             }
 
 #ifdef FL_CPP98
             // ignore timing
 #else
             auto end = std::chrono::high_resolution_clock::now();
-            runTimes.at(t) = std::chrono::duration<scalar, std::nano>(end - start).count();
+            runTimes.at(t) = std::chrono::duration<scalar, std::nano>(end - start - excluded).count();
 #endif
         }
         _times.insert(_times.end(), runTimes.begin(), runTimes.end());
@@ -195,6 +294,7 @@ namespace fuzzylite {
     void Benchmark::reset() {
         this->_obtained.clear();
         this->_times.clear();
+        this->_samples.clear();
     }
 
     bool Benchmark::canComputeErrors() const {
@@ -369,10 +469,19 @@ namespace fuzzylite {
         result.push_back(Result("ruleBlocks", Op::str(_engine->numberOfRuleBlocks())));
         std::size_t rules = 0;
         for (std::size_t i = 0; i < _engine->ruleBlocks().size(); ++i)
-            rules += _engine->ruleBlocks().at(i)->rules().size();
+            rules += _engine->ruleBlocks().at(i)->numberOfRules();
         result.push_back(Result("rules", Op::str(rules)));
         result.push_back(Result("runs", Op::str(_times.size())));
         result.push_back(Result("evaluations", Op::str(_expected.size())));
+        scalar samples = 0.0;
+        for (std::size_t i = 0; i < _samples.size() and i < _engine->outputVariables().size(); ++i) {
+            if (outputVariable == fl::null or outputVariable == _engine->getOutputVariable(i))
+                samples += _samples.at(i);
+        }
+        const std::size_t evaluations = _times.size() * _expected.size();
+        result.push_back(
+            Result("samples", Op::str(_samples.empty() ? fl::nan : (evaluations == 0 ? 0.0 : samples / evaluations)))
+        );
         if (canComputeErrors()) {
             std::vector<std::string> names;
             scalar meanRange = 0.0;
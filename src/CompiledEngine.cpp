@@ -0,0 +1,1684 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/CompiledEngine.h"
+
+#include <algorithm>
+#include <queue>
+
+#include "fuzzylite/Engine.h"
+#include "fuzzylite/Kernels.h"
+#include "fuzzylite/activation/First.h"
+#include "fuzzylite/activation/General.h"
+#include "fuzzylite/activation/Highest.h"
+#include "fuzzylite/activation/Last.h"
+#include "fuzzylite/activation/Lowest.h"
+#include "fuzzylite/activation/Proportional.h"
+#include "fuzzylite/activation/Threshold.h"
+#include "fuzzylite/defuzzifier/Bisector.h"
+#include "fuzzylite/defuzzifier/Centroid.h"
+#include "fuzzylite/defuzzifier/IntegralDefuzzifier.h"
+#include "fuzzylite/defuzzifier/WeightedDefuzzifier.h"
+#include "fuzzylite/hedge/Any.h"
+#include "fuzzylite/hedge/Extremely.h"
+#include "fuzzylite/hedge/Not.h"
+#include "fuzzylite/hedge/Seldom.h"
+#include "fuzzylite/hedge/Somewhat.h"
+#include "fuzzylite/hedge/Very.h"
+#include "fuzzylite/norm/SNorm.h"
+#include "fuzzylite/norm/TNorm.h"
+#include "fuzzylite/rule/Antecedent.h"
+#include "fuzzylite/rule/Consequent.h"
+#include "fuzzylite/rule/Expression.h"
+#include "fuzzylite/rule/Rule.h"
+#include "fuzzylite/rule/RuleBlock.h"
+#include "fuzzylite/term/Aggregated.h"
+#include "fuzzylite/term/Bell.h"
+#include "fuzzylite/term/Binary.h"
+#include "fuzzylite/term/Concave.h"
+#include "fuzzylite/term/Constant.h"
+#include "fuzzylite/term/Cosine.h"
+#include "fuzzylite/term/Function.h"
+#include "fuzzylite/term/Gaussian.h"
+#include "fuzzylite/term/GaussianProduct.h"
+#include "fuzzylite/term/Linear.h"
+#include "fuzzylite/term/PiShape.h"
+#include "fuzzylite/term/Ramp.h"
+#include "fuzzylite/term/Rectangle.h"
+#include "fuzzylite/term/SShape.h"
+#include "fuzzylite/term/Sigmoid.h"
+#include "fuzzylite/term/SigmoidDifference.h"
+#include "fuzzylite/term/SigmoidProduct.h"
+#include "fuzzylite/term/Spike.h"
+#include "fuzzylite/term/Trapezoid.h"
+#include "fuzzylite/term/Triangle.h"
+#include "fuzzylite/term/ZShape.h"
+#include "fuzzylite/variable/InputVariable.h"
+#include "fuzzylite/variable/OutputVariable.h"
+
+namespace fuzzylite {
+
+    template <typename T>
+    BasicCompiledEngine<T>::BasicCompiledEngine(const Engine* engine) :
+        _engine(fl::null),
+        _numberOfGroups(0),
+        _resolution(0),
+        _generation(0) {
+        if (engine)
+            compile(engine);
+    }
+
+    template <typename T>
+    BasicCompiledEngine<T>::~BasicCompiledEngine() {
+        for (std::size_t i = 0; i < _functions.size(); ++i)
+            delete _functions.at(i).function;
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::clear() {
+        _parameters.clear();
+        _terms.clear();
+        for (std::size_t i = 0; i < _functions.size(); ++i)
+            delete _functions.at(i).function;
+        _functions.clear();
+        _arguments.clear();
+        _hedges.clear();
+        _code.clear();
+        _conclusions.clear();
+        _rules.clear();
+        _ruleBlocks.clear();
+        _outputs.clear();
+        _inputValues.clear();
+        _inputMinimum.clear();
+        _inputMaximum.clear();
+        _inputLockValueInRange.clear();
+        _outputValues.clear();
+        _previousValues.clear();
+        _samples.clear();
+        _numberOfGroups = 0;
+        _resolution = 0;
+        _context = BasicEvaluationContext<T>();
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::compile(const Engine* engine) {
+        if (not engine)
+            throw Exception("[compile error] expected an engine to compile, but found none", FL_AT);
+        clear();
+        // the contexts created for the previous compilation are sized for its model
+        ++_generation;
+        _engine.reset(engine->clone());
+        try {
+            std::map<const Term*, std::size_t> slots;
+            std::size_t resolution = 0;
+
+            for (std::size_t i = 0; i < _engine->numberOfInputVariables(); ++i) {
+                const InputVariable* inputVariable = _engine->getInputVariable(i);
+                _inputValues.push_back(inputVariable->getValue());
+                _inputMinimum.push_back(inputVariable->getMinimum());
+                _inputMaximum.push_back(inputVariable->getMaximum());
+                _inputLockValueInRange.push_back(inputVariable->isLockValueInRange());
+                for (std::size_t t = 0; t < inputVariable->numberOfTerms(); ++t)
+                    compileTerm(inputVariable->getTerm(t), slots);
+            }
+
+            for (std::size_t i = 0; i < _engine->numberOfOutputVariables(); ++i) {
+                const OutputVariable* outputVariable = _engine->getOutputVariable(i);
+                for (std::size_t t = 0; t < outputVariable->numberOfTerms(); ++t)
+                    _terms.at(compileTerm(outputVariable->getTerm(t), slots)).position = t;
+
+                CompiledOutput output;
+                output.enabled = outputVariable->isEnabled();
+                output.minimum = outputVariable->getMinimum();
+                output.maximum = outputVariable->getMaximum();
+                output.defaultValue = outputVariable->getDefaultValue();
+                output.lockPreviousValue = outputVariable->isLockPreviousValue();
+                output.lockValueInRange = outputVariable->isLockValueInRange();
+                output.aggregation = compileNorm(outputVariable->getAggregation());
+                output.defuzzifier = DefuzzifierNone;
+                output.resolution = 0;
+                output.weightedType = WeightedDefuzzifier::Automatic;
+                output.groups = 0;
+                output.samples = 0;
+
+                const Defuzzifier* defuzzifier = outputVariable->getDefuzzifier();
+                if (defuzzifier) {
+                    const std::string name = defuzzifier->className();
+                    output.defuzzifier = DefuzzifierObject;
+                    if (const IntegralDefuzzifier* integral = dynamic_cast<const IntegralDefuzzifier*>(defuzzifier)) {
+                        output.resolution = integral->getResolution();
+                        // the exact, adaptive, and restricted integrals are computed by the defuzzifier itself
+                        const Centroid* centroid = dynamic_cast<const Centroid*>(defuzzifier);
+                        const Bisector* bisector = dynamic_cast<const Bisector*>(defuzzifier);
+                        if (integral->isRestrictedToSupport())
+                            output.defuzzifier = DefuzzifierObject;
+                        else if (name == "Centroid"
+                            and not(centroid and (centroid->isExact() or centroid->getTolerance() > 0.0)))
+                            output.defuzzifier = DefuzzifierCentroid;
+                        else if (name == "Bisector" and not(bisector and bisector->getTolerance() > 0.0))
+                            output.defuzzifier = DefuzzifierBisector;
+                        else if (name == "MeanOfMaximum")
+                            output.defuzzifier = DefuzzifierMeanOfMaximum;
+                        else if (name == "SmallestOfMaximum")
+                            output.defuzzifier = DefuzzifierSmallestOfMaximum;
+                        else if (name == "LargestOfMaximum")
+                            output.defuzzifier = DefuzzifierLargestOfMaximum;
+                    } else if (const WeightedDefuzzifier* weighted
+                               = dynamic_cast<const WeightedDefuzzifier*>(defuzzifier)) {
+                        output.weightedType = weighted->getType();
+                        if (name == "WeightedAverage")
+                            output.defuzzifier = DefuzzifierWeightedAverage;
+                        else if (name == "WeightedSum")
+                            output.defuzzifier = DefuzzifierWeightedSum;
+                    }
+                }
+                // the samples at which the aggregated membership is integrated, as in IntegralDefuzzifier
+                if (output.resolution > 0 and Op::isFinite(output.minimum + output.maximum)) {
+                    output.samples = _samples.size();
+                    const scalar minimum = outputVariable->getMinimum();
+                    const scalar dx = (outputVariable->getMaximum() - minimum) / output.resolution;
+                    for (int s = 0; s < output.resolution; ++s)
+                        _samples.push_back(T(minimum + (s + 0.5) * dx));
+                    resolution = std::max(resolution, std::size_t(output.resolution));
+                }
+                _outputs.push_back(output);
+                _outputValues.push_back(outputVariable->getValue());
+                _previousValues.push_back(outputVariable->getPreviousValue());
+            }
+
+            for (std::size_t b = 0; b < _engine->numberOfRuleBlocks(); ++b) {
+                const RuleBlock* ruleBlock = _engine->getRuleBlock(b);
+                if (not ruleBlock->isEnabled())
+                    continue;
+                CompiledRuleBlock block;
+                block.conjunction = compileNorm(ruleBlock->getConjunction());
+                block.disjunction = compileNorm(ruleBlock->getDisjunction());
+                block.implication = compileNorm(ruleBlock->getImplication());
+                block.numberOfRules = 0;
+                block.threshold = 0.0;
+                block.comparison = 0;
+
+                const Activation* activation = ruleBlock->getActivation();
+                const std::string name = activation ? activation->className() : General().className();
+                if (name == "General") {
+                    block.activation = ActivationGeneral;
+                } else if (name == "First") {
+                    block.activation = ActivationFirst;
+                    block.numberOfRules = static_cast<const First*>(activation)->getNumberOfRules();
+                    block.threshold = static_cast<const First*>(activation)->getThreshold();
+                } else if (name == "Last") {
+                    block.activation = ActivationLast;
+                    block.numberOfRules = static_cast<const Last*>(activation)->getNumberOfRules();
+                    block.threshold = static_cast<const Last*>(activation)->getThreshold();
+                } else if (name == "Highest") {
+                    block.activation = ActivationHighest;
+                    block.numberOfRules = static_cast<const Highest*>(activation)->getNumberOfRules();
+                } else if (name == "Lowest") {
+                    block.activation = ActivationLowest;
+                    block.numberOfRules = static_cast<const Lowest*>(activation)->getNumberOfRules();
+                } else if (name == "Proportional") {
+                    block.activation = ActivationProportional;
+                } else if (name == "Threshold") {
+                    block.activation = ActivationThreshold;
+                    block.threshold = static_cast<const Threshold*>(activation)->getValue();
+                    block.comparison = static_cast<const Threshold*>(activation)->getComparison();
+                } else {
+                    throw Exception(
+                        "[compile error] activation method <" + name + "> in rule block <" + ruleBlock->getName()
+                            + "> cannot be compiled",
+                        FL_AT
+                    );
+                }
+
+                block.ruleBegin = _rules.size();
+                for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r) {
+                    Rule* rule = ruleBlock->getRule(r);
+                    if (not rule->isLoaded())
+                        continue;
+                    CompiledRule compiled;
+                    compiled.enabled = rule->isEnabled();
+                    compiled.weight = rule->getWeight();
+                    compiled.codeBegin = _code.size();
+                    compileExpression(rule->getAntecedent()->getExpression(), block, rule->getText(), slots);
+                    compiled.codeEnd = _code.size();
+
+                    compiled.conclusionBegin = _conclusions.size();
+                    const std::vector<Proposition*>& conclusions = rule->getConsequent()->conclusions();
+                    for (std::size_t c = 0; c < conclusions.size(); ++c) {
+                        const Proposition* proposition = conclusions.at(c);
+                        if (not proposition->variable->isEnabled())
+                            continue;
+                        Conclusion conclusion;
+                        conclusion.output = _engine->outputVariables().size();
+                        for (std::size_t o = 0; o < _engine->numberOfOutputVariables(); ++o) {
+                            if (_engine->getOutputVariable(o) == proposition->variable) {
+                                conclusion.output = o;
+                                break;
+                            }
+                        }
+                        if (conclusion.output == _engine->outputVariables().size() or not proposition->term)
+                            throw Exception(
+                                "[compile error] conclusion <" + proposition->toString()
+                                    + "> must refer to a term of an output variable of the engine",
+                                FL_AT
+                            );
+                        conclusion.term = compileTerm(proposition->term, slots);
+                        conclusion.hedgeBegin = _hedges.size();
+                        conclusion.hedgeEnd = compileHedges(proposition->hedges);
+                        _conclusions.push_back(conclusion);
+                    }
+                    compiled.conclusionEnd = _conclusions.size();
+                    _rules.push_back(compiled);
+                }
+                block.ruleEnd = _rules.size();
+                _ruleBlocks.push_back(block);
+            }
+
+            // terms of output variables are grouped by name in alphabetical order, as in Aggregated::groupedTerms()
+            std::vector<std::map<std::string, std::size_t> > groups(_outputs.size());
+            for (std::size_t o = 0; o < _outputs.size(); ++o) {
+                const OutputVariable* outputVariable = _engine->getOutputVariable(o);
+                for (std::size_t t = 0; t < outputVariable->numberOfTerms(); ++t)
+                    groups.at(o)[outputVariable->getTerm(t)->getName()] = 0;
+            }
+            for (std::size_t c = 0; c < _conclusions.size(); ++c) {
+                const Conclusion& conclusion = _conclusions.at(c);
+                groups.at(conclusion.output)[_terms.at(conclusion.term).term->getName()] = 0;
+            }
+            std::size_t numberOfGroups = 0;
+            for (std::size_t o = 0; o < _outputs.size(); ++o) {
+                std::size_t group = 0;
+                for (std::map<std::string, std::size_t>::iterator it = groups.at(o).begin(); it != groups.at(o).end();
+                     ++it)
+                    it->second = group++;
+                _outputs.at(o).groups = group;
+                numberOfGroups = std::max(numberOfGroups, group);
+            }
+            for (std::size_t c = 0; c < _conclusions.size(); ++c) {
+                const Conclusion& conclusion = _conclusions.at(c);
+                CompiledTerm& term = _terms.at(conclusion.term);
+                term.group = groups.at(conclusion.output)[term.term->getName()];
+                if (const WeightedDefuzzifier* weighted = dynamic_cast<const WeightedDefuzzifier*>(
+                        _engine->getOutputVariable(conclusion.output)->getDefuzzifier()
+                    ))
+                    term.type = weighted->inferType(term.term);
+            }
+
+            _numberOfGroups = numberOfGroups;
+            _resolution = resolution;
+            _context.reset(this);
+        } catch (...) {
+            clear();
+            _engine.reset(fl::null);
+            throw;
+        }
+    }
+
+    template <typename T>
+    std::size_t BasicCompiledEngine<T>::compileTerm(const Term* term, std::map<const Term*, std::size_t>& slots) {
+        std::map<const Term*, std::size_t>::const_iterator it = slots.find(term);
+        if (it != slots.end())
+            return it->second;
+
+        CompiledTerm compiled;
+        compiled.kind = TermObject;
+        compiled.offset = _parameters.size();
+        compiled.height = term->getHeight();
+        compiled.term = term;
+        compiled.group = 0;
+        compiled.type = WeightedDefuzzifier::Automatic;
+        compiled.position = std::size_t(-1);
+        compiled.function = std::size_t(-1);
+
+        const std::string name = term->className();
+        if (name == "Triangle") {
+            const Triangle* triangle = static_cast<const Triangle*>(term);
+            compiled.kind = TermTriangle;
+            _parameters.push_back(triangle->getVertexA());
+            _parameters.push_back(triangle->getVertexB());
+            _parameters.push_back(triangle->getVertexC());
+        } else if (name == "Trapezoid") {
+            const Trapezoid* trapezoid = static_cast<const Trapezoid*>(term);
+            compiled.kind = TermTrapezoid;
+            _parameters.push_back(trapezoid->getVertexA());
+            _parameters.push_back(trapezoid->getVertexB());
+            _parameters.push_back(trapezoid->getVertexC());
+            _parameters.push_back(trapezoid->getVertexD());
+        } else if (name == "Rectangle") {
+            const Rectangle* rectangle = static_cast<const Rectangle*>(term);
+            compiled.kind = TermRectangle;
+            _parameters.push_back(rectangle->getStart());
+            _parameters.push_back(rectangle->getEnd());
+        } else if (name == "Gaussian") {
+            const Gaussian* gaussian = static_cast<const Gaussian*>(term);
+            compiled.kind = TermGaussian;
+            _parameters.push_back(gaussian->getMean());
+            _parameters.push_back(gaussian->getStandardDeviation());
+        } else if (name == "GaussianProduct") {
+            const GaussianProduct* gaussianProduct = static_cast<const GaussianProduct*>(term);
+            compiled.kind = TermGaussianProduct;
+            _parameters.push_back(gaussianProduct->getMeanA());
+            _parameters.push_back(gaussianProduct->getStandardDeviationA());
+            _parameters.push_back(gaussianProduct->getMeanB());
+            _parameters.push_back(gaussianProduct->getStandardDeviationB());
+        } else if (name == "Bell") {
+            const Bell* bell = static_cast<const Bell*>(term);
+            compiled.kind = TermBell;
+            _parameters.push_back(bell->getCenter());
+            _parameters.push_back(bell->getWidth());
+            _parameters.push_back(bell->getSlope());
+        } else if (name == "Sigmoid") {
+            const Sigmoid* sigmoid = static_cast<const Sigmoid*>(term);
+            compiled.kind = TermSigmoid;
+            _parameters.push_back(sigmoid->getInflection());
+            _parameters.push_back(sigmoid->getSlope());
+        } else if (name == "SShape") {
+            const SShape* sShape = static_cast<const SShape*>(term);
+            compiled.kind = TermSShape;
+            _parameters.push_back(sShape->getStart());
+            _parameters.push_back(sShape->getEnd());
+        } else if (name == "ZShape") {
+            const ZShape* zShape = static_cast<const ZShape*>(term);
+            compiled.kind = TermZShape;
+            _parameters.push_back(zShape->getStart());
+            _parameters.push_back(zShape->getEnd());
+        } else if (name == "PiShape") {
+            const PiShape* piShape = static_cast<const PiShape*>(term);
+            compiled.kind = TermPiShape;
+            _parameters.push_back(piShape->getBottomLeft());
+            _parameters.push_back(piShape->getTopLeft());
+            _parameters.push_back(piShape->getTopRight());
+            _parameters.push_back(piShape->getBottomRight());
+        } else if (name == "Ramp") {
+            const Ramp* ramp = static_cast<const Ramp*>(term);
+            compiled.kind = TermRamp;
+            _parameters.push_back(ramp->getStart());
+            _parameters.push_back(ramp->getEnd());
+        } else if (name == "Concave") {
+            const Concave* concave = static_cast<const Concave*>(term);
+            compiled.kind = TermConcave;
+            _parameters.push_back(concave->getInflection());
+            _parameters.push_back(concave->getEnd());
+        } else if (name == "Cosine") {
+            const Cosine* cosine = static_cast<const Cosine*>(term);
+            compiled.kind = TermCosine;
+            _parameters.push_back(cosine->getCenter());
+            _parameters.push_back(cosine->getWidth());
+        } else if (name == "Spike") {
+            const Spike* spike = static_cast<const Spike*>(term);
+            compiled.kind = TermSpike;
+            _parameters.push_back(spike->getCenter());
+            _parameters.push_back(spike->getWidth());
+        } else if (name == "SigmoidDifference") {
+            const SigmoidDifference* sigmoidDifference = static_cast<const SigmoidDifference*>(term);
+            compiled.kind = TermSigmoidDifference;
+            _parameters.push_back(sigmoidDifference->getLeft());
+            _parameters.push_back(sigmoidDifference->getRising());
+            _parameters.push_back(sigmoidDifference->getFalling());
+            _parameters.push_back(sigmoidDifference->getRight());
+        } else if (name == "SigmoidProduct") {
+            const SigmoidProduct* sigmoidProduct = static_cast<const SigmoidProduct*>(term);
+            compiled.kind = TermSigmoidProduct;
+            _parameters.push_back(sigmoidProduct->getLeft());
+            _parameters.push_back(sigmoidProduct->getRising());
+            _parameters.push_back(sigmoidProduct->getFalling());
+            _parameters.push_back(sigmoidProduct->getRight());
+        } else if (name == "Binary") {
+            const Binary* binary = static_cast<const Binary*>(term);
+            compiled.kind = TermBinary;
+            _parameters.push_back(binary->getStart());
+            _parameters.push_back(binary->getDirection());
+        } else if (name == "Constant") {
+            compiled.kind = TermConstant;
+            _parameters.push_back(static_cast<const Constant*>(term)->getValue());
+        } else if (name == "Linear") {
+            const Linear* linear = static_cast<const Linear*>(term);
+            if (linear->getEngine() == _engine.get()) {
+                compiled.kind = TermLinear;
+                _parameters.insert(_parameters.end(), linear->coefficients().begin(), linear->coefficients().end());
+            }
+        } else if (name == "Function") {
+            const Function* function = static_cast<const Function*>(term);
+            if (function->isLoaded() and (function->getEngine() == _engine.get() or not function->getEngine())) {
+                compiled.kind = TermFunction;
+                compiled.function = compileFunction(function);
+            }
+        }
+        compiled.size = _parameters.size() - compiled.offset;
+
+        const std::size_t slot = _terms.size();
+        _terms.push_back(compiled);
+        slots[term] = slot;
+        return slot;
+    }
+
+    namespace {
+        // Adds the names of the variables in the expression tree under the node, once each
+        void variablesOf(const Function::Node* node, std::vector<std::string>& names) {
+            if (not node)
+                return;
+            variablesOf(node->left.get(), names);
+            variablesOf(node->right.get(), names);
+            if (not node->variable.empty() and std::find(names.begin(), names.end(), node->variable) == names.end())
+                names.push_back(node->variable);
+        }
+    }
+
+    template <typename T>
+    std::size_t BasicCompiledEngine<T>::compileFunction(const Function* function) {
+        // the variables of the engine are bound to the arguments of a copy of the function, which
+        // reads their values from the context, and the other variables are read from its map
+        CompiledFunction compiled;
+        compiled.argumentBegin = _arguments.size();
+        std::vector<std::string> names;
+        if (function->getEngine()) {
+            std::vector<std::string> variables;
+            variablesOf(function->root(), variables);
+            for (std::size_t v = 0; v < variables.size(); ++v) {
+                // x takes precedence over the variables, and the last output or input variable with the name is read
+                const std::string& name = variables.at(v);
+                if (name == "x")
+                    continue;
+                CompiledArgument argument;
+                bool found = false;
+                for (std::size_t i = _engine->numberOfOutputVariables(); i > 0 and not found; --i) {
+                    if (_engine->getOutputVariable(i - 1)->getName() == name) {
+                        argument.output = true;
+                        argument.variable = i - 1;
+                        found = true;
+                    }
+                }
+                for (std::size_t i = _engine->numberOfInputVariables(); i > 0 and not found; --i) {
+                    if (_engine->getInputVariable(i - 1)->getName() == name) {
+                        argument.output = false;
+                        argument.variable = i - 1;
+                        found = true;
+                    }
+                }
+                if (found) {
+                    names.push_back(name);
+                    _arguments.push_back(argument);
+                }
+            }
+        }
+        compiled.argumentEnd = _arguments.size();
+        compiled.function = function->clone();
+        try {
+            compiled.function->setEngine(fl::null);
+            compiled.function->setArguments(names);
+        } catch (...) {
+            delete compiled.function;
+            throw;
+        }
+        _functions.push_back(compiled);
+        return _functions.size() - 1;
+    }
+
+    template <typename T>
+    std::size_t BasicCompiledEngine<T>::compileHedges(const std::vector<Hedge*>& hedges) {
+        // hedges are applied in reverse order
+        for (std::vector<Hedge*>::const_reverse_iterator rit = hedges.rbegin(); rit != hedges.rend(); ++rit) {
+            CompiledHedge compiled;
+            compiled.hedge = *rit;
+            compiled.kind = HedgeObject;
+            if (dynamic_cast<const Any*>(compiled.hedge))
+                compiled.kind = HedgeAny;
+            else if (dynamic_cast<const Not*>(compiled.hedge))
+                compiled.kind = HedgeNot;
+            else if (dynamic_cast<const Very*>(compiled.hedge))
+                compiled.kind = HedgeVery;
+            else if (dynamic_cast<const Somewhat*>(compiled.hedge))
+                compiled.kind = HedgeSomewhat;
+            else if (dynamic_cast<const Extremely*>(compiled.hedge))
+                compiled.kind = HedgeExtremely;
+            else if (dynamic_cast<const Seldom*>(compiled.hedge))
+                compiled.kind = HedgeSeldom;
+            _hedges.push_back(compiled);
+        }
+        return _hedges.size();
+    }
+
+    template <typename T>
+    typename BasicCompiledEngine<T>::CompiledNorm BasicCompiledEngine<T>::compileNorm(const Norm* norm) const {
+        CompiledNorm compiled;
+        compiled.norm = norm;
+        compiled.kind = NormNone;
+        if (not norm)
+            return compiled;
+        compiled.kind = NormObject;
+        const std::string name = norm->className();
+        if (name == "Minimum")
+            compiled.kind = NormMinimum;
+        else if (name == "AlgebraicProduct")
+            compiled.kind = NormAlgebraicProduct;
+        else if (name == "BoundedDifference")
+            compiled.kind = NormBoundedDifference;
+        else if (name == "DrasticProduct")
+            compiled.kind = NormDrasticProduct;
+        else if (name == "EinsteinProduct")
+            compiled.kind = NormEinsteinProduct;
+        else if (name == "HamacherProduct")
+            compiled.kind = NormHamacherProduct;
+        else if (name == "NilpotentMinimum")
+            compiled.kind = NormNilpotentMinimum;
+        else if (name == "Maximum")
+            compiled.kind = NormMaximum;
+        else if (name == "AlgebraicSum")
+            compiled.kind = NormAlgebraicSum;
+        else if (name == "BoundedSum")
+            compiled.kind = NormBoundedSum;
+        else if (name == "DrasticSum")
+            compiled.kind = NormDrasticSum;
+        else if (name == "EinsteinSum")
+            compiled.kind = NormEinsteinSum;
+        else if (name == "HamacherSum")
+            compiled.kind = NormHamacherSum;
+        else if (name == "NilpotentMaximum")
+            compiled.kind = NormNilpotentMaximum;
+        else if (name == "NormalizedSum")
+            compiled.kind = NormNormalizedSum;
+        else if (name == "UnboundedSum")
+            compiled.kind = NormUnboundedSum;
+        return compiled;
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::compileExpression(
+        const Expression* node,
+        const CompiledRuleBlock& ruleBlock,
+        const std::string& text,
+        std::map<const Term*, std::size_t>& slots
+    ) {
+        if (not node)
+            throw Exception("[compile error] antecedent <" + text + "> is not loaded", FL_AT);
+
+        if (node->type() == Expression::Proposition) {
+            const Proposition* proposition = static_cast<const Proposition*>(node);
+            Instruction instruction;
+            instruction.opcode = OpConstant;
+            instruction.variable = 0;
+            instruction.term = 0;
+            instruction.value = fl::nan;
+            instruction.hedgeBegin = _hedges.size();
+            instruction.hedgeEnd = _hedges.size();
+
+            if (not proposition->variable->isEnabled()) {
+                instruction.value = 0.0;
+                _code.push_back(instruction);
+                return;
+            }
+
+            const bool any = not proposition->hedges.empty()
+                             and dynamic_cast<const Any*>(proposition->hedges.back());
+            if (not any) {
+                const Variable::Type variableType = proposition->variable->type();
+                if (variableType == Variable::Input or variableType == Variable::Output) {
+                    if (not proposition->term)
+                        throw Exception(
+                            "[compile error] proposition <" + proposition->toString() + "> requires a term", FL_AT
+                        );
+                    std::vector<Variable*> variables;
+                    if (variableType == Variable::Input) {
+                        instruction.opcode = OpInput;
+                        variables.assign(_engine->inputVariables().begin(), _engine->inputVariables().end());
+                    } else {
+                        instruction.opcode = OpOutput;
+                        variables.assign(_engine->outputVariables().begin(), _engine->outputVariables().end());
+                    }
+                    instruction.variable = variables.size();
+                    for (std::size_t i = 0; i < variables.size(); ++i) {
+                        if (variables.at(i) == proposition->variable) {
+                            instruction.variable = i;
+                            break;
+                        }
+                    }
+                    if (instruction.variable == variables.size())
+                        throw Exception(
+                            "[compile error] proposition <" + proposition->toString()
+                                + "> refers to a variable that is not in the engine",
+                            FL_AT
+                        );
+                    instruction.term = compileTerm(proposition->term, slots);
+                }
+            }
+            instruction.hedgeEnd = compileHedges(proposition->hedges);
+            _code.push_back(instruction);
+            return;
+        }
+
+        if (node->type() == Expression::Operator) {
+            const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+            if (not(fuzzyOperator->left and fuzzyOperator->right))
+                throw Exception("[syntax error] left and right operands must exist", FL_AT);
+            Instruction instruction;
+            instruction.variable = 0;
+            instruction.term = 0;
+            instruction.hedgeBegin = 0;
+            instruction.hedgeEnd = 0;
+            instruction.value = fl::nan;
+            if (fuzzyOperator->name == Rule::andKeyword()) {
+                if (ruleBlock.conjunction.kind == NormNone)
+                    throw Exception(
+                        "[conjunction error] "
+                        "the following rule requires a conjunction operator:\n"
+                            + text,
+                        FL_AT
+                    );
+                instruction.opcode = OpAnd;
+            } else if (fuzzyOperator->name == Rule::orKeyword()) {
+                if (ruleBlock.disjunction.kind == NormNone)
+                    throw Exception(
+                        "[disjunction error] "
+                        "the following rule requires a disjunction operator:\n"
+                            + text,
+                        FL_AT
+                    );
+                instruction.opcode = OpOr;
+            } else {
+                throw Exception("[syntax error] operator <" + fuzzyOperator->name + "> not recognized", FL_AT);
+            }
+            compileExpression(fuzzyOperator->left, ruleBlock, text, slots);
+            compileExpression(fuzzyOperator->right, ruleBlock, text, slots);
+            _code.push_back(instruction);
+            return;
+        }
+
+        throw Exception("[antecedent error] expected a Proposition or Operator, but found <" + node->toString() + ">", FL_AT);
+    }
+
+    template <typename T>
+    bool BasicCompiledEngine<T>::isCompiled() const {
+        return _engine.get() != fl::null;
+    }
+
+    template <typename T>
+    const Engine* BasicCompiledEngine<T>::getEngine() const {
+        return this->_engine.get();
+    }
+
+    template <typename T>
+    std::size_t BasicCompiledEngine<T>::numberOfInputVariables() const {
+        return _inputValues.size();
+    }
+
+    template <typename T>
+    std::size_t BasicCompiledEngine<T>::numberOfOutputVariables() const {
+        return _outputValues.size();
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::setInputValue(std::size_t index, T value) {
+        _context.setInputValue(index, value);
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::getInputValue(std::size_t index) const {
+        return _context.getInputValue(index);
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::getOutputValue(std::size_t index) const {
+        return _context.getOutputValue(index);
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::getPreviousOutputValue(std::size_t index) const {
+        return _context.getPreviousOutputValue(index);
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::restart() {
+        _context.restart();
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::checkContext(const BasicEvaluationContext<T>& context) const {
+        if (not isCompiled())
+            throw Exception("[compile error] the engine has not been compiled", FL_AT);
+        if (context._engine != this)
+            throw Exception("[context error] the context does not evaluate this compiled engine", FL_AT);
+        if (context._generation != _generation)
+            throw Exception(
+                "[context error] the context was created before the engine was last compiled, "
+                "so it must be reset to evaluate the engine",
+                FL_AT
+            );
+    }
+
+    template <typename T>
+    BasicEvaluationContext<T>* BasicCompiledEngine<T>::createContext() const {
+        return new BasicEvaluationContext<T>(this);
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::initialize(BasicEvaluationContext<T>& context) const {
+        context._generation = _generation;
+        context._inputValues = _inputValues;
+        context._outputValues = _outputValues;
+        context._previousValues = _previousValues;
+        context._activationDegrees.assign(_rules.size(), 0.0);
+        context._activatedTerms.assign(_outputs.size(), std::vector<ActivatedTerm>());
+        context._groupDegrees.assign(_numberOfGroups, fl::nan);
+        context._groupTerms.assign(_numberOfGroups, _terms.size());
+        context._stack.clear();
+        context._memberships.assign(_resolution, fl::nan);
+        context._aggregated.assign(_resolution, fl::nan);
+        context._arguments.assign(_arguments.size(), fl::nan);
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::boundInputValue(std::size_t index, T value) const {
+        return _inputLockValueInRange.at(index) ? Op::bound(value, _inputMinimum.at(index), _inputMaximum.at(index))
+                                                : value;
+    }
+
+    namespace {
+        // membership functions of the terms, where p are the parameters of the term and h is its height
+
+        template <typename T>
+        inline T triangle(const T* p, T h, T x) {
+            return kernel::triangle(p[0], p[1], p[2], h, x);
+        }
+
+        template <typename T>
+        inline T trapezoid(const T* p, T h, T x) {
+            return kernel::trapezoid(p[0], p[1], p[2], p[3], h, x);
+        }
+
+        template <typename T>
+        inline T rectangle(const T* p, T h, T x) {
+            return kernel::rectangle(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T gaussian(const T* p, T h, T x) {
+            return kernel::gaussian(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T gaussianProduct(const T* p, T h, T x) {
+            return kernel::gaussianProduct(p[0], p[1], p[2], p[3], h, x);
+        }
+
+        template <typename T>
+        inline T bell(const T* p, T h, T x) {
+            return kernel::bell(p[0], p[1], p[2], h, x);
+        }
+
+        template <typename T>
+        inline T sigmoid(const T* p, T h, T x) {
+            return kernel::sigmoid(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T sShape(const T* p, T h, T x) {
+            return kernel::sShape(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T zShape(const T* p, T h, T x) {
+            return kernel::zShape(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T piShape(const T* p, T h, T x) {
+            return kernel::piShape(p[0], p[1], p[2], p[3], h, x);
+        }
+
+        template <typename T>
+        inline T ramp(const T* p, T h, T x) {
+            return kernel::ramp(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T concave(const T* p, T h, T x) {
+            return kernel::concave(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T cosine(const T* p, T h, T x) {
+            return kernel::cosine(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T spike(const T* p, T h, T x) {
+            return kernel::spike(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T sigmoidDifference(const T* p, T h, T x) {
+            return kernel::sigmoidDifference(p[0], p[1], p[2], p[3], h, x);
+        }
+
+        template <typename T>
+        inline T sigmoidProduct(const T* p, T h, T x) {
+            return kernel::sigmoidProduct(p[0], p[1], p[2], p[3], h, x);
+        }
+
+        template <typename T>
+        inline T binary(const T* p, T h, T x) {
+            return kernel::binary(p[0], p[1], h, x);
+        }
+
+        template <typename T>
+        inline T constant(const T* p, T h, T x) {
+            FL_IUNUSED(h);
+            FL_IUNUSED(x);
+            return p[0];
+        }
+
+        template <typename T, T (*kernel)(const T*, T, T)>
+        inline void memberships(const T* p, T h, const T* x, T* y, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                y[i] = kernel(p, h, x[i]);
+        }
+
+        // norms
+
+        using kernel::minimum;
+        using kernel::algebraicProduct;
+        using kernel::boundedDifference;
+        using kernel::drasticProduct;
+        using kernel::einsteinProduct;
+        using kernel::hamacherProduct;
+        using kernel::nilpotentMinimum;
+        using kernel::maximum;
+        using kernel::algebraicSum;
+        using kernel::boundedSum;
+        using kernel::drasticSum;
+        using kernel::einsteinSum;
+        using kernel::hamacherSum;
+        using kernel::nilpotentMaximum;
+        using kernel::normalizedSum;
+        using kernel::unboundedSum;
+
+        template <typename T>
+        inline T element(T b, std::size_t i) {
+            FL_IUNUSED(i);
+            return b;
+        }
+
+        template <typename T>
+        inline T element(const T* b, std::size_t i) {
+            return b[i];
+        }
+
+        template <typename T, T (*kernel)(T, T)>
+        inline void computes(const T* a, T b, T* y, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                y[i] = kernel(a[i], b);
+        }
+
+        template <typename T, T (*kernel)(T, T)>
+        inline void computes(const T* a, const T* b, T* y, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                y[i] = kernel(a[i], b[i]);
+        }
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::membership(const BasicEvaluationContext<T>& context, std::size_t term, T x) const {
+        const CompiledTerm& compiled = _terms[term];
+        const T* p = &_parameters[0] + compiled.offset;
+        const T h = compiled.height;
+        switch (compiled.kind) {
+            case TermTriangle:
+                return triangle(p, h, x);
+            case TermTrapezoid:
+                return trapezoid(p, h, x);
+            case TermRectangle:
+                return rectangle(p, h, x);
+            case TermGaussian:
+                return gaussian(p, h, x);
+            case TermGaussianProduct:
+                return gaussianProduct(p, h, x);
+            case TermBell:
+                return bell(p, h, x);
+            case TermSigmoid:
+                return sigmoid(p, h, x);
+            case TermSShape:
+                return sShape(p, h, x);
+            case TermZShape:
+                return zShape(p, h, x);
+            case TermPiShape:
+                return piShape(p, h, x);
+            case TermRamp:
+                return ramp(p, h, x);
+            case TermConcave:
+                return concave(p, h, x);
+            case TermCosine:
+                return cosine(p, h, x);
+            case TermSpike:
+                return spike(p, h, x);
+            case TermSigmoidDifference:
+                return sigmoidDifference(p, h, x);
+            case TermSigmoidProduct:
+                return sigmoidProduct(p, h, x);
+            case TermBinary:
+                return binary(p, h, x);
+            case TermConstant:
+                return constant(p, h, x);
+
+            case TermLinear: {
+                T result = 0.0;
+                const std::size_t numberOfInputVariables = context._inputValues.size();
+                const std::size_t numberOfCoefficients = compiled.size;
+                for (std::size_t i = 0; i < numberOfInputVariables; ++i)
+                    if (i < numberOfCoefficients)
+                        result += p[i] * context._inputValues[i];
+                if (numberOfCoefficients > numberOfInputVariables)
+                    result += p[numberOfCoefficients - 1];
+                return result;
+            }
+
+            case TermFunction: {
+                const CompiledFunction& function = _functions[compiled.function];
+                scalar* arguments = fl::null;
+                if (function.argumentEnd > function.argumentBegin) {
+                    arguments = &context._arguments[function.argumentBegin];
+                    for (std::size_t i = function.argumentBegin; i < function.argumentEnd; ++i) {
+                        const CompiledArgument& argument = _arguments[i];
+                        arguments[i - function.argumentBegin] = argument.output
+                                                                    ? context._outputValues[argument.variable]
+                                                                    : context._inputValues[argument.variable];
+                    }
+                }
+                return T(function.function->evaluate(scalar(x), arguments));
+            }
+
+            default:
+                return compiled.term->membership(x);
+        }
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::membership(
+        const BasicEvaluationContext<T>& context, std::size_t term, const T* x, T* y, std::size_t n
+    ) const {
+        const CompiledTerm& compiled = _terms[term];
+        const T* p = &_parameters[0] + compiled.offset;
+        const T h = compiled.height;
+        switch (compiled.kind) {
+            case TermTriangle:
+                return memberships<T, triangle<T> >(p, h, x, y, n);
+            case TermTrapezoid:
+                return memberships<T, trapezoid<T> >(p, h, x, y, n);
+            case TermRectangle:
+                return memberships<T, rectangle<T> >(p, h, x, y, n);
+            case TermGaussian:
+                return memberships<T, gaussian<T> >(p, h, x, y, n);
+            case TermGaussianProduct:
+                return memberships<T, gaussianProduct<T> >(p, h, x, y, n);
+            case TermBell:
+                return memberships<T, bell<T> >(p, h, x, y, n);
+            case TermSigmoid:
+                return memberships<T, sigmoid<T> >(p, h, x, y, n);
+            case TermSShape:
+                return memberships<T, sShape<T> >(p, h, x, y, n);
+            case TermZShape:
+                return memberships<T, zShape<T> >(p, h, x, y, n);
+            case TermPiShape:
+                return memberships<T, piShape<T> >(p, h, x, y, n);
+            case TermRamp:
+                return memberships<T, ramp<T> >(p, h, x, y, n);
+            case TermConcave:
+                return memberships<T, concave<T> >(p, h, x, y, n);
+            case TermCosine:
+                return memberships<T, cosine<T> >(p, h, x, y, n);
+            case TermSpike:
+                return memberships<T, spike<T> >(p, h, x, y, n);
+            case TermSigmoidDifference:
+                return memberships<T, sigmoidDifference<T> >(p, h, x, y, n);
+            case TermSigmoidProduct:
+                return memberships<T, sigmoidProduct<T> >(p, h, x, y, n);
+            case TermBinary:
+                return memberships<T, binary<T> >(p, h, x, y, n);
+            default:
+                for (std::size_t i = 0; i < n; ++i)
+                    y[i] = membership(context, term, x[i]);
+        }
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::hedge(std::size_t begin, std::size_t end, T x) const {
+        for (std::size_t i = begin; i < end; ++i) {
+            const CompiledHedge& compiled = _hedges[i];
+            switch (compiled.kind) {
+                case HedgeAny:
+                    x = 1.0;
+                    break;
+                case HedgeNot:
+                    x = kernel::negate(x);
+                    break;
+                case HedgeVery:
+                    x = kernel::very(x);
+                    break;
+                case HedgeSomewhat:
+                    x = kernel::somewhat(x);
+                    break;
+                case HedgeExtremely:
+                    x = kernel::extremely(x);
+                    break;
+                case HedgeSeldom:
+                    x = kernel::seldom(x);
+                    break;
+                default:
+                    x = compiled.hedge->hedge(x);
+            }
+        }
+        return x;
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::compute(const CompiledNorm& norm, T a, T b) const {
+        switch (norm.kind) {
+            case NormMinimum:
+                return minimum(a, b);
+            case NormAlgebraicProduct:
+                return algebraicProduct(a, b);
+            case NormBoundedDifference:
+                return boundedDifference(a, b);
+            case NormDrasticProduct:
+                return drasticProduct(a, b);
+            case NormEinsteinProduct:
+                return einsteinProduct(a, b);
+            case NormHamacherProduct:
+                return hamacherProduct(a, b);
+            case NormNilpotentMinimum:
+                return nilpotentMinimum(a, b);
+            case NormMaximum:
+                return maximum(a, b);
+            case NormAlgebraicSum:
+                return algebraicSum(a, b);
+            case NormBoundedSum:
+                return boundedSum(a, b);
+            case NormDrasticSum:
+                return drasticSum(a, b);
+            case NormEinsteinSum:
+                return einsteinSum(a, b);
+            case NormHamacherSum:
+                return hamacherSum(a, b);
+            case NormNilpotentMaximum:
+                return nilpotentMaximum(a, b);
+            case NormNormalizedSum:
+                return normalizedSum(a, b);
+            case NormUnboundedSum:
+                return unboundedSum(a, b);
+            default:
+                return norm.norm->compute(a, b);
+        }
+    }
+
+    template <typename T>
+    template <typename B>
+    void BasicCompiledEngine<T>::compute(const CompiledNorm& norm, const T* a, B b, T* y, std::size_t n) const {
+        switch (norm.kind) {
+            case NormMinimum:
+                return computes<T, minimum<T> >(a, b, y, n);
+            case NormAlgebraicProduct:
+                return computes<T, algebraicProduct<T> >(a, b, y, n);
+            case NormBoundedDifference:
+                return computes<T, boundedDifference<T> >(a, b, y, n);
+            case NormDrasticProduct:
+                return computes<T, drasticProduct<T> >(a, b, y, n);
+            case NormEinsteinProduct:
+                return computes<T, einsteinProduct<T> >(a, b, y, n);
+            case NormHamacherProduct:
+                return computes<T, hamacherProduct<T> >(a, b, y, n);
+            case NormNilpotentMinimum:
+                return computes<T, nilpotentMinimum<T> >(a, b, y, n);
+            case NormMaximum:
+                return computes<T, maximum<T> >(a, b, y, n);
+            case NormAlgebraicSum:
+                return computes<T, algebraicSum<T> >(a, b, y, n);
+            case NormBoundedSum:
+                return computes<T, boundedSum<T> >(a, b, y, n);
+            case NormDrasticSum:
+                return computes<T, drasticSum<T> >(a, b, y, n);
+            case NormEinsteinSum:
+                return computes<T, einsteinSum<T> >(a, b, y, n);
+            case NormHamacherSum:
+                return computes<T, hamacherSum<T> >(a, b, y, n);
+            case NormNilpotentMaximum:
+                return computes<T, nilpotentMaximum<T> >(a, b, y, n);
+            case NormNormalizedSum:
+                return computes<T, normalizedSum<T> >(a, b, y, n);
+            case NormUnboundedSum:
+                return computes<T, unboundedSum<T> >(a, b, y, n);
+            default:
+                for (std::size_t i = 0; i < n; ++i)
+                    y[i] = norm.norm->compute(a[i], element(b, i));
+        }
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::activationDegree(
+        const BasicEvaluationContext<T>& context, std::size_t output, std::size_t term
+    ) const {
+        const std::vector<ActivatedTerm>& activatedTerms = context._activatedTerms[output];
+        const CompiledNorm& aggregation = _outputs[output].aggregation;
+        T result = 0.0;
+        for (std::size_t i = 0; i < activatedTerms.size(); ++i) {
+            const ActivatedTerm& activated = activatedTerms[i];
+            if (activated.term == term) {
+                if (aggregation.kind != NormNone)
+                    result = compute(aggregation, result, activated.degree);
+                else
+                    result += activated.degree;
+            }
+        }
+        return result;
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::aggregate(
+        BasicEvaluationContext<T>& context, std::size_t output, const T* x, T* y, std::size_t n
+    ) const {
+        if (n == 0)
+            return;
+        const std::vector<ActivatedTerm>& activatedTerms = context._activatedTerms[output];
+        const CompiledNorm& aggregation = _outputs[output].aggregation;
+        T* mu = &context._memberships[0];
+        std::fill(y, y + n, T(0.0));
+        for (std::size_t i = 0; i < activatedTerms.size(); ++i) {
+            const ActivatedTerm& activated = activatedTerms[i];
+            const CompiledNorm& implication = _ruleBlocks[activated.ruleBlock].implication;
+            membership(context, activated.term, x, mu, n);
+            compute<T>(implication, mu, activated.degree, mu, n);
+            compute<const T*>(aggregation, y, mu, y, n);
+        }
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::evaluate(
+        BasicEvaluationContext<T>& context, const CompiledRule& rule, const CompiledRuleBlock& ruleBlock
+    ) const {
+        context._stack.clear();
+        for (std::size_t i = rule.codeBegin; i < rule.codeEnd; ++i) {
+            const Instruction& instruction = _code[i];
+            switch (instruction.opcode) {
+                case OpConstant:
+                    context._stack.push_back(hedge(instruction.hedgeBegin, instruction.hedgeEnd, instruction.value));
+                    break;
+                case OpInput:
+                    context._stack.push_back(hedge(
+                        instruction.hedgeBegin,
+                        instruction.hedgeEnd,
+                        membership(context, instruction.term, context._inputValues[instruction.variable])
+                    ));
+                    break;
+                case OpOutput:
+                    context._stack.push_back(hedge(
+                        instruction.hedgeBegin,
+                        instruction.hedgeEnd,
+                        activationDegree(context, instruction.variable, instruction.term)
+                    ));
+                    break;
+                case OpAnd: {
+                    const T b = context._stack.back();
+                    context._stack.pop_back();
+                    context._stack.back() = compute(ruleBlock.conjunction, context._stack.back(), b);
+                    break;
+                }
+                case OpOr: {
+                    const T b = context._stack.back();
+                    context._stack.pop_back();
+                    context._stack.back() = compute(ruleBlock.disjunction, context._stack.back(), b);
+                    break;
+                }
+            }
+        }
+        return rule.weight * context._stack.back();
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::trigger(
+        BasicEvaluationContext<T>& context, std::size_t ruleBlock, std::size_t rule
+    ) const {
+        const CompiledRule& compiled = _rules[rule];
+        T activationDegree = context._activationDegrees[rule];
+        if (not(compiled.enabled and Op::isGt(activationDegree, 0.0)))
+            return;
+        for (std::size_t i = compiled.conclusionBegin; i < compiled.conclusionEnd; ++i) {
+            const Conclusion& conclusion = _conclusions[i];
+            activationDegree = hedge(conclusion.hedgeBegin, conclusion.hedgeEnd, activationDegree);
+            ActivatedTerm activated;
+            activated.term = conclusion.term;
+            activated.degree = activationDegree;
+            activated.ruleBlock = ruleBlock;
+            context._activatedTerms[conclusion.output].push_back(activated);
+        }
+    }
+
+    namespace {
+        template <typename T>
+        struct Descending {
+            const std::vector<T>* degrees;
+
+            explicit Descending(const std::vector<T>* degrees) : degrees(degrees) {}
+
+            bool operator()(std::size_t a, std::size_t b) const {
+                return (*degrees)[a] < (*degrees)[b];
+            }
+        };
+
+        template <typename T>
+        struct Ascending {
+            const std::vector<T>* degrees;
+
+            explicit Ascending(const std::vector<T>* degrees) : degrees(degrees) {}
+
+            bool operator()(std::size_t a, std::size_t b) const {
+                return (*degrees)[a] > (*degrees)[b];
+            }
+        };
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::activate(BasicEvaluationContext<T>& context, std::size_t ruleBlock) const {
+        const CompiledRuleBlock& block = _ruleBlocks[ruleBlock];
+        switch (block.activation) {
+            case ActivationGeneral:
+                for (std::size_t r = block.ruleBegin; r < block.ruleEnd; ++r) {
+                    context._activationDegrees[r] = evaluate(context, _rules[r], block);
+                    trigger(context, ruleBlock, r);
+                }
+                break;
+
+            case ActivationFirst: {
+                int activated = 0;
+                for (std::size_t r = block.ruleBegin; r < block.ruleEnd; ++r) {
+                    const T activationDegree = context._activationDegrees[r] = evaluate(context, _rules[r], block);
+                    if (activated < block.numberOfRules and Op::isGt(activationDegree, 0.0)
+                        and Op::isGE(activationDegree, block.threshold)) {
+                        trigger(context, ruleBlock, r);
+                        ++activated;
+                    }
+                }
+                break;
+            }
+
+            case ActivationLast: {
+                int activated = 0;
+                for (std::size_t r = block.ruleEnd; r > block.ruleBegin; --r) {
+                    const T activationDegree = context._activationDegrees[r - 1] = evaluate(context, _rules[r - 1], block);
+                    if (activated < block.numberOfRules and Op::isGt(activationDegree, 0.0)
+                        and Op::isGE(activationDegree, block.threshold)) {
+                        trigger(context, ruleBlock, r - 1);
+                        ++activated;
+                    }
+                }
+                break;
+            }
+
+            case ActivationHighest: {
+                std::priority_queue<std::size_t, std::vector<std::size_t>, Descending<T> > rulesToActivate(
+                    (Descending<T>(&context._activationDegrees))
+                );
+                for (std::size_t r = block.ruleBegin; r < block.ruleEnd; ++r) {
+                    const T activationDegree = context._activationDegrees[r] = evaluate(context, _rules[r], block);
+                    if (Op::isGt(activationDegree, 0.0))
+                        rulesToActivate.push(r);
+                }
+                int activated = 0;
+                while (rulesToActivate.size() > 0 and activated++ < block.numberOfRules) {
+                    trigger(context, ruleBlock, rulesToActivate.top());
+                    rulesToActivate.pop();
+                }
+                break;
+            }
+
+            case ActivationLowest: {
+                std::priority_queue<std::size_t, std::vector<std::size_t>, Ascending<T> > rulesToActivate(
+                    (Ascending<T>(&context._activationDegrees))
+                );
+                for (std::size_t r = block.ruleBegin; r < block.ruleEnd; ++r) {
+                    const T activationDegree = context._activationDegrees[r] = evaluate(context, _rules[r], block);
+                    if (Op::isGt(activationDegree, 0.0))
+                        rulesToActivate.push(r);
+                }
+                int activated = 0;
+                while (rulesToActivate.size() > 0 and activated++ < block.numberOfRules) {
+                    trigger(context, ruleBlock, rulesToActivate.top());
+                    rulesToActivate.pop();
+                }
+                break;
+            }
+
+            case ActivationProportional: {
+                T sumActivationDegrees = 0.0;
+                for (std::size_t r = block.ruleBegin; r < block.ruleEnd; ++r)
+                    sumActivationDegrees += context._activationDegrees[r] = evaluate(context, _rules[r], block);
+                for (std::size_t r = block.ruleBegin; r < block.ruleEnd; ++r) {
+                    context._activationDegrees[r] = context._activationDegrees[r] / sumActivationDegrees;
+                    trigger(context, ruleBlock, r);
+                }
+                break;
+            }
+
+            case ActivationThreshold:
+                for (std::size_t r = block.ruleBegin; r < block.ruleEnd; ++r) {
+                    const T activationDegree = context._activationDegrees[r] = evaluate(context, _rules[r], block);
+                    bool activates = false;
+                    switch (block.comparison) {
+                        case Threshold::LessThan:
+                            activates = Op::isLt(activationDegree, block.threshold);
+                            break;
+                        case Threshold::LessThanOrEqualTo:
+                            activates = Op::isLE(activationDegree, block.threshold);
+                            break;
+                        case Threshold::EqualTo:
+                            activates = Op::isEq(activationDegree, block.threshold);
+                            break;
+                        case Threshold::NotEqualTo:
+                            activates = not Op::isEq(activationDegree, block.threshold);
+                            break;
+                        case Threshold::GreaterThanOrEqualTo:
+                            activates = Op::isGE(activationDegree, block.threshold);
+                            break;
+                        case Threshold::GreaterThan:
+                            activates = Op::isGt(activationDegree, block.threshold);
+                            break;
+                    }
+                    if (activates)
+                        trigger(context, ruleBlock, r);
+                }
+                break;
+        }
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::defuzzify(BasicEvaluationContext<T>& context, std::size_t output) const {
+        const CompiledOutput& compiled = _outputs[output];
+        switch (compiled.defuzzifier) {
+            case DefuzzifierCentroid:
+            case DefuzzifierBisector:
+            case DefuzzifierMeanOfMaximum:
+            case DefuzzifierSmallestOfMaximum:
+            case DefuzzifierLargestOfMaximum:
+                if (compiled.aggregation.kind == NormNone)
+                    return defuzzifyObject(context, output);
+                for (std::size_t i = 0; i < context._activatedTerms[output].size(); ++i)
+                    if (_ruleBlocks[context._activatedTerms[output][i].ruleBlock].implication.kind == NormNone)
+                        return defuzzifyObject(context, output);
+                return integralDefuzzify(context, output);
+            case DefuzzifierWeightedAverage:
+            case DefuzzifierWeightedSum:
+                return weightedDefuzzify(context, output);
+            default:
+                return defuzzifyObject(context, output);
+        }
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::integralDefuzzify(BasicEvaluationContext<T>& context, std::size_t output) const {
+        const CompiledOutput& compiled = _outputs[output];
+        if (not Op::isFinite(compiled.minimum + compiled.maximum))
+            return fl::nan;
+        const std::size_t resolution = std::size_t(std::max(compiled.resolution, 0));
+        const T* x = resolution ? &_samples[compiled.samples] : fl::null;
+        T* y = resolution ? &context._aggregated[0] : fl::null;
+        aggregate(context, output, x, y, resolution);
+
+        switch (compiled.defuzzifier) {
+            case DefuzzifierCentroid: {
+                T area = 0.0, centroid = 0.0;
+                for (std::size_t i = 0; i < resolution; ++i) {
+                    centroid += y[i] * x[i];
+                    area += y[i];
+                }
+                centroid /= area;
+                return centroid;
+            }
+
+            case DefuzzifierBisector: {
+                T sum = 0.0;
+                for (std::size_t i = 0; i < resolution; ++i) {
+                    if (Op::isFinite(y[i]))
+                        sum += y[i];
+                    y[i] = sum;
+                }
+                T smallest = fl::inf;
+                for (std::size_t i = 0; i < resolution; ++i) {
+                    y[i] = std::fabs(y[i] / sum - T(0.5));
+                    if (y[i] < smallest)
+                        smallest = y[i];
+                }
+                std::vector<T> bisectors;
+                for (std::size_t i = 0; i < resolution; ++i)
+                    if (smallest == y[i])
+                        bisectors.push_back(x[i]);
+                return Op::mean(bisectors);
+            }
+
+            case DefuzzifierMeanOfMaximum: {
+                T ymax = -fl::inf;
+                std::vector<T> maxima;
+                for (std::size_t i = 0; i < resolution; ++i) {
+                    if (y[i] > ymax) {
+                        maxima.clear();
+                        maxima.push_back(x[i]);
+                        ymax = y[i];
+                    } else if (y[i] == ymax)
+                        maxima.push_back(x[i]);
+                }
+                return Op::mean(maxima);
+            }
+
+            case DefuzzifierSmallestOfMaximum: {
+                T ymax = -fl::inf;
+                T som = fl::nan;
+                for (std::size_t i = 0; i < resolution; ++i) {
+                    if (y[i] > ymax) {
+                        som = x[i];
+                        ymax = y[i];
+                    }
+                }
+                return som;
+            }
+
+            case DefuzzifierLargestOfMaximum: {
+                T ymax = -fl::inf;
+                T lom = fl::nan;
+                for (std::size_t i = 0; i < resolution; ++i) {
+                    if (y[i] >= ymax) {
+                        lom = x[i];
+                        ymax = y[i];
+                    }
+                }
+                return lom;
+            }
+
+            default:
+                return fl::nan;
+        }
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::weightedDefuzzify(BasicEvaluationContext<T>& context, std::size_t output) const {
+        const CompiledOutput& compiled = _outputs[output];
+        const std::vector<ActivatedTerm>& activatedTerms = context._activatedTerms[output];
+        WeightedDefuzzifier::Type type = WeightedDefuzzifier::Type(compiled.weightedType);
+        if (type == WeightedDefuzzifier::Automatic) {
+            // the type inferred from the activated terms as in WeightedDefuzzifier::inferType()
+            type = WeightedDefuzzifier::Type(_terms[activatedTerms.front().term].type);
+            for (std::size_t i = 1; i < activatedTerms.size(); ++i)
+                if (_terms[activatedTerms[i].term].type != type)
+                    throw Exception(
+                        "cannot infer type of '" + _engine->getOutputVariable(output)->getDefuzzifier()->className()
+                        + "', got multiple types"
+                    );
+        }
+
+        // groups the activated terms by name as in Aggregated::groupedTerms()
+        for (std::size_t g = 0; g < compiled.groups; ++g)
+            context._groupTerms[g] = _terms.size();
+        for (std::size_t i = 0; i < activatedTerms.size(); ++i) {
+            const ActivatedTerm& activated = activatedTerms[i];
+            const std::size_t group = _terms[activated.term].group;
+            if (context._groupTerms[group] == _terms.size()) {
+                context._groupTerms[group] = activated.term;
+                context._groupDegrees[group] = activated.degree;
+            } else if (compiled.aggregation.kind != NormNone)
+                context._groupDegrees[group] = compute(compiled.aggregation, context._groupDegrees[group], activated.degree);
+            else
+                context._groupDegrees[group] = context._groupDegrees[group] + activated.degree;
+        }
+
+        T sum = 0.0;
+        T weights = 0.0;
+        for (std::size_t g = 0; g < compiled.groups; ++g) {
+            if (context._groupTerms[g] == _terms.size())
+                continue;
+            const T w = context._groupDegrees[g];
+            T z;
+            if (type == WeightedDefuzzifier::TakagiSugeno)
+                z = membership(context, context._groupTerms[g], w);
+            else if (type == WeightedDefuzzifier::Tsukamoto)
+                z = _terms[context._groupTerms[g]].term->tsukamoto(w);
+            else
+                throw Exception("unexpected type: " + WeightedDefuzzifier::typeName(type));
+            sum += w * z;
+            weights += w;
+        }
+        if (compiled.defuzzifier == DefuzzifierWeightedSum)
+            return sum;
+        return sum / weights;
+    }
+
+    template <typename T>
+    T BasicCompiledEngine<T>::defuzzifyObject(BasicEvaluationContext<T>& context, std::size_t output) const {
+        // the objects are evaluated on a clone of the snapshot owned by the context, so the snapshot is not modified
+        if (not context._snapshot.get())
+            context._snapshot.reset(_engine->clone());
+        Engine* engine = context._snapshot.get();
+        for (std::size_t i = 0; i < context._inputValues.size(); ++i)
+            engine->getInputVariable(i)->setValue(context._inputValues[i]);
+        for (std::size_t i = 0; i < context._outputValues.size(); ++i)
+            engine->getOutputVariable(i)->setValue(context._outputValues[i]);
+
+        const std::vector<ActivatedTerm>& activatedTerms = context._activatedTerms[output];
+        OutputVariable* outputVariable = engine->getOutputVariable(output);
+        Aggregated* fuzzyOutput = outputVariable->fuzzyOutput();
+        fuzzyOutput->clear();
+        for (std::size_t i = 0; i < activatedTerms.size(); ++i) {
+            const ActivatedTerm& activated = activatedTerms[i];
+            const CompiledTerm& compiled = _terms[activated.term];
+            const CompiledNorm& implication = _ruleBlocks[activated.ruleBlock].implication;
+            fuzzyOutput->addTerm(
+                compiled.position < outputVariable->numberOfTerms() ? outputVariable->getTerm(compiled.position)
+                                                                    : compiled.term,
+                activated.degree,
+                static_cast<const TNorm*>(implication.norm)
+            );
+        }
+        return outputVariable->getDefuzzifier()->defuzzify(
+            fuzzyOutput, outputVariable->getMinimum(), outputVariable->getMaximum()
+        );
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::process() {
+        process(_context);
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::process(BasicEvaluationContext<T>& context) const {
+        checkContext(context);
+
+        for (std::size_t o = 0; o < context._activatedTerms.size(); ++o)
+            context._activatedTerms[o].clear();
+
+        for (std::size_t b = 0; b < _ruleBlocks.size(); ++b)
+            activate(context, b);
+
+        for (std::size_t o = 0; o < _outputs.size(); ++o) {
+            const CompiledOutput& compiled = _outputs[o];
+            if (not compiled.enabled)
+                continue;
+
+            if (Op::isFinite(context._outputValues[o]))
+                context._previousValues[o] = context._outputValues[o];
+
+            std::string exception;
+            T result = fl::nan;
+            bool isValid = not context._activatedTerms[o].empty();
+            if (isValid) {
+                isValid = false;
+                if (compiled.defuzzifier != DefuzzifierNone) {
+                    try {
+                        result = defuzzify(context, o);
+                        isValid = true;
+                    } catch (std::exception& ex) { exception = ex.what(); }
+                } else {
+                    exception = "[defuzzifier error] "
+                                "defuzzifier needed to defuzzify output variable <"
+                                + _engine->getOutputVariable(o)->getName() + ">";
+                }
+            }
+
+            if (not isValid) {
+                if (compiled.lockPreviousValue and not Op::isNaN(context._previousValues[o]))
+                    result = context._previousValues[o];
+                else
+                    result = compiled.defaultValue;
+            }
+
+            context._outputValues[o] = compiled.lockValueInRange ? Op::bound(result, compiled.minimum, compiled.maximum)
+                                                         : result;
+
+            if (not exception.empty())
+                throw Exception(exception, FL_AT);
+        }
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::processBatch(const T* inputs, std::size_t rows, T* outputs, Engine::Layout layout) {
+        processBatch(_context, inputs, rows, outputs, layout);
+    }
+
+    template <typename T>
+    void BasicCompiledEngine<T>::processBatch(
+        BasicEvaluationContext<T>& context, const T* inputs, std::size_t rows, T* outputs, Engine::Layout layout
+    ) const {
+        checkContext(context);
+
+        const std::size_t numberOfInputs = _inputValues.size();
+        const std::size_t numberOfOutputs = _outputValues.size();
+        const bool rowMajor = layout == Engine::RowMajor;
+        for (std::size_t row = 0; row < rows; ++row) {
+            const T* input = inputs + (rowMajor ? row * numberOfInputs : row);
+            for (std::size_t i = 0; i < numberOfInputs; ++i)
+                context._inputValues[i] = boundInputValue(i, input[rowMajor ? i : i * rows]);
+
+            T* output = outputs + (rowMajor ? row * numberOfOutputs : row);
+            try {
+                process(context);
+            } catch (...) {
+                for (std::size_t o = 0; o < numberOfOutputs; ++o)
+                    output[rowMajor ? o : o * rows] = context._outputValues[o];
+                throw;
+            }
+            for (std::size_t o = 0; o < numberOfOutputs; ++o)
+                output[rowMajor ? o : o * rows] = context._outputValues[o];
+        }
+    }
+
+    template class BasicCompiledEngine<float>;
+    template class BasicCompiledEngine<double>;
+
+}
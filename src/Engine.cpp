@@ -17,11 +17,16 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/Engine.h"
 
+#include <map>
+
+#include "fuzzylite/CompiledEngine.h"
+#include "fuzzylite/ParallelEvaluator.h"
 #include "fuzzylite/activation/General.h"
 #include "fuzzylite/defuzzifier/WeightedAverage.h"
 #include "fuzzylite/defuzzifier/WeightedSum.h"
 #include "fuzzylite/factory/DefuzzifierFactory.h"
 #include "fuzzylite/factory/FactoryManager.h"
+#include "fuzzylite/hedge/Hedge.h"
 #include "fuzzylite/imex/FllExporter.h"
 #include "fuzzylite/norm/t/AlgebraicProduct.h"
 #include "fuzzylite/rule/Consequent.h"
@@ -30,6 +35,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include "fuzzylite/rule/RuleBlock.h"
 #include "fuzzylite/term/Aggregated.h"
 #include "fuzzylite/term/Constant.h"
+#include "fuzzylite/term/Function.h"
 #include "fuzzylite/term/Linear.h"
 #include "fuzzylite/term/Ramp.h"
 #include "fuzzylite/term/SShape.h"
@@ -40,6 +46,82 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 namespace fuzzylite {
 
+    namespace {
+        /** variables and terms of an engine mapped to those of its copy */
+        struct References {
+            std::map<const Variable*, Variable*> variables;
+            std::map<const Term*, Term*> terms;
+
+            void add(const Variable* source, Variable* copy) {
+                variables[source] = copy;
+                for (std::size_t t = 0; t < source->numberOfTerms() and t < copy->numberOfTerms(); ++t)
+                    terms[source->getTerm(t)] = copy->getTerm(t);
+            }
+        };
+
+        /**
+          Copies the expression replacing its variables and terms with their
+          references, or returns `fl::null` if any of them has no reference
+         */
+        Expression* copyExpression(const Expression* source, const References& references) {
+            if (not source)
+                return fl::null;
+            if (source->type() == Expression::Proposition) {
+                const Proposition* proposition = static_cast<const Proposition*>(source);
+                std::map<const Variable*, Variable*>::const_iterator variable
+                    = references.variables.find(proposition->variable);
+                std::map<const Term*, Term*>::const_iterator term = references.terms.find(proposition->term);
+                if (variable == references.variables.end()
+                    or (proposition->term and term == references.terms.end()))
+                    return fl::null;
+                Proposition* result = new Proposition;
+                result->variable = variable->second;
+                result->term = proposition->term ? term->second : fl::null;
+                for (std::size_t i = 0; i < proposition->hedges.size(); ++i)
+                    result->hedges.push_back(proposition->hedges.at(i)->clone());
+                return result;
+            }
+            const Operator* fuzzyOperator = static_cast<const Operator*>(source);
+            FL_unique_ptr<Operator> result(new Operator);
+            result->name = fuzzyOperator->name;
+            result->left = copyExpression(fuzzyOperator->left, references);
+            result->right = copyExpression(fuzzyOperator->right, references);
+            if (not(result->left and result->right))
+                return fl::null;
+            return result.release();
+        }
+
+        /**
+          Loads the copy of the rule with copies of the antecedent and
+          consequent of the rule, without parsing its text
+          @return whether the copy of the rule was loaded
+         */
+        bool copyRule(const Rule* source, Rule* copy, const References& references) {
+            if (not source->isLoaded())
+                return false;
+            FL_unique_ptr<Expression> antecedent(
+                copyExpression(source->getAntecedent()->getExpression(), references)
+            );
+            if (not antecedent.get())
+                return false;
+            const std::vector<Proposition*>& conclusions = source->getConsequent()->conclusions();
+            std::vector<Proposition*> copies;
+            for (std::size_t i = 0; i < conclusions.size(); ++i) {
+                Expression* conclusion = copyExpression(conclusions.at(i), references);
+                if (not conclusion) {
+                    for (std::size_t c = 0; c < copies.size(); ++c)
+                        delete copies.at(c);
+                    return false;
+                }
+                copies.push_back(static_cast<Proposition*>(conclusion));
+            }
+            copy->getAntecedent()->setExpression(antecedent.release());
+            copy->getConsequent()->unload();
+            copy->getConsequent()->conclusions() = copies;
+            return true;
+        }
+    }
+
     Engine::Engine(
         const std::string& name,
         const std::string& description,
@@ -52,7 +134,12 @@ namespace fuzzylite {
         _description(description),
         _inputVariables(inputVariables),
         _outputVariables(outputVariables),
-        _ruleBlocks(ruleBlocks) {
+        _ruleBlocks(ruleBlocks),
+        _incremental(false),
+        _numberOfThreads(1),
+        _functionsResolved(false) {
+        _inputIndex.rebuild(_inputVariables);
+        _outputIndex.rebuild(_outputVariables);
         if (load) {
             updateReferences();
 
@@ -61,7 +148,12 @@ namespace fuzzylite {
         }
     }
 
-    Engine::Engine(const Engine& other) : _name(""), _description("") {
+    Engine::Engine(const Engine& other) :
+        _name(""),
+        _description(""),
+        _incremental(false),
+        _numberOfThreads(1),
+        _functionsResolved(false) {
         copyFrom(other);
     }
 
@@ -85,19 +177,37 @@ namespace fuzzylite {
     void Engine::copyFrom(const Engine& other) {
         _name = other._name;
         _description = other._description;
-        for (std::size_t i = 0; i < other._inputVariables.size(); ++i)
+        _incremental = other._incremental;
+        _incrementalEvaluator.clear();
+        _numberOfThreads = other._numberOfThreads;
+        _ruleBlockScheduler.clear();
+        References references;
+        for (std::size_t i = 0; i < other._inputVariables.size(); ++i) {
             _inputVariables.push_back(new InputVariable(*other._inputVariables.at(i)));
-        for (std::size_t i = 0; i < other._outputVariables.size(); ++i)
+            references.add(other._inputVariables.at(i), _inputVariables.back());
+        }
+        for (std::size_t i = 0; i < other._outputVariables.size(); ++i) {
             _outputVariables.push_back(new OutputVariable(*other._outputVariables.at(i)));
+            references.add(other._outputVariables.at(i), _outputVariables.back());
+        }
+        _inputIndex.rebuild(_inputVariables);
+        _outputIndex.rebuild(_outputVariables);
 
         updateReferences();
 
+        // the loaded rules are copied from their expressions, and the others are loaded from their text
         for (std::size_t i = 0; i < other._ruleBlocks.size(); ++i) {
-            RuleBlock* ruleBlock = new RuleBlock(*other._ruleBlocks.at(i));
-            try {
-                ruleBlock->loadRules(this);
-            } catch (...) {
-                // ignore
+            const RuleBlock* source = other._ruleBlocks.at(i);
+            RuleBlock* ruleBlock = new RuleBlock(*source);
+            for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r) {
+                Rule* rule = ruleBlock->getRule(r);
+                if (copyRule(source->getRule(r), rule, references))
+                    continue;
+                try {
+                    rule->load(this);
+                } catch (...) {
+                    // ignore
+                }
             }
             _ruleBlocks.push_back(ruleBlock);
         }
@@ -110,6 +220,7 @@ namespace fuzzylite {
             for (std::size_t t = 0; t < variable->numberOfTerms(); ++t)
                 variable->getTerm(t)->updateReference(this);
         }
+        _functionsResolved = true;
     }
 
     Engine::~Engine() {
@@ -159,6 +270,7 @@ namespace fuzzylite {
         Defuzzifier* defuzzifier,
         Activation* activation
     ) {
+        _incrementalEvaluator.clear();
         for (std::size_t i = 0; i < numberOfRuleBlocks(); ++i) {
             RuleBlock* ruleBlock = ruleBlocks().at(i);
             ruleBlock->setConjunction(conjunction ? conjunction->clone() : fl::null);
@@ -222,7 +334,7 @@ namespace fuzzylite {
         if (ruleBlocks().empty())
             ss << "- Engine <" << getName() << "> has no rule blocks\n";
         for (std::size_t i = 0; i < ruleBlocks().size(); ++i) {
-            RuleBlock* ruleblock = ruleBlocks().at(i);
+            const RuleBlock* ruleblock = ruleBlocks().at(i);
             if (not ruleblock) {
                 ss << "- Engine <" << getName() << "> has a fl::null rule block at index <" << i << ">\n";
             } else {
@@ -282,19 +394,34 @@ namespace fuzzylite {
                 }
             }
         }
+
+        const RuleBlockScheduler& scheduler = ruleBlockScheduler();
+        for (std::size_t i = 0; i < scheduler.cycles().size(); ++i) {
+            const std::vector<std::size_t>& cycle = scheduler.cycles().at(i);
+            ss << "- Rule blocks";
+            for (std::size_t b = 0; b < cycle.size(); ++b)
+                ss << (b == 0 ? " " : ", ") << (cycle.at(b) + 1) << " <" << getRuleBlock(cycle.at(b))->getName() << ">";
+            ss << " depend on each other through their output variables\n";
+        }
         if (status)
             *status = ss.str();
         return ss.str().empty();
     }
 
     void Engine::restart() {
-        for (std::size_t i = 0; i < inputVariables().size(); ++i)
-            inputVariables().at(i)->setValue(fl::nan);
-        for (std::size_t i = 0; i < outputVariables().size(); ++i)
-            outputVariables().at(i)->clear();
+        _incrementalEvaluator.clear();
+        for (std::size_t i = 0; i < _inputVariables.size(); ++i)
+            _inputVariables.at(i)->setValue(fl::nan);
+        for (std::size_t i = 0; i < _outputVariables.size(); ++i)
+            _outputVariables.at(i)->clear();
     }
 
     void Engine::process() {
+        resolveFunctions();
+        if (_incremental and _incrementalEvaluator.process(this))
+            return;
+        _incrementalEvaluator.clear();
+
         for (std::size_t i = 0; i < _outputVariables.size(); ++i)
             _outputVariables.at(i)->fuzzyOutput()->clear();
 
@@ -313,18 +440,32 @@ namespace fuzzylite {
         }
         FL_DEBUG_END;
 
-        for (std::size_t i = 0; i < _ruleBlocks.size(); ++i) {
-            RuleBlock* ruleBlock = _ruleBlocks.at(i);
-            if (ruleBlock->isEnabled()) {
-                FL_DBG("===============");
-                FL_DBG("RULE BLOCK: " << ruleBlock->getName());
-                ruleBlock->activate();
+        const RuleBlockScheduler& scheduler = ruleBlockScheduler();
+        const std::size_t numberOfThreads
+            = _numberOfThreads == 0 ? ParallelEvaluator::hardwareConcurrency() : _numberOfThreads;
+        // the memberships of the input values are computed once and shared by all the rules
+        if (not scheduler.isConcurrent(numberOfThreads)) {
+            for (std::size_t i = 0; i < _inputVariables.size(); ++i) {
+                if (_inputVariables.at(i)->isEnabled())
+                    _inputVariables.at(i)->cacheMemberships();
             }
         }
+        try {
+            scheduler.activate(numberOfThreads);
+        } catch (...) {
+            for (std::size_t i = 0; i < _inputVariables.size(); ++i)
+                _inputVariables.at(i)->clearMembershipCache();
+            throw;
+        }
+        for (std::size_t i = 0; i < _inputVariables.size(); ++i)
+            _inputVariables.at(i)->clearMembershipCache();
 
         for (std::size_t i = 0; i < _outputVariables.size(); ++i)
             _outputVariables.at(i)->defuzzify();
 
+        if (_incremental)
+            _incrementalEvaluator.record(this);
+
         FL_DEBUG_BEGIN;
         FL_DBG("===============");
         FL_DBG("CURRENT OUTPUTS:");
@@ -349,6 +490,59 @@ namespace fuzzylite {
         FL_DEBUG_END;
     }
 
+    void Engine::setIncremental(bool incremental) {
+        this->_incremental = incremental;
+        _incrementalEvaluator.clear();
+    }
+
+    bool Engine::isIncremental() const {
+        return this->_incremental;
+    }
+
+    const IncrementalEvaluator& Engine::incrementalEvaluator() const {
+        return this->_incrementalEvaluator;
+    }
+
+    void Engine::setNumberOfThreads(std::size_t numberOfThreads) {
+        this->_numberOfThreads = numberOfThreads;
+    }
+
+    std::size_t Engine::getNumberOfThreads() const {
+        return this->_numberOfThreads;
+    }
+
+    const RuleBlockScheduler& Engine::ruleBlockScheduler() const {
+        if (not _ruleBlockScheduler.isBuiltFor(this))
+            _ruleBlockScheduler.build(this);
+        return this->_ruleBlockScheduler;
+    }
+
+    void Engine::processBatch(const scalar* inputs, std::size_t rows, scalar* outputs, Layout layout) {
+        _incrementalEvaluator.clear();
+        for (std::size_t i = 0; i < _outputVariables.size(); ++i)
+            _outputVariables.at(i)->fuzzyOutput()->clear();
+        if (rows == 0)
+            return;
+
+        CompiledEngine compiled(this);
+        try {
+            compiled.processBatch(inputs, rows, outputs, layout);
+        } catch (...) {
+            updateValues(compiled);
+            throw;
+        }
+        updateValues(compiled);
+    }
+
+    void Engine::updateValues(const CompiledEngine& compiled) {
+        for (std::size_t i = 0; i < _inputVariables.size(); ++i)
+            _inputVariables.at(i)->setValue(compiled.getInputValue(i));
+        for (std::size_t i = 0; i < _outputVariables.size(); ++i) {
+            _outputVariables.at(i)->setPreviousValue(compiled.getPreviousOutputValue(i));
+            _outputVariables.at(i)->setValue(compiled.getOutputValue(i));
+        }
+    }
+
     void Engine::setName(const std::string& name) {
         this->_name = name;
     }
@@ -513,6 +707,10 @@ namespace fuzzylite {
         return new Engine(*this);
     }
 
+    CompiledEngine* Engine::compile() const {
+        return new CompiledEngine(this);
+    }
+
     std::vector<Variable*> Engine::variables() const {
         std::vector<Variable*> result;
         result.reserve(inputVariables().size() + outputVariables().size());
@@ -521,6 +719,36 @@ namespace fuzzylite {
         return result;
     }
 
+    void Engine::resolveFunctions() {
+        // the functions read the variables of the engine at the positions resolved when they were loaded
+        if (_functionsResolved)
+            return;
+        std::vector<Variable*> myVariables = variables();
+        for (std::size_t i = 0; i < myVariables.size(); ++i) {
+            Variable* variable = myVariables.at(i);
+            for (std::size_t t = 0; t < variable->numberOfTerms(); ++t) {
+                Function* function = dynamic_cast<Function*>(variable->getTerm(t));
+                if (function and function->getEngine() == this)
+                    function->setEngine(this);
+            }
+        }
+        _functionsResolved = true;
+    }
+
+    void Engine::rebuildIndexes() {
+        _inputIndex.rebuild(_inputVariables);
+        _outputIndex.rebuild(_outputVariables);
+        _functionsResolved = false;
+        resolveFunctions();
+        for (std::size_t i = 0; i < _inputVariables.size(); ++i)
+            _inputVariables.at(i)->rebuildIndex();
+        for (std::size_t i = 0; i < _outputVariables.size(); ++i)
+            _outputVariables.at(i)->rebuildIndex();
+        for (std::size_t i = 0; i < _ruleBlocks.size(); ++i)
+            _ruleBlocks.at(i)->rebuildIndex();
+        _incrementalEvaluator.clear();
+    }
+
     /**
      * Operations for InputVariables
      */
@@ -530,17 +758,23 @@ namespace fuzzylite {
     }
 
     void Engine::addInputVariable(InputVariable* inputVariable) {
-        inputVariables().push_back(inputVariable);
+        _inputVariables.push_back(inputVariable);
+        _inputIndex.add(_inputVariables);
+        _functionsResolved = false;
     }
 
     InputVariable* Engine::setInputVariable(InputVariable* inputVariable, std::size_t index) {
         InputVariable* result = inputVariables().at(index);
-        inputVariables().at(index) = inputVariable;
+        _inputVariables.at(index) = inputVariable;
+        _inputIndex.rebuild(_inputVariables);
+        _functionsResolved = false;
         return result;
     }
 
     void Engine::insertInputVariable(InputVariable* inputVariable, std::size_t index) {
-        inputVariables().insert(inputVariables().begin() + index, inputVariable);
+        _inputVariables.insert(_inputVariables.begin() + index, inputVariable);
+        _inputIndex.rebuild(_inputVariables);
+        _functionsResolved = false;
     }
 
     InputVariable* Engine::getInputVariable(std::size_t index) const {
@@ -548,30 +782,31 @@ namespace fuzzylite {
     }
 
     InputVariable* Engine::getInputVariable(const std::string& name) const {
-        for (std::size_t i = 0; i < inputVariables().size(); ++i)
-            if (inputVariables().at(i)->getName() == name)
-                return inputVariables().at(i);
+        InputVariable* inputVariable = _inputIndex.find(_inputVariables, name);
+        if (inputVariable)
+            return inputVariable;
         throw Exception("[engine error] input variable <" + name + "> not found", FL_AT);
     }
 
     bool Engine::hasInputVariable(const std::string& name) const {
-        for (std::size_t i = 0; i < inputVariables().size(); ++i)
-            if (inputVariables().at(i)->getName() == name)
-                return true;
-        return false;
+        return _inputIndex.find(_inputVariables, name) != fl::null;
     }
 
     InputVariable* Engine::removeInputVariable(std::size_t index) {
-        InputVariable* result = inputVariables().at(index);
-        inputVariables().erase(inputVariables().begin() + index);
+        InputVariable* result = _inputVariables.at(index);
+        _inputVariables.erase(_inputVariables.begin() + index);
+        _inputIndex.rebuild(_inputVariables);
+        _functionsResolved = false;
         return result;
     }
 
     InputVariable* Engine::removeInputVariable(const std::string& name) {
         for (std::size_t i = 0; i < inputVariables().size(); ++i) {
             if (inputVariables().at(i)->getName() == name) {
-                InputVariable* result = inputVariables().at(i);
-                inputVariables().erase(inputVariables().begin() + i);
+                InputVariable* result = _inputVariables.at(i);
+                _inputVariables.erase(_inputVariables.begin() + i);
+                _inputIndex.rebuild(_inputVariables);
+                _functionsResolved = false;
                 return result;
             }
         }
@@ -588,6 +823,8 @@ namespace fuzzylite {
 
     void Engine::setInputVariables(const std::vector<InputVariable*>& inputVariables) {
         this->_inputVariables = inputVariables;
+        this->_inputIndex.rebuild(this->_inputVariables);
+        _functionsResolved = false;
     }
 
     std::vector<InputVariable*>& Engine::inputVariables() {
@@ -603,17 +840,23 @@ namespace fuzzylite {
     }
 
     void Engine::addOutputVariable(OutputVariable* outputVariable) {
-        outputVariables().push_back(outputVariable);
+        _outputVariables.push_back(outputVariable);
+        _outputIndex.add(_outputVariables);
+        _functionsResolved = false;
     }
 
     OutputVariable* Engine::setOutputVariable(OutputVariable* outputVariable, std::size_t index) {
         OutputVariable* result = outputVariables().at(index);
-        outputVariables().at(index) = outputVariable;
+        _outputVariables.at(index) = outputVariable;
+        _outputIndex.rebuild(_outputVariables);
+        _functionsResolved = false;
         return result;
     }
 
     void Engine::insertOutputVariable(OutputVariable* outputVariable, std::size_t index) {
-        outputVariables().insert(outputVariables().begin() + index, outputVariable);
+        _outputVariables.insert(_outputVariables.begin() + index, outputVariable);
+        _outputIndex.rebuild(_outputVariables);
+        _functionsResolved = false;
     }
 
     OutputVariable* Engine::getOutputVariable(std::size_t index) const {
@@ -621,30 +864,31 @@ namespace fuzzylite {
     }
 
     OutputVariable* Engine::getOutputVariable(const std::string& name) const {
-        for (std::size_t i = 0; i < outputVariables().size(); ++i)
-            if (outputVariables().at(i)->getName() == name)
-                return outputVariables().at(i);
+        OutputVariable* outputVariable = _outputIndex.find(_outputVariables, name);
+        if (outputVariable)
+            return outputVariable;
         throw Exception("[engine error] output variable <" + name + "> not found", FL_AT);
     }
 
     bool Engine::hasOutputVariable(const std::string& name) const {
-        for (std::size_t i = 0; i < outputVariables().size(); ++i)
-            if (outputVariables().at(i)->getName() == name)
-                return true;
-        return false;
+        return _outputIndex.find(_outputVariables, name) != fl::null;
     }
 
     OutputVariable* Engine::removeOutputVariable(std::size_t index) {
-        OutputVariable* result = outputVariables().at(index);
-        outputVariables().erase(outputVariables().begin() + index);
+        OutputVariable* result = _outputVariables.at(index);
+        _outputVariables.erase(_outputVariables.begin() + index);
+        _outputIndex.rebuild(_outputVariables);
+        _functionsResolved = false;
         return result;
     }
 
     OutputVariable* Engine::removeOutputVariable(const std::string& name) {
         for (std::size_t i = 0; i < outputVariables().size(); ++i) {
             if (outputVariables().at(i)->getName() == name) {
-                OutputVariable* result = outputVariables().at(i);
-                outputVariables().erase(outputVariables().begin() + i);
+                OutputVariable* result = _outputVariables.at(i);
+                _outputVariables.erase(_outputVariables.begin() + i);
+                _outputIndex.rebuild(_outputVariables);
+                _functionsResolved = false;
                 return result;
             }
         }
@@ -661,6 +905,8 @@ namespace fuzzylite {
 
     void Engine::setOutputVariables(const std::vector<OutputVariable*>& outputVariables) {
         this->_outputVariables = outputVariables;
+        this->_outputIndex.rebuild(this->_outputVariables);
+        _functionsResolved = false;
     }
 
     std::vector<OutputVariable*>& Engine::outputVariables() {
@@ -0,0 +1,131 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/EvaluationContext.h"
+
+#include "fuzzylite/CompiledEngine.h"
+#include "fuzzylite/Engine.h"
+#include "fuzzylite/Exception.h"
+
+namespace fuzzylite {
+
+    template <typename T>
+    BasicEvaluationContext<T>::BasicEvaluationContext(const BasicCompiledEngine<T>* engine) :
+        _engine(fl::null),
+        _generation(0),
+        _snapshot(fl::null) {
+        if (engine)
+            reset(engine);
+    }
+
+    template <typename T>
+    BasicEvaluationContext<T>::BasicEvaluationContext(const BasicEvaluationContext& other) :
+        _engine(fl::null),
+        _generation(0),
+        _snapshot(fl::null) {
+        copyFrom(other);
+    }
+
+    template <typename T>
+    BasicEvaluationContext<T>& BasicEvaluationContext<T>::operator=(const BasicEvaluationContext& other) {
+        if (this != &other)
+            copyFrom(other);
+        return *this;
+    }
+
+    template <typename T>
+    BasicEvaluationContext<T>::~BasicEvaluationContext() {}
+
+    template <typename T>
+    void BasicEvaluationContext<T>::copyFrom(const BasicEvaluationContext& other) {
+        // the snapshot is cloned lazily by each context when needed, and kept while evaluating the same engine
+        if (_engine != other._engine or _generation != other._generation)
+            _snapshot.reset(fl::null);
+        _engine = other._engine;
+        _generation = other._generation;
+        _inputValues = other._inputValues;
+        _outputValues = other._outputValues;
+        _previousValues = other._previousValues;
+        _activationDegrees = other._activationDegrees;
+        _activatedTerms = other._activatedTerms;
+        _groupDegrees = other._groupDegrees;
+        _groupTerms = other._groupTerms;
+        _stack = other._stack;
+        _memberships = other._memberships;
+        _aggregated = other._aggregated;
+        _arguments = other._arguments;
+    }
+
+    template <typename T>
+    void BasicEvaluationContext<T>::reset(const BasicCompiledEngine<T>* engine) {
+        if (not engine)
+            throw Exception("[context error] expected a compiled engine, but found none", FL_AT);
+        _engine = engine;
+        _snapshot.reset(fl::null);
+        engine->initialize(*this);
+    }
+
+    template <typename T>
+    const BasicCompiledEngine<T>* BasicEvaluationContext<T>::getEngine() const {
+        return this->_engine;
+    }
+
+    template <typename T>
+    std::size_t BasicEvaluationContext<T>::numberOfInputValues() const {
+        return _inputValues.size();
+    }
+
+    template <typename T>
+    std::size_t BasicEvaluationContext<T>::numberOfOutputValues() const {
+        return _outputValues.size();
+    }
+
+    template <typename T>
+    void BasicEvaluationContext<T>::setInputValue(std::size_t index, T value) {
+        _inputValues.at(index) = _engine->boundInputValue(index, value);
+    }
+
+    template <typename T>
+    T BasicEvaluationContext<T>::getInputValue(std::size_t index) const {
+        return _inputValues.at(index);
+    }
+
+    template <typename T>
+    T BasicEvaluationContext<T>::getOutputValue(std::size_t index) const {
+        return _outputValues.at(index);
+    }
+
+    template <typename T>
+    T BasicEvaluationContext<T>::getPreviousOutputValue(std::size_t index) const {
+        return _previousValues.at(index);
+    }
+
+    template <typename T>
+    void BasicEvaluationContext<T>::restart() {
+        for (std::size_t i = 0; i < _inputValues.size(); ++i)
+            _inputValues.at(i) = fl::nan;
+        for (std::size_t i = 0; i < _outputValues.size(); ++i) {
+            _activatedTerms.at(i).clear();
+            _outputValues.at(i) = fl::nan;
+            _previousValues.at(i) = fl::nan;
+        }
+    }
+
+    template class BasicEvaluationContext<float>;
+    template class BasicEvaluationContext<double>;
+
+}
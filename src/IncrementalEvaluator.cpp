@@ -0,0 +1,364 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/IncrementalEvaluator.h"
+
+#include "fuzzylite/Engine.h"
+#include "fuzzylite/activation/General.h"
+#include "fuzzylite/rule/Antecedent.h"
+#include "fuzzylite/rule/Consequent.h"
+#include "fuzzylite/rule/Expression.h"
+#include "fuzzylite/rule/Rule.h"
+#include "fuzzylite/rule/RuleBlock.h"
+#include "fuzzylite/term/Aggregated.h"
+#include "fuzzylite/term/Function.h"
+#include "fuzzylite/term/Linear.h"
+#include "fuzzylite/variable/InputVariable.h"
+#include "fuzzylite/variable/OutputVariable.h"
+
+namespace fuzzylite {
+
+    namespace {
+        const std::size_t none = std::size_t(-1);
+
+        // whether the membership function of the term reads the values of the variables of the engine
+        bool readsVariables(const Term* term) {
+            return dynamic_cast<const Linear*>(term) or dynamic_cast<const Function*>(term);
+        }
+
+        /**
+          Collects the indexes of the input variables in the expression
+          @return false if the expression refers to variables other than the
+          input variables of the engine, or to Function terms
+         */
+        bool dependencies(
+            const Expression* node, const std::vector<InputVariable*>& inputs, std::vector<std::size_t>& result
+        ) {
+            if (not node)
+                return true;
+            if (node->type() == Expression::Operator) {
+                const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+                return dependencies(fuzzyOperator->left, inputs, result)
+                       and dependencies(fuzzyOperator->right, inputs, result);
+            }
+            const Proposition* proposition = static_cast<const Proposition*>(node);
+            if (dynamic_cast<const Function*>(proposition->term))
+                return false;
+            // the Linear terms read the values of every input variable
+            if (dynamic_cast<const Linear*>(proposition->term)) {
+                for (std::size_t i = 0; i < inputs.size(); ++i)
+                    result.push_back(i);
+            }
+            for (std::size_t i = 0; i < inputs.size(); ++i) {
+                if (proposition->variable == inputs.at(i)) {
+                    result.push_back(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::size_t find(std::vector<std::size_t>& parents, std::size_t x) {
+            while (parents.at(x) != x)
+                x = parents.at(x) = parents.at(parents.at(x));
+            return x;
+        }
+
+        // whether the rule is not in the state left by Rule::deactivate()
+        bool isActive(const Rule* rule) {
+            return rule->getActivationDegree() != 0.0 or rule->isTriggered();
+        }
+
+        bool isSame(scalar a, scalar b) {
+            return a == b or (Op::isNaN(a) and Op::isNaN(b));
+        }
+    }
+
+    IncrementalEvaluator::IncrementalEvaluator() :
+        _recorded(false),
+        _supported(false),
+        _evaluatedRules(0) {}
+
+    IncrementalEvaluator::~IncrementalEvaluator() {}
+
+    void IncrementalEvaluator::snapshot(
+        const Engine* engine,
+        std::vector<const void*>& structure,
+        std::vector<int>& enabled,
+        std::vector<std::size_t>& revisions
+    ) const {
+        structure.clear();
+        enabled.clear();
+        revisions.clear();
+        for (std::size_t i = 0; i < engine->numberOfInputVariables(); ++i) {
+            structure.push_back(engine->getInputVariable(i));
+            enabled.push_back(engine->getInputVariable(i)->isEnabled());
+        }
+        for (std::size_t i = 0; i < engine->numberOfOutputVariables(); ++i) {
+            const OutputVariable* outputVariable = engine->getOutputVariable(i);
+            structure.push_back(outputVariable);
+            structure.push_back(outputVariable->fuzzyOutput()->getAggregation());
+            structure.push_back(outputVariable->getDefuzzifier());
+            enabled.push_back(outputVariable->isEnabled());
+        }
+        for (std::size_t b = 0; b < engine->numberOfRuleBlocks(); ++b) {
+            const RuleBlock* ruleBlock = engine->getRuleBlock(b);
+            structure.push_back(ruleBlock);
+            structure.push_back(ruleBlock->getConjunction());
+            structure.push_back(ruleBlock->getDisjunction());
+            structure.push_back(ruleBlock->getImplication());
+            structure.push_back(ruleBlock->getActivation());
+            structure.insert(structure.end(), ruleBlock->rules().begin(), ruleBlock->rules().end());
+            enabled.push_back(ruleBlock->isEnabled());
+            revisions.push_back(ruleBlock->revision());
+        }
+    }
+
+    void IncrementalEvaluator::record(const Engine* engine) {
+        snapshot(engine, _currentStructure, _currentEnabled, _currentRevisions);
+        if (_recorded and not _supported and _structure == _currentStructure and _enabled == _currentEnabled
+            and _revisions == _currentRevisions)
+            return;
+        clear();
+        _structure.swap(_currentStructure);
+        _enabled.swap(_currentEnabled);
+        _revisions.swap(_currentRevisions);
+        _recorded = true;
+
+        const std::vector<InputVariable*>& inputs = engine->inputVariables();
+        const std::vector<OutputVariable*>& outputs = engine->outputVariables();
+        _dependents.resize(inputs.size());
+        std::vector<std::size_t> parents(outputs.size());
+        for (std::size_t o = 0; o < outputs.size(); ++o)
+            parents.at(o) = o;
+        std::vector<std::size_t> ruleOutputs(0);
+
+        _blockRules.push_back(0);
+        for (std::size_t b = 0; b < engine->numberOfRuleBlocks(); ++b) {
+            RuleBlock* ruleBlock = engine->getRuleBlock(b);
+            if (ruleBlock->isEnabled()) {
+                if (not dynamic_cast<const General*>(ruleBlock->getActivation()))
+                    return;
+                for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r) {
+                    Rule* rule = ruleBlock->getRule(r);
+                    std::vector<std::size_t> inputIndexes;
+                    if (not dependencies(rule->getAntecedent()->getExpression(), inputs, inputIndexes))
+                        return;
+                    const std::size_t id = _rules.size();
+                    if (not _ruleIds.insert(std::make_pair(rule, id)).second)
+                        return;
+                    for (std::size_t i = 0; i < inputIndexes.size(); ++i) {
+                        std::vector<std::size_t>& dependents = _dependents.at(inputIndexes.at(i));
+                        if (dependents.empty() or dependents.back() != id)
+                            dependents.push_back(id);
+                    }
+                    // the output variables modified by the same rule are aggregated together
+                    std::size_t first = none;
+                    const std::vector<Proposition*>& conclusions = rule->getConsequent()->conclusions();
+                    for (std::size_t c = 0; c < conclusions.size(); ++c) {
+                        for (std::size_t o = 0; o < outputs.size(); ++o) {
+                            if (conclusions.at(c)->variable == outputs.at(o)) {
+                                if (first == none)
+                                    first = o;
+                                else
+                                    parents.at(find(parents, o)) = find(parents, first);
+                            }
+                        }
+                    }
+                    ruleOutputs.push_back(first);
+                    Entry entry;
+                    entry.ruleBlock = ruleBlock;
+                    entry.rule = rule;
+                    entry.component = none;
+                    _rules.push_back(entry);
+                }
+            }
+            _blockRules.push_back(_rules.size());
+        }
+
+        _outputComponents.assign(outputs.size(), none);
+        for (std::size_t o = 0; o < outputs.size(); ++o) {
+            const std::size_t root = find(parents, o);
+            if (_outputComponents.at(root) == none) {
+                _outputComponents.at(root) = _componentOutputs.size();
+                _componentOutputs.push_back(std::vector<std::size_t>());
+            }
+            _outputComponents.at(o) = _outputComponents.at(root);
+            _componentOutputs.at(_outputComponents.at(o)).push_back(o);
+        }
+        // the output variables whose terms read the values of the variables are affected by any change
+        _changeSensitive.assign(_componentOutputs.size(), 0);
+        for (std::size_t o = 0; o < outputs.size(); ++o) {
+            for (std::size_t t = 0; t < outputs.at(o)->numberOfTerms(); ++t) {
+                if (readsVariables(outputs.at(o)->getTerm(t)))
+                    _changeSensitive.at(_outputComponents.at(o)) = 1;
+            }
+        }
+        _componentRules.resize(_componentOutputs.size());
+        for (std::size_t r = 0; r < _rules.size(); ++r) {
+            if (ruleOutputs.at(r) != none) {
+                _rules.at(r).component = _outputComponents.at(ruleOutputs.at(r));
+                _componentRules.at(_rules.at(r).component).push_back(r);
+            }
+        }
+
+        _active.resize(_rules.size());
+        for (std::size_t r = 0; r < _rules.size(); ++r)
+            _active.at(r) = isActive(_rules.at(r).rule);
+        _inputValues.resize(inputs.size());
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+            _inputValues.at(i) = inputs.at(i)->getValue();
+        _supported = true;
+    }
+
+    bool IncrementalEvaluator::process(Engine* engine) {
+        if (not(_recorded and _supported))
+            return false;
+        snapshot(engine, _currentStructure, _currentEnabled, _currentRevisions);
+        if (_structure != _currentStructure or _enabled != _currentEnabled or _revisions != _currentRevisions)
+            return false;
+
+        const std::vector<InputVariable*>& inputs = engine->inputVariables();
+        const std::vector<OutputVariable*>& outputs = engine->outputVariables();
+        _dirty.assign(_rules.size(), 0);
+        bool changed = false;
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            if (not isSame(inputs.at(i)->getValue(), _inputValues.at(i))) {
+                changed = true;
+                const std::vector<std::size_t>& dependents = _dependents.at(i);
+                for (std::size_t r = 0; r < dependents.size(); ++r)
+                    _dirty.at(dependents.at(r)) = 1;
+            }
+        }
+
+        _evaluatedRules = 0;
+        if (changed)
+            _affected = _changeSensitive;
+        else
+            _affected.assign(_componentOutputs.size(), 0);
+        try {
+            for (std::size_t i = 0; i < inputs.size(); ++i) {
+                if (inputs.at(i)->isEnabled())
+                    inputs.at(i)->cacheMemberships();
+            }
+            // activates the rules as General::activate() does
+            for (std::size_t b = 0; b + 1 < _blockRules.size(); ++b) {
+                bool dirty = false;
+                for (std::size_t r = _blockRules.at(b); r < _blockRules.at(b + 1); ++r) {
+                    if (_dirty.at(r)) {
+                        dirty = true;
+                        // the inactive rules are already deactivated
+                        if (_active.at(r)) {
+                            _rules.at(r).rule->deactivate();
+                            _active.at(r) = 0;
+                            if (_rules.at(r).component != none)
+                                _affected.at(_rules.at(r).component) = 1;
+                        }
+                    }
+                }
+                if (not dirty)
+                    continue;
+                RuleBlock* ruleBlock = _rules.at(_blockRules.at(b)).ruleBlock;
+                const std::vector<Rule*>& candidates = ruleBlock->candidateRules(_candidates);
+                for (std::size_t c = 0; c < candidates.size(); ++c) {
+                    Rule* rule = candidates.at(c);
+                    const std::size_t id = _ruleIds.find(rule)->second;
+                    if (_dirty.at(id) and rule->isLoaded()) {
+                        rule->activateWith(ruleBlock->getConjunction(), ruleBlock->getDisjunction());
+                        ++_evaluatedRules;
+                        if (_rules.at(id).component == none) {
+                            // the rules without conclusions on the output variables are triggered here
+                            rule->trigger(ruleBlock->getImplication());
+                        } else {
+                            _affected.at(_rules.at(id).component) = 1;
+                        }
+                        _active.at(id) = 1;
+                    }
+                }
+            }
+            // aggregates the affected output variables in the order of the rules
+            for (std::size_t c = 0; c < _componentOutputs.size(); ++c) {
+                if (not _affected.at(c))
+                    continue;
+                for (std::size_t o = 0; o < _componentOutputs.at(c).size(); ++o)
+                    outputs.at(_componentOutputs.at(c).at(o))->fuzzyOutput()->clear();
+                for (std::size_t r = 0; r < _componentRules.at(c).size(); ++r) {
+                    const std::size_t id = _componentRules.at(c).at(r);
+                    if (_active.at(id)) {
+                        const Entry& entry = _rules.at(id);
+                        entry.rule->trigger(entry.ruleBlock->getImplication());
+                        _active.at(id) = isActive(entry.rule);
+                    }
+                }
+            }
+        } catch (...) {
+            for (std::size_t i = 0; i < inputs.size(); ++i)
+                inputs.at(i)->clearMembershipCache();
+            clear();
+            throw;
+        }
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+            inputs.at(i)->clearMembershipCache();
+
+        try {
+            for (std::size_t o = 0; o < outputs.size(); ++o) {
+                OutputVariable* output = outputs.at(o);
+                if (_affected.at(_outputComponents.at(o))) {
+                    output->defuzzify();
+                } else if (output->isEnabled() and Op::isFinite(output->getValue())) {
+                    // the defuzzification of the same fuzzy output yields the same value
+                    output->setPreviousValue(output->getValue());
+                }
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+            _inputValues.at(i) = inputs.at(i)->getValue();
+        return true;
+    }
+
+    void IncrementalEvaluator::clear() {
+        _recorded = false;
+        _supported = false;
+        _structure.clear();
+        _enabled.clear();
+        _revisions.clear();
+        _inputValues.clear();
+        _rules.clear();
+        _active.clear();
+        _ruleIds.clear();
+        _blockRules.clear();
+        _dependents.clear();
+        _componentRules.clear();
+        _componentOutputs.clear();
+        _outputComponents.clear();
+        _changeSensitive.clear();
+        _evaluatedRules = 0;
+    }
+
+    bool IncrementalEvaluator::isRecorded() const {
+        return this->_recorded;
+    }
+
+    std::size_t IncrementalEvaluator::numberOfEvaluatedRules() const {
+        return this->_evaluatedRules;
+    }
+
+}
@@ -0,0 +1,301 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/ParallelEvaluator.h"
+
+#include <algorithm>
+#include <deque>
+
+#ifndef FL_CPP98
+#include <mutex>
+#include <thread>
+#endif
+
+#include "fuzzylite/CompiledEngine.h"
+#include "fuzzylite/EvaluationContext.h"
+#include "fuzzylite/Exception.h"
+
+namespace fuzzylite {
+
+    namespace {
+        /**
+          The queue of chunks of a worker. The owner takes the chunks from the
+          front and the thieves take the chunks from the back.
+         */
+        class ChunkQueue {
+          private:
+            std::deque<std::size_t> _chunks;
+#ifndef FL_CPP98
+            std::mutex _mutex;
+#endif
+
+          public:
+            void push(std::size_t chunk) {
+                _chunks.push_back(chunk);
+            }
+
+            bool take(std::size_t& chunk) {
+#ifndef FL_CPP98
+                std::lock_guard<std::mutex> lock(_mutex);
+#endif
+                if (_chunks.empty())
+                    return false;
+                chunk = _chunks.front();
+                _chunks.pop_front();
+                return true;
+            }
+
+            bool steal(std::size_t& chunk) {
+#ifndef FL_CPP98
+                std::lock_guard<std::mutex> lock(_mutex);
+#endif
+                if (_chunks.empty())
+                    return false;
+                chunk = _chunks.back();
+                _chunks.pop_back();
+                return true;
+            }
+        };
+
+        /**
+          The work shared by the workers of ParallelEvaluator::process()
+         */
+        class Work {
+          private:
+            const CompiledEngine* _engine;
+            const scalar* _inputs;
+            std::size_t _rows;
+            scalar* _outputs;
+            Engine::Layout _layout;
+            std::size_t _chunkSize;
+            std::vector<ChunkQueue*> _queues;
+            std::vector<std::string> _errors;
+            std::vector<int> _failed;
+
+            void process(std::size_t chunk, EvaluationContext& context, const EvaluationContext& initial) {
+                // every chunk starts from the state at compilation to make the results independent of the scheduling
+                context = initial;
+                const std::size_t numberOfInputs = _engine->numberOfInputVariables();
+                const std::size_t numberOfOutputs = _engine->numberOfOutputVariables();
+                const bool rowMajor = _layout == Engine::RowMajor;
+                const std::size_t end = std::min(_rows, (chunk + 1) * _chunkSize);
+                for (std::size_t row = chunk * _chunkSize; row < end; ++row) {
+                    for (std::size_t i = 0; i < numberOfInputs; ++i)
+                        context.setInputValue(i, _inputs[rowMajor ? row * numberOfInputs + i : i * _rows + row]);
+                    bool failed = false;
+                    try {
+                        _engine->process(context);
+                    } catch (std::exception& ex) {
+                        _errors.at(chunk) = ex.what();
+                        failed = true;
+                    }
+                    for (std::size_t o = 0; o < numberOfOutputs; ++o)
+                        _outputs[rowMajor ? row * numberOfOutputs + o : o * _rows + row] = context.getOutputValue(o);
+                    if (failed) {
+                        _failed.at(chunk) = 1;
+                        return;
+                    }
+                }
+            }
+
+          public:
+            Work(
+                const CompiledEngine* engine,
+                const scalar* inputs,
+                std::size_t rows,
+                scalar* outputs,
+                Engine::Layout layout,
+                std::size_t chunkSize,
+                std::size_t numberOfWorkers
+            ) :
+                _engine(engine),
+                _inputs(inputs),
+                _rows(rows),
+                _outputs(outputs),
+                _layout(layout),
+                _chunkSize(chunkSize) {
+                const std::size_t chunks = (rows + chunkSize - 1) / chunkSize;
+                _errors.resize(chunks);
+                _failed.resize(chunks, 0);
+                // each worker starts with a contiguous range of chunks
+                for (std::size_t w = 0; w < numberOfWorkers; ++w) {
+                    ChunkQueue* queue = new ChunkQueue;
+                    for (std::size_t c = w * chunks / numberOfWorkers; c < (w + 1) * chunks / numberOfWorkers; ++c)
+                        queue->push(c);
+                    _queues.push_back(queue);
+                }
+            }
+
+            ~Work() {
+                for (std::size_t i = 0; i < _queues.size(); ++i)
+                    delete _queues.at(i);
+            }
+
+            void run(std::size_t worker) {
+                const EvaluationContext initial(_engine);
+                EvaluationContext context(initial);
+                std::size_t chunk;
+                while (true) {
+                    bool found = _queues.at(worker)->take(chunk);
+                    for (std::size_t i = 1; not found and i < _queues.size(); ++i)
+                        found = _queues.at((worker + i) % _queues.size())->steal(chunk);
+                    if (not found)
+                        return;
+                    process(chunk, context, initial);
+                }
+            }
+
+            void rethrow() const {
+                for (std::size_t c = 0; c < _failed.size(); ++c)
+                    if (_failed.at(c))
+                        throw Exception(_errors.at(c), FL_AT);
+            }
+
+          private:
+            FL_DISABLE_COPY(Work)
+        };
+
+#ifndef FL_CPP98
+        void runWorker(Work* work, std::size_t worker) {
+            work->run(worker);
+        }
+#endif
+    }
+
+    ParallelEvaluator::ParallelEvaluator(std::size_t numberOfThreads, std::size_t chunkSize) :
+        _numberOfThreads(numberOfThreads),
+        _chunkSize(chunkSize) {}
+
+    ParallelEvaluator::~ParallelEvaluator() {}
+
+    void ParallelEvaluator::setNumberOfThreads(std::size_t numberOfThreads) {
+        this->_numberOfThreads = numberOfThreads;
+    }
+
+    std::size_t ParallelEvaluator::getNumberOfThreads() const {
+        return this->_numberOfThreads;
+    }
+
+    void ParallelEvaluator::setChunkSize(std::size_t chunkSize) {
+        this->_chunkSize = chunkSize;
+    }
+
+    std::size_t ParallelEvaluator::getChunkSize() const {
+        return this->_chunkSize;
+    }
+
+    std::size_t ParallelEvaluator::hardwareConcurrency() {
+#ifdef FL_CPP98
+        return 1;
+#else
+        const std::size_t result = std::thread::hardware_concurrency();
+        return result == 0 ? 1 : result;
+#endif
+    }
+
+    void ParallelEvaluator::process(
+        const CompiledEngine* engine, const scalar* inputs, std::size_t rows, scalar* outputs, Engine::Layout layout
+    ) const {
+        if (not engine or not engine->isCompiled())
+            throw Exception("[parallel error] expected a compiled engine, but found none", FL_AT);
+        if (rows == 0)
+            return;
+        const std::size_t chunkSize = std::max(std::size_t(1), _chunkSize);
+#ifdef FL_CPP98
+        const std::size_t numberOfWorkers = 1;
+#else
+        const std::size_t chunks = (rows + chunkSize - 1) / chunkSize;
+        const std::size_t numberOfWorkers
+            = std::min(chunks, _numberOfThreads == 0 ? hardwareConcurrency() : _numberOfThreads);
+#endif
+
+        Work work(engine, inputs, rows, outputs, layout, chunkSize, numberOfWorkers);
+#ifdef FL_CPP98
+        work.run(0);
+#else
+        // the calling thread is the first worker
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfWorkers - 1);
+        try {
+            for (std::size_t w = 1; w < numberOfWorkers; ++w)
+                threads.push_back(std::thread(runWorker, &work, w));
+            work.run(0);
+        } catch (...) {
+            // the threads started steal the remaining chunks, and must be joined before the work is destroyed
+            for (std::size_t t = 0; t < threads.size(); ++t)
+                threads.at(t).join();
+            throw;
+        }
+        for (std::size_t t = 0; t < threads.size(); ++t)
+            threads.at(t).join();
+#endif
+        work.rethrow();
+    }
+
+    void ParallelEvaluator::process(
+        const Engine* engine, const scalar* inputs, std::size_t rows, scalar* outputs, Engine::Layout layout
+    ) const {
+        if (not engine)
+            throw Exception("[parallel error] expected an engine, but found none", FL_AT);
+        const CompiledEngine compiled(engine);
+        process(&compiled, inputs, rows, outputs, layout);
+    }
+
+    void ParallelEvaluator::process(
+        const Engine* engine,
+        const std::vector<std::vector<scalar> >& inputRows,
+        std::vector<std::vector<scalar> >& outputRows
+    ) const {
+        if (not engine)
+            throw Exception("[parallel error] expected an engine, but found none", FL_AT);
+        const std::size_t numberOfInputs = engine->numberOfInputVariables();
+        const std::size_t numberOfOutputs = engine->numberOfOutputVariables();
+        const std::size_t rows = inputRows.size();
+        std::vector<scalar> inputs(rows * numberOfInputs, fl::nan);
+        for (std::size_t r = 0; r < rows; ++r) {
+            if (inputRows.at(r).size() != numberOfInputs) {
+                std::ostringstream ss;
+                ss << "[parallel error] expected " << numberOfInputs << " input values in row " << r << ", but found "
+                   << inputRows.at(r).size();
+                throw Exception(ss.str(), FL_AT);
+            }
+            std::copy(inputRows.at(r).begin(), inputRows.at(r).end(), inputs.begin() + r * numberOfInputs);
+        }
+        std::vector<scalar> outputs(rows * numberOfOutputs, fl::nan);
+
+        std::string exception;
+        try {
+            if (rows > 0)
+                process(
+                    engine,
+                    inputs.empty() ? fl::null : &inputs.at(0),
+                    rows,
+                    outputs.empty() ? fl::null : &outputs.at(0),
+                    Engine::RowMajor
+                );
+        } catch (std::exception& ex) { exception = ex.what(); }
+
+        outputRows.resize(rows);
+        for (std::size_t r = 0; r < rows; ++r)
+            outputRows.at(r).assign(
+                outputs.begin() + r * numberOfOutputs, outputs.begin() + (r + 1) * numberOfOutputs
+            );
+        if (not exception.empty())
+            throw Exception(exception, FL_AT);
+    }
+
+}
@@ -46,9 +46,13 @@ namespace fuzzylite {
         const TNorm* implication = ruleBlock->getImplication();
 
         const std::size_t numberOfRules = ruleBlock->numberOfRules();
-        for (std::size_t i = 0; i < numberOfRules; ++i) {
-            Rule* rule = ruleBlock->getRule(i);
-            rule->deactivate();
+        for (std::size_t i = 0; i < numberOfRules; ++i)
+            ruleBlock->getRule(i)->deactivate();
+
+        // the rules that are not candidates have an activation degree of zero
+        const std::vector<Rule*>& candidates = ruleBlock->candidateRules();
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            Rule* rule = candidates.at(i);
             if (rule->isLoaded()) {
                 rule->activateWith(conjunction, disjunction);
                 rule->trigger(implication);
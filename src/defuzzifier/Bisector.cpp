@@ -21,7 +21,9 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 namespace fuzzylite {
 
-    Bisector::Bisector(int resolution) : IntegralDefuzzifier(resolution) {}
+    Bisector::Bisector(int resolution, scalar tolerance, bool restrictedToSupport) :
+        IntegralDefuzzifier(resolution, restrictedToSupport),
+        _tolerance(tolerance) {}
 
     Bisector::~Bisector() {}
 
@@ -29,38 +31,23 @@ namespace fuzzylite {
         return "Bisector";
     }
 
+    void Bisector::setTolerance(scalar tolerance) {
+        this->_tolerance = tolerance;
+    }
+
+    scalar Bisector::getTolerance() const {
+        return this->_tolerance;
+    }
+
     scalar Bisector::defuzzify(const Term* term, scalar minimum, scalar maximum) const {
-        if (not Op::isFinite(minimum + maximum))
-            return fl::nan;
-
-        const std::vector<scalar> x = Op::midpoints(minimum, maximum, getResolution());
-        std::vector<scalar> ysum;
-        ysum.reserve(getResolution());
-        scalar sum = 0.0;
-
-        // Compute area
-        for (std::size_t i = 0; i < x.size(); ++i) {
-            const scalar yi = term->membership(x.at(i));
-            if (Op::isFinite(yi))
-                sum += yi;
-            ysum.push_back(sum);
-        }
-
-        // Normalize area
-        minimum = fl::inf;
-        for (std::size_t i = 0; i < x.size(); ++i) {
-            ysum.at(i) = fabs(ysum.at(i) / sum - 0.5);
-            if (ysum.at(i) < minimum)
-                minimum = ysum.at(i);
-        }
-
-        // All minima x are bisectors
-        std::vector<scalar> bisectors;
-        for (std::size_t i = 0; i < x.size(); ++i)
-            if (minimum == ysum.at(i))
-                bisectors.push_back(x.at(i));
-        const scalar bisector = Op::mean(bisectors);
-        return bisector;
+        return defuzzification(term, minimum, maximum).bisector;
+    }
+
+    IntegralDefuzzifier::Statistics
+    Bisector::defuzzification(const Term* term, scalar minimum, scalar maximum) const {
+        if (_tolerance > 0.0)
+            return adaptiveStatistics(term, minimum, maximum, _tolerance, BisectorStatistic);
+        return statistics(term, minimum, maximum, BisectorStatistic);
     }
 
     Bisector* Bisector::clone() const {
@@ -17,11 +17,130 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/defuzzifier/Centroid.h"
 
+#include <algorithm>
+
+#include "fuzzylite/norm/s/Maximum.h"
+#include "fuzzylite/norm/t/AlgebraicProduct.h"
+#include "fuzzylite/norm/t/Minimum.h"
+#include "fuzzylite/term/Activated.h"
+#include "fuzzylite/term/Aggregated.h"
+#include "fuzzylite/term/Constant.h"
+#include "fuzzylite/term/Discrete.h"
+#include "fuzzylite/term/Ramp.h"
+#include "fuzzylite/term/Rectangle.h"
 #include "fuzzylite/term/Term.h"
+#include "fuzzylite/term/Trapezoid.h"
+#include "fuzzylite/term/Triangle.h"
 
 namespace fuzzylite {
 
-    Centroid::Centroid(int resolution) : IntegralDefuzzifier(resolution) {}
+    namespace {
+        /**
+          A term modified by an implication operator, whose membership
+          function is linear between the vertices of the term
+         */
+        struct Component {
+            const Term* term;
+            const TNorm* implication;
+            scalar degree;
+
+            scalar membership(scalar x) const {
+                const scalar y = term->membership(x);
+                return implication ? implication->compute(y, degree) : y;
+            }
+        };
+
+        // the vertices of the piecewise-linear terms
+        bool addVertices(const Term* term, std::vector<scalar>& vertices) {
+            if (not term or not(term->getHeight() >= 0.0))
+                return false;
+            if (const Triangle* triangle = dynamic_cast<const Triangle*>(term)) {
+                vertices.push_back(triangle->getVertexA());
+                vertices.push_back(triangle->getVertexB());
+                vertices.push_back(triangle->getVertexC());
+            } else if (const Trapezoid* trapezoid = dynamic_cast<const Trapezoid*>(term)) {
+                vertices.push_back(trapezoid->getVertexA());
+                vertices.push_back(trapezoid->getVertexB());
+                vertices.push_back(trapezoid->getVertexC());
+                vertices.push_back(trapezoid->getVertexD());
+            } else if (const Rectangle* rectangle = dynamic_cast<const Rectangle*>(term)) {
+                vertices.push_back(rectangle->getStart());
+                vertices.push_back(rectangle->getEnd());
+            } else if (const Ramp* ramp = dynamic_cast<const Ramp*>(term)) {
+                vertices.push_back(ramp->getStart());
+                vertices.push_back(ramp->getEnd());
+            } else if (const Discrete* discrete = dynamic_cast<const Discrete*>(term)) {
+                for (std::size_t i = 0; i < discrete->xy().size(); ++i)
+                    vertices.push_back(discrete->xy().at(i).first);
+            } else if (not dynamic_cast<const Constant*>(term)) {
+                return false;
+            }
+            return true;
+        }
+
+        bool addComponent(
+            const Term* term, const TNorm* implication, scalar degree, std::vector<Component>& components
+        ) {
+            if (implication and not(dynamic_cast<const Minimum*>(implication)
+                                    or dynamic_cast<const AlgebraicProduct*>(implication)))
+                return false;
+            if (implication and not(degree >= 0.0 and Op::isFinite(degree)))
+                return false;
+            // the maximum of the same term modified by the same implication is the term modified by the maximum degree
+            for (std::size_t i = 0; i < components.size(); ++i) {
+                Component& component = components.at(i);
+                if (component.term == term and component.implication == implication) {
+                    component.degree = std::max(component.degree, degree);
+                    return true;
+                }
+            }
+            const Component component = {term, implication, degree};
+            components.push_back(component);
+            return true;
+        }
+
+        /**
+          Extrapolates the values at the ends of a segment where the function
+          is linear from two interior points, so the discontinuities at the
+          ends are ignored
+         */
+        template <typename Function>
+        void linearEnds(const Function& function, scalar a, scalar b, scalar& ya, scalar& yb) {
+            const scalar y1 = function.membership(a + (b - a) / 3.0);
+            const scalar y2 = function.membership(b - (b - a) / 3.0);
+            ya = 2.0 * y1 - y2;
+            yb = 2.0 * y2 - y1;
+        }
+
+        void sortUnique(std::vector<scalar>& points, scalar minimum, scalar maximum) {
+            std::vector<scalar>::iterator end = std::remove_if(points.begin(), points.end(), Op::isNaN<scalar>);
+            points.erase(end, points.end());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                points.at(i) = Op::bound(points.at(i), minimum, maximum);
+            std::sort(points.begin(), points.end());
+            points.erase(std::unique(points.begin(), points.end()), points.end());
+        }
+
+        /**
+          The maximum of the components, as computed by Aggregated::membership()
+          with the Maximum aggregation operator
+         */
+        struct Envelope {
+            const std::vector<Component>& components;
+
+            scalar membership(scalar x) const {
+                scalar result = 0.0;
+                for (std::size_t i = 0; i < components.size(); ++i)
+                    result = Op::max(result, components[i].membership(x));
+                return result;
+            }
+        };
+    }
+
+    Centroid::Centroid(int resolution, bool exact, scalar tolerance, bool restrictedToSupport) :
+        IntegralDefuzzifier(resolution, restrictedToSupport),
+        _exact(exact),
+        _tolerance(tolerance) {}
 
     Centroid::~Centroid() {}
 
@@ -29,22 +148,153 @@ namespace fuzzylite {
         return "Centroid";
     }
 
+    void Centroid::setExact(bool exact) {
+        this->_exact = exact;
+    }
+
+    bool Centroid::isExact() const {
+        return this->_exact;
+    }
+
+    void Centroid::setTolerance(scalar tolerance) {
+        this->_tolerance = tolerance;
+    }
+
+    scalar Centroid::getTolerance() const {
+        return this->_tolerance;
+    }
+
     scalar Centroid::defuzzify(const Term* term, scalar minimum, scalar maximum) const {
+        return defuzzification(term, minimum, maximum).centroid;
+    }
+
+    IntegralDefuzzifier::Statistics
+    Centroid::defuzzification(const Term* term, scalar minimum, scalar maximum) const {
+        Statistics result;
         if (not Op::isFinite(minimum + maximum))
-            return fl::nan;
+            return result;
+
+        if (_exact) {
+            scalar area;
+            if (exactCentroid(term, minimum, maximum, result.centroid, area))
+                return result;
+        }
 
-        const int resolution = getResolution();
-        const scalar dx = (maximum - minimum) / resolution;
-        scalar area = 0.0, centroid = 0.0;
-        for (int i = 0; i < resolution; ++i) {
-            const scalar x = minimum + (i + 0.5) * dx;
-            const scalar y = term->membership(x);
+        if (_tolerance > 0.0)
+            return adaptiveStatistics(term, minimum, maximum, _tolerance, CentroidStatistic);
+        return statistics(term, minimum, maximum, CentroidStatistic);
+    }
+
+    bool Centroid::exactCentroid(
+        const Term* term, scalar minimum, scalar maximum, scalar& centroid, scalar& area
+    ) const {
+        if (not Op::isFinite(minimum + maximum) or minimum > maximum)
+            return false;
+
+        std::vector<Component> components;
+        std::vector<scalar> points;
+        if (const Aggregated* aggregated = dynamic_cast<const Aggregated*>(term)) {
+            if (not aggregated->isEmpty() and not dynamic_cast<const Maximum*>(aggregated->getAggregation()))
+                return false;
+            for (std::size_t i = 0; i < aggregated->numberOfTerms(); ++i) {
+                const Activated& activated = aggregated->getTerm(i);
+                if (not activated.getImplication()
+                    or not addComponent(
+                        activated.getTerm(), activated.getImplication(), activated.getDegree(), components
+                    ))
+                    return false;
+            }
+        } else if (const Activated* activated = dynamic_cast<const Activated*>(term)) {
+            if (not activated->getImplication()
+                or not addComponent(
+                    activated->getTerm(), activated->getImplication(), activated->getDegree(), components
+                ))
+                return false;
+        } else if (not addComponent(term, fl::null, 1.0, components)) {
+            return false;
+        }
+        for (std::size_t i = 0; i < components.size(); ++i) {
+            if (not addVertices(components.at(i).term, points))
+                return false;
+        }
+        points.push_back(minimum);
+        points.push_back(maximum);
+        sortUnique(points, minimum, maximum);
+
+        // the terms are linear between the vertices, and the implication clips them where they cross the degree
+        const std::size_t vertices = points.size();
+        for (std::size_t p = 0; p + 1 < vertices; ++p) {
+            const scalar a = points.at(p), b = points.at(p + 1);
+            for (std::size_t i = 0; i < components.size(); ++i) {
+                const Component& component = components.at(i);
+                if (not dynamic_cast<const Minimum*>(component.implication))
+                    continue;
+                scalar ya, yb;
+                linearEnds(*component.term, a, b, ya, yb);
+                const scalar degree = component.degree;
+                if ((ya < degree and yb > degree) or (ya > degree and yb < degree))
+                    points.push_back(a + (b - a) * (degree - ya) / (yb - ya));
+            }
+        }
+        sortUnique(points, minimum, maximum);
+
+        // the components are linear between the points, and their maximum changes where they intersect
+        if (components.size() > 1) {
+            std::vector<scalar> ya(components.size() + 1, 0.0), yb(components.size() + 1, 0.0);
+            const std::size_t segments = points.size();
+            for (std::size_t p = 0; p + 1 < segments; ++p) {
+                const scalar a = points.at(p), b = points.at(p + 1);
+                for (std::size_t i = 0; i < components.size(); ++i)
+                    linearEnds(components.at(i), a, b, ya.at(i), yb.at(i));
+                // the upper envelope of the lines (including zero) over the segment, from left to right
+                std::size_t current = components.size();
+                for (std::size_t i = 0; i < ya.size(); ++i) {
+                    if (ya.at(i) > ya.at(current)
+                        or (ya.at(i) == ya.at(current) and yb.at(i) - ya.at(i) > yb.at(current) - ya.at(current)))
+                        current = i;
+                }
+                scalar u = 0.0;
+                while (true) {
+                    std::size_t next = ya.size();
+                    scalar crossing = 1.0;
+                    const scalar slope = yb.at(current) - ya.at(current);
+                    for (std::size_t i = 0; i < ya.size(); ++i) {
+                        const scalar otherSlope = yb.at(i) - ya.at(i);
+                        if (not(otherSlope > slope))
+                            continue;
+                        const scalar t = (ya.at(current) - ya.at(i)) / (otherSlope - slope);
+                        if (not(t > u) or t > crossing)
+                            continue;
+                        if (t < crossing or next == ya.size() or otherSlope > yb.at(next) - ya.at(next)) {
+                            crossing = t;
+                            next = i;
+                        }
+                    }
+                    if (next == ya.size())
+                        break;
+                    points.push_back(a + (b - a) * crossing);
+                    u = crossing;
+                    current = next;
+                }
+            }
+            sortUnique(points, minimum, maximum);
+        }
 
-            centroid += y * x;
-            area += y;
+        // the integrals of the linear segments
+        const Envelope envelope = {components};
+        scalar moment = 0.0;
+        area = 0.0;
+        for (std::size_t p = 0; p + 1 < points.size(); ++p) {
+            const scalar a = points.at(p), b = points.at(p + 1);
+            scalar ya, yb;
+            linearEnds(envelope, a, b, ya, yb);
+            if (not(Op::isFinite(ya) and Op::isFinite(yb)))
+                return false;
+            area += (b - a) * (ya + yb) / 2.0;
+            moment += (b - a) * (a * (2.0 * ya + yb) + b * (ya + 2.0 * yb)) / 6.0;
         }
-        centroid /= area;
-        return centroid;
+        centroid = moment / area;
+        return true;
     }
 
     Centroid* Centroid::clone() const {
@@ -17,8 +17,162 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/defuzzifier/IntegralDefuzzifier.h"
 
+#include <algorithm>
+
+#include "fuzzylite/term/Activated.h"
+#include "fuzzylite/term/Aggregated.h"
+#include "fuzzylite/term/Term.h"
+
 namespace fuzzylite {
 
+    namespace {
+        // Intervals are subdivided at least this many times, and at most the maximum
+        const int MinimumDepth = 3;
+        const int MaximumDepth = 50;
+
+        // Half of a Simpson interval: the membership values at its start, middle, and end
+        struct Interval {
+            scalar start, end;
+            scalar y0, y1, y2;
+
+            Interval(scalar start, scalar end, scalar y0, scalar y1, scalar y2) :
+                start(start),
+                end(end),
+                y0(y0),
+                y1(y1),
+                y2(y2) {}
+
+            // Integral of the quadratic interpolation from the start to the fraction s of the interval
+            scalar area(scalar s) const {
+                return (end - start) * s
+                       * (y0 + s * (-3.0 * y0 + 4.0 * y1 - y2) / 2.0 + s * s * (2.0 * y0 - 4.0 * y1 + 2.0 * y2) / 3.0);
+            }
+
+            scalar area() const {
+                return (end - start) * (y0 + 4.0 * y1 + y2) / 6.0;
+            }
+        };
+
+        struct AdaptiveSimpson {
+            const Term* term;
+            scalar center;
+            scalar tolerance;
+            scalar minimumWidth;
+            bool keepIntervals;
+            std::size_t samples;
+            scalar area;
+            scalar moment;
+            std::vector<Interval> intervals;
+
+            AdaptiveSimpson(const Term* term, scalar center, scalar tolerance, scalar range, bool keepIntervals) :
+                term(term),
+                center(center),
+                tolerance(tolerance),
+                minimumWidth(tolerance * range),
+                keepIntervals(keepIntervals),
+                samples(0),
+                area(0.0),
+                moment(0.0) {}
+
+            scalar membership(scalar x) {
+                ++samples;
+                return term->membership(x);
+            }
+
+            // The moments are about the center of the range to keep their magnitude close to the area
+            void integrate(scalar a, scalar b, scalar ya, scalar ym, scalar yb, int depth) {
+                const scalar m = 0.5 * (a + b), h = b - a;
+                const scalar l = 0.5 * (a + m), r = 0.5 * (m + b);
+                const scalar yl = membership(l), yr = membership(r);
+                const scalar ga = (a - center) * ya, gl = (l - center) * yl, gm = (m - center) * ym;
+                const scalar gr = (r - center) * yr, gb = (b - center) * yb;
+
+                const scalar wholeArea = h * (ya + 4.0 * ym + yb) / 6.0;
+                const scalar halvesArea = h * (ya + 4.0 * yl + 2.0 * ym + 4.0 * yr + yb) / 12.0;
+                const scalar wholeMoment = h * (ga + 4.0 * gm + gb) / 6.0;
+                const scalar halvesMoment = h * (ga + 4.0 * gl + 2.0 * gm + 4.0 * gr + gb) / 12.0;
+                const scalar areaError = halvesArea - wholeArea, momentError = halvesMoment - wholeMoment;
+
+                const scalar limit = 15.0 * tolerance * h;
+                const bool converged = std::abs(areaError) <= limit and std::abs(momentError) <= limit;
+                // intervals narrower than the tolerance stop the subdivision at discontinuities
+                if (depth >= MaximumDepth or h <= minimumWidth or not Op::isFinite(areaError + momentError)
+                    or (depth >= MinimumDepth and converged)) {
+                    area += halvesArea + areaError / 15.0;
+                    moment += halvesMoment + momentError / 15.0;
+                    if (keepIntervals) {
+                        intervals.push_back(Interval(a, m, ya, yl, ym));
+                        intervals.push_back(Interval(m, b, ym, yr, yb));
+                    }
+                    return;
+                }
+                integrate(a, m, ya, yl, ym, depth + 1);
+                integrate(m, b, ym, yr, yb, depth + 1);
+            }
+        };
+
+        // Supports of the terms, where those of an aggregated term are the supports of its activated terms
+        void addSupports(const Term* term, std::vector<std::pair<scalar, scalar> >& supports) {
+            if (const Aggregated* aggregated = dynamic_cast<const Aggregated*>(term)) {
+                for (std::size_t i = 0; i < aggregated->numberOfTerms(); ++i)
+                    supports.push_back(aggregated->getTerm(i).support());
+            } else if (term) {
+                supports.push_back(term->support());
+            }
+        }
+
+        // Union of the supports of the terms within [lower, upper] as sorted and disjoint intervals
+        void unionOfSupports(
+            const Term* term, scalar lower, scalar upper, std::vector<std::pair<scalar, scalar> >& result
+        ) {
+            result.clear();
+            addSupports(term, result);
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < result.size(); ++i) {
+                // a support that is not a number is unbounded
+                const scalar a = Op::isNaN(result.at(i).first) ? lower : std::max(result.at(i).first, lower);
+                const scalar b = Op::isNaN(result.at(i).second) ? upper : std::min(result.at(i).second, upper);
+                if (a < b)
+                    result.at(size++) = std::pair<scalar, scalar>(a, b);
+            }
+            result.resize(size);
+            std::sort(result.begin(), result.end());
+            size = 0;
+            for (std::size_t i = 0; i < result.size(); ++i) {
+                if (size > 0 and result.at(i).first <= result.at(size - 1).second)
+                    result.at(size - 1).second = std::max(result.at(size - 1).second, result.at(i).second);
+                else
+                    result.at(size++) = result.at(i);
+            }
+            result.resize(size);
+        }
+
+        // Leftmost (or rightmost) x at which the cumulative area reaches the target from the left (or right)
+        scalar crossing(const std::vector<Interval>& intervals, scalar target, bool fromLeft) {
+            scalar cumulative = 0.0;
+            for (std::size_t k = 0; k < intervals.size(); ++k) {
+                const Interval& interval = intervals.at(fromLeft ? k : intervals.size() - 1 - k);
+                const scalar area = interval.area();
+                if (cumulative + area < target and k + 1 < intervals.size()) {
+                    cumulative += area;
+                    continue;
+                }
+                scalar low = 0.0, high = 1.0;
+                for (int i = 0; i < 52; ++i) {
+                    const scalar s = 0.5 * (low + high);
+                    const bool reached = fromLeft ? cumulative + interval.area(s) >= target
+                                                  : cumulative + area - interval.area(s) >= target;
+                    if (reached == fromLeft)
+                        high = s;
+                    else
+                        low = s;
+                }
+                return interval.start + (fromLeft ? high : low) * (interval.end - interval.start);
+            }
+            return fl::nan;
+        }
+    }
+
     int IntegralDefuzzifier::_defaultResolution = 1000;
 
     void IntegralDefuzzifier::setDefaultResolution(int defaultResolution) {
@@ -29,7 +183,10 @@ namespace fuzzylite {
         return _defaultResolution;
     }
 
-    IntegralDefuzzifier::IntegralDefuzzifier(int resolution) : Defuzzifier(), _resolution(resolution) {}
+    IntegralDefuzzifier::IntegralDefuzzifier(int resolution, bool restrictedToSupport) :
+        Defuzzifier(),
+        _resolution(resolution),
+        _restrictedToSupport(restrictedToSupport) {}
 
     IntegralDefuzzifier::~IntegralDefuzzifier() {}
 
@@ -41,4 +198,211 @@ namespace fuzzylite {
         return this->_resolution;
     }
 
+    void IntegralDefuzzifier::setRestrictedToSupport(bool restrictedToSupport) {
+        this->_restrictedToSupport = restrictedToSupport;
+    }
+
+    bool IntegralDefuzzifier::isRestrictedToSupport() const {
+        return this->_restrictedToSupport;
+    }
+
+    IntegralDefuzzifier::Statistics::Statistics() :
+        area(fl::nan),
+        centroid(fl::nan),
+        bisector(fl::nan),
+        smallestOfMaximum(fl::nan),
+        meanOfMaximum(fl::nan),
+        largestOfMaximum(fl::nan),
+        samples(0) {}
+
+    IntegralDefuzzifier::Statistics
+    IntegralDefuzzifier::statistics(const Term* term, scalar minimum, scalar maximum, int requested) const {
+        Statistics result;
+        if (not Op::isFinite(minimum + maximum))
+            return result;
+
+        // the buffers are local to keep the defuzzifier stateless
+        std::vector<scalar> xs, ys;
+        std::vector<std::pair<scalar, scalar> > supports;
+        const int resolution = getResolution();
+        std::size_t n = std::size_t(std::max(resolution, 0));
+        scalar dx = (maximum - minimum) / resolution;
+        if (_restrictedToSupport) {
+            // The samples are spread over the union of the supports as if its intervals were contiguous
+            unionOfSupports(term, Op::min(minimum, maximum), Op::max(minimum, maximum), supports);
+            scalar length = 0.0;
+            for (std::size_t k = 0; k < supports.size(); ++k)
+                length += supports.at(k).second - supports.at(k).first;
+            dx = length / resolution;
+            if (not(length > 0.0))
+                n = 0;
+            xs.resize(n);
+            ys.resize(n);
+            std::size_t k = 0;
+            scalar offset = 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const scalar t = (i + 0.5) * dx;
+                while (k + 1 < supports.size() and t >= offset + supports.at(k).second - supports.at(k).first) {
+                    offset += supports.at(k).second - supports.at(k).first;
+                    ++k;
+                }
+                xs.at(i) = supports.at(k).first + (t - offset);
+            }
+        } else {
+            xs.resize(n);
+            ys.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+                xs.at(i) = minimum + (i + 0.5) * dx;
+        }
+        if (n > 0)
+            term->membershipBatch(&xs.front(), &ys.front(), n);
+        result.samples = n;
+
+        // Single pass over the samples, keeping the cumulative sum of the finite memberships for the bisector
+        const bool bisect = requested & BisectorStatistic;
+        scalar area = 0.0, moment = 0.0, finiteArea = 0.0;
+        scalar ymax = -fl::inf, smallest = fl::nan, largest = fl::nan, maximaSum = 0.0;
+        std::size_t maxima = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const scalar x = xs[i];
+            const scalar y = ys[i];
+            area += y;
+            moment += y * x;
+            if (y >= ymax) {
+                largest = x;
+                if (y > ymax) {
+                    smallest = x;
+                    maximaSum = 0.0;
+                    maxima = 0;
+                    ymax = y;
+                }
+                maximaSum += x;
+                ++maxima;
+            }
+            if (bisect) {
+                if (Op::isFinite(y))
+                    finiteArea += y;
+                ys[i] = finiteArea;
+            }
+        }
+
+        if (bisect) {
+            // All x closest to half of the area are bisectors
+            scalar closest = fl::inf, bisectorSum = 0.0, bisectors = 0.0;
+            std::size_t k = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const scalar distance = std::abs(ys[i] / finiteArea - scalar(0.5));
+                if (distance < closest) {
+                    closest = distance;
+                    bisectorSum = 0.0;
+                    bisectors = 0.0;
+                }
+                if (distance == closest) {
+                    bisectorSum += xs[i];
+                    bisectors += 1.0;
+                }
+                if (_restrictedToSupport) {
+                    while (k + 1 < supports.size() and xs[i] >= supports.at(k + 1).first)
+                        ++k;
+                    // the gap until the next support has no area, so it is as close as the last sample before it,
+                    // and it counts as the samples that would have fallen in it
+                    if (distance == closest and i + 1 < n and k + 1 < supports.size()
+                        and xs[i + 1] >= supports.at(k + 1).first) {
+                        const scalar start = supports.at(k).second, end = supports.at(k + 1).first;
+                        bisectorSum += (end - start) / dx * scalar(0.5) * (start + end);
+                        bisectors += (end - start) / dx;
+                    }
+                }
+            }
+            result.bisector = bisectorSum / bisectors;
+        }
+        if (requested & AreaStatistic)
+            result.area = area * dx;
+        if (requested & CentroidStatistic)
+            result.centroid = moment / area;
+        if (requested & SmallestOfMaximumStatistic)
+            result.smallestOfMaximum = smallest;
+        if (requested & MeanOfMaximumStatistic)
+            result.meanOfMaximum = maximaSum / maxima;
+        if (requested & LargestOfMaximumStatistic)
+            result.largestOfMaximum = largest;
+        return result;
+    }
+
+    IntegralDefuzzifier::Statistics IntegralDefuzzifier::adaptiveStatistics(
+        const Term* term, scalar minimum, scalar maximum, scalar tolerance, int requested
+    ) const {
+        Statistics result;
+        if (not Op::isFinite(minimum + maximum))
+            return result;
+
+        // The supports of the terms split the range so that no term falls in between the samples
+        const scalar lower = Op::min(minimum, maximum), upper = Op::max(minimum, maximum);
+        std::vector<scalar> breakpoints;
+        breakpoints.push_back(minimum);
+        breakpoints.push_back(maximum);
+        std::vector<std::pair<scalar, scalar> > supports;
+        addSupports(term, supports);
+        for (std::size_t i = 0; i < supports.size(); ++i) {
+            const scalar points[] = {supports.at(i).first, supports.at(i).second};
+            for (std::size_t p = 0; p < 2; ++p) {
+                if (Op::isFinite(points[p]) and lower <= points[p] and points[p] <= upper)
+                    breakpoints.push_back(points[p]);
+            }
+        }
+        std::sort(breakpoints.begin(), breakpoints.end());
+        breakpoints.erase(std::unique(breakpoints.begin(), breakpoints.end()), breakpoints.end());
+        // the boundaries of the union of the supports are breakpoints, so each interval is either inside or outside
+        std::vector<std::pair<scalar, scalar> > inside;
+        if (_restrictedToSupport)
+            unionOfSupports(term, lower, upper, inside);
+
+        const bool bisect = requested & BisectorStatistic;
+        AdaptiveSimpson simpson(term, 0.5 * (minimum + maximum), tolerance, upper - lower, bisect);
+        bool sampled = false;
+        scalar ya = fl::nan;
+        std::size_t k = 0;
+        for (std::size_t i = 0; i + 1 < breakpoints.size(); ++i) {
+            const scalar a = breakpoints.at(i), b = breakpoints.at(i + 1);
+            if (_restrictedToSupport) {
+                while (k < inside.size() and inside.at(k).second <= a)
+                    ++k;
+                if (k == inside.size() or b <= inside.at(k).first) {
+                    sampled = false;
+                    continue;
+                }
+            }
+            if (not sampled)
+                ya = simpson.membership(a);
+            const scalar ym = simpson.membership(0.5 * (a + b)), yb = simpson.membership(b);
+            simpson.integrate(a, b, ya, ym, yb, 0);
+            ya = yb;
+            sampled = true;
+        }
+        result.samples = simpson.samples;
+
+        if (requested & AreaStatistic)
+            result.area = simpson.area;
+        if (requested & CentroidStatistic)
+            result.centroid = simpson.center + simpson.moment / simpson.area;
+        if (bisect) {
+            scalar area = 0.0;
+            for (std::size_t i = 0; i < simpson.intervals.size(); ++i)
+                area += simpson.intervals.at(i).area();
+            // The bisector is the middle of the region where the cumulative area is half of the area,
+            // up to the error of the integral
+            if (area > 0.0 and Op::isFinite(area)) {
+                const scalar target = 0.5 * area - tolerance * (upper - lower);
+                result.bisector
+                    = 0.5 * (crossing(simpson.intervals, target, true) + crossing(simpson.intervals, target, false));
+            }
+        }
+        return result;
+    }
+
+    IntegralDefuzzifier::Statistics
+    IntegralDefuzzifier::defuzzification(const Term* term, scalar minimum, scalar maximum) const {
+        return statistics(term, minimum, maximum, AllStatistics);
+    }
+
 }
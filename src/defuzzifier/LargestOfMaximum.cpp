@@ -22,7 +22,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 namespace fuzzylite {
 
-    LargestOfMaximum::LargestOfMaximum(int resolution) : IntegralDefuzzifier(resolution) {}
+    LargestOfMaximum::LargestOfMaximum(int resolution, bool restrictedToSupport) :
+        IntegralDefuzzifier(resolution, restrictedToSupport) {}
 
     LargestOfMaximum::~LargestOfMaximum() {}
 
@@ -31,21 +32,12 @@ namespace fuzzylite {
     }
 
     scalar LargestOfMaximum::defuzzify(const Term* term, scalar minimum, scalar maximum) const {
-        if (not Op::isFinite(minimum + maximum))
-            return fl::nan;
-        const int resolution = getResolution();
-        const scalar dx = (maximum - minimum) / resolution;
-        scalar ymax = -fl::inf;
-        scalar lom = fl::nan;
-        for (int i = 0; i < resolution; ++i) {
-            const scalar x = minimum + (i + 0.5) * dx;
-            const scalar y = term->membership(x);
-            if (y >= ymax) {
-                lom = x;
-                ymax = y;
-            }
-        }
-        return lom;
+        return defuzzification(term, minimum, maximum).largestOfMaximum;
+    }
+
+    IntegralDefuzzifier::Statistics
+    LargestOfMaximum::defuzzification(const Term* term, scalar minimum, scalar maximum) const {
+        return statistics(term, minimum, maximum, LargestOfMaximumStatistic);
     }
 
     LargestOfMaximum* LargestOfMaximum::clone() const {
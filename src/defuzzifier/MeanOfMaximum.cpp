@@ -22,7 +22,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 namespace fuzzylite {
 
-    MeanOfMaximum::MeanOfMaximum(int resolution) : IntegralDefuzzifier(resolution) {}
+    MeanOfMaximum::MeanOfMaximum(int resolution, bool restrictedToSupport) :
+        IntegralDefuzzifier(resolution, restrictedToSupport) {}
 
     MeanOfMaximum::~MeanOfMaximum() {}
 
@@ -31,24 +32,12 @@ namespace fuzzylite {
     }
 
     scalar MeanOfMaximum::defuzzify(const Term* term, scalar minimum, scalar maximum) const {
-        if (not Op::isFinite(minimum + maximum))
-            return fl::nan;
-        const int resolution = getResolution();
-        const scalar dx = (maximum - minimum) / resolution;
-        scalar ymax = -fl::inf;
-        std::vector<scalar> maxima;
-        for (int i = 0; i < resolution; ++i) {
-            const scalar x = minimum + (i + 0.5) * dx;
-            const scalar y = term->membership(x);
-            if (y > ymax) {
-                maxima.clear();
-                maxima.push_back(x);
-                ymax = y;
-            } else if (y == ymax)
-                maxima.push_back(x);
-        }
-        const scalar mom = Op::mean(maxima);
-        return mom;
+        return defuzzification(term, minimum, maximum).meanOfMaximum;
+    }
+
+    IntegralDefuzzifier::Statistics
+    MeanOfMaximum::defuzzification(const Term* term, scalar minimum, scalar maximum) const {
+        return statistics(term, minimum, maximum, MeanOfMaximumStatistic);
     }
 
     MeanOfMaximum* MeanOfMaximum::clone() const {
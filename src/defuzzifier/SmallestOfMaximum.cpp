@@ -22,7 +22,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 namespace fuzzylite {
 
-    SmallestOfMaximum::SmallestOfMaximum(int resolution) : IntegralDefuzzifier(resolution) {}
+    SmallestOfMaximum::SmallestOfMaximum(int resolution, bool restrictedToSupport) :
+        IntegralDefuzzifier(resolution, restrictedToSupport) {}
 
     SmallestOfMaximum::~SmallestOfMaximum() {}
 
@@ -31,21 +32,12 @@ namespace fuzzylite {
     }
 
     scalar SmallestOfMaximum::defuzzify(const Term* term, scalar minimum, scalar maximum) const {
-        if (not Op::isFinite(minimum + maximum))
-            return fl::nan;
-        const int resolution = getResolution();
-        const scalar dx = (maximum - minimum) / resolution;
-        scalar ymax = -fl::inf;
-        scalar som = fl::nan;
-        for (int i = 0; i < resolution; ++i) {
-            const scalar x = minimum + (i + 0.5) * dx;
-            const scalar y = term->membership(x);
-            if (y > ymax) {
-                som = x;
-                ymax = y;
-            }
-        }
-        return som;
+        return defuzzification(term, minimum, maximum).smallestOfMaximum;
+    }
+
+    IntegralDefuzzifier::Statistics
+    SmallestOfMaximum::defuzzification(const Term* term, scalar minimum, scalar maximum) const {
+        return statistics(term, minimum, maximum, SmallestOfMaximumStatistic);
     }
 
     SmallestOfMaximum* SmallestOfMaximum::clone() const {
@@ -36,7 +36,8 @@ namespace fuzzylite {
     scalar WeightedAverage::takagiSugeno(const Aggregated* term) const {
         scalar sum = 0.0;
         scalar weights = 0.0;
-        std::vector<Activated> groupedTerms(term->groupedTerms());
+        std::vector<Activated> buffer;
+        const std::vector<Activated>& groupedTerms = term->groupedTerms(buffer);
         for (std::size_t i = 0; i < groupedTerms.size(); ++i) {
             const Activated& activated = groupedTerms.at(i);
             const scalar w = activated.getDegree();
@@ -50,7 +51,8 @@ namespace fuzzylite {
     scalar WeightedAverage::tsukamoto(const Aggregated* term) const {
         scalar sum = 0.0;
         scalar weights = 0.0;
-        std::vector<Activated> groupedTerms(term->groupedTerms());
+        std::vector<Activated> buffer;
+        const std::vector<Activated>& groupedTerms = term->groupedTerms(buffer);
         for (std::size_t i = 0; i < groupedTerms.size(); ++i) {
             const Activated& activated = groupedTerms.at(i);
             const scalar w = activated.getDegree();
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/defuzzifier/WeightedDefuzzifier.h"
 
-#include <set>
+#include <algorithm>
 
 #include "fuzzylite/term/Activated.h"
 #include "fuzzylite/term/Aggregated.h"
@@ -33,6 +33,43 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 namespace fuzzylite {
 
+    namespace {
+        /**
+          The distinct types inferred from the terms
+         */
+        class InferredTypes {
+          private:
+            bool _found[3];
+            std::size_t _size;
+            WeightedDefuzzifier::Type _type;
+
+          public:
+            InferredTypes() : _size(0), _type(WeightedDefuzzifier::Automatic) {
+                _found[0] = _found[1] = _found[2] = false;
+            }
+
+            void insert(WeightedDefuzzifier::Type type) {
+                if (not _found[type]) {
+                    _found[type] = true;
+                    ++_size;
+                    _type = type;
+                }
+            }
+
+            WeightedDefuzzifier::Type type(const std::string& className) const {
+                switch (_size) {
+                    case 0:
+                        // cannot infer type of empty term, and won't matter anyway
+                        return WeightedDefuzzifier::Automatic;
+                    case 1:
+                        return _type;
+                    default:
+                        throw Exception("cannot infer type of '" + className + "', got multiple types");
+                }
+            }
+        };
+    }
+
     WeightedDefuzzifier::WeightedDefuzzifier(Type type) : _type(type) {}
 
     WeightedDefuzzifier::WeightedDefuzzifier(const std::string& type) {
@@ -85,27 +122,28 @@ namespace fuzzylite {
     }
 
     WeightedDefuzzifier::Type WeightedDefuzzifier::inferType(const std::vector<const Term*>& terms) const {
-        std::set<WeightedDefuzzifier::Type> types;
+        InferredTypes types;
         for (std::size_t i = 0; i < terms.size(); ++i)
             types.insert(this->inferType(terms.at(i)));
-        switch (types.size()) {
-            case 0:
-                // cannot infer type of empty term, and won't matter anyway
-                return Automatic;
-            case 1:
-                return *types.begin();
-            default:
-                throw Exception("cannot infer type of '" + this->className() + "', got multiple types");
-        }
+        return types.type(this->className());
     }
 
     WeightedDefuzzifier::Type WeightedDefuzzifier::inferType(const Term* term) const {
         if (const Aggregated* aggregated = dynamic_cast<const Aggregated*>(term)) {
-            std::vector<const Term*> terms;
-            terms.reserve(aggregated->numberOfTerms());
-            for (std::size_t i = 0; i < aggregated->numberOfTerms(); ++i)
-                terms.push_back(aggregated->getTerm(i).getTerm());
-            return inferType(terms);
+            // the type is inferred once for each of the first distinct terms, which are usually all of them
+            InferredTypes types;
+            const std::size_t capacity = 16;
+            const Term* inferred[capacity];
+            std::size_t numberOfInferred = 0;
+            for (std::size_t i = 0; i < aggregated->numberOfTerms(); ++i) {
+                const Term* activated = aggregated->getTerm(i).getTerm();
+                if (std::find(inferred, inferred + numberOfInferred, activated) != inferred + numberOfInferred)
+                    continue;
+                types.insert(this->inferType(activated));
+                if (numberOfInferred < capacity)
+                    inferred[numberOfInferred++] = activated;
+            }
+            return types.type(this->className());
         }
         if (const Activated* activated = dynamic_cast<const Activated*>(term))
             return inferType(activated->getTerm());
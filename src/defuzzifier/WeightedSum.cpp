@@ -35,7 +35,8 @@ namespace fuzzylite {
 
     scalar WeightedSum::takagiSugeno(const Aggregated* term) const {
         scalar sum = 0.0;
-        std::vector<Activated> groupedTerms = term->groupedTerms();
+        std::vector<Activated> buffer;
+        const std::vector<Activated>& groupedTerms = term->groupedTerms(buffer);
         for (std::size_t i = 0; i < groupedTerms.size(); ++i) {
             const Activated& activated = groupedTerms.at(i);
             const scalar w = activated.getDegree();
@@ -47,7 +48,8 @@ namespace fuzzylite {
 
     scalar WeightedSum::tsukamoto(const Aggregated* term) const {
         scalar sum = 0.0;
-        std::vector<Activated> groupedTerms = term->groupedTerms();
+        std::vector<Activated> buffer;
+        const std::vector<Activated>& groupedTerms = term->groupedTerms(buffer);
         for (std::size_t i = 0; i < groupedTerms.size(); ++i) {
             const Activated& activated = groupedTerms.at(i);
             const scalar w = activated.getDegree();
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/hedge/Extremely.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar Extremely::hedge(scalar x) const {
-        return Op::isLE(x, 0.5) ? 2.0 * x * x : (1.0 - 2.0 * (1.0 - x) * (1.0 - x));
+        return kernel::extremely(x);
     }
 
     Extremely* Extremely::clone() const {
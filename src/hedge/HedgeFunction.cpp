@@ -33,7 +33,6 @@ namespace fuzzylite {
     }
 
     scalar HedgeFunction::hedge(scalar x) const {
-        _function.variables["x"] = x;
         return _function.membership(x);
     }
 
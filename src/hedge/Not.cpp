@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/hedge/Not.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     std::string Not::name() const {
@@ -24,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar Not::hedge(scalar x) const {
-        return 1.0 - x;
+        return kernel::negate(x);
     }
 
     Not* Not::clone() const {
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/hedge/Seldom.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar Seldom::hedge(scalar x) const {
-        return Op::isLE(x, 0.5) ? std::sqrt(0.5 * x) : (1.0 - std::sqrt(0.5 * (1.0 - x)));
+        return kernel::seldom(x);
     }
 
     Seldom* Seldom::clone() const {
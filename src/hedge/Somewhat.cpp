@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/hedge/Somewhat.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     std::string Somewhat::name() const {
@@ -24,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar Somewhat::hedge(scalar x) const {
-        return std::sqrt(x);
+        return kernel::somewhat(x);
     }
 
     Somewhat* Somewhat::clone() const {
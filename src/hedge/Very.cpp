@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/hedge/Very.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     std::string Very::name() const {
@@ -24,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar Very::hedge(scalar x) const {
-        return x * x;
+        return kernel::very(x);
     }
 
     Very* Very::clone() const {
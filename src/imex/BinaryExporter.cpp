@@ -0,0 +1,462 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/imex/BinaryExporter.h"
+
+#include <cstring>
+#include <fstream>
+#include <map>
+
+#include "fuzzylite/Headers.h"
+
+namespace fuzzylite {
+
+    namespace {
+        const std::size_t none = 0xFFFFFFFFul;
+
+        void writeInteger(std::string& binary, std::size_t value) {
+            if (value > none)
+                throw Exception("[export error] value <" + Op::str(value) + "> exceeds the binary format", FL_AT);
+            for (int byte = 0; byte < 4; ++byte)
+                binary.push_back(char((value >> (8 * byte)) & 0xFF));
+        }
+
+        void writeScalar(std::string& binary, scalar value) {
+            const double real = double(value);
+            char bytes[sizeof(double)];
+            std::memcpy(bytes, &real, sizeof(double));
+            binary.append(bytes, sizeof(double));
+        }
+
+        void writeBoolean(std::string& binary, bool value) {
+            binary.push_back(char(value ? 1 : 0));
+        }
+
+        void writeString(std::string& binary, const std::string& value) {
+            writeInteger(binary, value.size());
+            binary.append(value);
+        }
+
+        void writeScalars(std::string& binary, const std::vector<scalar>& values) {
+            writeInteger(binary, values.size());
+            for (std::size_t i = 0; i < values.size(); ++i)
+                writeScalar(binary, values.at(i));
+        }
+
+        void writeTerm(std::string& binary, const Term* term) {
+            std::vector<scalar> parameters;
+            BinaryExporter::TermCode code = BinaryExporter::TermByName;
+            const std::string name = term->className();
+            if (name == "Triangle") {
+                const Triangle* triangle = static_cast<const Triangle*>(term);
+                code = BinaryExporter::TermTriangle;
+                parameters.push_back(triangle->getVertexA());
+                parameters.push_back(triangle->getVertexB());
+                parameters.push_back(triangle->getVertexC());
+            } else if (name == "Trapezoid") {
+                const Trapezoid* trapezoid = static_cast<const Trapezoid*>(term);
+                code = BinaryExporter::TermTrapezoid;
+                parameters.push_back(trapezoid->getVertexA());
+                parameters.push_back(trapezoid->getVertexB());
+                parameters.push_back(trapezoid->getVertexC());
+                parameters.push_back(trapezoid->getVertexD());
+            } else if (name == "Rectangle") {
+                const Rectangle* rectangle = static_cast<const Rectangle*>(term);
+                code = BinaryExporter::TermRectangle;
+                parameters.push_back(rectangle->getStart());
+                parameters.push_back(rectangle->getEnd());
+            } else if (name == "Gaussian") {
+                const Gaussian* gaussian = static_cast<const Gaussian*>(term);
+                code = BinaryExporter::TermGaussian;
+                parameters.push_back(gaussian->getMean());
+                parameters.push_back(gaussian->getStandardDeviation());
+            } else if (name == "GaussianProduct") {
+                const GaussianProduct* gaussianProduct = static_cast<const GaussianProduct*>(term);
+                code = BinaryExporter::TermGaussianProduct;
+                parameters.push_back(gaussianProduct->getMeanA());
+                parameters.push_back(gaussianProduct->getStandardDeviationA());
+                parameters.push_back(gaussianProduct->getMeanB());
+                parameters.push_back(gaussianProduct->getStandardDeviationB());
+            } else if (name == "Bell") {
+                const Bell* bell = static_cast<const Bell*>(term);
+                code = BinaryExporter::TermBell;
+                parameters.push_back(bell->getCenter());
+                parameters.push_back(bell->getWidth());
+                parameters.push_back(bell->getSlope());
+            } else if (name == "Sigmoid") {
+                const Sigmoid* sigmoid = static_cast<const Sigmoid*>(term);
+                code = BinaryExporter::TermSigmoid;
+                parameters.push_back(sigmoid->getInflection());
+                parameters.push_back(sigmoid->getSlope());
+            } else if (name == "SShape") {
+                const SShape* sShape = static_cast<const SShape*>(term);
+                code = BinaryExporter::TermSShape;
+                parameters.push_back(sShape->getStart());
+                parameters.push_back(sShape->getEnd());
+            } else if (name == "ZShape") {
+                const ZShape* zShape = static_cast<const ZShape*>(term);
+                code = BinaryExporter::TermZShape;
+                parameters.push_back(zShape->getStart());
+                parameters.push_back(zShape->getEnd());
+            } else if (name == "PiShape") {
+                const PiShape* piShape = static_cast<const PiShape*>(term);
+                code = BinaryExporter::TermPiShape;
+                parameters.push_back(piShape->getBottomLeft());
+                parameters.push_back(piShape->getTopLeft());
+                parameters.push_back(piShape->getTopRight());
+                parameters.push_back(piShape->getBottomRight());
+            } else if (name == "Ramp") {
+                const Ramp* ramp = static_cast<const Ramp*>(term);
+                code = BinaryExporter::TermRamp;
+                parameters.push_back(ramp->getStart());
+                parameters.push_back(ramp->getEnd());
+            } else if (name == "Concave") {
+                const Concave* concave = static_cast<const Concave*>(term);
+                code = BinaryExporter::TermConcave;
+                parameters.push_back(concave->getInflection());
+                parameters.push_back(concave->getEnd());
+            } else if (name == "Cosine") {
+                const Cosine* cosine = static_cast<const Cosine*>(term);
+                code = BinaryExporter::TermCosine;
+                parameters.push_back(cosine->getCenter());
+                parameters.push_back(cosine->getWidth());
+            } else if (name == "Spike") {
+                const Spike* spike = static_cast<const Spike*>(term);
+                code = BinaryExporter::TermSpike;
+                parameters.push_back(spike->getCenter());
+                parameters.push_back(spike->getWidth());
+            } else if (name == "SigmoidDifference") {
+                const SigmoidDifference* sigmoidDifference = static_cast<const SigmoidDifference*>(term);
+                code = BinaryExporter::TermSigmoidDifference;
+                parameters.push_back(sigmoidDifference->getLeft());
+                parameters.push_back(sigmoidDifference->getRising());
+                parameters.push_back(sigmoidDifference->getFalling());
+                parameters.push_back(sigmoidDifference->getRight());
+            } else if (name == "SigmoidProduct") {
+                const SigmoidProduct* sigmoidProduct = static_cast<const SigmoidProduct*>(term);
+                code = BinaryExporter::TermSigmoidProduct;
+                parameters.push_back(sigmoidProduct->getLeft());
+                parameters.push_back(sigmoidProduct->getRising());
+                parameters.push_back(sigmoidProduct->getFalling());
+                parameters.push_back(sigmoidProduct->getRight());
+            } else if (name == "Binary") {
+                const Binary* binaryTerm = static_cast<const Binary*>(term);
+                code = BinaryExporter::TermBinary;
+                parameters.push_back(binaryTerm->getStart());
+                parameters.push_back(binaryTerm->getDirection());
+            } else if (name == "Constant") {
+                code = BinaryExporter::TermConstant;
+                parameters.push_back(static_cast<const Constant*>(term)->getValue());
+            } else if (name == "Linear") {
+                code = BinaryExporter::TermLinear;
+                parameters = static_cast<const Linear*>(term)->coefficients();
+            } else if (name == "Discrete") {
+                const std::vector<Discrete::Pair>& xy = static_cast<const Discrete*>(term)->xy();
+                code = BinaryExporter::TermDiscrete;
+                for (std::size_t i = 0; i < xy.size(); ++i) {
+                    parameters.push_back(xy.at(i).first);
+                    parameters.push_back(xy.at(i).second);
+                }
+            }
+
+            writeInteger(binary, code);
+            writeString(binary, term->getName());
+            if (code == BinaryExporter::TermByName) {
+                // user-defined terms and functions are configured from their parameters in text
+                writeString(binary, term->className());
+                writeString(binary, term->parameters());
+            } else {
+                writeScalar(binary, term->getHeight());
+                writeScalars(binary, parameters);
+            }
+        }
+
+        void writeTerms(std::string& binary, const Variable* variable) {
+            writeInteger(binary, variable->numberOfTerms());
+            for (std::size_t i = 0; i < variable->numberOfTerms(); ++i)
+                writeTerm(binary, variable->getTerm(i));
+        }
+
+        void writeHedges(std::string& binary, const std::vector<Hedge*>& hedges) {
+            writeInteger(binary, hedges.size());
+            for (std::size_t i = 0; i < hedges.size(); ++i) {
+                const Hedge* hedge = hedges.at(i);
+                BinaryExporter::HedgeCode code = BinaryExporter::HedgeByName;
+                if (dynamic_cast<const Any*>(hedge))
+                    code = BinaryExporter::HedgeAny;
+                else if (dynamic_cast<const Extremely*>(hedge))
+                    code = BinaryExporter::HedgeExtremely;
+                else if (dynamic_cast<const Not*>(hedge))
+                    code = BinaryExporter::HedgeNot;
+                else if (dynamic_cast<const Seldom*>(hedge))
+                    code = BinaryExporter::HedgeSeldom;
+                else if (dynamic_cast<const Somewhat*>(hedge))
+                    code = BinaryExporter::HedgeSomewhat;
+                else if (dynamic_cast<const Very*>(hedge))
+                    code = BinaryExporter::HedgeVery;
+                writeInteger(binary, code);
+                if (code == BinaryExporter::HedgeByName)
+                    writeString(binary, hedge->name());
+            }
+        }
+
+        void writeNorm(std::string& binary, const Norm* norm) {
+            writeString(binary, norm ? norm->className() : "");
+        }
+
+        void writeActivation(std::string& binary, const Activation* activation) {
+            writeString(binary, activation ? activation->className() : "");
+            if (not activation)
+                return;
+            std::vector<scalar> parameters;
+            std::string text;
+            if (const First* first = dynamic_cast<const First*>(activation)) {
+                parameters.push_back(first->getNumberOfRules());
+                parameters.push_back(first->getThreshold());
+            } else if (const Last* last = dynamic_cast<const Last*>(activation)) {
+                parameters.push_back(last->getNumberOfRules());
+                parameters.push_back(last->getThreshold());
+            } else if (const Highest* highest = dynamic_cast<const Highest*>(activation)) {
+                parameters.push_back(highest->getNumberOfRules());
+            } else if (const Lowest* lowest = dynamic_cast<const Lowest*>(activation)) {
+                parameters.push_back(lowest->getNumberOfRules());
+            } else if (const Threshold* threshold = dynamic_cast<const Threshold*>(activation)) {
+                parameters.push_back(threshold->getComparison());
+                parameters.push_back(threshold->getValue());
+            } else {
+                text = activation->parameters();
+            }
+            writeScalars(binary, parameters);
+            writeString(binary, text);
+        }
+
+        void writeDefuzzifier(std::string& binary, const Defuzzifier* defuzzifier) {
+            writeString(binary, defuzzifier ? defuzzifier->className() : "");
+            if (not defuzzifier)
+                return;
+            std::vector<scalar> parameters;
+            if (const IntegralDefuzzifier* integral = dynamic_cast<const IntegralDefuzzifier*>(defuzzifier)) {
+                scalar tolerance = 0.0;
+                bool exact = false;
+                if (const Centroid* centroid = dynamic_cast<const Centroid*>(defuzzifier)) {
+                    tolerance = centroid->getTolerance();
+                    exact = centroid->isExact();
+                } else if (const Bisector* bisector = dynamic_cast<const Bisector*>(defuzzifier)) {
+                    tolerance = bisector->getTolerance();
+                }
+                parameters.push_back(integral->getResolution());
+                parameters.push_back(integral->isRestrictedToSupport());
+                parameters.push_back(tolerance);
+                parameters.push_back(exact);
+            } else if (const WeightedDefuzzifier* weighted = dynamic_cast<const WeightedDefuzzifier*>(defuzzifier)) {
+                parameters.push_back(weighted->getType());
+            }
+            writeScalars(binary, parameters);
+        }
+
+        /**
+          Indices of the variables and of the terms within their variables,
+          which resolve the propositions of the rules
+         */
+        struct Indices {
+            std::map<const Variable*, std::size_t> variables;
+            std::map<const Term*, std::size_t> terms;
+
+            explicit Indices(const Engine* engine) {
+                for (std::size_t i = 0; i < engine->numberOfInputVariables(); ++i)
+                    add(engine->getInputVariable(i), i);
+                for (std::size_t i = 0; i < engine->numberOfOutputVariables(); ++i)
+                    add(engine->getOutputVariable(i), i);
+            }
+
+            void add(const Variable* variable, std::size_t index) {
+                variables[variable] = index;
+                for (std::size_t t = 0; t < variable->numberOfTerms(); ++t)
+                    terms[variable->getTerm(t)] = t;
+            }
+
+            bool resolve(const Proposition* proposition, std::size_t& variable, std::size_t& term) const {
+                std::map<const Variable*, std::size_t>::const_iterator v = variables.find(proposition->variable);
+                if (v == variables.end())
+                    return false;
+                variable = v->second;
+                term = none;
+                if (proposition->term) {
+                    std::map<const Term*, std::size_t>::const_iterator t = terms.find(proposition->term);
+                    if (t == terms.end() or proposition->variable->getTerm(t->second) != proposition->term)
+                        return false;
+                    term = t->second;
+                }
+                return true;
+            }
+        };
+
+        bool writeAntecedent(std::string& code, std::size_t& size, const Expression* node, const Indices& indices) {
+            if (not node)
+                return false;
+            if (node->type() == Expression::Proposition) {
+                const Proposition* proposition = static_cast<const Proposition*>(node);
+                std::size_t variable, term;
+                if (not indices.resolve(proposition, variable, term))
+                    return false;
+                if (proposition->variable->type() == Variable::Input)
+                    writeInteger(code, BinaryExporter::InstructionInput);
+                else if (proposition->variable->type() == Variable::Output)
+                    writeInteger(code, BinaryExporter::InstructionOutput);
+                else
+                    return false;
+                writeInteger(code, variable);
+                writeInteger(code, term);
+                writeHedges(code, proposition->hedges);
+                ++size;
+                return true;
+            }
+            const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+            if (not(writeAntecedent(code, size, fuzzyOperator->left, indices)
+                    and writeAntecedent(code, size, fuzzyOperator->right, indices)))
+                return false;
+            if (fuzzyOperator->name == Rule::andKeyword())
+                writeInteger(code, BinaryExporter::InstructionAnd);
+            else if (fuzzyOperator->name == Rule::orKeyword())
+                writeInteger(code, BinaryExporter::InstructionOr);
+            else
+                return false;
+            ++size;
+            return true;
+        }
+
+        bool writeConsequent(std::string& code, const Consequent* consequent, const Indices& indices) {
+            const std::vector<Proposition*>& conclusions = consequent->conclusions();
+            writeInteger(code, conclusions.size());
+            for (std::size_t i = 0; i < conclusions.size(); ++i) {
+                const Proposition* proposition = conclusions.at(i);
+                std::size_t variable, term;
+                if (not(proposition->variable and proposition->term
+                        and proposition->variable->type() == Variable::Output
+                        and indices.resolve(proposition, variable, term)))
+                    return false;
+                writeInteger(code, variable);
+                writeInteger(code, term);
+                writeHedges(code, proposition->hedges);
+            }
+            return true;
+        }
+
+        void writeRule(std::string& binary, const Rule* rule, const Indices& indices) {
+            writeString(binary, rule->getText());
+            writeScalar(binary, rule->getWeight());
+            writeBoolean(binary, rule->isEnabled());
+            std::string antecedent, consequent;
+            std::size_t instructions = 0;
+            const bool loaded = rule->isLoaded()
+                                and writeAntecedent(
+                                    antecedent, instructions, rule->getAntecedent()->getExpression(), indices
+                                )
+                                and writeConsequent(consequent, rule->getConsequent(), indices);
+            writeBoolean(binary, loaded);
+            if (loaded) {
+                writeInteger(binary, instructions);
+                binary.append(antecedent);
+                binary.append(consequent);
+            }
+        }
+    }
+
+    BinaryExporter::BinaryExporter() : Exporter() {}
+
+    BinaryExporter::~BinaryExporter() {}
+
+    std::string BinaryExporter::name() const {
+        return "BinaryExporter";
+    }
+
+    std::string BinaryExporter::magic() {
+        return "FLBN";
+    }
+
+    int BinaryExporter::version() {
+        return 1;
+    }
+
+    std::string BinaryExporter::toString(const Engine* engine) const {
+        std::string binary(magic());
+        writeInteger(binary, version());
+        writeScalar(binary, 1234.5);
+
+        writeString(binary, engine->getName());
+        writeString(binary, engine->getDescription());
+
+        writeInteger(binary, engine->numberOfInputVariables());
+        for (std::size_t i = 0; i < engine->numberOfInputVariables(); ++i) {
+            const InputVariable* inputVariable = engine->getInputVariable(i);
+            writeString(binary, inputVariable->getName());
+            writeString(binary, inputVariable->getDescription());
+            writeBoolean(binary, inputVariable->isEnabled());
+            writeScalar(binary, inputVariable->getMinimum());
+            writeScalar(binary, inputVariable->getMaximum());
+            writeBoolean(binary, inputVariable->isLockValueInRange());
+            writeTerms(binary, inputVariable);
+        }
+
+        writeInteger(binary, engine->numberOfOutputVariables());
+        for (std::size_t i = 0; i < engine->numberOfOutputVariables(); ++i) {
+            const OutputVariable* outputVariable = engine->getOutputVariable(i);
+            writeString(binary, outputVariable->getName());
+            writeString(binary, outputVariable->getDescription());
+            writeBoolean(binary, outputVariable->isEnabled());
+            writeScalar(binary, outputVariable->getMinimum());
+            writeScalar(binary, outputVariable->getMaximum());
+            writeBoolean(binary, outputVariable->isLockValueInRange());
+            writeNorm(binary, outputVariable->fuzzyOutput()->getAggregation());
+            writeDefuzzifier(binary, outputVariable->getDefuzzifier());
+            writeScalar(binary, outputVariable->getDefaultValue());
+            writeBoolean(binary, outputVariable->isLockPreviousValue());
+            writeTerms(binary, outputVariable);
+        }
+
+        const Indices indices(engine);
+        writeInteger(binary, engine->numberOfRuleBlocks());
+        for (std::size_t i = 0; i < engine->numberOfRuleBlocks(); ++i) {
+            const RuleBlock* ruleBlock = engine->getRuleBlock(i);
+            writeString(binary, ruleBlock->getName());
+            writeString(binary, ruleBlock->getDescription());
+            writeBoolean(binary, ruleBlock->isEnabled());
+            writeNorm(binary, ruleBlock->getConjunction());
+            writeNorm(binary, ruleBlock->getDisjunction());
+            writeNorm(binary, ruleBlock->getImplication());
+            writeActivation(binary, ruleBlock->getActivation());
+            writeInteger(binary, ruleBlock->numberOfRules());
+            for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r)
+                writeRule(binary, ruleBlock->getRule(r), indices);
+        }
+        return binary;
+    }
+
+    void BinaryExporter::toFile(const std::string& path, const Engine* engine) const {
+        std::ofstream writer(path.c_str(), std::ios_base::out | std::ios_base::binary);
+        if (not writer.is_open())
+            throw Exception("[file error] file <" + path + "> could not be created", FL_AT);
+        const std::string binary = toString(engine);
+        writer.write(binary.data(), std::streamsize(binary.size()));
+        writer.close();
+    }
+
+    BinaryExporter* BinaryExporter::clone() const {
+        return new BinaryExporter(*this);
+    }
+
+}
@@ -0,0 +1,546 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/imex/BinaryImporter.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "fuzzylite/Headers.h"
+
+#ifdef FL_UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fuzzylite {
+
+    namespace {
+        const std::size_t none = 0xFFFFFFFFul;
+
+        /**
+          Reads the values of the binary format from the bytes in memory,
+          checking that every value is within the bounds of the bytes
+         */
+        class Reader {
+          private:
+            const unsigned char* _position;
+            const unsigned char* _end;
+
+          public:
+            Reader(const char* data, std::size_t size) :
+                _position(reinterpret_cast<const unsigned char*>(data)),
+                _end(_position + size) {}
+
+            const unsigned char* take(std::size_t bytes) {
+                if (std::size_t(_end - _position) < bytes)
+                    throw Exception("[import error] unexpected end of the binary engine", FL_AT);
+                const unsigned char* result = _position;
+                _position += bytes;
+                return result;
+            }
+
+            bool atEnd() const {
+                return _position == _end;
+            }
+
+            std::size_t integer() {
+                const unsigned char* bytes = take(4);
+                return std::size_t(bytes[0]) | (std::size_t(bytes[1]) << 8) | (std::size_t(bytes[2]) << 16)
+                       | (std::size_t(bytes[3]) << 24);
+            }
+
+            std::size_t index(std::size_t size, const std::string& what) {
+                const std::size_t result = integer();
+                if (result >= size)
+                    throw Exception(
+                        "[import error] index <" + Op::str(result) + "> of " + what + " is out of range in the binary "
+                            "engine",
+                        FL_AT
+                    );
+                return result;
+            }
+
+            scalar real() {
+                double value;
+                std::memcpy(&value, take(sizeof(double)), sizeof(double));
+                return scalar(value);
+            }
+
+            bool boolean() {
+                return *take(1) != 0;
+            }
+
+            std::string text() {
+                const std::size_t size = integer();
+                return std::string(reinterpret_cast<const char*>(take(size)), size);
+            }
+
+            std::vector<scalar> reals() {
+                const std::size_t size = integer();
+                std::vector<scalar> result;
+                result.reserve(std::min(size, std::size_t(_end - _position) / sizeof(double)));
+                for (std::size_t i = 0; i < size; ++i)
+                    result.push_back(real());
+                return result;
+            }
+        };
+
+        void requireParameters(const std::vector<scalar>& parameters, std::size_t size, const std::string& name) {
+            if (parameters.size() != size)
+                throw Exception(
+                    "[import error] expected " + Op::str(size) + " parameters of <" + name + ">, but found "
+                        + Op::str(parameters.size()) + " in the binary engine",
+                    FL_AT
+                );
+        }
+
+        Term* readTerm(Reader& reader, const Engine* engine) {
+            const std::size_t code = reader.integer();
+            const std::string name = reader.text();
+            if (code == BinaryExporter::TermByName) {
+                const std::string className = reader.text();
+                const std::string parameters = reader.text();
+                FL_unique_ptr<Term> term(FactoryManager::instance()->term()->constructObject(className));
+                if (not term.get())
+                    throw Exception("[import error] expected the class of term <" + name + ">", FL_AT);
+                term->updateReference(engine);
+                term->setName(name);
+                term->configure(parameters);
+                return term.release();
+            }
+
+            const scalar height = reader.real();
+            const std::vector<scalar> p = reader.reals();
+            FL_unique_ptr<Term> term;
+            switch (code) {
+                case BinaryExporter::TermBell:
+                    requireParameters(p, 3, "Bell");
+                    term.reset(new Bell(name, p[0], p[1], p[2], height));
+                    break;
+                case BinaryExporter::TermBinary:
+                    requireParameters(p, 2, "Binary");
+                    term.reset(new Binary(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermConcave:
+                    requireParameters(p, 2, "Concave");
+                    term.reset(new Concave(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermConstant:
+                    requireParameters(p, 1, "Constant");
+                    term.reset(new Constant(name, p[0]));
+                    break;
+                case BinaryExporter::TermCosine:
+                    requireParameters(p, 2, "Cosine");
+                    term.reset(new Cosine(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermDiscrete: {
+                    if (p.size() % 2 != 0)
+                        throw Exception("[import error] expected pairs of values of <Discrete>", FL_AT);
+                    std::vector<Discrete::Pair> xy;
+                    xy.reserve(p.size() / 2);
+                    for (std::size_t i = 0; i + 1 < p.size(); i += 2)
+                        xy.push_back(Discrete::Pair(p[i], p[i + 1]));
+                    term.reset(new Discrete(name, xy, height));
+                    break;
+                }
+                case BinaryExporter::TermGaussian:
+                    requireParameters(p, 2, "Gaussian");
+                    term.reset(new Gaussian(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermGaussianProduct:
+                    requireParameters(p, 4, "GaussianProduct");
+                    term.reset(new GaussianProduct(name, p[0], p[1], p[2], p[3], height));
+                    break;
+                case BinaryExporter::TermLinear:
+                    term.reset(new Linear(name, p, engine));
+                    break;
+                case BinaryExporter::TermPiShape:
+                    requireParameters(p, 4, "PiShape");
+                    term.reset(new PiShape(name, p[0], p[1], p[2], p[3], height));
+                    break;
+                case BinaryExporter::TermRamp:
+                    requireParameters(p, 2, "Ramp");
+                    term.reset(new Ramp(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermRectangle:
+                    requireParameters(p, 2, "Rectangle");
+                    term.reset(new Rectangle(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermSShape:
+                    requireParameters(p, 2, "SShape");
+                    term.reset(new SShape(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermSigmoid:
+                    requireParameters(p, 2, "Sigmoid");
+                    term.reset(new Sigmoid(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermSigmoidDifference:
+                    requireParameters(p, 4, "SigmoidDifference");
+                    term.reset(new SigmoidDifference(name, p[0], p[1], p[2], p[3], height));
+                    break;
+                case BinaryExporter::TermSigmoidProduct:
+                    requireParameters(p, 4, "SigmoidProduct");
+                    term.reset(new SigmoidProduct(name, p[0], p[1], p[2], p[3], height));
+                    break;
+                case BinaryExporter::TermSpike:
+                    requireParameters(p, 2, "Spike");
+                    term.reset(new Spike(name, p[0], p[1], height));
+                    break;
+                case BinaryExporter::TermTrapezoid:
+                    requireParameters(p, 4, "Trapezoid");
+                    term.reset(new Trapezoid(name, p[0], p[1], p[2], p[3], height));
+                    break;
+                case BinaryExporter::TermTriangle:
+                    requireParameters(p, 3, "Triangle");
+                    term.reset(new Triangle(name, p[0], p[1], p[2], height));
+                    break;
+                case BinaryExporter::TermZShape:
+                    requireParameters(p, 2, "ZShape");
+                    term.reset(new ZShape(name, p[0], p[1], height));
+                    break;
+                default:
+                    throw Exception("[import error] term code <" + Op::str(code) + "> not recognized", FL_AT);
+            }
+            term->setHeight(height);
+            return term.release();
+        }
+
+        void readTerms(Reader& reader, Variable* variable, const Engine* engine) {
+            const std::size_t terms = reader.integer();
+            for (std::size_t i = 0; i < terms; ++i)
+                variable->addTerm(readTerm(reader, engine));
+        }
+
+        void readHedges(Reader& reader, std::vector<Hedge*>& hedges) {
+            const std::size_t size = reader.integer();
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::size_t code = reader.integer();
+                switch (code) {
+                    case BinaryExporter::HedgeByName: {
+                        const std::string name = reader.text();
+                        const HedgeFactory* factory = FactoryManager::instance()->hedge();
+                        Hedge* hedge = factory->hasConstructor(name) ? factory->constructObject(name) : fl::null;
+                        if (not hedge)
+                            throw Exception("[import error] hedge <" + name + "> not recognized", FL_AT);
+                        hedges.push_back(hedge);
+                        break;
+                    }
+                    case BinaryExporter::HedgeAny:
+                        hedges.push_back(new Any);
+                        break;
+                    case BinaryExporter::HedgeExtremely:
+                        hedges.push_back(new Extremely);
+                        break;
+                    case BinaryExporter::HedgeNot:
+                        hedges.push_back(new Not);
+                        break;
+                    case BinaryExporter::HedgeSeldom:
+                        hedges.push_back(new Seldom);
+                        break;
+                    case BinaryExporter::HedgeSomewhat:
+                        hedges.push_back(new Somewhat);
+                        break;
+                    case BinaryExporter::HedgeVery:
+                        hedges.push_back(new Very);
+                        break;
+                    default:
+                        throw Exception("[import error] hedge code <" + Op::str(code) + "> not recognized", FL_AT);
+                }
+            }
+        }
+
+        Proposition* readProposition(Reader& reader, Variable* variable) {
+            FL_unique_ptr<Proposition> proposition(new Proposition);
+            proposition->variable = variable;
+            const std::size_t term = reader.integer();
+            if (term != none) {
+                if (term >= variable->numberOfTerms())
+                    throw Exception(
+                        "[import error] index <" + Op::str(term) + "> of term in variable <" + variable->getName()
+                            + "> is out of range in the binary engine",
+                        FL_AT
+                    );
+                proposition->term = variable->getTerm(term);
+            }
+            readHedges(reader, proposition->hedges);
+            return proposition.release();
+        }
+
+        Expression* readAntecedent(Reader& reader, const Engine* engine) {
+            const std::size_t size = reader.integer();
+            std::vector<Expression*> stack;
+            try {
+                for (std::size_t i = 0; i < size; ++i) {
+                    const std::size_t code = reader.integer();
+                    if (code == BinaryExporter::InstructionInput) {
+                        const std::size_t variable = reader.index(engine->numberOfInputVariables(), "input variable");
+                        stack.push_back(readProposition(reader, engine->getInputVariable(variable)));
+                    } else if (code == BinaryExporter::InstructionOutput) {
+                        const std::size_t variable
+                            = reader.index(engine->numberOfOutputVariables(), "output variable");
+                        stack.push_back(readProposition(reader, engine->getOutputVariable(variable)));
+                    } else if (code == BinaryExporter::InstructionAnd or code == BinaryExporter::InstructionOr) {
+                        if (stack.size() < 2)
+                            throw Exception("[import error] expected two operands in the antecedent", FL_AT);
+                        Operator* fuzzyOperator = new Operator;
+                        fuzzyOperator->name
+                            = code == BinaryExporter::InstructionAnd ? Rule::andKeyword() : Rule::orKeyword();
+                        fuzzyOperator->right = stack.back();
+                        stack.pop_back();
+                        fuzzyOperator->left = stack.back();
+                        stack.back() = fuzzyOperator;
+                    } else {
+                        throw Exception(
+                            "[import error] instruction code <" + Op::str(code) + "> not recognized", FL_AT
+                        );
+                    }
+                }
+                if (stack.size() != 1)
+                    throw Exception("[import error] expected a single expression in the antecedent", FL_AT);
+            } catch (...) {
+                for (std::size_t i = 0; i < stack.size(); ++i)
+                    delete stack.at(i);
+                throw;
+            }
+            return stack.front();
+        }
+
+        void readConsequent(Reader& reader, Consequent* consequent, const Engine* engine) {
+            const std::size_t size = reader.integer();
+            if (size == 0)
+                throw Exception("[import error] expected conclusions in the consequent", FL_AT);
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::size_t variable = reader.index(engine->numberOfOutputVariables(), "output variable");
+                consequent->conclusions().push_back(readProposition(reader, engine->getOutputVariable(variable)));
+                if (not consequent->conclusions().back()->term)
+                    throw Exception("[import error] expected a term in the conclusion of the consequent", FL_AT);
+            }
+        }
+
+        Rule* readRule(Reader& reader, const Engine* engine) {
+            FL_unique_ptr<Rule> rule(new Rule(reader.text()));
+            const scalar weight = reader.real();
+            const bool enabled = reader.boolean();
+            if (reader.boolean()) {
+                rule->getAntecedent()->setExpression(readAntecedent(reader, engine));
+                readConsequent(reader, rule->getConsequent(), engine);
+                rule->setWeight(weight);
+            } else {
+                // the rules that were not loaded when exported are loaded from text as in FllImporter
+                try {
+                    rule->load(engine);
+                } catch (std::exception& ex) { FL_LOG(ex.what()); }
+            }
+            rule->setEnabled(enabled);
+            return rule.release();
+        }
+
+        Activation* readActivation(Reader& reader) {
+            const std::string className = reader.text();
+            Activation* activation = FactoryManager::instance()->activation()->constructObject(className);
+            if (not activation)
+                return new General;
+            FL_unique_ptr<Activation> result(activation);
+            const std::vector<scalar> p = reader.reals();
+            const std::string parameters = reader.text();
+            if (First* first = dynamic_cast<First*>(activation)) {
+                requireParameters(p, 2, className);
+                first->setNumberOfRules(int(p[0]));
+                first->setThreshold(p[1]);
+            } else if (Last* last = dynamic_cast<Last*>(activation)) {
+                requireParameters(p, 2, className);
+                last->setNumberOfRules(int(p[0]));
+                last->setThreshold(p[1]);
+            } else if (Highest* highest = dynamic_cast<Highest*>(activation)) {
+                requireParameters(p, 1, className);
+                highest->setNumberOfRules(int(p[0]));
+            } else if (Lowest* lowest = dynamic_cast<Lowest*>(activation)) {
+                requireParameters(p, 1, className);
+                lowest->setNumberOfRules(int(p[0]));
+            } else if (Threshold* threshold = dynamic_cast<Threshold*>(activation)) {
+                requireParameters(p, 2, className);
+                threshold->setComparison(Threshold::Comparison(int(p[0])));
+                threshold->setValue(p[1]);
+            } else if (not parameters.empty()) {
+                activation->configure(parameters);
+            }
+            return result.release();
+        }
+
+        Defuzzifier* readDefuzzifier(Reader& reader) {
+            const std::string className = reader.text();
+            // the engines without a defuzzifier are exported without its parameters
+            if (className.empty())
+                return fl::null;
+            const DefuzzifierFactory* factory = FactoryManager::instance()->defuzzifier();
+            Defuzzifier* defuzzifier
+                = factory->hasConstructor(className) ? factory->constructObject(className) : fl::null;
+            if (not defuzzifier)
+                throw Exception("[import error] defuzzifier <" + className + "> not recognized", FL_AT);
+            FL_unique_ptr<Defuzzifier> result(defuzzifier);
+            const std::vector<scalar> p = reader.reals();
+            if (IntegralDefuzzifier* integral = dynamic_cast<IntegralDefuzzifier*>(defuzzifier)) {
+                requireParameters(p, 4, className);
+                integral->setResolution(int(p[0]));
+                integral->setRestrictedToSupport(p[1] != 0.0);
+                if (Centroid* centroid = dynamic_cast<Centroid*>(defuzzifier)) {
+                    centroid->setTolerance(p[2]);
+                    centroid->setExact(p[3] != 0.0);
+                } else if (Bisector* bisector = dynamic_cast<Bisector*>(defuzzifier)) {
+                    bisector->setTolerance(p[2]);
+                }
+            } else if (WeightedDefuzzifier* weighted = dynamic_cast<WeightedDefuzzifier*>(defuzzifier)) {
+                requireParameters(p, 1, className);
+                weighted->setType(WeightedDefuzzifier::Type(int(p[0])));
+            }
+            return result.release();
+        }
+
+        /**
+          Unmaps the file from memory and closes it on destruction
+         */
+        struct MappedFile {
+            int descriptor;
+            void* data;
+            std::size_t size;
+
+            MappedFile() : descriptor(-1), data(fl::null), size(0) {}
+
+            ~MappedFile() {
+#ifdef FL_UNIX
+                if (data)
+                    ::munmap(data, size);
+                if (descriptor >= 0)
+                    ::close(descriptor);
+#endif
+            }
+        };
+    }
+
+    BinaryImporter::BinaryImporter() : Importer() {}
+
+    BinaryImporter::~BinaryImporter() {}
+
+    std::string BinaryImporter::name() const {
+        return "BinaryImporter";
+    }
+
+    Engine* BinaryImporter::fromString(const std::string& binary) const {
+        return fromMemory(binary.data(), binary.size());
+    }
+
+    Engine* BinaryImporter::fromMemory(const char* data, std::size_t size) const {
+        Reader reader(data, size);
+        const std::string magic = BinaryExporter::magic();
+        if (size < magic.size() or std::memcmp(reader.take(magic.size()), magic.data(), magic.size()) != 0)
+            throw Exception("[import error] expected a binary engine starting with <" + magic + ">", FL_AT);
+        const std::size_t version = reader.integer();
+        if (version < 1 or version > std::size_t(BinaryExporter::version()))
+            throw Exception(
+                "[import error] version <" + Op::str(version) + "> of the binary engine is not supported", FL_AT
+            );
+        if (reader.real() != 1234.5)
+            throw Exception("[import error] the binary engine was exported in a different byte order", FL_AT);
+
+        FL_unique_ptr<Engine> engine(new Engine);
+        engine->setName(reader.text());
+        engine->setDescription(reader.text());
+
+        const std::size_t inputVariables = reader.integer();
+        for (std::size_t i = 0; i < inputVariables; ++i) {
+            // the variable is named before it is added, so the engine indexes it by name
+            InputVariable* inputVariable = new InputVariable(reader.text());
+            engine->addInputVariable(inputVariable);
+            inputVariable->setDescription(reader.text());
+            inputVariable->setEnabled(reader.boolean());
+            const scalar minimum = reader.real();
+            inputVariable->setRange(minimum, reader.real());
+            inputVariable->setLockValueInRange(reader.boolean());
+            readTerms(reader, inputVariable, engine.get());
+        }
+
+        const std::size_t outputVariables = reader.integer();
+        for (std::size_t i = 0; i < outputVariables; ++i) {
+            OutputVariable* outputVariable = new OutputVariable(reader.text());
+            engine->addOutputVariable(outputVariable);
+            outputVariable->setDescription(reader.text());
+            outputVariable->setEnabled(reader.boolean());
+            const scalar minimum = reader.real();
+            outputVariable->setRange(minimum, reader.real());
+            outputVariable->setLockValueInRange(reader.boolean());
+            outputVariable->setAggregation(FactoryManager::instance()->snorm()->constructObject(reader.text()));
+            outputVariable->setDefuzzifier(readDefuzzifier(reader));
+            outputVariable->setDefaultValue(reader.real());
+            outputVariable->setLockPreviousValue(reader.boolean());
+            readTerms(reader, outputVariable, engine.get());
+        }
+
+        const std::size_t ruleBlocks = reader.integer();
+        for (std::size_t i = 0; i < ruleBlocks; ++i) {
+            RuleBlock* ruleBlock = new RuleBlock;
+            engine->addRuleBlock(ruleBlock);
+            ruleBlock->setName(reader.text());
+            ruleBlock->setDescription(reader.text());
+            ruleBlock->setEnabled(reader.boolean());
+            ruleBlock->setConjunction(FactoryManager::instance()->tnorm()->constructObject(reader.text()));
+            ruleBlock->setDisjunction(FactoryManager::instance()->snorm()->constructObject(reader.text()));
+            ruleBlock->setImplication(FactoryManager::instance()->tnorm()->constructObject(reader.text()));
+            ruleBlock->setActivation(readActivation(reader));
+            const std::size_t rules = reader.integer();
+            for (std::size_t r = 0; r < rules; ++r)
+                ruleBlock->addRule(readRule(reader, engine.get()));
+        }
+
+        if (not reader.atEnd())
+            throw Exception("[import error] unexpected bytes at the end of the binary engine", FL_AT);
+        return engine.release();
+    }
+
+    Engine* BinaryImporter::fromFile(const std::string& path) const {
+#ifdef FL_UNIX
+        MappedFile file;
+        file.descriptor = ::open(path.c_str(), O_RDONLY);
+        if (file.descriptor < 0)
+            throw Exception("[file error] file <" + path + "> could not be opened", FL_AT);
+        struct stat status;
+        if (::fstat(file.descriptor, &status) != 0)
+            throw Exception("[file error] file <" + path + "> could not be read", FL_AT);
+        file.size = std::size_t(status.st_size);
+        if (file.size == 0)
+            return fromMemory("", 0);
+        void* data = ::mmap(fl::null, file.size, PROT_READ, MAP_PRIVATE, file.descriptor, 0);
+        if (data == MAP_FAILED)
+            throw Exception("[file error] file <" + path + "> could not be mapped into memory", FL_AT);
+        file.data = data;
+        return fromMemory(static_cast<const char*>(file.data), file.size);
+#else
+        std::ifstream reader(path.c_str(), std::ios_base::in | std::ios_base::binary);
+        if (not reader.is_open())
+            throw Exception("[file error] file <" + path + "> could not be opened", FL_AT);
+        const std::string binary((std::istreambuf_iterator<char>(reader)), std::istreambuf_iterator<char>());
+        return fromString(binary);
+#endif
+    }
+
+    BinaryImporter* BinaryImporter::clone() const {
+        return new BinaryImporter(*this);
+    }
+
+}
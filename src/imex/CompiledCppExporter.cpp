@@ -0,0 +1,1438 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/imex/CompiledCppExporter.h"
+
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+
+#include "fuzzylite/Headers.h"
+
+namespace fuzzylite {
+
+    CompiledCppExporter::CompiledCppExporter(const std::string& functionName) :
+        Exporter(),
+        _functionName(functionName) {}
+
+    CompiledCppExporter::~CompiledCppExporter() {}
+
+    std::string CompiledCppExporter::name() const {
+        return "CompiledCppExporter";
+    }
+
+    void CompiledCppExporter::setFunctionName(const std::string& functionName) {
+        this->_functionName = functionName;
+    }
+
+    std::string CompiledCppExporter::getFunctionName() const {
+        return this->_functionName;
+    }
+
+    CompiledCppExporter* CompiledCppExporter::clone() const {
+        return new CompiledCppExporter(*this);
+    }
+
+    namespace {
+        // sources of the helper functions of the generated code, which mirror the kernels of CompiledEngine
+
+        const char* const helpers[][2] = {
+            {"triangle",
+             "    inline double triangle(double a, double b, double c, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isLt(x, a) || isGt(x, c))\n"
+             "            return h * 0.0;\n"
+             "        if (isEq(x, b))\n"
+             "            return h * 1.0;\n"
+             "        if (isLt(x, b)) {\n"
+             "            if (a == -Infinity)\n"
+             "                return h * 1.0;\n"
+             "            return h * (x - a) / (b - a);\n"
+             "        }\n"
+             "        if (c == Infinity)\n"
+             "            return h * 1.0;\n"
+             "        return h * (c - x) / (c - b);\n"
+             "    }\n"},
+            {"trapezoid",
+             "    inline double trapezoid(double a, double b, double c, double d, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isLt(x, a) || isGt(x, d))\n"
+             "            return h * 0.0;\n"
+             "        if (isLt(x, b)) {\n"
+             "            if (a == -Infinity)\n"
+             "                return h * 1.0;\n"
+             "            return h * minimum(1.0, (x - a) / (b - a));\n"
+             "        }\n"
+             "        if (isLE(x, c))\n"
+             "            return h * 1.0;\n"
+             "        if (isLt(x, d)) {\n"
+             "            if (d == Infinity)\n"
+             "                return h * 1.0;\n"
+             "            return h * (d - x) / (d - c);\n"
+             "        }\n"
+             "        if (d == Infinity)\n"
+             "            return h * 1.0;\n"
+             "        return h * 0.0;\n"
+             "    }\n"},
+            {"rectangle",
+             "    inline double rectangle(double start, double end, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isGE(x, start) && isLE(x, end))\n"
+             "            return h * 1.0;\n"
+             "        return h * 0.0;\n"
+             "    }\n"},
+            {"gaussian",
+             "    inline double gaussian(double mean, double deviation, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        return h * std::exp((-(x - mean) * (x - mean)) / (2.0 * deviation * deviation));\n"
+             "    }\n"},
+            {"gaussianProduct",
+             "    inline double gaussianProduct(\n"
+             "        double meanA, double deviationA, double meanB, double deviationB, double h, double x\n"
+             "    ) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        double a = 1.0, b = 1.0;\n"
+             "        if (isLt(x, meanA))\n"
+             "            a = std::exp((-(x - meanA) * (x - meanA)) / (2.0 * deviationA * deviationA));\n"
+             "        if (isGt(x, meanB))\n"
+             "            b = std::exp((-(x - meanB) * (x - meanB)) / (2.0 * deviationB * deviationB));\n"
+             "        return h * a * b;\n"
+             "    }\n"},
+            {"bell",
+             "    inline double bell(double center, double width, double slope, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        return h * (1.0 / (1.0 + std::pow(std::fabs((x - center) / width), 2.0 * slope)));\n"
+             "    }\n"},
+            {"sigmoid",
+             "    inline double sigmoid(double inflection, double slope, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        return h * 1.0 / (1.0 + std::exp(-slope * (x - inflection)));\n"
+             "    }\n"},
+            {"sShape",
+             "    inline double sShape(double start, double end, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isLE(x, start))\n"
+             "            return h * 0.0;\n"
+             "        if (isLE(x, 0.5 * (start + end)))\n"
+             "            return h * (2.0 * std::pow((x - start) / (end - start), 2));\n"
+             "        if (isLt(x, end))\n"
+             "            return h * (1.0 - 2.0 * std::pow((x - end) / (end - start), 2));\n"
+             "        return h * 1.0;\n"
+             "    }\n"},
+            {"zShape",
+             "    inline double zShape(double start, double end, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isLE(x, start))\n"
+             "            return h * 1.0;\n"
+             "        if (isLE(x, 0.5 * (start + end)))\n"
+             "            return h * (1.0 - 2.0 * std::pow((x - start) / (end - start), 2));\n"
+             "        if (isLt(x, end))\n"
+             "            return h * (2.0 * std::pow((x - end) / (end - start), 2));\n"
+             "        return h * 0.0;\n"
+             "    }\n"},
+            {"piShape",
+             "    inline double piShape(\n"
+             "        double bottomLeft, double topLeft, double topRight, double bottomRight, double h, double x\n"
+             "    ) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        double sshape;\n"
+             "        if (isLE(x, bottomLeft))\n"
+             "            sshape = 0.0;\n"
+             "        else if (isLE(x, 0.5 * (bottomLeft + topLeft)))\n"
+             "            sshape = 2.0 * std::pow((x - bottomLeft) / (topLeft - bottomLeft), 2);\n"
+             "        else if (isLt(x, topLeft))\n"
+             "            sshape = 1.0 - 2.0 * std::pow((x - topLeft) / (topLeft - bottomLeft), 2);\n"
+             "        else\n"
+             "            sshape = 1.0;\n"
+             "        double zshape;\n"
+             "        if (isLE(x, topRight))\n"
+             "            zshape = 1.0;\n"
+             "        else if (isLE(x, 0.5 * (topRight + bottomRight)))\n"
+             "            zshape = 1.0 - 2.0 * std::pow((x - topRight) / (bottomRight - topRight), 2);\n"
+             "        else if (isLt(x, bottomRight))\n"
+             "            zshape = 2.0 * std::pow((x - bottomRight) / (bottomRight - topRight), 2);\n"
+             "        else\n"
+             "            zshape = 0.0;\n"
+             "        return h * sshape * zshape;\n"
+             "    }\n"},
+            {"ramp",
+             "    inline double ramp(double start, double end, double h, double x) {\n"
+             "        if (isNaN(x) || isEq(start, end))\n"
+             "            return NaN;\n"
+             "        if (isLt(start, end)) {\n"
+             "            if (isLE(x, start))\n"
+             "                return h * 0.0;\n"
+             "            if (isGE(x, end))\n"
+             "                return h * 1.0;\n"
+             "            return h * (x - start) / (end - start);\n"
+             "        }\n"
+             "        if (isGE(x, start))\n"
+             "            return h * 0.0;\n"
+             "        if (isLE(x, end))\n"
+             "            return h * 1.0;\n"
+             "        return h * (start - x) / (start - end);\n"
+             "    }\n"},
+            {"concave",
+             "    inline double concave(double inflection, double end, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isLE(inflection, end)) {\n"
+             "            if (isLt(x, end))\n"
+             "                return h * (end - inflection) / (2.0 * end - inflection - x);\n"
+             "        } else {\n"
+             "            if (isGt(x, end))\n"
+             "                return h * (inflection - end) / (inflection - 2.0 * end + x);\n"
+             "        }\n"
+             "        return h * 1.0;\n"
+             "    }\n"},
+            {"cosine",
+             "    inline double cosine(double center, double width, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isLt(x, center - 0.5 * width) || isGt(x, center + 0.5 * width))\n"
+             "            return h * 0.0;\n"
+             "        const double pi = 4.0 * std::atan(1.0);\n"
+             "        return h * (0.5 * (1.0 + std::cos(2.0 / width * pi * (x - center))));\n"
+             "    }\n"},
+            {"spike",
+             "    inline double spike(double center, double width, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        return h * std::exp(-std::fabs(10.0 / width * (x - center)));\n"
+             "    }\n"},
+            {"sigmoidDifference",
+             "    inline double sigmoidDifference(double left, double rising, double falling, double right, double h, "
+             "double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        const double a = 1.0 / (1.0 + std::exp(-rising * (x - left)));\n"
+             "        const double b = 1.0 / (1.0 + std::exp(-falling * (x - right)));\n"
+             "        return h * std::fabs(a - b);\n"
+             "    }\n"},
+            {"sigmoidProduct",
+             "    inline double sigmoidProduct(double left, double rising, double falling, double right, double h, "
+             "double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        const double a = 1.0 + std::exp(-rising * (x - left));\n"
+             "        const double b = 1.0 + std::exp(-falling * (x - right));\n"
+             "        return h * 1.0 / (a * b);\n"
+             "    }\n"},
+            {"binary",
+             "    inline double binary(double start, double direction, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (direction > start && isGE(x, start))\n"
+             "            return h * 1.0;\n"
+             "        if (direction < start && isLE(x, start))\n"
+             "            return h * 1.0;\n"
+             "        return h * 0.0;\n"
+             "    }\n"},
+            {"discrete",
+             "    inline double discrete(const double* xy, int n, double h, double x) {\n"
+             "        if (isNaN(x))\n"
+             "            return NaN;\n"
+             "        if (isLE(x, xy[0]))\n"
+             "            return h * xy[1];\n"
+             "        if (isGE(x, xy[2 * n - 2]))\n"
+             "            return h * xy[2 * n - 1];\n"
+             "        int i = 0;\n"
+             "        while (xy[2 * i] < x)\n"
+             "            ++i;\n"
+             "        if (isEq(x, xy[2 * i]))\n"
+             "            return h * xy[2 * i + 1];\n"
+             "        return h\n"
+             "               * ((xy[2 * i + 1] - xy[2 * i - 1]) / (xy[2 * i] - xy[2 * i - 2]) * (x - xy[2 * i - 2])\n"
+             "                  + xy[2 * i - 1]);\n"
+             "    }\n"},
+            {"rampTsukamoto",
+             "    inline double rampTsukamoto(double start, double end, double h, double y) {\n"
+             "        return start + (end - start) * y / h;\n"
+             "    }\n"},
+            {"sigmoidTsukamoto",
+             "    inline double sigmoidTsukamoto(double inflection, double slope, double h, double y) {\n"
+             "        return inflection + std::log(h / y - 1.0) / -slope;\n"
+             "    }\n"},
+            {"sShapeTsukamoto",
+             "    inline double sShapeTsukamoto(double start, double end, double h, double y) {\n"
+             "        if (y <= h / 2)\n"
+             "            return start + (end - start) * std::sqrt(y / (2 * h));\n"
+             "        return end - (end - start) * std::sqrt((h - y) / (2 * h));\n"
+             "    }\n"},
+            {"zShapeTsukamoto",
+             "    inline double zShapeTsukamoto(double start, double end, double h, double y) {\n"
+             "        if (y <= h / 2)\n"
+             "            return end - (end - start) * std::sqrt(y / (2 * h));\n"
+             "        return start + (end - start) * std::sqrt((h - y) / (2 * h));\n"
+             "    }\n"},
+            {"concaveTsukamoto",
+             "    inline double concaveTsukamoto(double inflection, double end, double h, double y) {\n"
+             "        return h * (inflection - end) / y + 2 * end - inflection;\n"
+             "    }\n"},
+            {"algebraicProduct",
+             "    inline double algebraicProduct(double a, double b) {\n"
+             "        return a * b;\n"
+             "    }\n"},
+            {"boundedDifference",
+             "    inline double boundedDifference(double a, double b) {\n"
+             "        return maximum(0.0, a + b - 1.0);\n"
+             "    }\n"},
+            {"drasticProduct",
+             "    inline double drasticProduct(double a, double b) {\n"
+             "        if (isEq(maximum(a, b), 1.0))\n"
+             "            return minimum(a, b);\n"
+             "        return 0.0;\n"
+             "    }\n"},
+            {"einsteinProduct",
+             "    inline double einsteinProduct(double a, double b) {\n"
+             "        return (a * b) / (2.0 - (a + b - a * b));\n"
+             "    }\n"},
+            {"hamacherProduct",
+             "    inline double hamacherProduct(double a, double b) {\n"
+             "        if (isEq(a + b, 0.0))\n"
+             "            return 0.0;\n"
+             "        return (a * b) / (a + b - a * b);\n"
+             "    }\n"},
+            {"nilpotentMinimum",
+             "    inline double nilpotentMinimum(double a, double b) {\n"
+             "        if (isGt(a + b, 1.0))\n"
+             "            return minimum(a, b);\n"
+             "        return 0.0;\n"
+             "    }\n"},
+            {"algebraicSum",
+             "    inline double algebraicSum(double a, double b) {\n"
+             "        return a + b - (a * b);\n"
+             "    }\n"},
+            {"boundedSum",
+             "    inline double boundedSum(double a, double b) {\n"
+             "        return minimum(1.0, a + b);\n"
+             "    }\n"},
+            {"drasticSum",
+             "    inline double drasticSum(double a, double b) {\n"
+             "        if (isEq(minimum(a, b), 0.0))\n"
+             "            return maximum(a, b);\n"
+             "        return 1.0;\n"
+             "    }\n"},
+            {"einsteinSum",
+             "    inline double einsteinSum(double a, double b) {\n"
+             "        return (a + b) / (1.0 + a * b);\n"
+             "    }\n"},
+            {"hamacherSum",
+             "    inline double hamacherSum(double a, double b) {\n"
+             "        if (isEq(a * b, 1.0))\n"
+             "            return 1.0;\n"
+             "        return (a + b - 2.0 * a * b) / (1.0 - a * b);\n"
+             "    }\n"},
+            {"nilpotentMaximum",
+             "    inline double nilpotentMaximum(double a, double b) {\n"
+             "        if (isLt(a + b, 1.0))\n"
+             "            return maximum(a, b);\n"
+             "        return 1.0;\n"
+             "    }\n"},
+            {"normalizedSum",
+             "    inline double normalizedSum(double a, double b) {\n"
+             "        return (a + b) / maximum(1.0, a + b);\n"
+             "    }\n"},
+            {"unboundedSum",
+             "    inline double unboundedSum(double a, double b) {\n"
+             "        return a + b;\n"
+             "    }\n"},
+            {"very",
+             "    inline double very(double x) {\n"
+             "        return x * x;\n"
+             "    }\n"},
+            {"somewhat",
+             "    inline double somewhat(double x) {\n"
+             "        return std::sqrt(x);\n"
+             "    }\n"},
+            {"extremely",
+             "    inline double extremely(double x) {\n"
+             "        return isLE(x, 0.5) ? 2.0 * x * x : (1.0 - 2.0 * (1.0 - x) * (1.0 - x));\n"
+             "    }\n"},
+            {"seldom",
+             "    inline double seldom(double x) {\n"
+             "        return isLE(x, 0.5) ? std::sqrt(0.5 * x) : (1.0 - std::sqrt(0.5 * (1.0 - x)));\n"
+             "    }\n"},
+            {"logicalAnd",
+             "    inline double logicalAnd(double a, double b) {\n"
+             "        return (isEq(a, 1.0) && isEq(b, 1.0)) ? 1.0 : 0.0;\n"
+             "    }\n"},
+            {"logicalOr",
+             "    inline double logicalOr(double a, double b) {\n"
+             "        return (isEq(a, 1.0) || isEq(b, 1.0)) ? 1.0 : 0.0;\n"
+             "    }\n"},
+            {"logicalNot",
+             "    inline double logicalNot(double a) {\n"
+             "        return isEq(a, 1.0) ? 0.0 : 1.0;\n"
+             "    }\n"},
+            {"rounded",
+             "    inline double rounded(double x) {\n"
+             "        return (x > 0.0) ? std::floor(x + 0.5) : std::ceil(x - 0.5);\n"
+             "    }\n"},
+            {"eq",
+             "    inline double eq(double a, double b) {\n"
+             "        return isEq(a, b);\n"
+             "    }\n"},
+            {"neq",
+             "    inline double neq(double a, double b) {\n"
+             "        return !isEq(a, b);\n"
+             "    }\n"},
+            {"gt",
+             "    inline double gt(double a, double b) {\n"
+             "        return isGt(a, b);\n"
+             "    }\n"},
+            {"ge",
+             "    inline double ge(double a, double b) {\n"
+             "        return isGE(a, b);\n"
+             "    }\n"},
+            {"lt",
+             "    inline double lt(double a, double b) {\n"
+             "        return isLt(a, b);\n"
+             "    }\n"},
+            {"le",
+             "    inline double le(double a, double b) {\n"
+             "        return isLE(a, b);\n"
+             "    }\n"}};
+
+        std::string literal(scalar value) {
+            if (Op::isNaN(value))
+                return "NaN";
+            if (Op::isInf(value))
+                return value > 0 ? "Infinity" : "-Infinity";
+            std::ostringstream ss;
+            ss << std::setprecision(std::numeric_limits<scalar>::digits10 + 3) << value;
+            std::string result = ss.str();
+            if (result.find_first_of(".e") == std::string::npos)
+                result += ".0";
+            return result;
+        }
+
+        std::string identifier(const std::string& prefix, std::size_t index) {
+            return prefix + "_" + Op::str(index);
+        }
+
+        struct Conclusion {
+            std::size_t output;
+            const Term* term;
+            const std::vector<Hedge*>* hedges;
+            const TNorm* implication;
+        };
+
+        struct RuleSlots {
+            std::size_t index;
+            std::size_t conclusionBegin;
+            std::size_t conclusionEnd;
+        };
+
+        struct Generator {
+            const Engine* engine;
+            std::set<std::string> used;
+            std::set<std::size_t> inputs;
+            std::ostringstream declarations;
+            std::vector<Conclusion> conclusions;
+            std::map<const Rule*, RuleSlots> rules;
+            std::map<std::pair<std::size_t, const Term*>, std::string> memberships;
+            std::ostringstream membershipCode;
+            std::size_t discretes;
+            std::size_t activations;
+
+            explicit Generator(const Engine* engine) : engine(engine), discretes(0), activations(0) {}
+
+            std::string input(std::size_t index) {
+                inputs.insert(index);
+                return identifier("input", index);
+            }
+
+            std::string call(const std::string& helper, const std::string& arguments) {
+                used.insert(helper);
+                return helper + "(" + arguments + ")";
+            }
+
+            std::string kernel(
+                const std::string& helper, const scalar* parameters, std::size_t n, scalar height, const std::string& x
+            ) {
+                std::string arguments;
+                for (std::size_t i = 0; i < n; ++i)
+                    arguments += literal(parameters[i]) + ", ";
+                return call(helper, arguments + literal(height) + ", " + x);
+            }
+
+            std::string norm(const Norm* norm) {
+                const std::string name = norm->className();
+                if (name == "Minimum")
+                    return "minimum";
+                if (name == "Maximum")
+                    return "maximum";
+                const char* const kernels[] = {
+                    "AlgebraicProduct",
+                    "BoundedDifference",
+                    "DrasticProduct",
+                    "EinsteinProduct",
+                    "HamacherProduct",
+                    "NilpotentMinimum",
+                    "AlgebraicSum",
+                    "BoundedSum",
+                    "DrasticSum",
+                    "EinsteinSum",
+                    "HamacherSum",
+                    "NilpotentMaximum",
+                    "NormalizedSum",
+                    "UnboundedSum"
+                };
+                for (std::size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); ++i) {
+                    if (name == kernels[i]) {
+                        const std::string helper = char(std::tolower(name.at(0))) + name.substr(1);
+                        used.insert(helper);
+                        return helper;
+                    }
+                }
+                throw Exception("[exporter error] norm <" + name + "> cannot be exported to C++ code", FL_AT);
+            }
+
+            std::string hedge(const Hedge* hedge, const std::string& x) {
+                if (dynamic_cast<const Any*>(hedge))
+                    return "1.0";
+                if (dynamic_cast<const Not*>(hedge))
+                    return "(1.0 - " + x + ")";
+                if (dynamic_cast<const Very*>(hedge))
+                    return call("very", x);
+                if (dynamic_cast<const Somewhat*>(hedge))
+                    return call("somewhat", x);
+                if (dynamic_cast<const Extremely*>(hedge))
+                    return call("extremely", x);
+                if (dynamic_cast<const Seldom*>(hedge))
+                    return call("seldom", x);
+                throw Exception("[exporter error] hedge <" + hedge->name() + "> cannot be exported to C++ code", FL_AT);
+            }
+
+            std::string hedges(const std::vector<Hedge*>& hedges, std::string x) {
+                // hedges are applied in reverse order
+                for (std::vector<Hedge*>::const_reverse_iterator rit = hedges.rbegin(); rit != hedges.rend(); ++rit)
+                    x = hedge(*rit, x);
+                return x;
+            }
+
+            std::string formula(const Function* function, const Function::Node* node, const std::string& x) {
+                if (node->element.get()) {
+                    const std::string name = node->element->name;
+                    if (node->element->unary) {
+                        if (not(node->left.get() or node->right.get()))
+                            throw Exception("[function error] expected one node, but got none: " + node->toString());
+                        const std::string a
+                            = formula(function, (node->left.get() ? node->left : node->right).get(), x);
+                        if (name == "~")
+                            return "(-" + a + ")";
+                        if (name == "!")
+                            return call("logicalNot", a);
+                        if (name == "round")
+                            return call("rounded", a);
+                        if (name == "abs" or name == "fabs")
+                            return "std::fabs(" + a + ")";
+                        const char* const functions[] = {"acos",  "asin", "atan", "ceil", "cos", "cosh", "exp", "floor",
+                                                         "log",   "log10", "sin", "sinh", "sqrt", "tan", "tanh"};
+                        for (std::size_t i = 0; i < sizeof(functions) / sizeof(functions[0]); ++i)
+                            if (name == functions[i])
+                                return "std::" + name + "(" + a + ")";
+                    } else if (node->element->binary) {
+                        if (not(node->left.get() and node->right.get()))
+                            throw Exception("[function error] expected two nodes, but got fewer: " + node->toString());
+                        const std::string a = formula(function, node->left.get(), x);
+                        const std::string b = formula(function, node->right.get(), x);
+                        if (name == "+" or name == "-" or name == "*" or name == "/")
+                            return "(" + a + " " + name + " " + b + ")";
+                        if (name == "^" or name == "pow")
+                            return "std::pow(" + a + ", " + b + ")";
+                        if (name == "%" or name == "fmod")
+                            return "std::fmod(" + a + ", " + b + ")";
+                        if (name == "atan2")
+                            return "std::atan2(" + a + ", " + b + ")";
+                        if (name == "min")
+                            return "minimum(" + a + ", " + b + ")";
+                        if (name == "max")
+                            return "maximum(" + a + ", " + b + ")";
+                        if (name == Rule::andKeyword())
+                            return call("logicalAnd", a + ", " + b);
+                        if (name == Rule::orKeyword())
+                            return call("logicalOr", a + ", " + b);
+                        if (name == "eq" or name == "neq" or name == "gt" or name == "ge" or name == "lt"
+                            or name == "le")
+                            return call(name, a + ", " + b);
+                    }
+                    throw Exception(
+                        "[exporter error] function <" + name + "> in formula <" + function->getFormula()
+                            + "> cannot be exported to C++ code",
+                        FL_AT
+                    );
+                }
+                if (node->variable.empty())
+                    return literal(node->constant);
+                const bool engineVariable = function->getEngine() == engine;
+                if (node->source == Function::Node::X)
+                    return x;
+                if (node->source == Function::Node::Input and engineVariable
+                    and node->index < engine->numberOfInputVariables())
+                    return input(node->index);
+                if (node->source == Function::Node::Output and engineVariable
+                    and node->index < engine->numberOfOutputVariables())
+                    return "out[" + Op::str(node->index) + "]";
+                std::map<std::string, scalar>::const_iterator it = function->variables.find(node->variable);
+                if (node->source == Function::Node::Map and it != function->variables.end())
+                    return literal(it->second);
+                throw Exception(
+                    "[exporter error] variable <" + node->variable + "> in formula <" + function->getFormula()
+                        + "> cannot be exported to C++ code",
+                    FL_AT
+                );
+            }
+
+            std::string membership(const Term* term, const std::string& x) {
+                const std::string name = term->className();
+                const scalar h = term->getHeight();
+                if (name == "Triangle") {
+                    const Triangle* t = static_cast<const Triangle*>(term);
+                    const scalar p[] = {t->getVertexA(), t->getVertexB(), t->getVertexC()};
+                    return kernel("triangle", p, 3, h, x);
+                }
+                if (name == "Trapezoid") {
+                    const Trapezoid* t = static_cast<const Trapezoid*>(term);
+                    const scalar p[] = {t->getVertexA(), t->getVertexB(), t->getVertexC(), t->getVertexD()};
+                    return kernel("trapezoid", p, 4, h, x);
+                }
+                if (name == "Rectangle") {
+                    const Rectangle* t = static_cast<const Rectangle*>(term);
+                    const scalar p[] = {t->getStart(), t->getEnd()};
+                    return kernel("rectangle", p, 2, h, x);
+                }
+                if (name == "Gaussian") {
+                    const Gaussian* t = static_cast<const Gaussian*>(term);
+                    const scalar p[] = {t->getMean(), t->getStandardDeviation()};
+                    return kernel("gaussian", p, 2, h, x);
+                }
+                if (name == "GaussianProduct") {
+                    const GaussianProduct* t = static_cast<const GaussianProduct*>(term);
+                    const scalar p[] = {
+                        t->getMeanA(), t->getStandardDeviationA(), t->getMeanB(), t->getStandardDeviationB()
+                    };
+                    return kernel("gaussianProduct", p, 4, h, x);
+                }
+                if (name == "Bell") {
+                    const Bell* t = static_cast<const Bell*>(term);
+                    const scalar p[] = {t->getCenter(), t->getWidth(), t->getSlope()};
+                    return kernel("bell", p, 3, h, x);
+                }
+                if (name == "Sigmoid") {
+                    const Sigmoid* t = static_cast<const Sigmoid*>(term);
+                    const scalar p[] = {t->getInflection(), t->getSlope()};
+                    return kernel("sigmoid", p, 2, h, x);
+                }
+                if (name == "SShape") {
+                    const SShape* t = static_cast<const SShape*>(term);
+                    const scalar p[] = {t->getStart(), t->getEnd()};
+                    return kernel("sShape", p, 2, h, x);
+                }
+                if (name == "ZShape") {
+                    const ZShape* t = static_cast<const ZShape*>(term);
+                    const scalar p[] = {t->getStart(), t->getEnd()};
+                    return kernel("zShape", p, 2, h, x);
+                }
+                if (name == "PiShape") {
+                    const PiShape* t = static_cast<const PiShape*>(term);
+                    const scalar p[] = {t->getBottomLeft(), t->getTopLeft(), t->getTopRight(), t->getBottomRight()};
+                    return kernel("piShape", p, 4, h, x);
+                }
+                if (name == "Ramp") {
+                    const Ramp* t = static_cast<const Ramp*>(term);
+                    const scalar p[] = {t->getStart(), t->getEnd()};
+                    return kernel("ramp", p, 2, h, x);
+                }
+                if (name == "Concave") {
+                    const Concave* t = static_cast<const Concave*>(term);
+                    const scalar p[] = {t->getInflection(), t->getEnd()};
+                    return kernel("concave", p, 2, h, x);
+                }
+                if (name == "Cosine") {
+                    const Cosine* t = static_cast<const Cosine*>(term);
+                    const scalar p[] = {t->getCenter(), t->getWidth()};
+                    return kernel("cosine", p, 2, h, x);
+                }
+                if (name == "Spike") {
+                    const Spike* t = static_cast<const Spike*>(term);
+                    const scalar p[] = {t->getCenter(), t->getWidth()};
+                    return kernel("spike", p, 2, h, x);
+                }
+                if (name == "SigmoidDifference") {
+                    const SigmoidDifference* t = static_cast<const SigmoidDifference*>(term);
+                    const scalar p[] = {t->getLeft(), t->getRising(), t->getFalling(), t->getRight()};
+                    return kernel("sigmoidDifference", p, 4, h, x);
+                }
+                if (name == "SigmoidProduct") {
+                    const SigmoidProduct* t = static_cast<const SigmoidProduct*>(term);
+                    const scalar p[] = {t->getLeft(), t->getRising(), t->getFalling(), t->getRight()};
+                    return kernel("sigmoidProduct", p, 4, h, x);
+                }
+                if (name == "Binary") {
+                    const Binary* t = static_cast<const Binary*>(term);
+                    const scalar p[] = {t->getStart(), t->getDirection()};
+                    return kernel("binary", p, 2, h, x);
+                }
+                if (name == "Discrete") {
+                    const Discrete* t = static_cast<const Discrete*>(term);
+                    if (t->xy().empty())
+                        throw Exception("[discrete error] term is empty", FL_AT);
+                    const std::string xy = identifier("discrete", discretes++);
+                    declarations << "    const double " << xy << "[] = {";
+                    for (std::size_t i = 0; i < t->xy().size(); ++i)
+                        declarations << (i ? ", " : "") << literal(t->xy().at(i).first) << ", "
+                                     << literal(t->xy().at(i).second);
+                    declarations << "};\n";
+                    return call("discrete", xy + ", " + Op::str(t->xy().size()) + ", " + literal(h) + ", " + x);
+                }
+                if (name == "Constant")
+                    return literal(static_cast<const Constant*>(term)->getValue());
+                if (name == "Linear") {
+                    const Linear* t = static_cast<const Linear*>(term);
+                    if (t->getEngine() != engine)
+                        throw Exception(
+                            "[exporter error] linear term <" + t->getName() + "> must refer to the exported engine",
+                            FL_AT
+                        );
+                    const std::vector<scalar>& coefficients = t->coefficients();
+                    const std::size_t numberOfInputVariables = engine->numberOfInputVariables();
+                    std::string result = "0.0";
+                    for (std::size_t i = 0; i < numberOfInputVariables and i < coefficients.size(); ++i)
+                        result += " + " + literal(coefficients.at(i)) + " * " + input(i);
+                    if (coefficients.size() > numberOfInputVariables)
+                        result += " + " + literal(coefficients.back());
+                    return "(" + result + ")";
+                }
+                if (name == "Function") {
+                    const Function* t = static_cast<const Function*>(term);
+                    if (not t->isLoaded())
+                        throw Exception(
+                            "[exporter error] function <" + t->getFormula() + "> must be loaded to be exported", FL_AT
+                        );
+                    return formula(t, t->root(), x);
+                }
+                throw Exception("[exporter error] term <" + name + "> cannot be exported to C++ code", FL_AT);
+            }
+
+            std::string tsukamoto(const Term* term, const std::string& y) {
+                const std::string name = term->className();
+                const scalar h = term->getHeight();
+                if (name == "Ramp") {
+                    const Ramp* t = static_cast<const Ramp*>(term);
+                    const scalar p[] = {t->getStart(), t->getEnd()};
+                    return kernel("rampTsukamoto", p, 2, h, y);
+                }
+                if (name == "Sigmoid") {
+                    const Sigmoid* t = static_cast<const Sigmoid*>(term);
+                    const scalar p[] = {t->getInflection(), t->getSlope()};
+                    return kernel("sigmoidTsukamoto", p, 2, h, y);
+                }
+                if (name == "SShape") {
+                    const SShape* t = static_cast<const SShape*>(term);
+                    const scalar p[] = {t->getStart(), t->getEnd()};
+                    return kernel("sShapeTsukamoto", p, 2, h, y);
+                }
+                if (name == "ZShape") {
+                    const ZShape* t = static_cast<const ZShape*>(term);
+                    const scalar p[] = {t->getStart(), t->getEnd()};
+                    return kernel("zShapeTsukamoto", p, 2, h, y);
+                }
+                if (name == "Concave") {
+                    const Concave* t = static_cast<const Concave*>(term);
+                    const scalar p[] = {t->getInflection(), t->getEnd()};
+                    return kernel("concaveTsukamoto", p, 2, h, y);
+                }
+                throw Exception("[tsukamoto error] the term does not support Tsukamoto: " + term->toString(), FL_AT);
+            }
+
+
+            std::size_t indexOf(const Variable* variable) const {
+                for (std::size_t o = 0; o < engine->numberOfOutputVariables(); ++o)
+                    if (engine->getOutputVariable(o) == variable)
+                        return o;
+                return engine->numberOfOutputVariables();
+            }
+
+            // the conclusions of the rules are the terms that can be activated in the fuzzy outputs
+            void collectConclusions() {
+                std::size_t index = 0;
+                for (std::size_t b = 0; b < engine->numberOfRuleBlocks(); ++b) {
+                    const RuleBlock* ruleBlock = engine->getRuleBlock(b);
+                    if (not ruleBlock->isEnabled())
+                        continue;
+                    for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r) {
+                        const Rule* rule = ruleBlock->getRule(r);
+                        if (not rule->isLoaded())
+                            continue;
+                        RuleSlots slots;
+                        slots.index = index++;
+                        slots.conclusionBegin = conclusions.size();
+                        const std::vector<Proposition*>& propositions = rule->getConsequent()->conclusions();
+                        for (std::size_t c = 0; c < propositions.size(); ++c) {
+                            const Proposition* proposition = propositions.at(c);
+                            if (not proposition->variable->isEnabled())
+                                continue;
+                            Conclusion conclusion;
+                            conclusion.output = indexOf(proposition->variable);
+                            if (conclusion.output == engine->numberOfOutputVariables() or not proposition->term)
+                                throw Exception(
+                                    "[exporter error] conclusion <" + proposition->toString()
+                                        + "> must refer to a term of an output variable of the engine",
+                                    FL_AT
+                                );
+                            conclusion.term = proposition->term;
+                            conclusion.hedges = &proposition->hedges;
+                            conclusion.implication = ruleBlock->getImplication();
+                            conclusions.push_back(conclusion);
+                        }
+                        slots.conclusionEnd = conclusions.size();
+                        rules[rule] = slots;
+                    }
+                }
+            }
+
+            // the membership of the input value to the term is computed once for all the rules
+            std::string inputMembership(std::size_t index, const Term* term) {
+                const std::pair<std::size_t, const Term*> key(index, term);
+                std::map<std::pair<std::size_t, const Term*>, std::string>::const_iterator it = memberships.find(key);
+                if (it != memberships.end())
+                    return it->second;
+                const std::string result = identifier("membership", memberships.size());
+                membershipCode << "    const double " << result << " = " << membership(term, input(index)) << "; // "
+                               << engine->getInputVariable(index)->getName() << " is " << term->getName() << "\n";
+                memberships[key] = result;
+                return result;
+            }
+
+            // the activation degree of the term in the fuzzy output so far, as in Aggregated::activationDegree()
+            std::string outputActivationDegree(
+                std::size_t output, const Term* term, std::ostream& code, const std::string& indent
+            ) {
+                const Norm* aggregation = engine->getOutputVariable(output)->getAggregation();
+                const std::string result = identifier("activation", activations++);
+                code << indent << "double " << result << " = 0.0;\n";
+                for (std::size_t c = 0; c < conclusions.size(); ++c) {
+                    if (conclusions.at(c).output != output or conclusions.at(c).term != term)
+                        continue;
+                    code << indent << "if (activated[" << c << "])\n" << indent << "    " << result;
+                    if (aggregation)
+                        code << " = " << norm(aggregation) << "(" << result << ", degree[" << c << "]);\n";
+                    else
+                        code << " += degree[" << c << "];\n";
+                }
+                return result;
+            }
+
+            std::string antecedent(
+                const Expression* node,
+                const RuleBlock* ruleBlock,
+                const std::string& text,
+                std::ostream& code,
+                const std::string& indent
+            ) {
+                if (not node)
+                    throw Exception("[exporter error] antecedent <" + text + "> is not loaded", FL_AT);
+
+                if (node->type() == Expression::Proposition) {
+                    const Proposition* proposition = static_cast<const Proposition*>(node);
+                    if (not proposition->variable->isEnabled())
+                        return "0.0";
+                    std::string value = "NaN";
+                    const bool any
+                        = not proposition->hedges.empty() and dynamic_cast<const Any*>(proposition->hedges.back());
+                    const Variable::Type variableType = proposition->variable->type();
+                    if (not any and (variableType == Variable::Input or variableType == Variable::Output)) {
+                        if (not proposition->term)
+                            throw Exception(
+                                "[exporter error] proposition <" + proposition->toString() + "> requires a term", FL_AT
+                            );
+                        std::size_t index = 0;
+                        std::size_t size = 0;
+                        if (variableType == Variable::Input) {
+                            size = engine->numberOfInputVariables();
+                            while (index < size and engine->getInputVariable(index) != proposition->variable)
+                                ++index;
+                        } else {
+                            size = engine->numberOfOutputVariables();
+                            index = indexOf(proposition->variable);
+                        }
+                        if (index == size)
+                            throw Exception(
+                                "[exporter error] proposition <" + proposition->toString()
+                                    + "> refers to a variable that is not in the engine",
+                                FL_AT
+                            );
+                        if (variableType == Variable::Input)
+                            value = inputMembership(index, proposition->term);
+                        else
+                            value = outputActivationDegree(index, proposition->term, code, indent);
+                    }
+                    return hedges(proposition->hedges, value);
+                }
+
+                if (node->type() == Expression::Operator) {
+                    const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+                    if (not(fuzzyOperator->left and fuzzyOperator->right))
+                        throw Exception("[syntax error] left and right operands must exist", FL_AT);
+                    const Norm* operation = fl::null;
+                    if (fuzzyOperator->name == Rule::andKeyword()) {
+                        operation = ruleBlock->getConjunction();
+                        if (not operation)
+                            throw Exception(
+                                "[conjunction error] the following rule requires a conjunction operator:\n" + text,
+                                FL_AT
+                            );
+                    } else if (fuzzyOperator->name == Rule::orKeyword()) {
+                        operation = ruleBlock->getDisjunction();
+                        if (not operation)
+                            throw Exception(
+                                "[disjunction error] the following rule requires a disjunction operator:\n" + text,
+                                FL_AT
+                            );
+                    } else {
+                        throw Exception("[syntax error] operator <" + fuzzyOperator->name + "> not recognized", FL_AT);
+                    }
+                    const std::string a = antecedent(fuzzyOperator->left, ruleBlock, text, code, indent);
+                    const std::string b = antecedent(fuzzyOperator->right, ruleBlock, text, code, indent);
+                    return norm(operation) + "(" + a + ", " + b + ")";
+                }
+
+                throw Exception(
+                    "[antecedent error] expected a Proposition or Operator, but found <" + node->toString() + ">", FL_AT
+                );
+            }
+
+            // the activation degree of the rule, as in Rule::activationDegree()
+            std::string ruleDegree(
+                const Rule* rule, const RuleBlock* ruleBlock, std::ostream& code, const std::string& indent
+            ) {
+                const std::string result = identifier("rule", rules[rule].index);
+                code << indent << "// " << rule->getText() << "\n";
+                const std::string value
+                    = antecedent(rule->getAntecedent()->getExpression(), ruleBlock, rule->getText(), code, indent);
+                code << indent << "const double " << result << " = ";
+                if (rule->getWeight() == 1.0)
+                    code << value << ";\n";
+                else
+                    code << literal(rule->getWeight()) << " * " << value << ";\n";
+                return result;
+            }
+
+            // the conclusions of the rule are activated in the fuzzy outputs, as in Rule::trigger()
+            void trigger(const Rule* rule, const std::string& degree, std::ostream& code, const std::string& indent) {
+                const RuleSlots& slots = rules[rule];
+                if (not rule->isEnabled() or slots.conclusionBegin == slots.conclusionEnd)
+                    return;
+                code << indent << "if (isGt(" << degree << ", 0.0)) {\n";
+                std::string previous = degree;
+                for (std::size_t c = slots.conclusionBegin; c < slots.conclusionEnd; ++c) {
+                    const std::string current = "degree[" + Op::str(c) + "]";
+                    code << indent << "    activated[" << c << "] = true;\n";
+                    code << indent << "    " << current << " = " << hedges(*conclusions.at(c).hedges, previous)
+                         << ";\n";
+                    previous = current;
+                }
+                code << indent << "}\n";
+            }
+
+            // the rules are activated as in the Activation methods
+            void activate(const RuleBlock* ruleBlock, std::ostream& code) {
+                std::vector<const Rule*> loaded;
+                for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r)
+                    if (ruleBlock->getRule(r)->isLoaded())
+                        loaded.push_back(ruleBlock->getRule(r));
+
+                const Activation* activation = ruleBlock->getActivation();
+                const std::string name = activation ? activation->className() : General().className();
+                code << "    // rule block <" << ruleBlock->getName() << "> with " << name << " activation\n";
+                if (loaded.empty())
+                    return;
+                const std::string indent = "        ";
+                code << "    {\n";
+                if (name == "General") {
+                    for (std::size_t r = 0; r < loaded.size(); ++r) {
+                        if (not loaded.at(r)->isEnabled())
+                            continue;
+                        trigger(loaded.at(r), ruleDegree(loaded.at(r), ruleBlock, code, indent), code, indent);
+                    }
+                } else if (name == "First" or name == "Last") {
+                    int numberOfRules;
+                    scalar threshold;
+                    if (name == "First") {
+                        numberOfRules = static_cast<const First*>(activation)->getNumberOfRules();
+                        threshold = static_cast<const First*>(activation)->getThreshold();
+                    } else {
+                        numberOfRules = static_cast<const Last*>(activation)->getNumberOfRules();
+                        threshold = static_cast<const Last*>(activation)->getThreshold();
+                        std::reverse(loaded.begin(), loaded.end());
+                    }
+                    code << indent << "int triggered = 0;\n";
+                    for (std::size_t r = 0; r < loaded.size(); ++r) {
+                        const std::string degree = ruleDegree(loaded.at(r), ruleBlock, code, indent);
+                        code << indent << "if (triggered < " << numberOfRules << " && isGt(" << degree
+                             << ", 0.0) && isGE(" << degree << ", " << literal(threshold) << ")) {\n";
+                        trigger(loaded.at(r), degree, code, indent + "    ");
+                        code << indent << "    ++triggered;\n" << indent << "}\n";
+                    }
+                } else if (name == "Highest" or name == "Lowest") {
+                    const bool highest = name == "Highest";
+                    const int numberOfRules = highest ? static_cast<const Highest*>(activation)->getNumberOfRules()
+                                                      : static_cast<const Lowest*>(activation)->getNumberOfRules();
+                    std::vector<std::string> degrees;
+                    for (std::size_t r = 0; r < loaded.size(); ++r)
+                        degrees.push_back(ruleDegree(loaded.at(r), ruleBlock, code, indent));
+                    code << indent << "const double degrees[] = {" << Op::join(degrees, ", ") << "};\n";
+                    code << indent << "bool selected[" << loaded.size() << "] = {false};\n";
+                    code << indent << "for (int n = 0; n < " << numberOfRules << "; ++n) {\n";
+                    code << indent << "    int best = -1;\n";
+                    code << indent << "    for (int r = 0; r < " << loaded.size() << "; ++r)\n";
+                    code << indent << "        if (!selected[r] && isGt(degrees[r], 0.0) && (best < 0 || degrees[r] "
+                         << (highest ? ">" : "<") << " degrees[best]))\n";
+                    code << indent << "            best = r;\n";
+                    code << indent << "    if (best < 0)\n";
+                    code << indent << "        break;\n";
+                    code << indent << "    selected[best] = true;\n";
+                    code << indent << "}\n";
+                    for (std::size_t r = 0; r < loaded.size(); ++r) {
+                        if (not loaded.at(r)->isEnabled())
+                            continue;
+                        code << indent << "if (selected[" << r << "]) {\n";
+                        trigger(loaded.at(r), degrees.at(r), code, indent + "    ");
+                        code << indent << "}\n";
+                    }
+                } else if (name == "Proportional") {
+                    std::vector<std::string> degrees;
+                    code << indent << "double sum = 0.0;\n";
+                    for (std::size_t r = 0; r < loaded.size(); ++r) {
+                        degrees.push_back(ruleDegree(loaded.at(r), ruleBlock, code, indent));
+                        code << indent << "sum += " << degrees.back() << ";\n";
+                    }
+                    for (std::size_t r = 0; r < loaded.size(); ++r) {
+                        if (not loaded.at(r)->isEnabled())
+                            continue;
+                        const std::string degree = identifier("proportional", rules[loaded.at(r)].index);
+                        code << indent << "const double " << degree << " = " << degrees.at(r) << " / sum;\n";
+                        trigger(loaded.at(r), degree, code, indent);
+                    }
+                } else if (name == "Threshold") {
+                    const Threshold* thresholdActivation = static_cast<const Threshold*>(activation);
+                    const std::string threshold = literal(thresholdActivation->getValue());
+                    for (std::size_t r = 0; r < loaded.size(); ++r) {
+                        if (not loaded.at(r)->isEnabled())
+                            continue;
+                        const std::string degree = ruleDegree(loaded.at(r), ruleBlock, code, indent);
+                        std::string comparison;
+                        switch (thresholdActivation->getComparison()) {
+                            case Threshold::LessThan:
+                                comparison = "isLt(" + degree + ", " + threshold + ")";
+                                break;
+                            case Threshold::LessThanOrEqualTo:
+                                comparison = "isLE(" + degree + ", " + threshold + ")";
+                                break;
+                            case Threshold::EqualTo:
+                                comparison = "isEq(" + degree + ", " + threshold + ")";
+                                break;
+                            case Threshold::NotEqualTo:
+                                comparison = "!isEq(" + degree + ", " + threshold + ")";
+                                break;
+                            case Threshold::GreaterThanOrEqualTo:
+                                comparison = "isGE(" + degree + ", " + threshold + ")";
+                                break;
+                            case Threshold::GreaterThan:
+                                comparison = "isGt(" + degree + ", " + threshold + ")";
+                                break;
+                        }
+                        code << indent << "if (" << comparison << ") {\n";
+                        trigger(loaded.at(r), degree, code, indent + "    ");
+                        code << indent << "}\n";
+                    }
+                } else {
+                    throw Exception(
+                        "[exporter error] activation method <" + name + "> in rule block <" + ruleBlock->getName()
+                            + "> cannot be exported to C++ code",
+                        FL_AT
+                    );
+                }
+                code << "    }\n";
+            }
+
+            // the fuzzy output is sampled at the midpoints of the resolution, as in IntegralDefuzzifier
+            void integralDefuzzify(std::size_t output, const std::vector<std::size_t>& activated, std::ostream& code) {
+                const OutputVariable* outputVariable = engine->getOutputVariable(output);
+                const IntegralDefuzzifier* defuzzifier
+                    = static_cast<const IntegralDefuzzifier*>(outputVariable->getDefuzzifier());
+                const std::string name = defuzzifier->className();
+                const Centroid* centroid = dynamic_cast<const Centroid*>(defuzzifier);
+                const Bisector* bisector = dynamic_cast<const Bisector*>(defuzzifier);
+                if (defuzzifier->isRestrictedToSupport()
+                    or (centroid and (centroid->isExact() or centroid->getTolerance() > 0.0))
+                    or (bisector and bisector->getTolerance() > 0.0)
+                    or not(name == "Centroid" or name == "Bisector" or name == "MeanOfMaximum"
+                           or name == "SmallestOfMaximum" or name == "LargestOfMaximum"))
+                    throw Exception(
+                        "[exporter error] defuzzifier <" + FllExporter().toString(defuzzifier)
+                            + "> cannot be exported to C++ code",
+                        FL_AT
+                    );
+                if (not outputVariable->getAggregation())
+                    throw Exception(
+                        "[exporter error] output variable <" + outputVariable->getName()
+                            + "> requires an aggregation operator to be exported to C++ code",
+                        FL_AT
+                    );
+                const std::string aggregation = norm(outputVariable->getAggregation());
+
+                const std::string indent = "            ";
+                const scalar minimum = outputVariable->getMinimum();
+                const scalar maximum = outputVariable->getMaximum();
+                const int resolution = defuzzifier->getResolution();
+                if (not Op::isFinite(minimum + maximum) or resolution <= 0) {
+                    code << indent << "value = NaN;\n";
+                    return;
+                }
+                const std::string dx = literal((maximum - minimum) / resolution);
+                const std::string x = literal(minimum) + " + (i + 0.5) * " + dx;
+
+                if (name == "Centroid")
+                    code << indent << "double area = 0.0, centroid = 0.0;\n";
+                else if (name == "Bisector")
+                    code << indent << "double ys[" << resolution << "];\n";
+                else if (name == "MeanOfMaximum")
+                    code << indent << "double ymax = -Infinity, maxima = 0.0;\n" << indent << "int count = 0;\n";
+                else
+                    code << indent << "double ymax = -Infinity, extreme = NaN;\n";
+
+                code << indent << "for (int i = 0; i < " << resolution << "; ++i) {\n";
+                code << indent << "    const double x = " << x << ";\n";
+                code << indent << "    double y = 0.0;\n";
+                // the membership of each term is computed once for all the conclusions activating it
+                std::vector<bool> done(activated.size(), false);
+                for (std::size_t i = 0; i < activated.size(); ++i) {
+                    if (done.at(i))
+                        continue;
+                    const Term* term = conclusions.at(activated.at(i)).term;
+                    std::vector<std::size_t> same;
+                    for (std::size_t j = i; j < activated.size(); ++j) {
+                        if (conclusions.at(activated.at(j)).term == term) {
+                            same.push_back(activated.at(j));
+                            done.at(j) = true;
+                        }
+                    }
+                    code << indent << "    if (";
+                    for (std::size_t j = 0; j < same.size(); ++j)
+                        code << (j ? " || " : "") << "activated[" << same.at(j) << "]";
+                    code << ") {\n";
+                    code << indent << "        const double mu = " << membership(term, "x") << ";\n";
+                    for (std::size_t j = 0; j < same.size(); ++j) {
+                        const std::size_t c = same.at(j);
+                        const TNorm* implication = conclusions.at(c).implication;
+                        if (not implication)
+                            throw Exception(
+                                "[exporter error] output variable <" + outputVariable->getName()
+                                    + "> requires an implication operator to be exported to C++ code",
+                                FL_AT
+                            );
+                        std::string statement = "y = " + aggregation + "(y, " + norm(implication) + "(mu, degree["
+                                                + Op::str(c) + "]));\n";
+                        if (same.size() == 1)
+                            code << indent << "        " << statement;
+                        else
+                            code << indent << "        if (activated[" << c << "])\n"
+                                 << indent << "            " << statement;
+                    }
+                    code << indent << "    }\n";
+                }
+                if (name == "Centroid") {
+                    code << indent << "    centroid += y * x;\n";
+                    code << indent << "    area += y;\n";
+                } else if (name == "Bisector") {
+                    code << indent << "    ys[i] = y;\n";
+                } else if (name == "MeanOfMaximum") {
+                    code << indent << "    if (y > ymax) {\n";
+                    code << indent << "        maxima = x;\n";
+                    code << indent << "        count = 1;\n";
+                    code << indent << "        ymax = y;\n";
+                    code << indent << "    } else if (y == ymax) {\n";
+                    code << indent << "        maxima += x;\n";
+                    code << indent << "        ++count;\n";
+                    code << indent << "    }\n";
+                } else {
+                    code << indent << "    if (y " << (name == "SmallestOfMaximum" ? ">" : ">=") << " ymax) {\n";
+                    code << indent << "        extreme = x;\n";
+                    code << indent << "        ymax = y;\n";
+                    code << indent << "    }\n";
+                }
+                code << indent << "}\n";
+
+                if (name == "Centroid") {
+                    code << indent << "value = centroid / area;\n";
+                } else if (name == "Bisector") {
+                    code << indent << "double sum = 0.0;\n";
+                    code << indent << "for (int i = 0; i < " << resolution << "; ++i) {\n";
+                    code << indent << "    if (isFinite(ys[i]))\n";
+                    code << indent << "        sum += ys[i];\n";
+                    code << indent << "    ys[i] = sum;\n";
+                    code << indent << "}\n";
+                    code << indent << "double smallest = Infinity;\n";
+                    code << indent << "for (int i = 0; i < " << resolution << "; ++i) {\n";
+                    code << indent << "    ys[i] = std::fabs(ys[i] / sum - 0.5);\n";
+                    code << indent << "    if (ys[i] < smallest)\n";
+                    code << indent << "        smallest = ys[i];\n";
+                    code << indent << "}\n";
+                    code << indent << "double bisectors = 0.0;\n";
+                    code << indent << "int count = 0;\n";
+                    code << indent << "for (int i = 0; i < " << resolution << "; ++i) {\n";
+                    code << indent << "    if (smallest == ys[i]) {\n";
+                    code << indent << "        bisectors += " << x << ";\n";
+                    code << indent << "        ++count;\n";
+                    code << indent << "    }\n";
+                    code << indent << "}\n";
+                    code << indent << "value = bisectors / count;\n";
+                } else if (name == "MeanOfMaximum") {
+                    code << indent << "value = maxima / count;\n";
+                } else {
+                    code << indent << "value = extreme;\n";
+                }
+            }
+
+            // the activated terms are grouped by name in alphabetical order, as in WeightedDefuzzifier
+            void weightedDefuzzify(std::size_t output, const std::vector<std::size_t>& activated, std::ostream& code) {
+                const OutputVariable* outputVariable = engine->getOutputVariable(output);
+                const WeightedDefuzzifier* defuzzifier
+                    = static_cast<const WeightedDefuzzifier*>(outputVariable->getDefuzzifier());
+                const std::string name = defuzzifier->className();
+                if (not(name == "WeightedAverage" or name == "WeightedSum"))
+                    throw Exception(
+                        "[exporter error] defuzzifier <" + name + "> cannot be exported to C++ code", FL_AT
+                    );
+                WeightedDefuzzifier::Type type = defuzzifier->getType();
+                std::map<std::string, std::vector<std::size_t> > groups;
+                for (std::size_t i = 0; i < activated.size(); ++i) {
+                    const Term* term = conclusions.at(activated.at(i)).term;
+                    groups[term->getName()].push_back(activated.at(i));
+                    if (defuzzifier->getType() == WeightedDefuzzifier::Automatic) {
+                        const WeightedDefuzzifier::Type inferred = defuzzifier->inferType(term);
+                        if (i > 0 and inferred != type)
+                            throw Exception("cannot infer type of '" + name + "', got multiple types", FL_AT);
+                        type = inferred;
+                    }
+                }
+                if (not(type == WeightedDefuzzifier::TakagiSugeno or type == WeightedDefuzzifier::Tsukamoto))
+                    throw Exception("unexpected type: " + WeightedDefuzzifier::typeName(type), FL_AT);
+                const Norm* aggregation = outputVariable->getAggregation();
+
+                const std::string indent = "            ";
+                code << indent << "double sum = 0.0, weights = 0.0;\n";
+                for (std::map<std::string, std::vector<std::size_t> >::const_iterator it = groups.begin();
+                     it != groups.end();
+                     ++it) {
+                    const std::vector<std::size_t>& group = it->second;
+                    const Term* term = conclusions.at(group.front()).term;
+                    const std::string z
+                        = type == WeightedDefuzzifier::TakagiSugeno ? membership(term, "w") : tsukamoto(term, "w");
+                    std::string inner = indent;
+                    if (group.size() == 1) {
+                        code << indent << "if (activated[" << group.front() << "]) {\n";
+                        code << indent << "    const double w = degree[" << group.front() << "];\n";
+                    } else {
+                        code << indent << "{\n";
+                        code << indent << "    bool grouped = false;\n";
+                        code << indent << "    double w = 0.0;\n";
+                        for (std::size_t i = 0; i < group.size(); ++i) {
+                            const std::string degree = "degree[" + Op::str(group.at(i)) + "]";
+                            code << indent << "    if (activated[" << group.at(i) << "]) {\n";
+                            code << indent << "        w = grouped ? ";
+                            if (aggregation)
+                                code << norm(aggregation) << "(w, " << degree << ")";
+                            else
+                                code << "w + " << degree;
+                            code << " : " << degree << ";\n";
+                            code << indent << "        grouped = true;\n";
+                            code << indent << "    }\n";
+                        }
+                        code << indent << "    if (grouped) {\n";
+                        inner += "    ";
+                    }
+                    code << inner << "    const double z = " << z << ";\n";
+                    code << inner << "    sum += w * z;\n";
+                    code << inner << "    weights += w;\n";
+                    if (group.size() > 1)
+                        code << inner << "}\n";
+                    code << indent << "}\n";
+                }
+                code << indent << "value = " << (name == "WeightedSum" ? "sum" : "sum / weights") << ";\n";
+            }
+
+            // the output variable is defuzzified, as in OutputVariable::defuzzify()
+            void defuzzify(std::size_t output, std::ostream& code) {
+                const OutputVariable* outputVariable = engine->getOutputVariable(output);
+                const std::string value = "out[" + Op::str(output) + "]";
+                code << "    // output variable <" << outputVariable->getName() << ">\n";
+                if (not outputVariable->isEnabled())
+                    return;
+
+                std::vector<std::size_t> activated;
+                for (std::size_t c = 0; c < conclusions.size(); ++c)
+                    if (conclusions.at(c).output == output)
+                        activated.push_back(c);
+
+                std::string fallback = literal(outputVariable->getDefaultValue());
+                if (outputVariable->isLockPreviousValue())
+                    fallback = "isFinite(" + value + ") ? " + value + " : " + fallback;
+
+                code << "    {\n";
+                code << "        double value;\n";
+                if (activated.empty()) {
+                    code << "        value = " << fallback << ";\n";
+                } else {
+                    const Defuzzifier* defuzzifier = outputVariable->getDefuzzifier();
+                    if (not defuzzifier)
+                        throw Exception(
+                            "[defuzzifier error] defuzzifier needed to defuzzify output variable <"
+                                + outputVariable->getName() + ">",
+                            FL_AT
+                        );
+                    code << "        if (";
+                    for (std::size_t i = 0; i < activated.size(); ++i)
+                        code << (i ? " || " : "") << "activated[" << activated.at(i) << "]";
+                    code << ") {\n";
+                    if (dynamic_cast<const IntegralDefuzzifier*>(defuzzifier))
+                        integralDefuzzify(output, activated, code);
+                    else if (dynamic_cast<const WeightedDefuzzifier*>(defuzzifier))
+                        weightedDefuzzify(output, activated, code);
+                    else
+                        throw Exception(
+                            "[exporter error] defuzzifier <" + defuzzifier->className()
+                                + "> cannot be exported to C++ code",
+                            FL_AT
+                        );
+                    code << "        } else {\n";
+                    code << "            value = " << fallback << ";\n";
+                    code << "        }\n";
+                }
+                code << "        " << value << " = ";
+                if (outputVariable->isLockValueInRange())
+                    code << "bound(value, " << literal(outputVariable->getMinimum()) << ", "
+                         << literal(outputVariable->getMaximum()) << ");\n";
+                else
+                    code << "value;\n";
+                code << "    }\n";
+            }
+        };
+    }
+
+    std::string CompiledCppExporter::toString(const Engine* engine) const {
+        Generator generator(engine);
+        generator.collectConclusions();
+
+        std::ostringstream body;
+        for (std::size_t b = 0; b < engine->numberOfRuleBlocks(); ++b)
+            if (engine->getRuleBlock(b)->isEnabled())
+                generator.activate(engine->getRuleBlock(b), body);
+        for (std::size_t o = 0; o < engine->numberOfOutputVariables(); ++o)
+            generator.defuzzify(o, body);
+
+        std::ostringstream cpp;
+        cpp << "//Code automatically generated with " << fuzzylite::library() << ".\n";
+        cpp << "//Evaluates the engine <" << engine->getName() << "> without the fuzzylite library, where\n";
+        for (std::size_t i = 0; i < engine->numberOfInputVariables(); ++i)
+            cpp << "//  in[" << i << "] is the value of the input variable <" << engine->getInputVariable(i)->getName()
+                << ">\n";
+        for (std::size_t o = 0; o < engine->numberOfOutputVariables(); ++o)
+            cpp << "//  out[" << o << "] is the value of the output variable <"
+                << engine->getOutputVariable(o)->getName() << ">\n";
+        cpp << "//and, upon entry, out contains the values of the output variables from the previous evaluation.\n\n";
+
+        cpp << "#include <cmath>\n";
+        cpp << "#include <limits>\n\n";
+
+        cpp << "namespace {\n";
+        cpp << "    const double NaN = std::numeric_limits<double>::quiet_NaN();\n";
+        cpp << "    const double Infinity = std::numeric_limits<double>::infinity();\n";
+        cpp << "    const double macheps = " << literal(fuzzylite::macheps()) << ";\n\n";
+        cpp << "    inline bool isNaN(double x) {\n"
+               "        return x != x;\n"
+               "    }\n\n"
+               "    inline bool isFinite(double x) {\n"
+               "        return !(x != x || x == Infinity || x == -Infinity);\n"
+               "    }\n\n"
+               "    inline bool isEq(double a, double b) {\n"
+               "        return a == b || std::fabs(a - b) < macheps || (a != a && b != b);\n"
+               "    }\n\n"
+               "    inline bool isLt(double a, double b) {\n"
+               "        return !isEq(a, b) && a < b;\n"
+               "    }\n\n"
+               "    inline bool isLE(double a, double b) {\n"
+               "        return isEq(a, b) || a < b;\n"
+               "    }\n\n"
+               "    inline bool isGt(double a, double b) {\n"
+               "        return !isEq(a, b) && a > b;\n"
+               "    }\n\n"
+               "    inline bool isGE(double a, double b) {\n"
+               "        return isEq(a, b) || a > b;\n"
+               "    }\n\n"
+               "    inline double minimum(double a, double b) {\n"
+               "        return (isNaN(a) || isNaN(b)) ? NaN : (b < a ? b : a);\n"
+               "    }\n\n"
+               "    inline double maximum(double a, double b) {\n"
+               "        return (isNaN(a) || isNaN(b)) ? NaN : (a < b ? b : a);\n"
+               "    }\n\n"
+               "    inline double bound(double x, double minimum, double maximum) {\n"
+               "        return x > maximum ? maximum : (x < minimum ? minimum : x);\n"
+               "    }\n";
+        for (std::size_t i = 0; i < sizeof(helpers) / sizeof(helpers[0]); ++i)
+            if (generator.used.count(helpers[i][0]))
+                cpp << "\n" << helpers[i][1];
+        if (not generator.declarations.str().empty())
+            cpp << "\n" << generator.declarations.str();
+        cpp << "}\n\n";
+
+        cpp << "void " << getFunctionName() << "(const double* in, double* out) {\n";
+        for (std::set<std::size_t>::const_iterator it = generator.inputs.begin(); it != generator.inputs.end(); ++it) {
+            const InputVariable* inputVariable = engine->getInputVariable(*it);
+            const std::string value = "in[" + Op::str(*it) + "]";
+            cpp << "    const double " << identifier("input", *it) << " = ";
+            if (inputVariable->isLockValueInRange())
+                cpp << "bound(" << value << ", " << literal(inputVariable->getMinimum()) << ", "
+                    << literal(inputVariable->getMaximum()) << ")";
+            else
+                cpp << value;
+            cpp << "; // " << inputVariable->getName() << "\n";
+        }
+        cpp << generator.membershipCode.str();
+        if (not generator.conclusions.empty()) {
+            cpp << "    bool activated[" << generator.conclusions.size() << "] = {false};\n";
+            cpp << "    double degree[" << generator.conclusions.size() << "] = {0.0};\n";
+        }
+        cpp << "\n" << body.str() << "}\n";
+        return cpp.str();
+    }
+
+}
@@ -233,8 +233,28 @@ namespace fuzzylite {
         if (not defuzzifier)
             return "fl::null";
         if (const IntegralDefuzzifier* integralDefuzzifier = dynamic_cast<const IntegralDefuzzifier*>(defuzzifier)) {
-            return "new " + fl(integralDefuzzifier->className()) + "(" + Op::str(integralDefuzzifier->getResolution())
-                   + ")";
+            const std::string resolution = Op::str(integralDefuzzifier->getResolution());
+            if (const Centroid* centroid = dynamic_cast<const Centroid*>(defuzzifier)) {
+                const std::string tolerance = Op::str(centroid->getTolerance(), -1, std::ios_base::fmtflags(0x0));
+                const std::string exact = centroid->isExact() ? "true" : "false";
+                if (integralDefuzzifier->isRestrictedToSupport())
+                    return "new " + fl(centroid->className()) + "(" + resolution + ", " + exact + ", " + tolerance
+                           + ", true)";
+                if (centroid->getTolerance() > 0.0)
+                    return "new " + fl(centroid->className()) + "(" + resolution + ", " + exact + ", " + tolerance
+                           + ")";
+                if (centroid->isExact())
+                    return "new " + fl(centroid->className()) + "(" + resolution + ", true)";
+            } else if (const Bisector* bisector = dynamic_cast<const Bisector*>(defuzzifier)) {
+                const std::string tolerance = Op::str(bisector->getTolerance(), -1, std::ios_base::fmtflags(0x0));
+                if (integralDefuzzifier->isRestrictedToSupport())
+                    return "new " + fl(bisector->className()) + "(" + resolution + ", " + tolerance + ", true)";
+                if (bisector->getTolerance() > 0.0)
+                    return "new " + fl(bisector->className()) + "(" + resolution + ", " + tolerance + ")";
+            } else if (integralDefuzzifier->isRestrictedToSupport()) {
+                return "new " + fl(integralDefuzzifier->className()) + "(" + resolution + ", true)";
+            }
+            return "new " + fl(integralDefuzzifier->className()) + "(" + resolution + ")";
         }
         if (const WeightedDefuzzifier* weightedDefuzzifier = dynamic_cast<const WeightedDefuzzifier*>(defuzzifier))
             return "new " + weightedDefuzzifier->className() + "(\"" + weightedDefuzzifier->getTypeName() + "\")";
@@ -188,9 +188,22 @@ namespace fuzzylite {
         if (not defuzzifier)
             return "none";
         if (const IntegralDefuzzifier* integralDefuzzifier = dynamic_cast<const IntegralDefuzzifier*>(defuzzifier)) {
+            std::string name = defuzzifier->className();
+            scalar tolerance = 0.0;
+            if (const Centroid* centroid = dynamic_cast<const Centroid*>(defuzzifier)) {
+                if (centroid->isExact())
+                    name += " exact";
+                tolerance = centroid->getTolerance();
+            } else if (const Bisector* bisector = dynamic_cast<const Bisector*>(defuzzifier)) {
+                tolerance = bisector->getTolerance();
+            }
+            if (integralDefuzzifier->isRestrictedToSupport())
+                name += " support";
+            if (tolerance > 0.0)
+                name += " adaptive " + Op::str(tolerance, -1, std::ios_base::fmtflags(0x0));
             if (integralDefuzzifier->getResolution() == IntegralDefuzzifier::defaultResolution())
-                return defuzzifier->className();
-            return defuzzifier->className() + " " + Op::str(integralDefuzzifier->getResolution());
+                return name;
+            return name + " " + Op::str(integralDefuzzifier->getResolution());
         }
         if (const WeightedDefuzzifier* weightedDefuzzifier = dynamic_cast<const WeightedDefuzzifier*>(defuzzifier)) {
             if (weightedDefuzzifier->getType() == WeightedDefuzzifier::Automatic)
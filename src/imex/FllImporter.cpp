@@ -76,6 +76,18 @@ namespace fuzzylite {
         return engine.release();
     }
 
+    template <typename T>
+    BasicCompiledEngine<T>* FllImporter::compileFromString(const std::string& fll) const {
+        const FL_unique_ptr<Engine> engine(fromString(fll));
+        return new BasicCompiledEngine<T>(engine.get());
+    }
+
+    template <typename T>
+    BasicCompiledEngine<T>* FllImporter::compileFromFile(const std::string& path) const {
+        const FL_unique_ptr<Engine> engine(fromFile(path));
+        return new BasicCompiledEngine<T>(engine.get());
+    }
+
     void FllImporter::process(const std::string& tag, const std::string& block, Engine* engine) const {
         if (tag.empty())
             return;
@@ -299,7 +311,26 @@ namespace fuzzylite {
         if (parameters.size() > 1) {
             std::string parameter(parameters.at(1));
             if (IntegralDefuzzifier* integralDefuzzifier = dynamic_cast<IntegralDefuzzifier*>(defuzzifier)) {
-                integralDefuzzifier->setResolution((int)Op::toScalar(parameter));
+                // [exact] [support] [adaptive tolerance] [resolution]
+                Centroid* centroid = dynamic_cast<Centroid*>(defuzzifier);
+                Bisector* bisector = dynamic_cast<Bisector*>(defuzzifier);
+                for (std::size_t i = 1; i < parameters.size(); ++i) {
+                    if (centroid and parameters.at(i) == "exact") {
+                        centroid->setExact(true);
+                    } else if (parameters.at(i) == "support") {
+                        integralDefuzzifier->setRestrictedToSupport(true);
+                    } else if ((centroid or bisector) and parameters.at(i) == "adaptive") {
+                        if (i + 1 == parameters.size())
+                            throw Exception("[syntax error] expected tolerance after <adaptive>", FL_AT);
+                        const scalar tolerance = Op::toScalar(parameters.at(++i));
+                        if (centroid)
+                            centroid->setTolerance(tolerance);
+                        else
+                            bisector->setTolerance(tolerance);
+                    } else {
+                        integralDefuzzifier->setResolution((int)Op::toScalar(parameters.at(i)));
+                    }
+                }
             } else if (WeightedDefuzzifier* weightedDefuzzifier = dynamic_cast<WeightedDefuzzifier*>(defuzzifier)) {
                 WeightedDefuzzifier::Type type = WeightedDefuzzifier::Automatic;
                 if (parameter == "Automatic")
@@ -355,4 +386,9 @@ namespace fuzzylite {
         return new FllImporter(*this);
     }
 
+    template BasicCompiledEngine<float>* FllImporter::compileFromString<float>(const std::string&) const;
+    template BasicCompiledEngine<double>* FllImporter::compileFromString<double>(const std::string&) const;
+    template BasicCompiledEngine<float>* FllImporter::compileFromFile<float>(const std::string&) const;
+    template BasicCompiledEngine<double>* FllImporter::compileFromFile<double>(const std::string&) const;
+
 }
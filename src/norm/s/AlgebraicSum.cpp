@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/AlgebraicSum.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     std::string AlgebraicSum::className() const {
@@ -24,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar AlgebraicSum::compute(scalar a, scalar b) const {
-        return a + b - (a * b);
+        return kernel::algebraicSum(a, b);
     }
 
     AlgebraicSum* AlgebraicSum::clone() const {
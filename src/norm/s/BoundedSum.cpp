@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/BoundedSum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar BoundedSum::compute(scalar a, scalar b) const {
-        return Op::min(scalar(1.0), a + b);
+        return kernel::boundedSum(a, b);
     }
 
     BoundedSum* BoundedSum::clone() const {
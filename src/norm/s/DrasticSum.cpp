@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/DrasticSum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,9 +26,7 @@ namespace fuzzylite {
     }
 
     scalar DrasticSum::compute(scalar a, scalar b) const {
-        if (Op::isEq(Op::min(a, b), 0.0))
-            return Op::max(a, b);
-        return 1.0;
+        return kernel::drasticSum(a, b);
     }
 
     DrasticSum* DrasticSum::clone() const {
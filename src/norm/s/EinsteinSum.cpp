@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/EinsteinSum.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     std::string EinsteinSum::className() const {
@@ -24,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar EinsteinSum::compute(scalar a, scalar b) const {
-        return (a + b) / (1.0 + a * b);
+        return kernel::einsteinSum(a, b);
     }
 
     EinsteinSum* EinsteinSum::clone() const {
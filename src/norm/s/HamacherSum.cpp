@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/HamacherSum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,9 +26,7 @@ namespace fuzzylite {
     }
 
     scalar HamacherSum::compute(scalar a, scalar b) const {
-        if (Op::isEq(a * b, 1.0))
-            return 1.0;
-        return (a + b - 2.0 * a * b) / (1.0 - a * b);
+        return kernel::hamacherSum(a, b);
     }
 
     HamacherSum* HamacherSum::clone() const {
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/Maximum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar Maximum::compute(scalar a, scalar b) const {
-        return Op::max(a, b);
+        return kernel::maximum(a, b);
     }
 
     Maximum* Maximum::clone() const {
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/NilpotentMaximum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,9 +26,7 @@ namespace fuzzylite {
     }
 
     scalar NilpotentMaximum::compute(scalar a, scalar b) const {
-        if (Op::isLt(a + b, 1.0))
-            return Op::max(a, b);
-        return 1.0;
+        return kernel::nilpotentMaximum(a, b);
     }
 
     NilpotentMaximum* NilpotentMaximum::clone() const {
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/NormalizedSum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar NormalizedSum::compute(scalar a, scalar b) const {
-        return (a + b) / Op::max(scalar(1.0), a + b);
+        return kernel::normalizedSum(a, b);
     }
 
     NormalizedSum* NormalizedSum::clone() const {
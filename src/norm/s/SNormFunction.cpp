@@ -22,6 +22,10 @@ namespace fuzzylite {
     SNormFunction::SNormFunction(const std::string& formula) : SNorm() {
         _function.variables["a"] = fl::nan;
         _function.variables["b"] = fl::nan;
+        std::vector<std::string> arguments;
+        arguments.push_back("a");
+        arguments.push_back("b");
+        _function.setArguments(arguments);
         if (not formula.empty())
             _function.load(formula);
     }
@@ -31,9 +35,8 @@ namespace fuzzylite {
     }
 
     scalar SNormFunction::compute(scalar a, scalar b) const {
-        _function.variables["a"] = a;
-        _function.variables["b"] = b;
-        return _function.evaluate();
+        const scalar arguments[] = {a, b};
+        return _function.evaluate(fl::nan, arguments);
     }
 
     Function& SNormFunction::function() {
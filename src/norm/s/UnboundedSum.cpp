@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/s/UnboundedSum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar UnboundedSum::compute(scalar a, scalar b) const {
-        return a + b;
+        return kernel::unboundedSum(a, b);
     }
 
     UnboundedSum* UnboundedSum::clone() const {
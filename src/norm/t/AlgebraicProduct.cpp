@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/t/AlgebraicProduct.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     std::string AlgebraicProduct::className() const {
@@ -24,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar AlgebraicProduct::compute(scalar a, scalar b) const {
-        return a * b;
+        return kernel::algebraicProduct(a, b);
     }
 
     AlgebraicProduct* AlgebraicProduct::clone() const {
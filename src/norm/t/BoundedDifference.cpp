@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/t/BoundedDifference.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar BoundedDifference::compute(scalar a, scalar b) const {
-        return Op::max(scalar(0.0), a + b - scalar(1.0));
+        return kernel::boundedDifference(a, b);
     }
 
     BoundedDifference* BoundedDifference::clone() const {
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/t/DrasticProduct.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,9 +26,7 @@ namespace fuzzylite {
     }
 
     scalar DrasticProduct::compute(scalar a, scalar b) const {
-        if (Op::isEq(Op::max(a, b), 1.0))
-            return Op::min(a, b);
-        return 0.0;
+        return kernel::drasticProduct(a, b);
     }
 
     DrasticProduct* DrasticProduct::clone() const {
@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/t/EinsteinProduct.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     std::string EinsteinProduct::className() const {
@@ -24,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar EinsteinProduct::compute(scalar a, scalar b) const {
-        return (a * b) / (2.0 - (a + b - a * b));
+        return kernel::einsteinProduct(a, b);
     }
 
     EinsteinProduct* EinsteinProduct::clone() const {
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/t/HamacherProduct.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,9 +26,7 @@ namespace fuzzylite {
     }
 
     scalar HamacherProduct::compute(scalar a, scalar b) const {
-        if (Op::isEq(a + b, 0.0))
-            return 0.0;
-        return (a * b) / (a + b - a * b);
+        return kernel::hamacherProduct(a, b);
     }
 
     HamacherProduct* HamacherProduct::clone() const {
@@ -17,7 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/norm/t/Minimum.h"
 
-#include "fuzzylite/Operation.h"
+#include "fuzzylite/Kernels.h"
 
 namespace fuzzylite {
 
@@ -26,7 +26,7 @@ namespace fuzzylite {
     }
 
     scalar Minimum::compute(scalar a, scalar b) const {
-        return Op::min(a, b);
+        return kernel::minimum(a, b);
     }
 
     Minimum* Minimum::clone() const {
@@ -22,6 +22,10 @@ namespace fuzzylite {
     TNormFunction::TNormFunction(const std::string& formula) : TNorm() {
         _function.variables["a"] = fl::nan;
         _function.variables["b"] = fl::nan;
+        std::vector<std::string> arguments;
+        arguments.push_back("a");
+        arguments.push_back("b");
+        _function.setArguments(arguments);
         if (not formula.empty())
             _function.load(formula);
     }
@@ -31,9 +35,8 @@ namespace fuzzylite {
     }
 
     scalar TNormFunction::compute(scalar a, scalar b) const {
-        _function.variables["a"] = a;
-        _function.variables["b"] = b;
-        return _function.evaluate();
+        const scalar arguments[] = {a, b};
+        return _function.evaluate(fl::nan, arguments);
     }
 
     Function& TNormFunction::function() {
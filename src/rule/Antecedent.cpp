@@ -17,21 +17,123 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/rule/Antecedent.h"
 
+#include <algorithm>
 #include <stack>
 
 #include "fuzzylite/Engine.h"
 #include "fuzzylite/factory/FactoryManager.h"
+#include "fuzzylite/factory/FunctionFactory.h"
 #include "fuzzylite/factory/HedgeFactory.h"
 #include "fuzzylite/hedge/Any.h"
 #include "fuzzylite/rule/Expression.h"
 #include "fuzzylite/rule/Rule.h"
+#include "fuzzylite/rule/Tokenizer.h"
 #include "fuzzylite/term/Aggregated.h"
+#include "fuzzylite/term/Function.h"
 #include "fuzzylite/variable/InputVariable.h"
 #include "fuzzylite/variable/OutputVariable.h"
 
 namespace fuzzylite {
 
-    Antecedent::Antecedent() : _text(""), _expression(fl::null) {}
+    namespace {
+        /** position and size of a token within the text of the antecedent */
+        struct Token {
+            std::size_t begin, size;
+            int precedence;  // of the logical operators, or -1 otherwise
+
+            Token(std::size_t begin, std::size_t size, int precedence) :
+                begin(begin),
+                size(size),
+                precedence(precedence) {}
+        };
+
+        int precedence(const std::string& keyword, int otherwise) {
+            const Function::Element* element = FactoryManager::instance()->function()->getObject(keyword);
+            return element ? element->precedence : otherwise;
+        }
+
+        /**
+          Appends the expression in infix notation with the parentheses
+          required to parse it back into the same expression tree
+         */
+        void appendText(const Expression* node, std::string& text) {
+            if (not node) {
+                text += "?";
+                return;
+            }
+            if (node->type() == Expression::Proposition) {
+                text += Op::trim(node->toString());
+                return;
+            }
+            const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+            const Expression* operands[] = {fuzzyOperator->left, fuzzyOperator->right};
+            for (std::size_t i = 0; i < 2; ++i) {
+                const Expression* operand = operands[i];
+                // operators are left-associative, so right operands and other operators are grouped
+                const bool parentheses
+                    = operand and operand->type() == Expression::Operator
+                      and (i == 1 or static_cast<const Operator*>(operand)->name != fuzzyOperator->name);
+                if (i == 1)
+                    text += " " + fuzzyOperator->name + " ";
+                if (parentheses)
+                    text += "(";
+                appendText(operand, text);
+                if (parentheses)
+                    text += ")";
+            }
+        }
+
+        /**
+          Converts the antecedent into postfix notation using the shunting-yard
+          algorithm, as Function::toPostfix() but only for the logical operators
+          and the parentheses, and without copying the tokens
+         */
+        std::vector<Token> tokenizePostfix(const std::string& antecedent) {
+            const int andPrecedence = precedence(Rule::andKeyword(), 1);
+            const int orPrecedence = precedence(Rule::orKeyword(), 0);
+            std::vector<Token> postfix, stack;
+            Tokenizer tokenizer(antecedent, 0, std::string::npos, true);
+            std::size_t begin, size;
+            while (tokenizer.next(begin, size)) {
+                if (size == 1 and antecedent[begin] == '(') {
+                    stack.push_back(Token(begin, size, -1));
+                } else if (size == 1 and antecedent[begin] == ')') {
+                    while (not stack.empty() and stack.back().precedence >= 0) {
+                        postfix.push_back(stack.back());
+                        stack.pop_back();
+                    }
+                    if (stack.empty())
+                        throw Exception("[parsing error] mismatching parentheses in: " + antecedent, FL_AT);
+                    stack.pop_back();
+                } else {
+                    int tokenPrecedence = -1;
+                    if (antecedent.compare(begin, size, Rule::andKeyword()) == 0)
+                        tokenPrecedence = andPrecedence;
+                    else if (antecedent.compare(begin, size, Rule::orKeyword()) == 0)
+                        tokenPrecedence = orPrecedence;
+                    if (tokenPrecedence < 0) {
+                        postfix.push_back(Token(begin, size, -1));
+                        continue;
+                    }
+                    // the logical operators are left-associative
+                    while (not stack.empty() and stack.back().precedence >= tokenPrecedence) {
+                        postfix.push_back(stack.back());
+                        stack.pop_back();
+                    }
+                    stack.push_back(Token(begin, size, tokenPrecedence));
+                }
+            }
+            while (not stack.empty()) {
+                if (stack.back().precedence < 0)
+                    throw Exception("[parsing error] mismatching parentheses in: " + antecedent, FL_AT);
+                postfix.push_back(stack.back());
+                stack.pop_back();
+            }
+            return postfix;
+        }
+    }
+
+    Antecedent::Antecedent() : _text(""), _expression(fl::null), _depth(0), _revision(0) {}
 
     Antecedent::~Antecedent() {
         _expression.reset(fl::null);
@@ -42,6 +144,11 @@ namespace fuzzylite {
     }
 
     std::string Antecedent::getText() const {
+        if (this->_text.empty() and this->_expression.get()) {
+            std::string text;
+            appendText(this->_expression.get(), text);
+            return text;
+        }
         return this->_text;
     }
 
@@ -51,6 +158,85 @@ namespace fuzzylite {
 
     void Antecedent::setExpression(Expression* expression) {
         this->_expression.reset(expression);
+        ++_revision;
+        _code.clear();
+        _hedges.clear();
+        _depth = 0;
+        // expressions that cannot be compiled are evaluated on the tree, which reports the errors
+        if (expression and not compile(expression)) {
+            _code.clear();
+            _hedges.clear();
+        }
+        // the maximum depth of the stack on which the instructions are evaluated
+        std::size_t depth = 0;
+        for (std::size_t i = 0; i < _code.size(); ++i) {
+            if (_code[i].opcode == OpAnd or _code[i].opcode == OpOr)
+                --depth;
+            else
+                _depth = std::max(_depth, ++depth);
+        }
+    }
+
+    std::size_t Antecedent::revision() const {
+        return this->_revision;
+    }
+
+    bool Antecedent::compile(const Expression* node) {
+        const Expression::Type expression = node->type();
+        if (expression == Expression::Proposition) {
+            const Proposition* proposition = static_cast<const Proposition*>(node);
+            if (not proposition->variable)
+                return false;
+            Instruction instruction;
+            instruction.variable = proposition->variable;
+            instruction.term = proposition->term;
+            // the position of the term finds its cached membership without searching the terms
+            instruction.termIndex = 0;
+            const std::vector<Term*>& terms = proposition->variable->terms();
+            while (instruction.termIndex < terms.size() and terms[instruction.termIndex] != proposition->term)
+                ++instruction.termIndex;
+            switch (proposition->variable->type()) {
+                case Variable::Input:
+                    instruction.opcode = OpInput;
+                    break;
+                case Variable::Output:
+                    instruction.opcode = OpOutput;
+                    break;
+                default:
+                    instruction.opcode = OpNone;
+            }
+            // if last hedge is "Any", the hedges are applied in reverse order starting from nan
+            if (not proposition->hedges.empty() and dynamic_cast<const Any*>(proposition->hedges.back()))
+                instruction.opcode = OpAny;
+            else if (not proposition->term and (instruction.opcode == OpInput or instruction.opcode == OpOutput))
+                return false;
+            instruction.hedgeBegin = _hedges.size();
+            _hedges.insert(_hedges.end(), proposition->hedges.rbegin(), proposition->hedges.rend());
+            instruction.hedgeEnd = _hedges.size();
+            _code.push_back(instruction);
+            return true;
+        }
+        if (expression == Expression::Operator) {
+            const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+            if (not(fuzzyOperator->left and fuzzyOperator->right))
+                return false;
+            Instruction instruction;
+            if (fuzzyOperator->name == Rule::andKeyword())
+                instruction.opcode = OpAnd;
+            else if (fuzzyOperator->name == Rule::orKeyword())
+                instruction.opcode = OpOr;
+            else
+                return false;
+            instruction.variable = fl::null;
+            instruction.term = fl::null;
+            instruction.termIndex = 0;
+            instruction.hedgeBegin = instruction.hedgeEnd = _hedges.size();
+            if (not(compile(fuzzyOperator->left) and compile(fuzzyOperator->right)))
+                return false;
+            _code.push_back(instruction);
+            return true;
+        }
+        return false;
     }
 
     bool Antecedent::isLoaded() const {
@@ -58,7 +244,65 @@ namespace fuzzylite {
     }
 
     scalar Antecedent::activationDegree(const TNorm* conjunction, const SNorm* disjunction) const {
-        return this->activationDegree(conjunction, disjunction, _expression.get());
+        if (_code.empty())
+            return this->activationDegree(conjunction, disjunction, _expression.get());
+
+        // the stack is local to keep the computation reentrant, and only deep antecedents allocate it
+        scalar local[16];
+        std::vector<scalar> allocated;
+        scalar* stack = local;
+        if (_depth > sizeof(local) / sizeof(local[0])) {
+            allocated.resize(_depth);
+            stack = &allocated[0];
+        }
+        std::size_t top = 0;
+        for (std::size_t i = 0; i < _code.size(); ++i) {
+            const Instruction& instruction = _code[i];
+            switch (instruction.opcode) {
+                case OpAnd: {
+                    if (not conjunction)
+                        throw Exception(
+                            "[conjunction error] "
+                            "the following rule requires a conjunction operator:\n"
+                                + _text,
+                            FL_AT
+                        );
+                    --top;
+                    stack[top - 1] = conjunction->compute(stack[top - 1], stack[top]);
+                    break;
+                }
+                case OpOr: {
+                    if (not disjunction)
+                        throw Exception(
+                            "[disjunction error] "
+                            "the following rule requires a disjunction operator:\n"
+                                + _text,
+                            FL_AT
+                        );
+                    --top;
+                    stack[top - 1] = disjunction->compute(stack[top - 1], stack[top]);
+                    break;
+                }
+                default: {
+                    if (not instruction.variable->isEnabled()) {
+                        stack[top++] = 0.0;
+                        break;
+                    }
+                    scalar result = fl::nan;
+                    if (instruction.opcode == OpInput)
+                        result = static_cast<InputVariable*>(instruction.variable)
+                                     ->membership(instruction.term, instruction.termIndex);
+                    else if (instruction.opcode == OpOutput)
+                        result = static_cast<OutputVariable*>(instruction.variable)
+                                     ->fuzzyOutput()
+                                     ->activationDegree(instruction.term);
+                    for (std::size_t h = instruction.hedgeBegin; h < instruction.hedgeEnd; ++h)
+                        result = _hedges[h]->hedge(result);
+                    stack[top++] = result;
+                }
+            }
+        }
+        return stack[top - 1];
     }
 
     scalar
@@ -84,7 +328,7 @@ namespace fuzzylite {
             scalar result = fl::nan;
             Variable::Type variableType = proposition->variable->type();
             if (variableType == Variable::Input) {
-                result = proposition->term->membership(proposition->variable->getValue());
+                result = static_cast<InputVariable*>(proposition->variable)->membership(proposition->term);
             } else if (variableType == Variable::Output) {
                 result = static_cast<OutputVariable*>(proposition->variable)
                              ->fuzzyOutput()
@@ -150,7 +394,7 @@ namespace fuzzylite {
     }
 
     void Antecedent::unload() {
-        _expression.reset(fl::null);
+        setExpression(fl::null);
     }
 
     void Antecedent::load(const Engine* engine) {
@@ -172,11 +416,7 @@ namespace fuzzylite {
          4) After a term comes a variable or an operator
          */
 
-        Function function;
-
-        std::string postfix = function.toPostfix(antecedent);
-        FL_DBG("Postfix: " << postfix);
-        std::stringstream tokenizer(postfix);
+        std::vector<Token> postfix = tokenizePostfix(antecedent);
         std::string token;
 
         enum FSM { S_VARIABLE = 1, S_IS = 2, S_HEDGE = 4, S_TERM = 8, S_AND_OR = 16 };
@@ -184,9 +424,12 @@ namespace fuzzylite {
         int state = S_VARIABLE;
         std::stack<Expression*> expressionStack;
         Proposition* proposition = fl::null;
+        HedgeFactory* hedgeFactory = FactoryManager::instance()->hedge();
         try {
-            while (tokenizer >> token) {
-                if (state bitand S_VARIABLE) {
+            for (std::size_t t = 0; t < postfix.size(); ++t) {
+                token.assign(antecedent, postfix.at(t).begin, postfix.at(t).size);
+                // the logical operators are not looked up as variables
+                if ((state bitand S_VARIABLE) and postfix.at(t).precedence < 0) {
                     Variable* variable = fl::null;
                     if (engine->hasInputVariable(token))
                         variable = engine->getInputVariable(token);
@@ -212,9 +455,9 @@ namespace fuzzylite {
                 }
 
                 if (state bitand S_HEDGE) {
-                    HedgeFactory* factory = FactoryManager::instance()->hedge();
-                    if (factory->hasConstructor(token)) {
-                        Hedge* hedge = factory->constructObject(token);
+                    HedgeFactory::Constructor constructor = hedgeFactory->getConstructor(token);
+                    if (constructor) {
+                        Hedge* hedge = constructor();
                         proposition->hedges.push_back(hedge);
                         if (dynamic_cast<Any*>(hedge))
                             state = S_VARIABLE bitor S_AND_OR;
@@ -23,6 +23,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include "fuzzylite/hedge/Any.h"
 #include "fuzzylite/rule/Expression.h"
 #include "fuzzylite/rule/Rule.h"
+#include "fuzzylite/rule/Tokenizer.h"
 #include "fuzzylite/term/Aggregated.h"
 #include "fuzzylite/variable/OutputVariable.h"
 
@@ -37,6 +38,8 @@ namespace fuzzylite {
     }
 
     std::string Consequent::getText() const {
+        if (this->_text.empty() and not this->_conclusions.empty())
+            return toString();
         return this->_text;
     }
 
@@ -110,10 +113,11 @@ namespace fuzzylite {
 
         Proposition* proposition = fl::null;
 
-        std::stringstream tokenizer(consequent);
+        Tokenizer tokenizer(consequent);
         std::string token;
+        HedgeFactory* hedgeFactory = FactoryManager::instance()->hedge();
         try {
-            while (tokenizer >> token) {
+            while (tokenizer.next(token)) {
                 if (state bitand S_VARIABLE) {
                     if (engine->hasOutputVariable(token)) {
                         proposition = new Proposition;
@@ -132,9 +136,9 @@ namespace fuzzylite {
                 }
 
                 if (state bitand S_HEDGE) {
-                    HedgeFactory* factory = FactoryManager::instance()->hedge();
-                    if (factory->hasConstructor(token)) {
-                        Hedge* hedge = factory->constructObject(token);
+                    HedgeFactory::Constructor constructor = hedgeFactory->getConstructor(token);
+                    if (constructor) {
+                        Hedge* hedge = constructor();
                         proposition->hedges.push_back(hedge);
                         state = S_HEDGE bitor S_TERM;
                         continue;
@@ -21,6 +21,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include "fuzzylite/Operation.h"
 #include "fuzzylite/imex/FllExporter.h"
 #include "fuzzylite/norm/Norm.h"
+#include "fuzzylite/rule/Tokenizer.h"
 
 namespace fuzzylite {
 
@@ -31,24 +32,27 @@ namespace fuzzylite {
         _activationDegree(0.0),
         _triggered(false),
         _antecedent(new Antecedent),
-        _consequent(new Consequent) {}
+        _consequent(new Consequent),
+        _revision(0) {}
 
     Rule::Rule(const Rule& other) :
         _enabled(other._enabled),
-        _text(other._text),
+        _text(other.getText()),
         _weight(other._weight),
         _activationDegree(other._activationDegree),
         _triggered(false),
         _antecedent(new Antecedent),
-        _consequent(new Consequent) {}
+        _consequent(new Consequent),
+        _revision(0) {}
 
     Rule& Rule::operator=(const Rule& other) {
         if (this != &other) {
             _enabled = other._enabled;
-            _text = other._text;
+            _text = other.getText();
             _weight = other._weight;
             _activationDegree = other._activationDegree;
             _triggered = other._triggered;
+            _revision += 1 + (_antecedent.get() ? _antecedent->revision() : 0);
             _antecedent.reset(new Antecedent);
             _consequent.reset(new Consequent);
         }
@@ -67,6 +71,17 @@ namespace fuzzylite {
     }
 
     std::string Rule::getText() const {
+        if (this->_text.empty() and isLoaded()) {
+            std::string text = Rule::ifKeyword() + " " + _antecedent->getText() + " " + Rule::thenKeyword() + " "
+                               + _consequent->getText();
+            if (_weight != 1.0) {
+                std::string weight = Op::str(_weight);
+                if (Op::toScalar(weight) != _weight)  // keeps every digit of the weight to load it back
+                    weight = Op::str(_weight, 17, std::ios_base::fmtflags(0x0));
+                text += " " + Rule::withKeyword() + " " + weight;
+            }
+            return text;
+        }
         return this->_text;
     }
 
@@ -79,6 +94,8 @@ namespace fuzzylite {
     }
 
     void Rule::setAntecedent(Antecedent* antecedent) {
+        // keeps the revision of the antecedent replaced, so the revision of the rule increases
+        this->_revision += 1 + (this->_antecedent.get() ? this->_antecedent->revision() : 0);
         this->_antecedent.reset(antecedent);
     }
 
@@ -88,6 +105,7 @@ namespace fuzzylite {
 
     void Rule::setConsequent(Consequent* consequent) {
         this->_consequent.reset(consequent);
+        ++this->_revision;
     }
 
     Consequent* Rule::getConsequent() const {
@@ -136,12 +154,19 @@ namespace fuzzylite {
         return this->_triggered;
     }
 
+    std::size_t Rule::revision() const {
+        return this->_revision + (this->_antecedent.get() ? this->_antecedent->revision() : 0);
+    }
+
     bool Rule::isLoaded() const {
         return _antecedent.get() and _consequent.get() and _antecedent->isLoaded() and _consequent->isLoaded();
     }
 
     void Rule::unload() {
+        if (_text.empty() and isLoaded())  // keeps the text of the rules built to load them back
+            _text = getText();
         deactivate();
+        ++_revision;
         if (getAntecedent())
             getAntecedent()->unload();
         if (getConsequent())
@@ -154,18 +179,18 @@ namespace fuzzylite {
 
     void Rule::load(const std::string& rule, const Engine* engine) {
         deactivate();
+        ++_revision;
         setEnabled(true);
         setText(rule);
-        std::istringstream tokenizer(rule.substr(0, rule.find_first_of('#')));
-        std::string token;
-        std::ostringstream ossAntecedent, ossConsequent;
+        Tokenizer tokenizer(rule, 0, rule.find_first_of('#'));
+        std::string token, antecedent, consequent;
         scalar weight = 1.0;
 
         enum FSM { S_NONE, S_IF, S_THEN, S_WITH, S_END };
 
         FSM state = S_NONE;
         try {
-            while (tokenizer >> token) {
+            while (tokenizer.next(token)) {
                 switch (state) {
                     case S_NONE:
                         if (token == Rule::ifKeyword())
@@ -181,13 +206,13 @@ namespace fuzzylite {
                         if (token == Rule::thenKeyword())
                             state = S_THEN;
                         else
-                            ossAntecedent << token << " ";
+                            antecedent.append(token).append(" ");
                         break;
                     case S_THEN:
                         if (token == Rule::withKeyword())
                             state = S_WITH;
                         else
-                            ossConsequent << token << " ";
+                            consequent.append(token).append(" ");
                         break;
                     case S_WITH:
                         try {
@@ -226,8 +251,8 @@ namespace fuzzylite {
                 throw Exception(ex.str(), FL_AT);
             }
 
-            getAntecedent()->load(ossAntecedent.str(), engine);
-            getConsequent()->load(ossConsequent.str(), engine);
+            getAntecedent()->load(antecedent, engine);
+            getConsequent()->load(consequent, engine);
             setWeight(weight);
 
         } catch (...) {
@@ -26,17 +26,23 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 namespace fuzzylite {
 
-    RuleBlock::RuleBlock(const std::string& name) : _enabled(true), _name(name), _description("") {}
+    RuleBlock::RuleBlock(const std::string& name) :
+        _enabled(true),
+        _name(name),
+        _description(""),
+        _revision(0) {}
 
     RuleBlock::RuleBlock(const RuleBlock& other) :
         _enabled(true),
         _name(other._name),
-        _description(other._description) {
+        _description(other._description),
+        _revision(0) {
         copyFrom(other);
     }
 
     RuleBlock& RuleBlock::operator=(const RuleBlock& other) {
         if (this != &other) {
+            _revision = revision() + 1;
             for (std::size_t i = 0; i < _rules.size(); ++i)
                 delete _rules.at(i);
             _rules.clear();
@@ -44,6 +50,7 @@ namespace fuzzylite {
             _disjunction.reset(fl::null);
             _implication.reset(fl::null);
             _activation.reset(fl::null);
+            _ruleIndex.clear();
 
             copyFrom(other);
         }
@@ -84,6 +91,7 @@ namespace fuzzylite {
     }
 
     void RuleBlock::loadRules(const Engine* engine) {
+        _ruleIndex.clear();
         std::ostringstream exceptions;
         bool throwException = false;
         for (std::size_t i = 0; i < _rules.size(); ++i) {
@@ -130,6 +138,7 @@ namespace fuzzylite {
     }
 
     void RuleBlock::setConjunction(TNorm* tnorm) {
+        _ruleIndex.clear();
         this->_conjunction.reset(tnorm);
     }
 
@@ -138,6 +147,7 @@ namespace fuzzylite {
     }
 
     void RuleBlock::setDisjunction(SNorm* snorm) {
+        _ruleIndex.clear();
         this->_disjunction.reset(snorm);
     }
 
@@ -177,10 +187,14 @@ namespace fuzzylite {
      * Operations for std::vector _rules
      */
     void RuleBlock::addRule(Rule* rule) {
+        _ruleIndex.clear();
+        ++_revision;
         _rules.push_back(rule);
     }
 
     void RuleBlock::insertRule(Rule* rule, std::size_t index) {
+        _ruleIndex.clear();
+        ++_revision;
         _rules.insert(_rules.begin() + index, rule);
     }
 
@@ -189,7 +203,9 @@ namespace fuzzylite {
     }
 
     Rule* RuleBlock::removeRule(std::size_t index) {
+        _ruleIndex.clear();
         Rule* result = _rules.at(index);
+        _revision += 1 + result->revision();
         _rules.erase(_rules.begin() + index);
         return result;
     }
@@ -203,13 +219,40 @@ namespace fuzzylite {
     }
 
     void RuleBlock::setRules(const std::vector<Rule*>& rules) {
+        _ruleIndex.clear();
+        _revision = revision() + 1;
         this->_rules = rules;
     }
 
     std::vector<Rule*>& RuleBlock::rules() {
+        // the rules can be modified through the mutable vector
+        _ruleIndex.clear();
         return this->_rules;
     }
 
+    std::size_t RuleBlock::revision() const {
+        // the revisions of the rules removed are kept, so the sum increases whenever any revision changes
+        std::size_t result = _revision;
+        for (std::size_t i = 0; i < _rules.size(); ++i)
+            if (_rules.at(i))
+                result += _rules.at(i)->revision();
+        return result;
+    }
+
+    const std::vector<Rule*>& RuleBlock::candidateRules(std::vector<Rule*>& buffer) {
+        if (not _ruleIndex.isBuiltFor(this))
+            _ruleIndex.build(this);
+        return _ruleIndex.candidates(buffer);
+    }
+
+    const std::vector<Rule*>& RuleBlock::candidateRules() {
+        return candidateRules(_candidates);
+    }
+
+    void RuleBlock::rebuildIndex() {
+        _ruleIndex.build(this);
+    }
+
     RuleBlock* RuleBlock::clone() const {
         return new RuleBlock(*this);
     }
@@ -0,0 +1,407 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/rule/RuleBlockScheduler.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+#ifndef FL_CPP98
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "fuzzylite/Engine.h"
+#include "fuzzylite/rule/Antecedent.h"
+#include "fuzzylite/rule/Consequent.h"
+#include "fuzzylite/rule/Expression.h"
+#include "fuzzylite/rule/Rule.h"
+#include "fuzzylite/rule/RuleBlock.h"
+#include "fuzzylite/variable/OutputVariable.h"
+
+namespace fuzzylite {
+
+    namespace {
+        typedef std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t> > MinQueue;
+
+        void
+        addOutput(const Variable* variable, const std::vector<OutputVariable*>& outputs, std::vector<int>& result) {
+            for (std::size_t o = 0; o < outputs.size(); ++o) {
+                if (variable == outputs.at(o)) {
+                    result.at(o) = 1;
+                    return;
+                }
+            }
+        }
+
+        // the output variables in the propositions of the expression
+        void readsOf(const Expression* node, const std::vector<OutputVariable*>& outputs, std::vector<int>& result) {
+            if (not node)
+                return;
+            if (node->type() == Expression::Operator) {
+                const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+                readsOf(fuzzyOperator->left, outputs, result);
+                readsOf(fuzzyOperator->right, outputs, result);
+            } else {
+                addOutput(static_cast<const Proposition*>(node)->variable, outputs, result);
+            }
+        }
+
+        void addDependency(std::vector<std::vector<std::size_t> >& dependencies, std::size_t from, std::size_t to) {
+            if (from != to and std::find(dependencies.at(to).begin(), dependencies.at(to).end(), from)
+                                   == dependencies.at(to).end())
+                dependencies.at(to).push_back(from);
+        }
+
+        /**
+          Tarjan's algorithm to find the strongly connected components of the
+          dependencies, of which those with more than one rule block are cycles
+         */
+        class CycleFinder {
+          private:
+            const std::vector<std::vector<std::size_t> >& _dependents;
+            std::vector<std::size_t> _index;
+            std::vector<std::size_t> _lowLink;
+            std::vector<int> _onStack;
+            std::vector<std::size_t> _stack;
+            std::size_t _counter;
+
+            void connect(std::size_t v, std::vector<std::vector<std::size_t> >& cycles) {
+                _index.at(v) = _lowLink.at(v) = ++_counter;
+                _stack.push_back(v);
+                _onStack.at(v) = 1;
+                for (std::size_t i = 0; i < _dependents.at(v).size(); ++i) {
+                    const std::size_t w = _dependents.at(v).at(i);
+                    if (_index.at(w) == 0) {
+                        connect(w, cycles);
+                        _lowLink.at(v) = std::min(_lowLink.at(v), _lowLink.at(w));
+                    } else if (_onStack.at(w)) {
+                        _lowLink.at(v) = std::min(_lowLink.at(v), _index.at(w));
+                    }
+                }
+                if (_lowLink.at(v) == _index.at(v)) {
+                    std::vector<std::size_t> component;
+                    std::size_t w;
+                    do {
+                        w = _stack.back();
+                        _stack.pop_back();
+                        _onStack.at(w) = 0;
+                        component.push_back(w);
+                    } while (w != v);
+                    if (component.size() > 1) {
+                        std::sort(component.begin(), component.end());
+                        cycles.push_back(component);
+                    }
+                }
+            }
+
+          public:
+            explicit CycleFinder(const std::vector<std::vector<std::size_t> >& dependents) :
+                _dependents(dependents),
+                _index(dependents.size(), 0),
+                _lowLink(dependents.size(), 0),
+                _onStack(dependents.size(), 0),
+                _counter(0) {}
+
+            void find(std::vector<std::vector<std::size_t> >& cycles) {
+                for (std::size_t v = 0; v < _dependents.size(); ++v)
+                    if (_index.at(v) == 0)
+                        connect(v, cycles);
+                std::sort(cycles.begin(), cycles.end());
+            }
+        };
+
+#ifndef FL_CPP98
+        /**
+          The state shared by the threads of RuleBlockScheduler::activate(),
+          where the threads take the rule blocks whose dependencies have been
+          activated in the order of activation
+         */
+        class Schedule {
+          private:
+            const std::vector<RuleBlock*>& _ruleBlocks;
+            const std::vector<std::vector<std::size_t> >& _dependents;
+            const std::vector<std::size_t>& _position;
+            std::vector<std::size_t> _pending;
+            MinQueue _ready;
+            std::size_t _remaining;
+            bool _failed;
+            std::size_t _failedPosition;
+            std::exception_ptr _exception;
+            std::mutex _mutex;
+            std::condition_variable _condition;
+
+          public:
+            Schedule(
+                const std::vector<RuleBlock*>& ruleBlocks,
+                const std::vector<std::size_t>& order,
+                const std::vector<std::vector<std::size_t> >& dependencies,
+                const std::vector<std::vector<std::size_t> >& dependents,
+                const std::vector<std::size_t>& position
+            ) :
+                _ruleBlocks(ruleBlocks),
+                _dependents(dependents),
+                _position(position),
+                _pending(ruleBlocks.size(), 0),
+                _remaining(order.size()),
+                _failed(false),
+                _failedPosition(0) {
+                for (std::size_t i = 0; i < order.size(); ++i) {
+                    const std::size_t b = order.at(i);
+                    _pending.at(b) = dependencies.at(b).size();
+                    if (_pending.at(b) == 0)
+                        _ready.push(_position.at(b));
+                }
+            }
+
+            void run(const std::vector<std::size_t>& order) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (true) {
+                    while (_ready.empty() and _remaining > 0 and not _failed)
+                        _condition.wait(lock);
+                    if (_remaining == 0 or _failed)
+                        return;
+                    const std::size_t position = _ready.top();
+                    _ready.pop();
+                    const std::size_t b = order.at(position);
+                    lock.unlock();
+
+                    std::exception_ptr exception;
+                    try {
+                        _ruleBlocks.at(b)->activate();
+                    } catch (...) {
+                        exception = std::current_exception();
+                    }
+
+                    lock.lock();
+                    --_remaining;
+                    if (exception) {
+                        if (not _failed or position < _failedPosition) {
+                            _failedPosition = position;
+                            _exception = exception;
+                        }
+                        _failed = true;
+                    } else {
+                        for (std::size_t i = 0; i < _dependents.at(b).size(); ++i) {
+                            const std::size_t d = _dependents.at(b).at(i);
+                            if (--_pending.at(d) == 0)
+                                _ready.push(_position.at(d));
+                        }
+                    }
+                    _condition.notify_all();
+                }
+            }
+
+            void rethrow() const {
+                if (_exception)
+                    std::rethrow_exception(_exception);
+            }
+        };
+#endif
+    }
+
+    RuleBlockScheduler::RuleBlockScheduler() : _width(0) {}
+
+    RuleBlockScheduler::~RuleBlockScheduler() {}
+
+    void RuleBlockScheduler::build(const Engine* engine) {
+        clear();
+        const std::vector<OutputVariable*>& outputs = engine->outputVariables();
+        _outputVariables.assign(outputs.begin(), outputs.end());
+        _ruleBlocks = engine->ruleBlocks();
+        const std::size_t numberOfRuleBlocks = _ruleBlocks.size();
+        _enabled.resize(numberOfRuleBlocks, 0);
+        _rules.resize(numberOfRuleBlocks);
+        _revisions.resize(numberOfRuleBlocks, 0);
+        _dependencies.resize(numberOfRuleBlocks);
+        _dependents.resize(numberOfRuleBlocks);
+
+        // the output variables read and written by each rule block
+        std::vector<std::vector<int> > reads(numberOfRuleBlocks, std::vector<int>(outputs.size(), 0));
+        std::vector<std::vector<int> > writes(numberOfRuleBlocks, std::vector<int>(outputs.size(), 0));
+        for (std::size_t b = 0; b < numberOfRuleBlocks; ++b) {
+            const RuleBlock* ruleBlock = _ruleBlocks.at(b);
+            if (not(ruleBlock and ruleBlock->isEnabled()))
+                continue;
+            _enabled.at(b) = 1;
+            _rules.at(b) = ruleBlock->rules();
+            _revisions.at(b) = ruleBlock->revision();
+            for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r) {
+                const Rule* rule = ruleBlock->getRule(r);
+                if (not rule)
+                    continue;
+                readsOf(rule->getAntecedent()->getExpression(), outputs, reads.at(b));
+                const std::vector<Proposition*>& conclusions = rule->getConsequent()->conclusions();
+                for (std::size_t c = 0; c < conclusions.size(); ++c)
+                    addOutput(conclusions.at(c)->variable, outputs, writes.at(b));
+            }
+        }
+
+        for (std::size_t o = 0; o < outputs.size(); ++o) {
+            std::size_t lastWriter = numberOfRuleBlocks;
+            for (std::size_t w = 0; w < numberOfRuleBlocks; ++w) {
+                if (not(_enabled.at(w) and writes.at(w).at(o)))
+                    continue;
+                // the rule blocks that modify the same output variable are activated in order of declaration
+                if (lastWriter != numberOfRuleBlocks)
+                    addDependency(_dependencies, lastWriter, w);
+                lastWriter = w;
+                for (std::size_t r = 0; r < numberOfRuleBlocks; ++r) {
+                    if (_enabled.at(r) and reads.at(r).at(o))
+                        addDependency(_dependencies, w, r);
+                }
+            }
+        }
+        for (std::size_t b = 0; b < numberOfRuleBlocks; ++b) {
+            std::sort(_dependencies.at(b).begin(), _dependencies.at(b).end());
+            for (std::size_t d = 0; d < _dependencies.at(b).size(); ++d)
+                _dependents.at(_dependencies.at(b).at(d)).push_back(b);
+        }
+
+        CycleFinder(_dependents).find(_cycles);
+        if (not _cycles.empty()) {
+            for (std::size_t b = 0; b < numberOfRuleBlocks; ++b)
+                if (_enabled.at(b))
+                    _order.push_back(b);
+            _width = std::min(_order.size(), std::size_t(1));
+            return;
+        }
+
+        // topological order where the ties are broken by the order of declaration
+        std::vector<std::size_t> pending(numberOfRuleBlocks, 0);
+        MinQueue ready;
+        for (std::size_t b = 0; b < numberOfRuleBlocks; ++b) {
+            pending.at(b) = _dependencies.at(b).size();
+            if (_enabled.at(b) and pending.at(b) == 0)
+                ready.push(b);
+        }
+        std::vector<std::size_t> depth(numberOfRuleBlocks, 0);
+        std::vector<std::size_t> blocksAtDepth;
+        while (not ready.empty()) {
+            const std::size_t b = ready.top();
+            ready.pop();
+            _order.push_back(b);
+            for (std::size_t d = 0; d < _dependencies.at(b).size(); ++d)
+                depth.at(b) = std::max(depth.at(b), depth.at(_dependencies.at(b).at(d)) + 1);
+            if (depth.at(b) >= blocksAtDepth.size())
+                blocksAtDepth.resize(depth.at(b) + 1, 0);
+            _width = std::max(_width, ++blocksAtDepth.at(depth.at(b)));
+            for (std::size_t d = 0; d < _dependents.at(b).size(); ++d) {
+                if (--pending.at(_dependents.at(b).at(d)) == 0)
+                    ready.push(_dependents.at(b).at(d));
+            }
+        }
+    }
+
+    bool RuleBlockScheduler::isBuiltFor(const Engine* engine) const {
+        if (_ruleBlocks != engine->ruleBlocks() or _outputVariables.size() != engine->numberOfOutputVariables())
+            return false;
+        for (std::size_t o = 0; o < _outputVariables.size(); ++o)
+            if (_outputVariables.at(o) != engine->getOutputVariable(o))
+                return false;
+        for (std::size_t b = 0; b < _ruleBlocks.size(); ++b) {
+            const RuleBlock* ruleBlock = _ruleBlocks.at(b);
+            if (_enabled.at(b) != int(ruleBlock and ruleBlock->isEnabled())
+                or (_enabled.at(b)
+                    and (_rules.at(b) != ruleBlock->rules() or _revisions.at(b) != ruleBlock->revision())))
+                return false;
+        }
+        return true;
+    }
+
+    void RuleBlockScheduler::clear() {
+        _ruleBlocks.clear();
+        _enabled.clear();
+        _rules.clear();
+        _revisions.clear();
+        _outputVariables.clear();
+        _order.clear();
+        _dependencies.clear();
+        _dependents.clear();
+        _cycles.clear();
+        _width = 0;
+    }
+
+    const std::vector<std::size_t>& RuleBlockScheduler::order() const {
+        return this->_order;
+    }
+
+    const std::vector<std::size_t>& RuleBlockScheduler::dependencies(std::size_t ruleBlock) const {
+        return this->_dependencies.at(ruleBlock);
+    }
+
+    const std::vector<std::vector<std::size_t> >& RuleBlockScheduler::cycles() const {
+        return this->_cycles;
+    }
+
+    std::size_t RuleBlockScheduler::width() const {
+        return this->_width;
+    }
+
+    bool RuleBlockScheduler::isConcurrent(std::size_t numberOfThreads) const {
+#ifdef FL_CPP98
+        FL_IUNUSED(numberOfThreads);
+        return false;
+#else
+        return numberOfThreads > 1 and _width > 1 and _cycles.empty();
+#endif
+    }
+
+    void RuleBlockScheduler::activate(std::size_t numberOfThreads) const {
+        if (isConcurrent(numberOfThreads))
+            activateInParallel(std::min(numberOfThreads, _width));
+        else
+            activateInOrder();
+    }
+
+    void RuleBlockScheduler::activateInOrder() const {
+        for (std::size_t i = 0; i < _order.size(); ++i) {
+            RuleBlock* ruleBlock = _ruleBlocks.at(_order.at(i));
+            FL_DBG("===============");
+            FL_DBG("RULE BLOCK: " << ruleBlock->getName());
+            ruleBlock->activate();
+        }
+    }
+
+    void RuleBlockScheduler::activateInParallel(std::size_t numberOfThreads) const {
+#ifdef FL_CPP98
+        FL_IUNUSED(numberOfThreads);
+        activateInOrder();
+#else
+        std::vector<std::size_t> position(_ruleBlocks.size(), 0);
+        for (std::size_t i = 0; i < _order.size(); ++i)
+            position.at(_order.at(i)) = i;
+        Schedule schedule(_ruleBlocks, _order, _dependencies, _dependents, position);
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfThreads - 1);
+        try {
+            for (std::size_t t = 1; t < numberOfThreads; ++t)
+                threads.push_back(std::thread(&Schedule::run, &schedule, std::cref(_order)));
+        } catch (...) {
+            // the calling thread activates the rule blocks left by the threads that could not be created
+        }
+        schedule.run(_order);
+        for (std::size_t t = 0; t < threads.size(); ++t)
+            threads.at(t).join();
+        schedule.rethrow();
+#endif
+    }
+
+}
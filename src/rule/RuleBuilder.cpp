@@ -0,0 +1,169 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/rule/RuleBuilder.h"
+
+#include "fuzzylite/Exception.h"
+#include "fuzzylite/hedge/Any.h"
+#include "fuzzylite/rule/Expression.h"
+#include "fuzzylite/rule/Rule.h"
+#include "fuzzylite/variable/OutputVariable.h"
+
+namespace fuzzylite {
+
+    namespace {
+        void validate(const Expression* node) {
+            if (not node)
+                throw Exception("[rule builder error] expected an expression, but found none", FL_AT);
+            if (node->type() == Expression::Proposition) {
+                const Proposition* proposition = static_cast<const Proposition*>(node);
+                if (not proposition->variable) {
+                    throw Exception(
+                        "[rule builder error] proposition <" + node->toString() + "> has no variable", FL_AT
+                    );
+                }
+                if (not proposition->term
+                    and not(not proposition->hedges.empty() and dynamic_cast<const Any*>(proposition->hedges.back())))
+                    throw Exception("[rule builder error] proposition <" + node->toString() + "> has no term", FL_AT);
+                return;
+            }
+            const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+            if (not(fuzzyOperator->name == Rule::andKeyword() or fuzzyOperator->name == Rule::orKeyword()))
+                throw Exception("[rule builder error] unknown operator <" + fuzzyOperator->name + ">", FL_AT);
+            validate(fuzzyOperator->left);
+            validate(fuzzyOperator->right);
+        }
+
+        Operator* binary(const std::string& name, Expression* left, Expression* right) {
+            Operator* result = new Operator;
+            result->name = name;
+            result->left = left;
+            result->right = right;
+            return result;
+        }
+    }
+
+    RuleBuilder::RuleBuilder() : _antecedent(fl::null), _weight(1.0) {}
+
+    RuleBuilder::~RuleBuilder() {
+        clear();
+    }
+
+    Proposition* RuleBuilder::proposition(Variable* variable, Term* term, const std::vector<Hedge*>& hedges) {
+        Proposition* result = new Proposition;
+        result->variable = variable;
+        result->hedges = hedges;
+        result->term = term;
+        return result;
+    }
+
+    Proposition* RuleBuilder::proposition(Variable* variable, Hedge* hedge, Term* term) {
+        return proposition(variable, term, std::vector<Hedge*>(1, hedge));
+    }
+
+    Operator* RuleBuilder::conjunction(Expression* left, Expression* right) {
+        return binary(Rule::andKeyword(), left, right);
+    }
+
+    Operator* RuleBuilder::disjunction(Expression* left, Expression* right) {
+        return binary(Rule::orKeyword(), left, right);
+    }
+
+    void RuleBuilder::combine(const std::string& name, Expression* expression) {
+        if (_antecedent)
+            _antecedent = binary(name, _antecedent, expression);
+        else
+            _antecedent = expression;
+    }
+
+    RuleBuilder& RuleBuilder::when(Expression* expression) {
+        if (_antecedent != expression)
+            delete _antecedent;
+        _antecedent = expression;
+        return *this;
+    }
+
+    RuleBuilder& RuleBuilder::when(Variable* variable, Term* term) {
+        return when(proposition(variable, term));
+    }
+
+    RuleBuilder& RuleBuilder::andWhen(Expression* expression) {
+        combine(Rule::andKeyword(), expression);
+        return *this;
+    }
+
+    RuleBuilder& RuleBuilder::andWhen(Variable* variable, Term* term) {
+        return andWhen(proposition(variable, term));
+    }
+
+    RuleBuilder& RuleBuilder::orWhen(Expression* expression) {
+        combine(Rule::orKeyword(), expression);
+        return *this;
+    }
+
+    RuleBuilder& RuleBuilder::orWhen(Variable* variable, Term* term) {
+        return orWhen(proposition(variable, term));
+    }
+
+    RuleBuilder& RuleBuilder::then(Proposition* conclusion) {
+        _conclusions.push_back(conclusion);
+        return *this;
+    }
+
+    RuleBuilder& RuleBuilder::then(OutputVariable* variable, Term* term) {
+        return then(proposition(variable, term));
+    }
+
+    RuleBuilder& RuleBuilder::with(scalar weight) {
+        _weight = weight;
+        return *this;
+    }
+
+    Rule* RuleBuilder::build() {
+        validate(_antecedent);
+        if (_conclusions.empty())
+            throw Exception("[rule builder error] expected a conclusion, but found none", FL_AT);
+        for (std::size_t i = 0; i < _conclusions.size(); ++i) {
+            const Proposition* conclusion = _conclusions.at(i);
+            if (not(conclusion and dynamic_cast<const OutputVariable*>(conclusion->variable) and conclusion->term)) {
+                throw Exception(
+                    "[rule builder error] expected a conclusion of an output variable and a term, but found <"
+                        + (conclusion ? conclusion->toString() : std::string("null")) + ">",
+                    FL_AT
+                );
+            }
+        }
+
+        Rule* rule = new Rule("", _weight);
+        rule->getAntecedent()->setExpression(_antecedent);
+        rule->getConsequent()->conclusions() = _conclusions;
+        _antecedent = fl::null;
+        _conclusions.clear();
+        _weight = 1.0;
+        return rule;
+    }
+
+    void RuleBuilder::clear() {
+        delete _antecedent;
+        _antecedent = fl::null;
+        for (std::size_t i = 0; i < _conclusions.size(); ++i)
+            delete _conclusions.at(i);
+        _conclusions.clear();
+        _weight = 1.0;
+    }
+
+}
@@ -0,0 +1,299 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/rule/RuleIndex.h"
+
+#include <algorithm>
+#include <map>
+
+#include "fuzzylite/Operation.h"
+#include "fuzzylite/hedge/Extremely.h"
+#include "fuzzylite/hedge/Seldom.h"
+#include "fuzzylite/hedge/Somewhat.h"
+#include "fuzzylite/hedge/Very.h"
+#include "fuzzylite/norm/s/AlgebraicSum.h"
+#include "fuzzylite/norm/s/BoundedSum.h"
+#include "fuzzylite/norm/s/DrasticSum.h"
+#include "fuzzylite/norm/s/EinsteinSum.h"
+#include "fuzzylite/norm/s/HamacherSum.h"
+#include "fuzzylite/norm/s/Maximum.h"
+#include "fuzzylite/norm/s/NilpotentMaximum.h"
+#include "fuzzylite/norm/s/NormalizedSum.h"
+#include "fuzzylite/norm/s/UnboundedSum.h"
+#include "fuzzylite/norm/t/AlgebraicProduct.h"
+#include "fuzzylite/norm/t/BoundedDifference.h"
+#include "fuzzylite/norm/t/DrasticProduct.h"
+#include "fuzzylite/norm/t/EinsteinProduct.h"
+#include "fuzzylite/norm/t/HamacherProduct.h"
+#include "fuzzylite/norm/t/Minimum.h"
+#include "fuzzylite/norm/t/NilpotentMinimum.h"
+#include "fuzzylite/rule/Antecedent.h"
+#include "fuzzylite/rule/Expression.h"
+#include "fuzzylite/rule/Rule.h"
+#include "fuzzylite/rule/RuleBlock.h"
+#include "fuzzylite/term/Term.h"
+#include "fuzzylite/variable/InputVariable.h"
+
+namespace fuzzylite {
+
+    namespace {
+        typedef std::pair<scalar, scalar> Interval;
+        typedef std::map<const InputVariable*, Interval> Box;
+
+        const std::size_t bitsPerWord = sizeof(unsigned long) * 8;
+
+        bool preservesZero(const Hedge* hedge) {
+            return dynamic_cast<const Very*>(hedge) or dynamic_cast<const Somewhat*>(hedge)
+                   or dynamic_cast<const Extremely*>(hedge) or dynamic_cast<const Seldom*>(hedge);
+        }
+
+        // T(0, b) = 0
+        bool isIndexable(const TNorm* tnorm) {
+            return dynamic_cast<const Minimum*>(tnorm) or dynamic_cast<const AlgebraicProduct*>(tnorm)
+                   or dynamic_cast<const BoundedDifference*>(tnorm) or dynamic_cast<const DrasticProduct*>(tnorm)
+                   or dynamic_cast<const EinsteinProduct*>(tnorm) or dynamic_cast<const HamacherProduct*>(tnorm)
+                   or dynamic_cast<const NilpotentMinimum*>(tnorm);
+        }
+
+        // S(0, 0) = 0
+        bool isIndexable(const SNorm* snorm) {
+            return dynamic_cast<const Maximum*>(snorm) or dynamic_cast<const AlgebraicSum*>(snorm)
+                   or dynamic_cast<const BoundedSum*>(snorm) or dynamic_cast<const DrasticSum*>(snorm)
+                   or dynamic_cast<const EinsteinSum*>(snorm) or dynamic_cast<const HamacherSum*>(snorm)
+                   or dynamic_cast<const NilpotentMaximum*>(snorm) or dynamic_cast<const NormalizedSum*>(snorm)
+                   or dynamic_cast<const UnboundedSum*>(snorm);
+        }
+
+        Interval supportOf(const Term* term) {
+            Interval result = term->support();
+            if (Op::isNaN(result.first))
+                result.first = -fl::inf;
+            if (Op::isNaN(result.second))
+                result.second = fl::inf;
+            return result;
+        }
+
+        /**
+          Computes the box outside of which the expression is zero, where the
+          input variables missing from the box are unconstrained.
+          @return false if the expression cannot be indexed
+         */
+        bool analyze(
+            const Expression* node,
+            const TNorm* conjunction,
+            const SNorm* disjunction,
+            Box& box
+        ) {
+            if (node->type() == Expression::Proposition) {
+                const Proposition* proposition = static_cast<const Proposition*>(node);
+                if (not proposition->variable or not proposition->term)
+                    return false;
+                if (proposition->variable->type() != Variable::Input)
+                    return true;
+                for (std::size_t i = 0; i < proposition->hedges.size(); ++i)
+                    if (not preservesZero(proposition->hedges.at(i)))
+                        return true;
+                box[static_cast<const InputVariable*>(proposition->variable)] = supportOf(proposition->term);
+                return true;
+            }
+            if (node->type() == Expression::Operator) {
+                const Operator* fuzzyOperator = static_cast<const Operator*>(node);
+                if (not(fuzzyOperator->left and fuzzyOperator->right))
+                    return false;
+                const bool conjunctive = fuzzyOperator->name == Rule::andKeyword();
+                if (conjunctive ? not isIndexable(conjunction)
+                                : fuzzyOperator->name != Rule::orKeyword() or not isIndexable(disjunction))
+                    return false;
+                Box left, right;
+                if (not(analyze(fuzzyOperator->left, conjunction, disjunction, left)
+                        and analyze(fuzzyOperator->right, conjunction, disjunction, right)))
+                    return false;
+                if (conjunctive) {
+                    // the conjunction is zero where either operand is zero
+                    box = left;
+                    for (Box::const_iterator it = right.begin(); it != right.end(); ++it) {
+                        Box::iterator match = box.find(it->first);
+                        if (match == box.end())
+                            box.insert(*it);
+                        else
+                            match->second = Interval(
+                                std::max(match->second.first, it->second.first),
+                                std::min(match->second.second, it->second.second)
+                            );
+                    }
+                } else {
+                    // the disjunction is zero where both operands are zero
+                    box.clear();
+                    for (Box::const_iterator it = left.begin(); it != left.end(); ++it) {
+                        Box::const_iterator match = right.find(it->first);
+                        if (match != right.end())
+                            box[it->first] = Interval(
+                                std::min(it->second.first, match->second.first),
+                                std::max(it->second.second, match->second.second)
+                            );
+                    }
+                }
+                return true;
+            }
+            return false;
+        }
+    }
+
+    RuleIndex::RuleIndex() :
+        _built(false),
+        _conjunction(fl::null),
+        _disjunction(fl::null),
+        _macheps(fuzzylite::macheps()),
+        _numberOfWords(0),
+        _numberOfIndexedRules(0) {}
+
+    RuleIndex::~RuleIndex() {}
+
+    void RuleIndex::clear() {
+        _built = false;
+        _conjunction = fl::null;
+        _disjunction = fl::null;
+        _rules.clear();
+        _dimensions.clear();
+        _numberOfWords = 0;
+        _numberOfIndexedRules = 0;
+    }
+
+    void RuleIndex::build(const RuleBlock* ruleBlock) {
+        clear();
+        _built = true;
+        _conjunction = ruleBlock->getConjunction();
+        _disjunction = ruleBlock->getDisjunction();
+        _macheps = fuzzylite::macheps();
+        _rules = ruleBlock->rules();
+        _numberOfWords = (_rules.size() + bitsPerWord - 1) / bitsPerWord;
+
+        std::vector<Box> boxes(_rules.size());
+        for (std::size_t r = 0; r < _rules.size(); ++r) {
+            const Expression* expression = _rules.at(r)->getAntecedent()->getExpression();
+            if (not(expression and analyze(expression, _conjunction, _disjunction, boxes.at(r)))) {
+                boxes.at(r).clear();
+                continue;
+            }
+            if (not boxes.at(r).empty())
+                ++_numberOfIndexedRules;
+        }
+
+        // the membership functions compare against the bounds of the supports with tolerance
+        std::map<const InputVariable*, std::size_t> dimensionOf;
+        for (std::size_t r = 0; r < boxes.size(); ++r) {
+            for (Box::iterator it = boxes.at(r).begin(); it != boxes.at(r).end(); ++it) {
+                it->second.first -= _macheps;
+                it->second.second += _macheps;
+                std::map<const InputVariable*, std::size_t>::const_iterator match = dimensionOf.find(it->first);
+                if (match == dimensionOf.end()) {
+                    match = dimensionOf.insert(std::make_pair(it->first, _dimensions.size())).first;
+                    _dimensions.push_back(Dimension());
+                    _dimensions.back().variable = it->first;
+                }
+                Dimension& dimension = _dimensions.at(match->second);
+                dimension.bounds.push_back(it->second.first);
+                dimension.bounds.push_back(it->second.second);
+            }
+        }
+
+        for (std::size_t d = 0; d < _dimensions.size(); ++d) {
+            Dimension& dimension = _dimensions.at(d);
+            std::vector<scalar>& bounds = dimension.bounds;
+            std::sort(bounds.begin(), bounds.end());
+            bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+            // segment 2k is the open interval before bounds[k], and segment 2k+1 is bounds[k]
+            const std::size_t segments = 2 * bounds.size() + 1;
+            dimension.masks.assign(segments * _numberOfWords, Word(0));
+            for (std::size_t r = 0; r < boxes.size(); ++r) {
+                const Word bit = Word(1) << (r % bitsPerWord);
+                Box::const_iterator constraint = boxes.at(r).find(dimension.variable);
+                for (std::size_t s = 0; s < segments; ++s) {
+                    bool candidate = true;
+                    if (constraint != boxes.at(r).end()) {
+                        const scalar lower = constraint->second.first;
+                        const scalar upper = constraint->second.second;
+                        const std::size_t k = s / 2;
+                        if (s % 2 == 1) {
+                            candidate = lower <= bounds.at(k) and bounds.at(k) <= upper;
+                        } else {
+                            const scalar left = k == 0 ? -fl::inf : bounds.at(k - 1);
+                            const scalar right = k == bounds.size() ? fl::inf : bounds.at(k);
+                            candidate = lower < right and upper > left;
+                        }
+                    }
+                    if (candidate)
+                        dimension.masks.at(s * _numberOfWords + r / bitsPerWord) |= bit;
+                }
+            }
+        }
+    }
+
+    bool RuleIndex::isBuiltFor(const RuleBlock* ruleBlock) const {
+        // the rule block clears the index whenever its rules change, so the rules are not compared here
+        return _built and _conjunction == ruleBlock->getConjunction() and _disjunction == ruleBlock->getDisjunction()
+               and _macheps == fuzzylite::macheps();
+    }
+
+    std::size_t RuleIndex::numberOfIndexedRules() const {
+        return this->_numberOfIndexedRules;
+    }
+
+    const std::vector<Rule*>& RuleIndex::candidates(std::vector<Rule*>& buffer) const {
+        if (_dimensions.empty())
+            return _rules;
+
+        // the masks of the segments where the values of the input variables fall, kept on the stack for
+        // the usual number of input variables
+        const std::size_t stackDimensions = 16;
+        const Word* stackMasks[stackDimensions];
+        std::vector<const Word*> heapMasks;
+        if (_dimensions.size() > stackDimensions)
+            heapMasks.resize(_dimensions.size());
+        const Word** masks = heapMasks.empty() ? stackMasks : &heapMasks.front();
+        std::size_t numberOfMasks = 0;
+        for (std::size_t d = 0; d < _dimensions.size(); ++d) {
+            const Dimension& dimension = _dimensions.at(d);
+            const scalar x = dimension.variable->getValue();
+            if (Op::isNaN(x))
+                continue;
+            const std::size_t k = std::size_t(
+                std::lower_bound(dimension.bounds.begin(), dimension.bounds.end(), x) - dimension.bounds.begin()
+            );
+            const bool bound = k < dimension.bounds.size() and dimension.bounds.at(k) == x;
+            const std::size_t segment = bound ? 2 * k + 1 : 2 * k;
+            masks[numberOfMasks++] = &dimension.masks.at(segment * _numberOfWords);
+        }
+
+        buffer.clear();
+        for (std::size_t w = 0; w < _numberOfWords; ++w) {
+            Word word = ~Word(0);
+            if (w + 1 == _numberOfWords and _rules.size() % bitsPerWord != 0)
+                word = (Word(1) << (_rules.size() % bitsPerWord)) - 1;
+            for (std::size_t m = 0; m < numberOfMasks and word != 0; ++m)
+                word &= masks[m][w];
+            for (; word != 0; word &= word - 1) {
+                std::size_t bit = 0;
+                while (not((word >> bit) & Word(1)))
+                    ++bit;
+                buffer.push_back(_rules.at(w * bitsPerWord + bit));
+            }
+        }
+        return buffer;
+    }
+
+}
@@ -0,0 +1,60 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "fuzzylite/rule/Tokenizer.h"
+
+namespace fuzzylite {
+
+    Tokenizer::Tokenizer(const std::string& text, std::size_t begin, std::size_t end, bool splitParentheses) :
+        _text(&text),
+        _position(begin),
+        _end(end < text.size() ? end : text.size()),
+        _splitParentheses(splitParentheses) {}
+
+    Tokenizer::~Tokenizer() {}
+
+    bool Tokenizer::next(std::size_t& begin, std::size_t& size) {
+        const std::string& text = *_text;
+        while (_position < _end and isSeparator(text[_position]))
+            ++_position;
+        if (_position >= _end)
+            return false;
+        begin = _position;
+        if (_splitParentheses and (text[_position] == '(' or text[_position] == ')')) {
+            ++_position;
+        } else {
+            while (_position < _end and not isSeparator(text[_position])
+                   and not(_splitParentheses and (text[_position] == '(' or text[_position] == ')')))
+                ++_position;
+        }
+        size = _position - begin;
+        return true;
+    }
+
+    bool Tokenizer::next(std::string& token) {
+        std::size_t begin, size;
+        if (not next(begin, size))
+            return false;
+        token.assign(*_text, begin, size);
+        return true;
+    }
+
+    bool Tokenizer::isSeparator(char c) {
+        return c == ' ' or c == '\t' or c == '\n' or c == '\v' or c == '\f' or c == '\r';
+    }
+
+}
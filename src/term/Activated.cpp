@@ -55,6 +55,10 @@ namespace fuzzylite {
         return _implication->compute(_term->membership(x), _height);
     }
 
+    std::pair<scalar, scalar> Activated::support() const {
+        return _term ? _term->support() : Term::support();
+    }
+
     std::string Activated::parameters() const {
         FllExporter exporter;
         std::ostringstream ss;
@@ -17,11 +17,29 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Aggregated.h"
 
+#include <algorithm>
+
 #include "fuzzylite/imex/FllExporter.h"
 #include "fuzzylite/norm/s/Maximum.h"
 
 namespace fuzzylite {
 
+    namespace {
+        // the position of the group of the name in the groups sorted by name
+        std::size_t groupOf(const std::vector<Activated>& groups, const std::string& name) {
+            std::size_t group = 0;
+            while (group < groups.size() and groups[group].getTerm()->getName() < name)
+                ++group;
+            return group;
+        }
+
+        scalar aggregate(const SNorm* aggregation, scalar a, scalar b) {
+            if (aggregation)
+                return aggregation->compute(a, b);
+            return a + b;  // Default for WeightDefuzzifier
+        }
+    }
+
     Aggregated::Aggregated(
         const std::string& name, scalar minimum, scalar maximum, SNorm* aggregation, const std::vector<Activated>& terms
     ) :
@@ -29,9 +47,14 @@ namespace fuzzylite {
         _minimum(minimum),
         _maximum(maximum),
         _aggregation(aggregation),
-        _terms(terms) {}
+        _terms(terms),
+        _indexedSlots(0),
+        _lastSlot(0),
+        _synchronized(false) {
+        synchronize();
+    }
 
-    Aggregated::Aggregated(const Aggregated& other) : Term(other) {
+    Aggregated::Aggregated(const Aggregated& other) : Term(other), _indexedSlots(0), _lastSlot(0), _synchronized(false) {
         copyFrom(other);
     }
 
@@ -55,8 +78,131 @@ namespace fuzzylite {
         if (source._aggregation.get())
             _aggregation.reset(source._aggregation->clone());
 
+        // the slots of the indexed terms are kept
+        _slots.assign(source._slots.begin(), source._slots.begin() + source._indexedSlots);
+        _slotIndex.clear();
+        for (std::size_t s = 0; s < _slots.size(); ++s)
+            _slotIndex[_slots[s].term] = s;
+        _indexedSlots = _slots.size();
+        _ranks.reserve(_slots.size());
+        _groups.reserve(_slots.size());
+
         for (std::size_t i = 0; i < source._terms.size(); ++i)
             _terms.push_back(source._terms.at(i));
+        synchronize();
+    }
+
+    std::size_t Aggregated::addSlot(const Term* term) {
+        // the ranks of the slots follow the order of the names of their terms
+        const std::string& name = term->getName();
+        std::size_t rank = 0;
+        bool shared = false;
+        for (std::size_t s = 0; s < _slots.size() and not shared; ++s) {
+            const std::string& slotName = _slots[s].term->getName();
+            if (slotName == name) {
+                rank = _slots[s].rank;
+                shared = true;
+            } else if (slotName < name)
+                rank = std::max(rank, _slots[s].rank + 1);
+        }
+        if (not shared) {
+            for (std::size_t s = 0; s < _slots.size(); ++s) {
+                if (_slots[s].rank >= rank)
+                    ++_slots[s].rank;
+            }
+            for (std::size_t g = 0; g < _ranks.size(); ++g) {
+                if (_ranks[g] >= rank)
+                    ++_ranks[g];
+            }
+        }
+        const Slot slot = {term, rank, 0.0};
+        _slotIndex[term] = _slots.size();
+        _slots.push_back(slot);
+        return _slots.size() - 1;
+    }
+
+    void Aggregated::reset() {
+        // the addresses of the terms that are not indexed may be reused
+        for (std::size_t s = _indexedSlots; s < _slots.size(); ++s)
+            _slotIndex.erase(_slots[s].term);
+        _slots.resize(_indexedSlots);
+        for (std::size_t s = 0; s < _slots.size(); ++s)
+            _slots[s].degree = 0.0;
+        _ranks.clear();
+        _groups.clear();
+        _lastSlot = 0;
+    }
+
+    void Aggregated::synchronize() {
+        reset();
+        for (std::size_t i = 0; i < _terms.size(); ++i)
+            accumulate(_terms[i]);
+        _synchronized = true;
+    }
+
+    void Aggregated::accumulate(const Activated& activated) {
+        const scalar degree = activated.getDegree();
+        // the same term is often activated by consecutive rules
+        std::size_t slot = _lastSlot;
+        if (not(slot < _slots.size() and _slots[slot].term == activated.getTerm())) {
+            const SlotIndex::const_iterator it = _slotIndex.find(activated.getTerm());
+            slot = it == _slotIndex.end() ? addSlot(activated.getTerm()) : it->second;
+            _lastSlot = slot;
+        }
+        Slot& current = _slots[slot];
+        current.degree = aggregate(_aggregation.get(), current.degree, degree);
+
+        // the groups are sorted by the ranks of the names
+        const std::vector<std::size_t>::iterator rank = std::lower_bound(_ranks.begin(), _ranks.end(), current.rank);
+        const std::size_t group = std::size_t(rank - _ranks.begin());
+        if (rank == _ranks.end() or *rank != current.rank) {
+            _ranks.insert(rank, current.rank);
+            _groups.insert(_groups.begin() + group, activated);
+        } else {
+            Activated& grouped = _groups[group];
+            grouped.setDegree(aggregate(_aggregation.get(), grouped.getDegree(), degree));
+        }
+    }
+
+    void Aggregated::indexTerms(const std::vector<Term*>& terms) {
+        _slots.clear();
+        _slotIndex.clear();
+        _ranks.clear();
+        _groups.clear();
+        std::vector<std::pair<std::string, std::size_t> > names;
+        names.reserve(terms.size());
+        for (std::size_t i = 0; i < terms.size(); ++i) {
+            if (_slotIndex.insert(SlotIndex::value_type(terms[i], _slots.size())).second) {
+                const Slot slot = {terms[i], 0, 0.0};
+                names.push_back(std::make_pair(terms[i]->getName(), _slots.size()));
+                _slots.push_back(slot);
+            }
+        }
+        // the ranks of the slots follow the order of the names of their terms
+        std::sort(names.begin(), names.end());
+        for (std::size_t i = 1; i < names.size(); ++i) {
+            const std::size_t previous = _slots[names[i - 1].second].rank;
+            _slots[names[i].second].rank = names[i].first == names[i - 1].first ? previous : previous + 1;
+        }
+        _indexedSlots = _slots.size();
+        _ranks.reserve(_slots.size());
+        _groups.reserve(_slots.size());
+        // the activated terms may refer to terms just deleted, so they are accumulated upon the next modification
+        _lastSlot = 0;
+        _synchronized = false;
+    }
+
+    void Aggregated::group(const std::vector<Activated>& terms, std::vector<Activated>& result) const {
+        result.clear();
+        for (std::size_t i = 0; i < terms.size(); ++i) {
+            const Activated& activated = terms[i];
+            const std::string& name = activated.getTerm()->getName();
+            const std::size_t group = groupOf(result, name);
+            if (group == result.size() or result[group].getTerm()->getName() != name)
+                result.insert(result.begin() + group, activated);
+            else
+                result[group].setDegree(aggregate(_aggregation.get(), result[group].getDegree(), activated.getDegree()));
+        }
     }
 
     std::string Aggregated::className() const {
@@ -82,22 +228,22 @@ namespace fuzzylite {
     }
 
     scalar Aggregated::activationDegree(const Term* forTerm) const {
+        if (_synchronized) {
+            const SlotIndex::const_iterator it = _slotIndex.find(forTerm);
+            return it == _slotIndex.end() ? 0.0 : _slots[it->second].degree;
+        }
         scalar result = 0.0;
         for (std::size_t i = 0; i < _terms.size(); ++i) {
-            const Activated& activatedTerm = _terms.at(i);
-            if (activatedTerm.getTerm() == forTerm) {
-                if (_aggregation.get())
-                    result = _aggregation->compute(result, activatedTerm.getDegree());
-                else
-                    result += activatedTerm.getDegree();  // Default for WeightDefuzzifier
-            }
+            if (_terms[i].getTerm() == forTerm)
+                result = aggregate(_aggregation.get(), result, _terms[i].getDegree());
         }
         return result;
     }
 
     Activated Aggregated::highestActivatedTerm() const {
         Activated highest(fl::null, 0.0);
-        std::vector<Activated> groupedTerms = this->groupedTerms();
+        std::vector<Activated> buffer;
+        const std::vector<Activated>& groupedTerms = this->groupedTerms(buffer);
         for (std::size_t i = 0; i < groupedTerms.size(); ++i) {
             const Activated& activated = groupedTerms.at(i);
             if (activated.getDegree() > highest.getDegree())
@@ -107,27 +253,15 @@ namespace fuzzylite {
     }
 
     std::vector<Activated> Aggregated::groupedTerms() const {
-        std::map<std::string, Activated> groups;
-        for (std::size_t i = 0; i < terms().size(); ++i) {
-            const Activated& activated = getTerm(i);
-            std::map<std::string, Activated>::iterator it = groups.find(activated.getTerm()->getName());
-            if (it == groups.end())
-                groups[activated.getTerm()->getName()] = activated;
-            else {
-                Activated& groupedTerm = it->second;
-                scalar groupedDegree;
-                if (getAggregation())
-                    groupedDegree = getAggregation()->compute(groupedTerm.getDegree(), activated.getDegree());
-                else
-                    groupedDegree = groupedTerm.getDegree() + activated.getDegree();
-                groupedTerm.setDegree(groupedDegree);
-            }
-        }
-        std::vector<Activated> terms;
-        terms.reserve(groups.size());
-        for (std::map<std::string, Activated>::const_iterator it = groups.begin(); it != groups.end(); ++it)
-            terms.push_back(it->second);
-        return terms;
+        std::vector<Activated> buffer;
+        return groupedTerms(buffer);
+    }
+
+    const std::vector<Activated>& Aggregated::groupedTerms(std::vector<Activated>& buffer) const {
+        if (_synchronized)
+            return this->_groups;
+        group(_terms, buffer);
+        return buffer;
     }
 
     std::string Aggregated::parameters() const {
@@ -144,6 +278,16 @@ namespace fuzzylite {
         FL_IUNUSED(parameters);
     }
 
+    std::pair<scalar, scalar> Aggregated::support() const {
+        std::pair<scalar, scalar> result(fl::inf, -fl::inf);
+        for (std::size_t i = 0; i < _terms.size(); ++i) {
+            const std::pair<scalar, scalar> support = _terms.at(i).support();
+            result.first = Op::min(result.first, support.first);
+            result.second = Op::max(result.second, support.second);
+        }
+        return result;
+    }
+
     Aggregated* Aggregated::clone() const {
         return new Aggregated(*this);
     }
@@ -190,6 +334,7 @@ namespace fuzzylite {
 
     void Aggregated::setAggregation(SNorm* aggregation) {
         this->_aggregation.reset(aggregation);
+        synchronize();
     }
 
     SNorm* Aggregated::getAggregation() const {
@@ -202,22 +347,32 @@ namespace fuzzylite {
 
     void Aggregated::addTerm(const Term* term, scalar degree, const TNorm* implication) {
         _terms.push_back(Activated(term, degree, implication));
+        if (_synchronized)
+            accumulate(_terms.back());
+        else
+            synchronize();
         FL_DBG("Aggregating " << _terms.back().toString());
     }
 
     void Aggregated::addTerm(const Activated& term) {
         _terms.push_back(term);
+        if (_synchronized)
+            accumulate(_terms.back());
+        else
+            synchronize();
         FL_DBG("Aggregating " << _terms.back().toString());
     }
 
     const Activated& Aggregated::removeTerm(std::size_t index) {
         const Activated& term = _terms.at(index);
         _terms.erase(_terms.begin() + index);
+        synchronize();
         return term;
     }
 
     void Aggregated::clear() {
         _terms.clear();
+        synchronize();
     }
 
     const Activated& Aggregated::getTerm(std::size_t index) const {
@@ -226,6 +381,7 @@ namespace fuzzylite {
 
     void Aggregated::setTerms(const std::vector<Activated>& terms) {
         this->_terms = terms;
+        synchronize();
     }
 
     const std::vector<Activated>& Aggregated::terms() const {
@@ -233,6 +389,7 @@ namespace fuzzylite {
     }
 
     std::vector<Activated>& Aggregated::terms() {
+        _synchronized = false;
         return this->_terms;
     }
 
@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Bell.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Bell::Bell(const std::string& name, scalar center, scalar width, scalar slope, scalar height) :
@@ -32,9 +34,17 @@ namespace fuzzylite {
     }
 
     scalar Bell::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        return Term::_height * (1.0 / (1.0 + std::pow(std::abs((x - _center) / _width), 2.0 * _slope)));
+        return kernel::bell(_center, _width, _slope, Term::_height, x);
+    }
+
+    void Bell::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        const scalar height = Term::_height, center = _center, width = _width;
+        const scalar exponent = scalar(2.0) * _slope;
+        for (std::size_t i = 0; i < n; ++i) {
+            const scalar xi = x[i];
+            const scalar mu = scalar(1.0) / (scalar(1.0) + std::pow(std::abs((xi - center) / width), exponent));
+            y[i] = Op::isNaN(xi) ? fl::nan : height * mu;
+        }
     }
 
     std::string Bell::parameters() const {
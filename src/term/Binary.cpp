@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Binary.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Binary::Binary(const std::string& name, scalar start, scalar direction, scalar height) :
@@ -31,13 +33,15 @@ namespace fuzzylite {
     }
 
     scalar Binary::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        if (_direction > _start and Op::isGE(x, _start))
-            return Term::_height * 1.0;
-        if (_direction < _start and Op::isLE(x, _start))
-            return Term::_height * 1.0;
-        return Term::_height * 0.0;
+        return kernel::binary(_start, _direction, Term::_height, x);
+    }
+
+    std::pair<scalar, scalar> Binary::support() const {
+        if (_direction > _start)
+            return std::pair<scalar, scalar>(_start, fl::inf);
+        if (_direction < _start)
+            return std::pair<scalar, scalar>(-fl::inf, _start);
+        return Term::support();
     }
 
     std::string Binary::parameters() const {
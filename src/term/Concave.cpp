@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Concave.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Concave::Concave(const std::string& name, scalar inflection, scalar end, scalar height) :
@@ -31,16 +33,7 @@ namespace fuzzylite {
     }
 
     scalar Concave::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        if (Op::isLE(_inflection, _end)) {  // Concave increasing
-            if (Op::isLt(x, _end))
-                return Term::_height * (_end - _inflection) / (2.0 * _end - _inflection - x);
-        } else {  // Concave decreasing
-            if (Op::isGt(x, _end))
-                return Term::_height * (_inflection - _end) / (_inflection - 2.0 * _end + x);
-        }
-        return Term::_height * 1.0;
+        return kernel::concave(_inflection, _end, Term::_height, x);
     }
 
     scalar Concave::tsukamoto(scalar y) const {
@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Cosine.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Cosine::Cosine(const std::string& name, scalar center, scalar width, scalar height) :
@@ -52,12 +54,11 @@ namespace fuzzylite {
     }
 
     scalar Cosine::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        if (Op::isLt(x, _center - 0.5 * _width) or Op::isGt(x, _center + 0.5 * _width))
-            return Term::_height * 0.0;
-        const scalar pi = 4.0 * std::atan(1.0);
-        return Term::_height * (0.5 * (1.0 + std::cos(2.0 / _width * pi * (x - _center))));
+        return kernel::cosine(_center, _width, Term::_height, x);
+    }
+
+    std::pair<scalar, scalar> Cosine::support() const {
+        return std::pair<scalar, scalar>(_center - 0.5 * _width, _center + 0.5 * _width);
     }
 
     void Cosine::setCenter(scalar center) {
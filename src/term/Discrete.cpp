@@ -74,6 +74,16 @@ namespace fuzzylite {
                * Op::scale(x, lowerBound->first, upperBound->first, lowerBound->second, upperBound->second);
     }
 
+    std::pair<scalar, scalar> Discrete::support() const {
+        if (_xy.empty())
+            return Term::support();
+        // the membership function is constant beyond the first and last pairs
+        return std::pair<scalar, scalar>(
+            _xy.front().second == 0.0 ? _xy.front().first : -fl::inf,
+            _xy.back().second == 0.0 ? _xy.back().first : fl::inf
+        );
+    }
+
     std::string Discrete::parameters() const {
         std::vector<std::string> result;
         for (std::size_t i = 0; i < xy().size(); ++i) {
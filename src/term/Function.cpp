@@ -17,6 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Function.h"
 
+#include <cstring>
 #include <queue>
 #include <stack>
 
@@ -127,28 +128,36 @@ namespace fuzzylite {
         left(left),
         right(right),
         variable(""),
-        constant(fl::nan) {}
+        constant(fl::nan),
+        source(Map),
+        index(0) {}
 
     Function::Node::Node(const std::string& variable) :
         element(fl::null),
         left(fl::null),
         right(fl::null),
         variable(variable),
-        constant(fl::nan) {}
+        constant(fl::nan),
+        source(Map),
+        index(0) {}
 
     Function::Node::Node(scalar constant) :
         element(fl::null),
         left(fl::null),
         right(fl::null),
         variable(""),
-        constant(constant) {}
+        constant(constant),
+        source(Map),
+        index(0) {}
 
     Function::Node::Node(const Node& other) :
         element(fl::null),
         left(fl::null),
         right(fl::null),
         variable(""),
-        constant(fl::nan) {
+        constant(fl::nan),
+        source(Map),
+        index(0) {
         copyFrom(other);
     }
 
@@ -172,6 +181,8 @@ namespace fuzzylite {
             right.reset(other.right->clone());
         variable = other.variable;
         constant = other.constant;
+        source = other.source;
+        index = other.index;
     }
 
     Function::Node::~Node() {}
@@ -226,6 +237,50 @@ namespace fuzzylite {
         return result;
     }
 
+    scalar Function::Node::evaluate(
+        scalar x, const Engine* engine, const std::map<std::string, scalar>* variables, const scalar* arguments
+    ) const {
+        if (element.get()) {
+            if (element->unary) {
+                if (left.get() or right.get())
+                    return element->unary((left.get() ? left : right)->evaluate(x, engine, variables, arguments));
+                throw Exception("[function error] expected one node, but got none: " + toString());
+            }
+            if (element->binary) {
+                if (left.get() and right.get())
+                    return element->binary(
+                        left->evaluate(x, engine, variables, arguments), right->evaluate(x, engine, variables, arguments)
+                    );
+                throw Exception("[function error] expected two nodes, but got fewer: " + toString());
+            }
+            std::ostringstream ex;
+            ex << "[function error] expected a pointer to a unary or binary function in node <" << element->name
+               << ">, but got none";
+            throw Exception(ex.str(), FL_AT);
+        }
+        if (variable.empty())
+            return constant;
+        switch (source) {
+            case X:
+                return x;
+            case Input:
+                if (engine and index < engine->numberOfInputVariables())
+                    return engine->getInputVariable(index)->getValue();
+                break;
+            case Output:
+                if (engine and index < engine->numberOfOutputVariables())
+                    return engine->getOutputVariable(index)->getValue();
+                break;
+            case Argument:
+                if (arguments)
+                    return arguments[index];
+                break;
+            default:
+                break;
+        }
+        return evaluate(variables);
+    }
+
     std::size_t Function::Node::treeSize(const Node* root) const {
         if (not root)
             root = this;
@@ -319,6 +374,194 @@ namespace fuzzylite {
         return ss.str();
     }
 
+    /******************************
+     * Program Instructions
+     ******************************/
+
+    Function::Instruction::Instruction(OpCode opcode, scalar constant, std::size_t index) :
+        opcode(opcode),
+        constant(constant),
+        index(index),
+        name(""),
+        unary(fl::null),
+        binary(fl::null) {}
+
+    std::string Function::Instruction::toString() const {
+        switch (opcode) {
+            case OpConstant:
+                return Op::str(constant);
+            case OpStore:
+                return "store(" + Op::str(index) + ")";
+            case OpLoad:
+                return "load(" + Op::str(index) + ")";
+            default:
+                return name;
+        }
+    }
+
+    namespace {
+        // The stack and the temporaries of the programs have a fixed size
+        const std::size_t MaximumStackSize = 64;
+        const std::size_t None = std::size_t(-1);
+
+        // A vertex of the graph of the formula, where the equal subexpressions are the same vertex
+        struct Vertex {
+            Function::Instruction instruction;
+            std::size_t left, right;
+            std::size_t uses;
+            std::size_t temporary;
+
+            Vertex(const Function::Instruction& instruction, std::size_t left = None, std::size_t right = None) :
+                instruction(instruction),
+                left(left),
+                right(right),
+                uses(0),
+                temporary(None) {}
+
+            bool isConstant(scalar value) const {
+                return instruction.opcode == Function::Instruction::OpConstant
+                       and std::memcmp(&instruction.constant, &value, sizeof(scalar)) == 0;
+            }
+
+            bool isEquivalent(const Vertex& other) const {
+                const Function::Instruction& a = instruction;
+                const Function::Instruction& b = other.instruction;
+                return a.opcode == b.opcode and std::memcmp(&a.constant, &b.constant, sizeof(scalar)) == 0
+                       and a.index == b.index and a.name == b.name and a.unary == b.unary and a.binary == b.binary
+                       and left == other.left and right == other.right;
+            }
+        };
+
+        struct Compiler {
+            std::vector<Vertex> vertices;
+            std::vector<Function::Instruction> program;
+            std::size_t depth, maximumDepth, temporaries;
+
+            Compiler() : depth(0), maximumDepth(0), temporaries(0) {}
+
+            std::size_t add(const Vertex& vertex) {
+                for (std::size_t i = 0; i < vertices.size(); ++i) {
+                    if (vertices.at(i).isEquivalent(vertex))
+                        return i;
+                }
+                vertices.push_back(vertex);
+                return vertices.size() - 1;
+            }
+
+            std::size_t constant(scalar value) {
+                return add(Vertex(Function::Instruction(Function::Instruction::OpConstant, value)));
+            }
+
+            // Adds the vertices of the tree, folding the constants and removing the identities
+            std::size_t build(const Function::Node* node) {
+                if (const Function::Element* element = node->element.get()) {
+                    Function::Instruction instruction;
+                    instruction.name = element->name;
+                    if (element->unary) {
+                        const Function::Node* operand = node->left.get() ? node->left.get() : node->right.get();
+                        if (not operand)
+                            return None;
+                        const std::size_t a = build(operand);
+                        if (a == None)
+                            return None;
+                        if (vertices.at(a).instruction.opcode == Function::Instruction::OpConstant)
+                            return constant(element->unary(vertices.at(a).instruction.constant));
+                        instruction.opcode = Function::Instruction::OpUnary;
+                        instruction.unary = element->unary;
+                        return add(Vertex(instruction, a));
+                    }
+                    if (element->binary) {
+                        if (not(node->left.get() and node->right.get()))
+                            return None;
+                        const std::size_t a = build(node->left.get());
+                        const std::size_t b = a == None ? None : build(node->right.get());
+                        if (b == None)
+                            return None;
+                        if (vertices.at(a).instruction.opcode == Function::Instruction::OpConstant
+                            and vertices.at(b).instruction.opcode == Function::Instruction::OpConstant)
+                            return constant(
+                                element->binary(vertices.at(a).instruction.constant, vertices.at(b).instruction.constant)
+                            );
+                        // the identities hold for every value, including nan and infinity
+                        if (element->binary == &Op::multiply and vertices.at(b).isConstant(1.0))
+                            return a;
+                        if (element->binary == &Op::multiply and vertices.at(a).isConstant(1.0))
+                            return b;
+                        if (element->binary == &Op::divide and vertices.at(b).isConstant(1.0))
+                            return a;
+                        if (element->binary == &Op::subtract and vertices.at(b).isConstant(0.0))
+                            return a;
+                        instruction.opcode = Function::Instruction::OpBinary;
+                        instruction.binary = element->binary;
+                        return add(Vertex(instruction, a, b));
+                    }
+                    return None;
+                }
+                if (node->variable.empty())
+                    return constant(node->constant);
+
+                Function::Instruction instruction;
+                instruction.name = node->variable;
+                instruction.index = node->index;
+                switch (node->source) {
+                    case Function::Node::X:
+                        instruction.opcode = Function::Instruction::OpX;
+                        break;
+                    case Function::Node::Input:
+                        instruction.opcode = Function::Instruction::OpInput;
+                        break;
+                    case Function::Node::Output:
+                        instruction.opcode = Function::Instruction::OpOutput;
+                        break;
+                    case Function::Node::Argument:
+                        instruction.opcode = Function::Instruction::OpArgument;
+                        break;
+                    default:
+                        instruction.opcode = Function::Instruction::OpVariable;
+                        instruction.index = 0;
+                }
+                return add(Vertex(instruction));
+            }
+
+            // Counts the uses of the vertices reachable from the root, leaving the others dead
+            void count(std::size_t vertex) {
+                if (vertices.at(vertex).uses++ > 0)
+                    return;
+                if (vertices.at(vertex).left != None)
+                    count(vertices.at(vertex).left);
+                if (vertices.at(vertex).right != None)
+                    count(vertices.at(vertex).right);
+            }
+
+            void push(const Function::Instruction& instruction, int change) {
+                program.push_back(instruction);
+                depth += change;
+                maximumDepth = std::max(maximumDepth, depth);
+            }
+
+            // Emits the vertices in postfix order, storing the operations used more than once in temporaries
+            void emit(std::size_t index) {
+                Vertex& vertex = vertices.at(index);
+                if (vertex.temporary != None) {
+                    push(Function::Instruction(Function::Instruction::OpLoad, fl::nan, vertex.temporary), 1);
+                    return;
+                }
+                if (vertex.left == None) {
+                    push(vertex.instruction, 1);
+                    return;
+                }
+                emit(vertex.left);
+                if (vertex.right != None)
+                    emit(vertex.right);
+                push(vertex.instruction, vertex.right != None ? -1 : 0);
+                if (vertex.uses > 1) {
+                    vertex.temporary = temporaries++;
+                    push(Function::Instruction(Function::Instruction::OpStore, fl::nan, vertex.temporary), 0);
+                }
+            }
+        };
+    }
+
     /**********************************
      * Function class.
      **********************************/
@@ -333,6 +576,8 @@ namespace fuzzylite {
         _root(fl::null),
         _formula(formula),
         _engine(engine),
+        _arguments(),
+        _program(),
         variables(variables) {
         if (load)
             this->load();
@@ -342,13 +587,17 @@ namespace fuzzylite {
         Term(name),
         _root(fl::null),
         _formula(formula),
-        _engine(engine) {}
+        _engine(engine),
+        _arguments(),
+        _program() {}
 
     Function::Function(const Function& other) :
         Term(other),
         _root(fl::null),
         _formula(other._formula),
-        _engine(other._engine) {
+        _engine(other._engine),
+        _arguments(other._arguments),
+        _program(other._program) {
         if (other._root.get())
             _root.reset(other._root->clone());
         variables = other.variables;
@@ -363,6 +612,8 @@ namespace fuzzylite {
             _engine = other._engine;
             if (other._root.get())
                 _root.reset(other._root->clone());
+            _arguments = other._arguments;
+            _program = other._program;
             variables = other.variables;
         }
         return *this;
@@ -375,20 +626,68 @@ namespace fuzzylite {
     }
 
     scalar Function::membership(scalar x) const {
+        return evaluate(x, fl::null);
+    }
+
+    scalar Function::evaluate(scalar x, const scalar* arguments) const {
         if (not _root.get())
             throw Exception("[function error] function <" + _formula + "> not loaded.", FL_AT);
-        if (_engine) {
-            for (std::size_t i = 0; i < _engine->numberOfInputVariables(); ++i) {
-                InputVariable* input = _engine->getInputVariable(i);
-                this->variables[input->getName()] = input->getValue();
-            }
-            for (std::size_t i = 0; i < _engine->numberOfOutputVariables(); ++i) {
-                OutputVariable* output = _engine->getOutputVariable(i);
-                this->variables[output->getName()] = output->getValue();
+        if (_program.empty())
+            return _root->evaluate(x, _engine, &this->variables, arguments);
+
+        scalar stack[MaximumStackSize];
+        scalar temporaries[MaximumStackSize];
+        std::size_t top = 0;
+        for (std::size_t i = 0; i < _program.size(); ++i) {
+            const Instruction& instruction = _program[i];
+            switch (instruction.opcode) {
+                case Instruction::OpConstant:
+                    stack[top++] = instruction.constant;
+                    break;
+                case Instruction::OpX:
+                    stack[top++] = x;
+                    break;
+                case Instruction::OpInput:
+                    if (_engine and instruction.index < _engine->numberOfInputVariables()) {
+                        stack[top++] = _engine->getInputVariable(instruction.index)->getValue();
+                        break;
+                    }
+                    stack[top++] = Node(instruction.name).evaluate(&this->variables);
+                    break;
+                case Instruction::OpOutput:
+                    if (_engine and instruction.index < _engine->numberOfOutputVariables()) {
+                        stack[top++] = _engine->getOutputVariable(instruction.index)->getValue();
+                        break;
+                    }
+                    stack[top++] = Node(instruction.name).evaluate(&this->variables);
+                    break;
+                case Instruction::OpArgument:
+                    stack[top++] = arguments ? arguments[instruction.index]
+                                             : Node(instruction.name).evaluate(&this->variables);
+                    break;
+                case Instruction::OpVariable: {
+                    std::map<std::string, scalar>::const_iterator it = variables.find(instruction.name);
+                    if (it == variables.end())
+                        throw Exception("[function error] unknown variable <" + instruction.name + ">", FL_AT);
+                    stack[top++] = it->second;
+                    break;
+                }
+                case Instruction::OpUnary:
+                    stack[top - 1] = instruction.unary(stack[top - 1]);
+                    break;
+                case Instruction::OpBinary:
+                    --top;
+                    stack[top - 1] = instruction.binary(stack[top - 1], stack[top]);
+                    break;
+                case Instruction::OpStore:
+                    temporaries[instruction.index] = stack[top - 1];
+                    break;
+                case Instruction::OpLoad:
+                    stack[top++] = temporaries[instruction.index];
+                    break;
             }
         }
-        this->variables["x"] = x;
-        return this->evaluate(&this->variables);
+        return stack[0];
     }
 
     scalar Function::evaluate(const std::map<std::string, scalar>& localVariables) const {
@@ -426,6 +725,7 @@ namespace fuzzylite {
 
     void Function::unload() {
         this->_root.reset(fl::null);
+        this->_program.clear();
         this->variables.clear();
     }
 
@@ -441,6 +741,8 @@ namespace fuzzylite {
         setFormula(formula);
         setEngine(engine);
         this->_root.reset(parse(formula));
+        resolve(this->_root.get());
+        compile();
         // TODO: Remove execution of membership because it does not allow to pass variables different from x
         membership(0.0);  // make sure function evaluates without throwing exception.
     }
@@ -455,16 +757,53 @@ namespace fuzzylite {
 
     void Function::setEngine(const Engine* engine) {
         this->_engine = engine;
+        if (this->_root.get()) {
+            resolve(this->_root.get());
+            compile();
+        }
     }
 
     const Engine* Function::getEngine() const {
         return this->_engine;
     }
 
+    void Function::setArguments(const std::vector<std::string>& arguments) {
+        this->_arguments = arguments;
+        if (this->_root.get()) {
+            resolve(this->_root.get());
+            compile();
+        }
+    }
+
+    const std::vector<std::string>& Function::getArguments() const {
+        return this->_arguments;
+    }
+
     Function::Node* Function::root() const {
         return this->_root.get();
     }
 
+    const std::vector<Function::Instruction>& Function::program() const {
+        return this->_program;
+    }
+
+    bool Function::compile() {
+        _program.clear();
+        if (not _root.get())
+            return false;
+        Compiler compiler;
+        const std::size_t root = compiler.build(_root.get());
+        if (root == None)
+            return false;
+        compiler.count(root);
+        compiler.emit(root);
+        // formulas that cannot be compiled, or do not fit in the stack, are evaluated on the tree
+        if (compiler.maximumDepth > MaximumStackSize or compiler.temporaries > MaximumStackSize)
+            return false;
+        _program = compiler.program;
+        return true;
+    }
+
     Function* Function::clone() const {
         return new Function(*this);
     }
@@ -499,6 +838,45 @@ namespace fuzzylite {
         return result;
     }
 
+    void Function::resolve(Node* node) const {
+        if (not node)
+            return;
+        resolve(node->left.get());
+        resolve(node->right.get());
+        if (node->variable.empty())
+            return;
+        node->source = Node::Map;
+        node->index = 0;
+        for (std::size_t i = 0; i < _arguments.size(); ++i) {
+            if (_arguments.at(i) == node->variable) {
+                node->source = Node::Argument;
+                node->index = i;
+                return;
+            }
+        }
+        if (node->variable == "x") {
+            node->source = Node::X;
+            return;
+        }
+        if (not _engine)
+            return;
+        // the last variable with the name takes precedence, as when the values were loaded into the map
+        for (std::size_t i = _engine->numberOfOutputVariables(); i > 0; --i) {
+            if (_engine->getOutputVariable(i - 1)->getName() == node->variable) {
+                node->source = Node::Output;
+                node->index = i - 1;
+                return;
+            }
+        }
+        for (std::size_t i = _engine->numberOfInputVariables(); i > 0; --i) {
+            if (_engine->getInputVariable(i - 1)->getName() == node->variable) {
+                node->source = Node::Input;
+                node->index = i - 1;
+                return;
+            }
+        }
+    }
+
     /****************************************
      * The Glorious Parser
      * Shunting-yard algorithm
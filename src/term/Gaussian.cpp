@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Gaussian.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Gaussian::Gaussian(const std::string& name, scalar mean, scalar standardDeviation, scalar height) :
@@ -31,9 +33,14 @@ namespace fuzzylite {
     }
 
     scalar Gaussian::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        return Term::_height * std::exp((-(x - _mean) * (x - _mean)) / (2.0 * _standardDeviation * _standardDeviation));
+        return kernel::gaussian(_mean, _standardDeviation, Term::_height, x);
+    }
+
+    void Gaussian::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        const scalar height = Term::_height, mean = _mean;
+        const scalar variance = scalar(2.0) * _standardDeviation * _standardDeviation;
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = height * std::exp((-(x[i] - mean) * (x[i] - mean)) / variance);
     }
 
     std::string Gaussian::parameters() const {
@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/GaussianProduct.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     GaussianProduct::GaussianProduct(
@@ -40,16 +42,23 @@ namespace fuzzylite {
     }
 
     scalar GaussianProduct::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-
-        scalar a = 1.0, b = 1.0;
-        if (Op::isLt(x, _meanA))
-            a = std::exp((-(x - _meanA) * (x - _meanA)) / (2.0 * _standardDeviationA * _standardDeviationA));
-        if (Op::isGt(x, _meanB))
-            b = std::exp((-(x - _meanB) * (x - _meanB)) / (2.0 * _standardDeviationB * _standardDeviationB));
+        return kernel::gaussianProduct(_meanA, _standardDeviationA, _meanB, _standardDeviationB, Term::_height, x);
+    }
 
-        return Term::_height * a * b;
+    void GaussianProduct::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        const scalar macheps = fuzzylite::macheps();
+        const scalar height = Term::_height, meanA = _meanA, meanB = _meanB;
+        const scalar varianceA = scalar(2.0) * _standardDeviationA * _standardDeviationA;
+        const scalar varianceB = scalar(2.0) * _standardDeviationB * _standardDeviationB;
+        for (std::size_t i = 0; i < n; ++i) {
+            const scalar xi = x[i];
+            scalar a = 1.0, b = 1.0;
+            if (Op::isLt(xi, meanA, macheps))
+                a = std::exp((-(xi - meanA) * (xi - meanA)) / varianceA);
+            if (Op::isGt(xi, meanB, macheps))
+                b = std::exp((-(xi - meanB) * (xi - meanB)) / varianceB);
+            y[i] = Op::isNaN(xi) ? fl::nan : height * a * b;
+        }
     }
 
     std::string GaussianProduct::parameters() const {
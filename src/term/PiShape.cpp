@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/PiShape.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     PiShape::PiShape(
@@ -35,30 +37,46 @@ namespace fuzzylite {
     }
 
     scalar PiShape::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-
-        scalar sshape;
-        if (Op::isLE(x, _bottomLeft))
-            sshape = 0.0;
-        else if (Op::isLE(x, 0.5 * (_bottomLeft + _topLeft)))
-            sshape = 2.0 * std::pow((x - _bottomLeft) / (_topLeft - _bottomLeft), 2);
-        else if (Op::isLt(x, _topLeft))
-            sshape = 1.0 - 2.0 * std::pow((x - _topLeft) / (_topLeft - _bottomLeft), 2);
-        else
-            sshape = 1.0;
-
-        scalar zshape;
-        if (Op::isLE(x, _topRight))
-            zshape = 1.0;
-        else if (Op::isLE(x, 0.5 * (_topRight + _bottomRight)))
-            zshape = 1.0 - 2.0 * std::pow((x - _topRight) / (_bottomRight - _topRight), 2);
-        else if (Op::isLt(x, _bottomRight))
-            zshape = 2.0 * std::pow((x - _bottomRight) / (_bottomRight - _topRight), 2);
-        else
-            zshape = 0.0;
-
-        return Term::_height * sshape * zshape;
+        return kernel::piShape(_bottomLeft, _topLeft, _topRight, _bottomRight, Term::_height, x);
+    }
+
+    void PiShape::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        const scalar macheps = fuzzylite::macheps();
+        const scalar height = Term::_height;
+        const scalar bottomLeft = _bottomLeft, topLeft = _topLeft, topRight = _topRight, bottomRight = _bottomRight;
+        const scalar middleLeft = scalar(0.5) * (bottomLeft + topLeft);
+        const scalar middleRight = scalar(0.5) * (topRight + bottomRight);
+        const scalar rangeLeft = topLeft - bottomLeft;
+        const scalar rangeRight = bottomRight - topRight;
+        for (std::size_t i = 0; i < n; ++i) {
+            const scalar xi = x[i];
+
+            scalar sshape;
+            if (Op::isLE(xi, bottomLeft, macheps))
+                sshape = 0.0;
+            else if (Op::isLE(xi, middleLeft, macheps))
+                sshape = scalar(2.0) * std::pow((xi - bottomLeft) / rangeLeft, 2);
+            else if (Op::isLt(xi, topLeft, macheps))
+                sshape = scalar(1.0) - scalar(2.0) * std::pow((xi - topLeft) / rangeLeft, 2);
+            else
+                sshape = 1.0;
+
+            scalar zshape;
+            if (Op::isLE(xi, topRight, macheps))
+                zshape = 1.0;
+            else if (Op::isLE(xi, middleRight, macheps))
+                zshape = scalar(1.0) - scalar(2.0) * std::pow((xi - topRight) / rangeRight, 2);
+            else if (Op::isLt(xi, bottomRight, macheps))
+                zshape = scalar(2.0) * std::pow((xi - bottomRight) / rangeRight, 2);
+            else
+                zshape = 0.0;
+
+            y[i] = Op::isNaN(xi) ? fl::nan : height * sshape * zshape;
+        }
+    }
+
+    std::pair<scalar, scalar> PiShape::support() const {
+        return std::pair<scalar, scalar>(_bottomLeft, _bottomRight);
     }
 
     std::string PiShape::parameters() const {
@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Ramp.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Ramp::Ramp(const std::string& name, scalar start, scalar end, scalar height) :
@@ -31,22 +33,22 @@ namespace fuzzylite {
     }
 
     scalar Ramp::membership(scalar x) const {
-        if (Op::isNaN(x) or Op::isEq(_start, _end))
-            return fl::nan;
-
-        if (Op::isLt(_start, _end)) {
-            if (Op::isLE(x, _start))
-                return Term::_height * 0.0;
-            if (Op::isGE(x, _end))
-                return Term::_height * 1.0;
-            return Term::_height * (x - _start) / (_end - _start);
-        } else {
-            if (Op::isGE(x, _start))
-                return Term::_height * 0.0;
-            if (Op::isLE(x, _end))
-                return Term::_height * 1.0;
-            return Term::_height * (_start - x) / (_start - _end);
-        }
+        return kernel::ramp(_start, _end, Term::_height, x);
+    }
+
+    void Ramp::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        // the kernel is shared with membership(), so both compute the same values
+        const scalar height = Term::_height, start = _start, end = _end;
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = kernel::ramp(start, end, height, x[i]);
+    }
+
+    std::pair<scalar, scalar> Ramp::support() const {
+        if (Op::isLt(_start, _end))
+            return std::pair<scalar, scalar>(_start, fl::inf);
+        if (Op::isGt(_start, _end))
+            return std::pair<scalar, scalar>(-fl::inf, _start);
+        return Term::support();
     }
 
     scalar Ramp::tsukamoto(scalar y) const {
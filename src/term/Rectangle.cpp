@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Rectangle.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Rectangle::Rectangle(const std::string& name, scalar start, scalar end, scalar height) :
@@ -31,11 +33,11 @@ namespace fuzzylite {
     }
 
     scalar Rectangle::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        if (Op::isGE(x, _start) and Op::isLE(x, _end))
-            return Term::_height * 1.0;
-        return Term::_height * 0.0;
+        return kernel::rectangle(_start, _end, Term::_height, x);
+    }
+
+    std::pair<scalar, scalar> Rectangle::support() const {
+        return std::pair<scalar, scalar>(_start, _end);
     }
 
     std::string Rectangle::parameters() const {
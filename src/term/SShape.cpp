@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/SShape.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     SShape::SShape(const std::string& name, scalar start, scalar end, scalar height) :
@@ -31,19 +33,18 @@ namespace fuzzylite {
     }
 
     scalar SShape::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-
-        if (Op::isLE(x, _start))
-            return Term::_height * 0.0;
-
-        if (Op::isLE(x, 0.5 * (_start + _end)))
-            return Term::_height * (2.0 * std::pow((x - _start) / (_end - _start), 2));
+        return kernel::sShape(_start, _end, Term::_height, x);
+    }
 
-        if (Op::isLt(x, _end))
-            return Term::_height * (1.0 - 2.0 * std::pow((x - _end) / (_end - _start), 2));
+    void SShape::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        // the kernel is shared with membership(), so both compute the same values
+        const scalar height = Term::_height, start = _start, end = _end;
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = kernel::sShape(start, end, height, x[i]);
+    }
 
-        return Term::_height * 1.0;
+    std::pair<scalar, scalar> SShape::support() const {
+        return std::pair<scalar, scalar>(_start, fl::inf);
     }
 
     scalar SShape::tsukamoto(scalar y) const {
@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Sigmoid.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Sigmoid::Sigmoid(const std::string& name, scalar inflection, scalar slope, scalar height) :
@@ -31,9 +33,13 @@ namespace fuzzylite {
     }
 
     scalar Sigmoid::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        return Term::_height * 1.0 / (1.0 + std::exp(-_slope * (x - _inflection)));
+        return kernel::sigmoid(_inflection, _slope, Term::_height, x);
+    }
+
+    void Sigmoid::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        const scalar height = Term::_height, inflection = _inflection, slope = _slope;
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = height / (scalar(1.0) + std::exp(-slope * (x[i] - inflection)));
     }
 
     scalar Sigmoid::tsukamoto(scalar y) const {
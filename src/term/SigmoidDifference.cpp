@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/SigmoidDifference.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     SigmoidDifference::SigmoidDifference(
@@ -35,12 +37,7 @@ namespace fuzzylite {
     }
 
     scalar SigmoidDifference::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-
-        const scalar a = 1.0 / (1.0 + std::exp(-_rising * (x - _left)));
-        const scalar b = 1.0 / (1.0 + std::exp(-_falling * (x - _right)));
-        return Term::_height * std::abs(a - b);
+        return kernel::sigmoidDifference(_left, _rising, _falling, _right, Term::_height, x);
     }
 
     std::string SigmoidDifference::parameters() const {
@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/SigmoidProduct.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     SigmoidProduct::SigmoidProduct(
@@ -35,11 +37,7 @@ namespace fuzzylite {
     }
 
     scalar SigmoidProduct::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        const scalar a = 1.0 + std::exp(-_rising * (x - _left));
-        const scalar b = 1.0 + std::exp(-_falling * (x - _right));
-        return Term::_height * 1.0 / (a * b);
+        return kernel::sigmoidProduct(_left, _rising, _falling, _right, Term::_height, x);
     }
 
     std::string SigmoidProduct::parameters() const {
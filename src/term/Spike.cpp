@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Spike.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Spike::Spike(const std::string& name, scalar center, scalar width, scalar height) :
@@ -31,9 +33,7 @@ namespace fuzzylite {
     }
 
     scalar Spike::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-        return Term::_height * std::exp(-std::abs(10.0 / _width * (x - _center)));
+        return kernel::spike(_center, _width, Term::_height, x);
     }
 
     std::string Spike::parameters() const {
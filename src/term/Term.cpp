@@ -17,6 +17,7 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Term.h"
 
+#include "fuzzylite/NameIndex.h"
 #include "fuzzylite/imex/FllExporter.h"
 #include "fuzzylite/term/Function.h"
 #include "fuzzylite/term/Linear.h"
@@ -28,6 +29,8 @@ namespace fuzzylite {
     Term::~Term() {}
 
     void Term::setName(const std::string& name) {
+        if (not this->_name.empty() and name != this->_name)
+            NameIndex::componentRenamed();
         this->_name = name;
     }
 
@@ -57,6 +60,15 @@ namespace fuzzylite {
         throw fl::Exception("[tsukamoto error] the term does not support Tsukamoto: " + toString());
     }
 
+    void Term::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = membership(x[i]);
+    }
+
+    std::pair<scalar, scalar> Term::support() const {
+        return std::pair<scalar, scalar>(-fl::inf, fl::inf);
+    }
+
     bool Term::isMonotonic() const {
         return false;
     }
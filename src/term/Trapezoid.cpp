@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Trapezoid.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Trapezoid::Trapezoid(
@@ -42,29 +44,18 @@ namespace fuzzylite {
     }
 
     scalar Trapezoid::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-
-        if (Op::isLt(x, _vertexA) or Op::isGt(x, _vertexD))
-            return Term::_height * 0.0;
-
-        if (Op::isLt(x, _vertexB)) {
-            if (_vertexA == -fl::inf)
-                return Term::_height * 1.0;
-            return Term::_height * Op::min(scalar(1.0), (x - _vertexA) / (_vertexB - _vertexA));
-        }
-        if (Op::isLE(x, _vertexC))
-            return Term::_height * 1.0;
+        return kernel::trapezoid(_vertexA, _vertexB, _vertexC, _vertexD, Term::_height, x);
+    }
 
-        if (Op::isLt(x, _vertexD)) {
-            if (_vertexD == fl::inf)
-                return Term::_height * 1.0;
-            return Term::_height * (_vertexD - x) / (_vertexD - _vertexC);
-        }
+    void Trapezoid::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        // the kernel is shared with membership(), so both compute the same values
+        const scalar height = Term::_height, a = _vertexA, b = _vertexB, c = _vertexC, d = _vertexD;
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = kernel::trapezoid(a, b, c, d, height, x[i]);
+    }
 
-        if (_vertexD == fl::inf)
-            return Term::_height * 1.0;
-        return Term::_height * 0.0;
+    std::pair<scalar, scalar> Trapezoid::support() const {
+        return std::pair<scalar, scalar>(_vertexA, _vertexD);
     }
 
     std::string Trapezoid::parameters() const {
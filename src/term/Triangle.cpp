@@ -17,6 +17,8 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 
 #include "fuzzylite/term/Triangle.h"
 
+#include "fuzzylite/Kernels.h"
+
 namespace fuzzylite {
 
     Triangle::Triangle(const std::string& name, scalar vertexA, scalar vertexB, scalar vertexC, scalar height) :
@@ -37,23 +39,18 @@ namespace fuzzylite {
     }
 
     scalar Triangle::membership(scalar x) const {
-        if (Op::isNaN(x))
-            return fl::nan;
-
-        if (Op::isLt(x, _vertexA) or Op::isGt(x, _vertexC))
-            return Term::_height * 0.0;
+        return kernel::triangle(_vertexA, _vertexB, _vertexC, Term::_height, x);
+    }
 
-        if (Op::isEq(x, _vertexB))
-            return Term::_height * 1.0;
+    void Triangle::membershipBatch(const scalar* x, scalar* y, std::size_t n) const {
+        // the kernel is shared with membership(), so both compute the same values
+        const scalar height = Term::_height, a = _vertexA, b = _vertexB, c = _vertexC;
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = kernel::triangle(a, b, c, height, x[i]);
+    }
 
-        if (Op::isLt(x, _vertexB)) {
-            if (_vertexA == -fl::inf)
-                return Term::_height * 1.0;
-            return Term::_height * (x - _vertexA) / (_vertexB - _vertexA);
-        }
-        if (_vertexC == fl::inf)
-            return Term::_height * 1.0;
-        return Term::_height * (_vertexC - x) / (_vertexC - _vertexB);
+    std::pair<scalar, scalar> Triangle::support() const {
+        return std::pair<scalar, scalar>(_vertexA, _vertexC);
     }
 
     std::string Triangle::parameters() const {
@@ -18,14 +18,69 @@ fuzzylite is a registered trademark of FuzzyLite Limited.
 #include "fuzzylite/variable/InputVariable.h"
 
 #include "fuzzylite/imex/FllExporter.h"
+#include "fuzzylite/term/Term.h"
 
 namespace fuzzylite {
 
     InputVariable::InputVariable(const std::string& name, scalar minimum, scalar maximum) :
-        Variable(name, minimum, maximum) {}
+        Variable(name, minimum, maximum),
+        _caching(false),
+        _cachedValue(fl::nan),
+        _savedMembershipCalls(0) {}
 
     InputVariable::~InputVariable() {}
 
+    void InputVariable::cacheMemberships() {
+        _caching = true;
+        _cachedValue = getValue();
+        _cachedMemberships.assign(_terms.size(), fl::nan);
+        _cached.assign(_terms.size(), false);
+    }
+
+    void InputVariable::clearMembershipCache() {
+        _caching = false;
+        _cachedMemberships.clear();
+        _cached.clear();
+    }
+
+    bool InputVariable::isCachingMemberships() const {
+        return this->_caching;
+    }
+
+    scalar InputVariable::membership(const Term* term) {
+        // the position is searched for only if the memberships are being cached
+        return membership(term, _terms.size());
+    }
+
+    scalar InputVariable::membership(const Term* term, std::size_t index) {
+        const scalar x = getValue();
+        // the cache is only valid for the value at which it started
+        if (not _caching or not(x == _cachedValue or (Op::isNaN(x) and Op::isNaN(_cachedValue))))
+            return term->membership(x);
+        if (not(index < _terms.size() and _terms[index] == term)) {
+            index = 0;
+            while (index < _terms.size() and _terms[index] != term)
+                ++index;
+        }
+        if (index < _cachedMemberships.size()) {
+            if (_cached[index]) {
+                ++_savedMembershipCalls;
+                return _cachedMemberships[index];
+            }
+            _cached[index] = true;
+            return _cachedMemberships[index] = term->membership(x);
+        }
+        return term->membership(x);
+    }
+
+    std::size_t InputVariable::getSavedMembershipCalls() const {
+        return this->_savedMembershipCalls;
+    }
+
+    void InputVariable::resetSavedMembershipCalls() {
+        this->_savedMembershipCalls = 0;
+    }
+
     std::string InputVariable::fuzzyInputValue() const {
         return fuzzify(getValue());
     }
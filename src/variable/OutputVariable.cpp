@@ -47,6 +47,7 @@ namespace fuzzylite {
 
     void OutputVariable::copyFrom(const OutputVariable& other) {
         _fuzzyOutput.reset(other._fuzzyOutput->clone());
+        _fuzzyOutput->indexTerms(_terms);
         if (other._defuzzifier.get())
             _defuzzifier.reset(other._defuzzifier->clone());
         _previousValue = other._previousValue;
@@ -73,6 +74,32 @@ namespace fuzzylite {
         _fuzzyOutput->setMaximum(maximum);
     }
 
+    void OutputVariable::addTerm(Term* term) {
+        Variable::addTerm(term);
+        _fuzzyOutput->indexTerms(_terms);
+    }
+
+    void OutputVariable::insertTerm(Term* term, std::size_t index) {
+        Variable::insertTerm(term, index);
+        _fuzzyOutput->indexTerms(_terms);
+    }
+
+    Term* OutputVariable::removeTerm(std::size_t index) {
+        Term* result = Variable::removeTerm(index);
+        _fuzzyOutput->indexTerms(_terms);
+        return result;
+    }
+
+    void OutputVariable::setTerms(const std::vector<Term*>& terms) {
+        Variable::setTerms(terms);
+        _fuzzyOutput->indexTerms(_terms);
+    }
+
+    void OutputVariable::rebuildIndex() {
+        Variable::rebuildIndex();
+        _fuzzyOutput->indexTerms(_terms);
+    }
+
     void OutputVariable::setDefuzzifier(Defuzzifier* defuzzifier) {
         this->_defuzzifier.reset(defuzzifier);
     }
@@ -59,6 +59,7 @@ namespace fuzzylite {
         _lockValueInRange = other._lockValueInRange;
         for (std::size_t i = 0; i < other._terms.size(); ++i)
             _terms.push_back(other._terms.at(i)->clone());
+        _termIndex.rebuild(_terms);
     }
 
     Variable::~Variable() {
@@ -67,6 +68,8 @@ namespace fuzzylite {
     }
 
     void Variable::setName(const std::string& name) {
+        if (not this->_name.empty() and name != this->_name)
+            NameIndex::componentRenamed();
         this->_name = name;
     }
 
@@ -223,10 +226,12 @@ namespace fuzzylite {
 
     void Variable::addTerm(Term* term) {
         _terms.push_back(term);
+        _termIndex.add(_terms);
     }
 
     void Variable::insertTerm(Term* term, std::size_t index) {
         _terms.insert(_terms.begin() + index, term);
+        _termIndex.rebuild(_terms);
     }
 
     Term* Variable::getTerm(std::size_t index) const {
@@ -234,9 +239,9 @@ namespace fuzzylite {
     }
 
     Term* Variable::getTerm(const std::string& name) const {
-        for (std::size_t i = 0; i < terms().size(); ++i)
-            if (_terms.at(i)->getName() == name)
-                return terms().at(i);
+        Term* term = _termIndex.find(_terms, name);
+        if (term)
+            return term;
         throw Exception(
             "[variable error] term <" + name
                 + "> "
@@ -247,15 +252,13 @@ namespace fuzzylite {
     }
 
     bool Variable::hasTerm(const std::string& name) const {
-        for (std::size_t i = 0; i < _terms.size(); ++i)
-            if (_terms.at(i)->getName() == name)
-                return true;
-        return false;
+        return _termIndex.find(_terms, name) != fl::null;
     }
 
     Term* Variable::removeTerm(std::size_t index) {
         Term* result = _terms.at(index);
         _terms.erase(_terms.begin() + index);
+        _termIndex.rebuild(_terms);
         return result;
     }
 
@@ -269,12 +272,17 @@ namespace fuzzylite {
 
     void Variable::setTerms(const std::vector<Term*>& terms) {
         this->_terms = terms;
+        this->_termIndex.rebuild(this->_terms);
     }
 
     std::vector<Term*>& Variable::terms() {
         return this->_terms;
     }
 
+    void Variable::rebuildIndex() {
+        _termIndex.rebuild(_terms);
+    }
+
     Variable* Variable::clone() const {
         return new Variable(*this);
     }
@@ -15,14 +15,91 @@ fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
 fuzzylite is a registered trademark of FuzzyLite Limited.
 */
 
+#include <chrono>
 #include <fstream>
 #include <typeinfo>
 #include <vector>
 
+#include "Examples.h"
 #include "Headers.h"
 
 namespace fuzzylite {
 
+    static std::string largeEngine(int rules) {
+        const int variables = 10, terms = 20;
+        std::ostringstream fll;
+        fll << "Engine: large\n";
+        for (int v = 0; v < variables; ++v) {
+            fll << "InputVariable: input" << v << "\n  range: 0.000 1.000\n";
+            for (int t = 0; t < terms; ++t)
+                fll << "  term: term" << t << " Triangle " << (t - 1.0) / terms << " " << scalar(t) / terms << " "
+                    << (t + 1.0) / terms << "\n";
+        }
+        fll << "OutputVariable: output\n  range: 0.000 1.000\n  aggregation: Maximum\n  defuzzifier: Centroid 100\n";
+        for (int t = 0; t < terms; ++t)
+            fll << "  term: term" << t << " Triangle " << (t - 1.0) / terms << " " << scalar(t) / terms << " "
+                << (t + 1.0) / terms << "\n";
+        fll << "RuleBlock: rules\n  conjunction: Minimum\n  disjunction: Maximum\n  implication: Minimum\n"
+            << "  activation: General\n";
+        unsigned long seed = 1;
+        for (int r = 0; r < rules; ++r) {
+            fll << "  rule: if";
+            for (int p = 0; p < 3; ++p) {
+                seed = (seed * 1103515245ul + 12345ul) % 2147483648ul;
+                fll << (p == 0 ? " " : (p == 1 ? " and " : " or ")) << "input" << (seed / 7) % variables
+                    << " is " << ((seed / 71) % 3 == 0 ? "very " : "") << "term" << (seed / 13) % terms;
+            }
+            fll << " then output is term" << r % terms << "\n";
+        }
+        return fll.str();
+    }
+
+    static double secondsSince(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static std::size_t loadedRules(const Engine* engine) {
+        std::size_t result = 0;
+        for (std::size_t r = 0; r < engine->getRuleBlock(0)->numberOfRules(); ++r)
+            result += engine->getRuleBlock(0)->getRule(r)->isLoaded();
+        return result;
+    }
+
+    // the timings are hidden from the default run; run them with the tag [benchmark]
+    TEST_CASE("Benchmark loads a large rule block in linear time", "[.benchmark][load]") {
+        const std::string small = largeEngine(10000);
+        const std::string large = largeEngine(100000);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        FL_unique_ptr<Engine> smallLoaded(FllImporter().fromString(small));
+        const double smallTime = secondsSince(start);
+        start = std::chrono::steady_clock::now();
+        FL_unique_ptr<Engine> largeLoaded(FllImporter().fromString(large));
+        const double largeTime = secondsSince(start);
+        FL_LOG("loading 10000 rules took " << smallTime << "s, and 100000 rules took " << largeTime << "s");
+
+        CHECK(loadedRules(smallLoaded.get()) == 10000);
+        CHECK(loadedRules(largeLoaded.get()) == 100000);
+        // ten times the rules take about ten times as long, with a generous margin for noise
+        CHECK(largeTime < 30.0 * smallTime);
+    }
+
+    TEST_CASE("Benchmark loads a large rule block faster from binary than from FLL", "[.benchmark][load][binary]") {
+        const std::string fll = largeEngine(100000);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        FL_unique_ptr<Engine> expected(FllImporter().fromString(fll));
+        const double fllTime = secondsSince(start);
+
+        const std::string binary = BinaryExporter().toString(expected.get());
+        start = std::chrono::steady_clock::now();
+        FL_unique_ptr<Engine> obtained(BinaryImporter().fromString(binary));
+        const double binaryTime = secondsSince(start);
+        FL_LOG("loading 100000 rules took " << fllTime << "s from FLL, and " << binaryTime << "s from binary");
+
+        CHECK(loadedRules(obtained.get()) == 100000);
+        CHECK(binaryTime < fllTime);
+    }
+
     TEST_CASE("Benchmarks run from Console ", "[benchmark][console]") {
         //        const char* args[] = {"dummy-command", "benchmarks", "../../examples/", "1"};
         //        Console::main(4, args);
@@ -126,9 +203,90 @@ namespace fuzzylite {
 
     TEST_CASE("Benchmark headers", "[benchmark][header]") {
         FL_LOG(Op::join(Benchmark().header(10, true), "\t"));
-        CHECK(Benchmark().header(10).size() == 30);
+        CHECK(Benchmark().header(10).size() == 31);
 
         FL_LOG(Op::join(Benchmark().header(10, false), "\t"));
-        CHECK(Benchmark().header(10, false).size() == 30 - 8);
+        CHECK(Benchmark().header(10, false).size() == 31 - 8);
+    }
+
+    TEST_CASE("Benchmark reports the samples per evaluation", "[benchmark][samples]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(
+            "Engine: SimpleDimmer\n"
+            "InputVariable: Ambient\n"
+            "  range: 0.000 1.000\n"
+            "  term: DARK Triangle 0.000 0.250 0.500\n"
+            "  term: MEDIUM Triangle 0.250 0.500 0.750\n"
+            "  term: BRIGHT Triangle 0.500 0.750 1.000\n"
+            "OutputVariable: Power\n"
+            "  range: 0.000 1.000\n"
+            "  aggregation: Maximum\n"
+            "  defuzzifier: Centroid 200\n"
+            "  term: LOW Triangle 0.000 0.250 0.500\n"
+            "  term: MEDIUM Triangle 0.250 0.500 0.750\n"
+            "  term: HIGH Triangle 0.500 0.750 1.000\n"
+            "RuleBlock: \n"
+            "  implication: Minimum\n"
+            "  activation: General\n"
+            "  rule: if Ambient is DARK then Power is HIGH\n"
+            "  rule: if Ambient is MEDIUM then Power is MEDIUM\n"
+            "  rule: if Ambient is BRIGHT then Power is LOW\n"
+        ));
+        const std::vector<std::vector<scalar> > expected = {{0.2, fl::nan}, {0.4, fl::nan}, {0.6, fl::nan}};
+        Benchmark benchmark("SimpleDimmer", engine.get());
+        benchmark.setExpected(expected);
+
+        // the samples are not counted by default
+        CHECK_FALSE(benchmark.isCountingSamples());
+        benchmark.run(1);
+        CHECK(benchmark.getSamples().empty());
+        benchmark.reset();
+
+        benchmark.setCountingSamples(true);
+        benchmark.run(2);
+        CHECK(benchmark.getSamples() == std::vector<scalar>{2 * 3 * 200});
+
+        std::map<std::string, std::string> results;
+        for (const Benchmark::Result& result : benchmark.results())
+            results[result.first] = result.second;
+        CHECK(results["samples"] == Op::str(200.0));
+
+        benchmark.reset();
+        engine->getOutputVariable(0)->setDefuzzifier(new Centroid(200, false, 1e-6));
+        benchmark.run(1);
+        REQUIRE(benchmark.getSamples().size() == 1);
+        CHECK(benchmark.getSamples().front() > 0.0);
+        CHECK(benchmark.getSamples().front() != 3 * 200);
+    }
+
+    TEST_CASE("Benchmark compares the single and double precision", "[benchmark][precision]") {
+        FL_unique_ptr<Engine> engine(loadExample("mamdani/matlab/tipper"));
+
+        Benchmark interpreted("tipper", engine.get());
+        interpreted.prepare(1024, FldExporter::AllVariables);
+        CHECK(interpreted.getEvaluation() == Benchmark::Interpreted);
+        interpreted.run(1);
+
+        Benchmark doublePrecision("tipper", engine.get());
+        doublePrecision.setExpected(interpreted.getObtained());
+        doublePrecision.setEvaluation(Benchmark::DoublePrecision);
+        doublePrecision.run(2);
+        REQUIRE(doublePrecision.canComputeErrors());
+        CHECK(doublePrecision.allErrors() == 0);
+        // the compiled engines do not count their samples
+        doublePrecision.setCountingSamples(true);
+        doublePrecision.run(1);
+        CHECK(doublePrecision.getSamples().empty());
+
+        Benchmark singlePrecision("tipper", engine.get(), 1e-4);
+        singlePrecision.setExpected(doublePrecision.getObtained());
+        singlePrecision.setEvaluation(Benchmark::SinglePrecision);
+        singlePrecision.run(2);
+        REQUIRE(singlePrecision.canComputeErrors());
+        CHECK(singlePrecision.allErrors() == 0);
+        CHECK(singlePrecision.meanSquaredError() < 1e-8);
+
+        singlePrecision.setTolerance(0.0);
+        CHECK(singlePrecision.accuracyErrors() > 0);
+        CHECK(singlePrecision.nonFiniteErrors() == 0);
     }
 }
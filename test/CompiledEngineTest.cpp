@@ -0,0 +1,369 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <typeinfo>
+#include <vector>
+
+#include "Examples.h"
+#include "Headers.h"
+
+namespace fuzzylite {
+
+    static std::vector<std::vector<scalar> > readInputs(std::istream& reader, std::size_t numberOfInputs) {
+        std::vector<std::vector<scalar> > inputs;
+        std::string line;
+        std::getline(reader, line);  // header
+        while (std::getline(reader, line)) {
+            std::istringstream tokenizer(line);
+            std::vector<scalar> row;
+            std::string token;
+            while (row.size() < numberOfInputs and tokenizer >> token)
+                row.push_back(Op::toScalar(token));
+            if (row.size() == numberOfInputs)
+                inputs.push_back(row);
+        }
+        return inputs;
+    }
+
+    static std::vector<std::vector<scalar> > readInputs(const std::string& fld, std::size_t numberOfInputs) {
+        std::ifstream reader(fld.c_str());
+        if (not reader.is_open())
+            throw Exception("File not found: " + fld);
+        return readInputs(reader, numberOfInputs);
+    }
+
+    // the inputs of the FLD file of the example, or otherwise a grid of 1024 values over the ranges of the inputs
+    static std::vector<std::vector<scalar> > inputsOf(const std::string& example, const Engine* engine) {
+        const std::string fld = examplesPath() + example + ".fld";
+        if (std::ifstream(fld.c_str()).is_open())
+            return readInputs(fld, engine->numberOfInputVariables());
+        FL_unique_ptr<Engine> grid(engine->clone());
+        FldExporter exporter;
+        exporter.setExportOutputValues(false);
+        std::istringstream reader(exporter.toString(grid.get(), 1024, FldExporter::AllVariables));
+        return readInputs(reader, engine->numberOfInputVariables());
+    }
+
+    TEST_CASE("CompiledEngine produces the same results as Engine", "[engine][compiled]") {
+        const std::vector<std::string> examples = examplesWith(".fll");
+        REQUIRE_FALSE(examples.empty());
+        CHECK(std::find(examples.begin(), examples.end(), "mamdani/matlab/tipper") != examples.end());
+        CHECK(std::find(examples.begin(), examples.end(), "original/mamdani/SimpleDimmer") != examples.end());
+        for (std::size_t i = 0; i < examples.size(); ++i) {
+            const std::string example = examples.at(i);
+            CAPTURE(example);
+            FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + example + ".fll"));
+            FL_unique_ptr<CompiledEngine> compiled(engine->compile());
+            REQUIRE(compiled->numberOfInputVariables() == engine->numberOfInputVariables());
+            REQUIRE(compiled->numberOfOutputVariables() == engine->numberOfOutputVariables());
+
+            const std::vector<std::vector<scalar> > inputs = inputsOf(example, engine.get());
+            CHECK(not inputs.empty());
+
+            std::size_t differences = 0;
+            std::string firstDifference;
+            for (std::size_t row = 0; row < inputs.size(); ++row) {
+                for (std::size_t v = 0; v < inputs.at(row).size(); ++v) {
+                    engine->getInputVariable(v)->setValue(inputs.at(row).at(v));
+                    compiled->setInputValue(v, inputs.at(row).at(v));
+                }
+                engine->process();
+                compiled->process();
+                for (std::size_t v = 0; v < engine->numberOfOutputVariables(); ++v) {
+                    const scalar expected = engine->getOutputVariable(v)->getValue();
+                    const scalar obtained = compiled->getOutputValue(v);
+                    if (not isIdentical(expected, obtained)) {
+                        if (differences++ == 0)
+                            firstDifference = "row " + Op::str(row) + ": " + engine->getOutputVariable(v)->getName()
+                                              + " expected " + Op::str(expected, 17) + " but obtained "
+                                              + Op::str(obtained, 17);
+                    }
+                }
+            }
+            CAPTURE(firstDifference);
+            CHECK(differences == 0);
+        }
+    }
+
+    TEST_CASE("BasicCompiledEngine evaluates in single and double precision", "[engine][compiled][precision]") {
+        const std::vector<std::string> examples = examplesWith(".fld");
+        for (std::size_t i = 0; i < examples.size(); ++i) {
+            const std::string example = examples.at(i);
+            CAPTURE(example);
+            const std::string fll = examplesPath() + example + ".fll";
+            FL_unique_ptr<Engine> engine(FllImporter().fromFile(fll));
+            FL_unique_ptr<BasicCompiledEngine<double> > doublePrecision(FllImporter().compileFromFile<double>(fll));
+            FL_unique_ptr<BasicCompiledEngine<float> > singlePrecision(FllImporter().compileFromFile<float>(fll));
+
+            const std::vector<std::vector<scalar> > inputs
+                = readInputs(examplesPath() + example + ".fld", engine->numberOfInputVariables());
+            std::size_t differences = 0;
+            std::size_t inaccuracies = 0;
+            for (std::size_t row = 0; row < inputs.size(); ++row) {
+                for (std::size_t v = 0; v < inputs.at(row).size(); ++v) {
+                    engine->getInputVariable(v)->setValue(inputs.at(row).at(v));
+                    doublePrecision->setInputValue(v, double(inputs.at(row).at(v)));
+                    singlePrecision->setInputValue(v, float(inputs.at(row).at(v)));
+                }
+                engine->process();
+                doublePrecision->process();
+                singlePrecision->process();
+                for (std::size_t v = 0; v < engine->numberOfOutputVariables(); ++v) {
+                    const double expected = doublePrecision->getOutputValue(v);
+                    const float obtained = singlePrecision->getOutputValue(v);
+                    if (typeid(scalar) == typeid(double))
+                        differences += not isIdentical(engine->getOutputVariable(v)->getValue(), expected);
+                    if (not(isIdentical(expected, obtained)
+                            or std::fabs(expected - obtained) <= 1e-4 * std::max(1.0, std::fabs(expected))))
+                        ++inaccuracies;
+                }
+            }
+            CHECK(differences == 0);
+            // in single precision, tsukamoto::sigmoid(y) produces infinity for values of y that round to 1.0
+            if (example.find("tsukamoto") == std::string::npos)
+                CHECK(inaccuracies == 0);
+        }
+    }
+
+    TEST_CASE("CompiledEngine is a snapshot of the engine", "[engine][compiled]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/SimpleDimmer.fll"));
+        CompiledEngine compiled(engine.get());
+        CHECK(compiled.isCompiled());
+        CHECK(compiled.getEngine() != engine.get());
+
+        engine->getInputVariable(0)->setValue(0.25);
+        engine->process();
+        const scalar expected = engine->getOutputVariable(0)->getValue();
+
+        engine->getRuleBlock(0)->setEnabled(false);
+        compiled.setInputValue(0, 0.25);
+        compiled.process();
+        CHECK(compiled.getOutputValue(0) == expected);
+
+        SECTION("input values are bounded when locked in range") {
+            compiled.setInputValue(0, 10.0);
+            CHECK(compiled.getInputValue(0) == 10.0);
+            engine->getInputVariable(0)->setLockValueInRange(true);
+            compiled.compile(engine.get());
+            compiled.setInputValue(0, 10.0);
+            CHECK(compiled.getInputValue(0) == 1.0);
+        }
+
+        SECTION("restart sets the values to nan") {
+            compiled.restart();
+            CHECK(Op::isNaN(compiled.getInputValue(0)));
+            CHECK(Op::isNaN(compiled.getOutputValue(0)));
+        }
+
+        SECTION("processing requires a compiled engine") {
+            CompiledEngine empty;
+            CHECK_FALSE(empty.isCompiled());
+            CHECK_THROWS_AS(empty.process(), Exception);
+        }
+    }
+
+    TEST_CASE("CompiledEngine reads the variables of functions from the context", "[engine][compiled][function]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(R"(Engine: functions
+InputVariable: a
+  range: 0.000 1.000
+  term: low Ramp 1.000 0.000
+  term: high Ramp 0.000 1.000
+InputVariable: b
+  range: 0.000 1.000
+  term: low Ramp 1.000 0.000
+  term: high Ramp 0.000 1.000
+OutputVariable: o
+  range: -10.000 10.000
+  default: nan
+  defuzzifier: WeightedAverage
+  term: f Function a * b + 1
+  term: g Function sin(a) - b * x
+  term: h Function (a + b) * (a + b)
+RuleBlock:
+  conjunction: Minimum
+  activation: General
+  rule: if a is low then o is f
+  rule: if b is high then o is g
+  rule: if a is high and b is low then o is h
+)"));
+        FL_unique_ptr<CompiledEngine> compiled(engine->compile());
+        for (int i = 0; i <= 10; ++i) {
+            for (int j = 0; j <= 10; ++j) {
+                engine->getInputVariable(0)->setValue(0.1 * i);
+                engine->getInputVariable(1)->setValue(0.1 * j);
+                compiled->setInputValue(0, 0.1 * i);
+                compiled->setInputValue(1, 0.1 * j);
+                engine->process();
+                compiled->process();
+                CAPTURE(i, j);
+                CHECK(isIdentical(engine->getOutputVariable(0)->getValue(), compiled->getOutputValue(0)));
+            }
+        }
+    }
+
+    TEST_CASE("CompiledEngine reproduces the activation methods", "[engine][compiled]") {
+        std::vector<Activation*> activations;
+        activations.push_back(new General);
+        activations.push_back(new First(2, 0.1));
+        activations.push_back(new Last(2, 0.1));
+        activations.push_back(new Highest(2));
+        activations.push_back(new Lowest(2));
+        activations.push_back(new Proportional);
+        activations.push_back(new Threshold(Threshold::GreaterThan, 0.3));
+
+        for (std::size_t i = 0; i < activations.size(); ++i) {
+            FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll"));
+            engine->getRuleBlock(0)->setActivation(activations.at(i));
+            CAPTURE(activations.at(i)->className());
+            FL_unique_ptr<CompiledEngine> compiled(engine->compile());
+            for (int x = 0; x <= 10; ++x) {
+                for (int y = 0; y <= 10; ++y) {
+                    engine->getInputVariable(0)->setValue(x);
+                    engine->getInputVariable(1)->setValue(y);
+                    compiled->setInputValue(0, x);
+                    compiled->setInputValue(1, y);
+                    engine->process();
+                    compiled->process();
+                    CAPTURE(x, y);
+                    CHECK(isIdentical(engine->getOutputVariable(0)->getValue(), compiled->getOutputValue(0)));
+                }
+            }
+        }
+    }
+
+    TEST_CASE("Engine processes batches of rows in both layouts", "[engine][compiled][batch]") {
+        const std::string examples[] = {"mamdani/SimpleDimmerChained", "takagi-sugeno/matlab/fpeaks", "hybrid/tipper"};
+        for (std::size_t e = 0; e < 3; ++e) {
+            CAPTURE(examples[e]);
+            FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + examples[e] + ".fll"));
+            const std::size_t numberOfInputs = engine->numberOfInputVariables();
+            const std::size_t numberOfOutputs = engine->numberOfOutputVariables();
+            const std::vector<std::vector<scalar> > inputs
+                = readInputs(examplesPath() + examples[e] + ".fld", numberOfInputs);
+            const std::size_t rows = inputs.size();
+
+            std::vector<scalar> rowMajor(rows * numberOfInputs), columnMajor(rows * numberOfInputs);
+            std::vector<scalar> expected(rows * numberOfOutputs);
+            FL_unique_ptr<Engine> sequential(engine->clone());
+            for (std::size_t r = 0; r < rows; ++r) {
+                for (std::size_t i = 0; i < numberOfInputs; ++i) {
+                    rowMajor.at(r * numberOfInputs + i) = inputs.at(r).at(i);
+                    columnMajor.at(i * rows + r) = inputs.at(r).at(i);
+                    sequential->getInputVariable(i)->setValue(inputs.at(r).at(i));
+                }
+                sequential->process();
+                for (std::size_t o = 0; o < numberOfOutputs; ++o)
+                    expected.at(r * numberOfOutputs + o) = sequential->getOutputVariable(o)->getValue();
+            }
+
+            std::vector<scalar> outputs(rows * numberOfOutputs, fl::nan);
+            FL_unique_ptr<Engine> columns(engine->clone());
+            columns->processBatch(&columnMajor.at(0), rows, &outputs.at(0), Engine::ColumnMajor);
+            std::size_t differences = 0;
+            for (std::size_t r = 0; r < rows; ++r)
+                for (std::size_t o = 0; o < numberOfOutputs; ++o)
+                    differences += not isIdentical(expected.at(r * numberOfOutputs + o), outputs.at(o * rows + r));
+            CHECK(differences == 0);
+
+            outputs.assign(rows * numberOfOutputs, fl::nan);
+            engine->processBatch(&rowMajor.at(0), rows, &outputs.at(0), Engine::RowMajor);
+            differences = 0;
+            for (std::size_t i = 0; i < outputs.size(); ++i)
+                differences += not isIdentical(expected.at(i), outputs.at(i));
+            CHECK(differences == 0);
+
+            for (std::size_t i = 0; i < numberOfInputs; ++i)
+                CHECK(isIdentical(
+                    engine->getInputVariable(i)->getValue(), sequential->getInputVariable(i)->getValue()
+                ));
+            for (std::size_t o = 0; o < numberOfOutputs; ++o) {
+                CHECK(isIdentical(
+                    engine->getOutputVariable(o)->getValue(), sequential->getOutputVariable(o)->getValue()
+                ));
+                CHECK(isIdentical(
+                    engine->getOutputVariable(o)->getPreviousValue(),
+                    sequential->getOutputVariable(o)->getPreviousValue()
+                ));
+            }
+        }
+    }
+
+    TEST_CASE("EvaluationContext keeps the state of each evaluation", "[engine][compiled][context]") {
+        const std::string examples[] = {"mamdani/SimpleDimmerChained", "takagi-sugeno/octave/heart_disease_risk"};
+        for (std::size_t e = 0; e < 2; ++e) {
+            CAPTURE(examples[e]);
+            FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + examples[e] + ".fll"));
+            const FL_unique_ptr<const CompiledEngine> compiled(engine->compile());
+            const std::vector<std::vector<scalar> > inputs
+                = readInputs(examplesPath() + examples[e] + ".fld", engine->numberOfInputVariables());
+
+            // two contexts process the rows in opposite order on the same compiled engine
+            EvaluationContext forward(compiled.get());
+            FL_unique_ptr<EvaluationContext> backward(compiled->createContext());
+            std::size_t differences = 0;
+            for (std::size_t row = 0; row < inputs.size(); ++row) {
+                const std::vector<scalar>& a = inputs.at(row);
+                const std::vector<scalar>& b = inputs.at(inputs.size() - row - 1);
+                for (std::size_t v = 0; v < a.size(); ++v) {
+                    forward.setInputValue(v, a.at(v));
+                    backward->setInputValue(v, b.at(v));
+                }
+                compiled->process(forward);
+                compiled->process(*backward);
+
+                for (std::size_t v = 0; v < a.size(); ++v)
+                    engine->getInputVariable(v)->setValue(a.at(v));
+                engine->process();
+                for (std::size_t v = 0; v < engine->numberOfOutputVariables(); ++v)
+                    differences += not isIdentical(engine->getOutputVariable(v)->getValue(), forward.getOutputValue(v));
+            }
+            CHECK(differences == 0);
+
+            EvaluationContext copy(forward);
+            CHECK(copy.getEngine() == compiled.get());
+            for (std::size_t v = 0; v < engine->numberOfOutputVariables(); ++v)
+                CHECK(isIdentical(copy.getOutputValue(v), forward.getOutputValue(v)));
+        }
+
+        SECTION("contexts are bound to their compiled engine") {
+            FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/SimpleDimmer.fll"));
+            CompiledEngine a(engine.get()), b(engine.get());
+            EvaluationContext context(&a);
+            CHECK_NOTHROW(a.process(context));
+            CHECK_THROWS_AS(b.process(context), Exception);
+        }
+
+        SECTION("contexts are invalidated when their compiled engine is compiled again") {
+            FL_unique_ptr<Engine> dimmer(FllImporter().fromFile(examplesPath() + "mamdani/SimpleDimmer.fll"));
+            FL_unique_ptr<Engine> chained(FllImporter().fromFile(examplesPath() + "mamdani/SimpleDimmerChained.fll"));
+            CompiledEngine compiled(dimmer.get());
+            FL_unique_ptr<EvaluationContext> context(compiled.createContext());
+            compiled.compile(chained.get());
+            const scalar inputs[] = {0.5};
+            scalar outputs[] = {0.0, 0.0};
+            CHECK_THROWS_WITH(compiled.process(*context), Catch::Matchers::StartsWith("[context error]"));
+            CHECK_THROWS_WITH(
+                compiled.processBatch(*context, inputs, 1, outputs), Catch::Matchers::StartsWith("[context error]")
+            );
+            context->reset(&compiled);
+            CHECK(context->numberOfOutputValues() == 2);
+            CHECK_NOTHROW(compiled.process(*context));
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <algorithm>
+
+#include "Examples.h"
+#include "Headers.h"
+
+namespace fuzzylite {
+
+    static bool referencesOf(const Engine* engine, const Expression* expression) {
+        if (expression->type() == Expression::Operator) {
+            const Operator* fuzzyOperator = static_cast<const Operator*>(expression);
+            return referencesOf(engine, fuzzyOperator->left) and referencesOf(engine, fuzzyOperator->right);
+        }
+        const Proposition* proposition = static_cast<const Proposition*>(expression);
+        const std::vector<Variable*> variables = engine->variables();
+        for (std::size_t v = 0; v < variables.size(); ++v) {
+            if (variables.at(v) == proposition->variable) {
+                const std::vector<Term*>& terms = variables.at(v)->terms();
+                return not proposition->term
+                       or std::find(terms.begin(), terms.end(), proposition->term) != terms.end();
+            }
+        }
+        return false;
+    }
+
+    class CountingInputVariable : public InputVariable {
+      public:
+        mutable int namesRead;
+
+        explicit CountingInputVariable(const std::string& name) : InputVariable(name, 0.0, 1.0), namesRead(0) {}
+
+        std::string getName() const FL_IOVERRIDE {
+            ++namesRead;
+            return InputVariable::getName();
+        }
+    };
+
+    TEST_CASE("Engine constructed with its components finds them by name using the indexes", "[engine][index]") {
+        std::vector<InputVariable*> inputVariables;
+        for (int i = 0; i < 10; ++i) {
+            inputVariables.push_back(new CountingInputVariable("i" + Op::str(i)));
+            inputVariables.back()->addTerm(new Triangle("term", 0.0, 0.5, 1.0));
+        }
+        std::vector<OutputVariable*> outputVariables;
+        outputVariables.push_back(new OutputVariable("o", 0.0, 1.0));
+        outputVariables.back()->addTerm(new Triangle("term", 0.0, 0.5, 1.0));
+        outputVariables.back()->setAggregation(new Maximum);
+        outputVariables.back()->setDefuzzifier(new Centroid);
+        std::vector<RuleBlock*> ruleBlocks;
+        ruleBlocks.push_back(new RuleBlock);
+        ruleBlocks.back()->setConjunction(new Minimum);
+        ruleBlocks.back()->setImplication(new Minimum);
+        ruleBlocks.back()->setActivation(new General);
+        ruleBlocks.back()->addRule(new Rule("if i9 is term and i0 is term then o is term"));
+
+        Engine engine("engine", "", inputVariables, outputVariables, ruleBlocks, true);
+        CHECK(engine.getRuleBlock(0)->getRule(0)->isLoaded());
+        CHECK(engine.getOutputVariable("o") == outputVariables.back());
+
+        for (std::size_t i = 0; i < inputVariables.size(); ++i)
+            static_cast<CountingInputVariable*>(inputVariables.at(i))->namesRead = 0;
+        CHECK(engine.getInputVariable("i9") == inputVariables.at(9));
+        int namesRead = 0;
+        for (std::size_t i = 0; i < inputVariables.size(); ++i)
+            namesRead += static_cast<CountingInputVariable*>(inputVariables.at(i))->namesRead;
+        CHECK(namesRead == 1);
+
+        // the names missing from the index are missing from the engine while the index is up to date
+        for (std::size_t i = 0; i < inputVariables.size(); ++i)
+            static_cast<CountingInputVariable*>(inputVariables.at(i))->namesRead = 0;
+        CHECK_FALSE(engine.hasInputVariable("missing"));
+        CHECK_THROWS_AS(engine.getInputVariable("missing"), Exception);
+        namesRead = 0;
+        for (std::size_t i = 0; i < inputVariables.size(); ++i)
+            namesRead += static_cast<CountingInputVariable*>(inputVariables.at(i))->namesRead;
+        CHECK(namesRead == 0);
+
+        // the index is out of date after a variable is renamed, until it is rebuilt
+        inputVariables.at(0)->setName("renamed");
+        CHECK(engine.getInputVariable("renamed") == inputVariables.at(0));
+        CHECK_FALSE(engine.hasInputVariable("i0"));
+        engine.rebuildIndexes();
+        for (std::size_t i = 0; i < inputVariables.size(); ++i)
+            static_cast<CountingInputVariable*>(inputVariables.at(i))->namesRead = 0;
+        CHECK_FALSE(engine.hasInputVariable("i0"));
+        namesRead = 0;
+        for (std::size_t i = 0; i < inputVariables.size(); ++i)
+            namesRead += static_cast<CountingInputVariable*>(inputVariables.at(i))->namesRead;
+        CHECK(namesRead == 0);
+    }
+
+    TEST_CASE("Engine copies the rules that reference its own variables and terms", "[engine][clone]") {
+        const std::string examples[] = {
+            "mamdani/matlab/tipper",
+            "mamdani/AllTerms",
+            "mamdani/octave/investment_portfolio",
+            "hybrid/ObstacleAvoidance",
+            "takagi-sugeno/approximation",
+            "takagi-sugeno/octave/heart_disease_risk",
+            "tsukamoto/tsukamoto",
+        };
+        for (std::size_t e = 0; e < sizeof(examples) / sizeof(examples[0]); ++e) {
+            CAPTURE(examples[e]);
+            FL_unique_ptr<Engine> expected(loadExample(examples[e]));
+            FL_unique_ptr<Engine> obtained(expected->clone());
+            CHECK(FllExporter().toString(obtained.get()) == FllExporter().toString(expected.get()));
+
+            for (std::size_t b = 0; b < obtained->numberOfRuleBlocks(); ++b) {
+                for (std::size_t r = 0; r < obtained->getRuleBlock(b)->numberOfRules(); ++r) {
+                    const Rule* rule = obtained->getRuleBlock(b)->getRule(r);
+                    REQUIRE(rule->isLoaded());
+                    CHECK(referencesOf(obtained.get(), rule->getAntecedent()->getExpression()));
+                    for (std::size_t c = 0; c < rule->getConsequent()->conclusions().size(); ++c)
+                        CHECK(referencesOf(obtained.get(), rule->getConsequent()->conclusions().at(c)));
+                    CHECK(rule->getAntecedent()->toPostfix()
+                          == expected->getRuleBlock(b)->getRule(r)->getAntecedent()->toPostfix());
+                }
+            }
+
+            for (int row = 0; row < 32; ++row) {
+                for (std::size_t v = 0; v < expected->numberOfInputVariables(); ++v) {
+                    const InputVariable* inputVariable = expected->getInputVariable(v);
+                    const scalar value = inputVariable->getMinimum() + (row / 31.0) * inputVariable->range();
+                    expected->getInputVariable(v)->setValue(value);
+                    obtained->getInputVariable(v)->setValue(value);
+                }
+                expected->process();
+                obtained->process();
+                for (std::size_t v = 0; v < expected->numberOfOutputVariables(); ++v) {
+                    CHECK(isIdentical(
+                        expected->getOutputVariable(v)->getValue(), obtained->getOutputVariable(v)->getValue()
+                    ));
+                }
+            }
+        }
+    }
+
+    TEST_CASE("Engine copies the loaded rules without parsing their text", "[engine][clone]") {
+        FL_unique_ptr<Engine> engine(loadExample("mamdani/matlab/tipper"));
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+        ruleBlock->getRule(0)->setText("not a rule");
+        ruleBlock->getRule(1)->setEnabled(false);
+        ruleBlock->getRule(2)->unload();
+
+        FL_unique_ptr<Engine> copy(engine->clone());
+        const RuleBlock* copied = copy->getRuleBlock(0);
+        CHECK(copied->getRule(0)->isLoaded());
+        CHECK(copied->getRule(0)->getText() == "not a rule");
+        CHECK(copied->getRule(0)->getAntecedent()->toPostfix() == ruleBlock->getRule(0)->getAntecedent()->toPostfix());
+        CHECK_FALSE(copied->getRule(1)->isEnabled());
+        CHECK(copied->getRule(1)->isLoaded());
+        CHECK(copied->getRule(2)->isLoaded());
+        CHECK(copied->getRule(2)->getText() == ruleBlock->getRule(2)->getText());
+
+        ruleBlock->getRule(2)->setText("if service is unknown then tip is cheap");
+        FL_unique_ptr<Engine> invalid(engine->clone());
+        CHECK_FALSE(invalid->getRuleBlock(0)->getRule(2)->isLoaded());
+        CHECK(invalid->getRuleBlock(0)->getRule(0)->isLoaded());
+    }
+
+}
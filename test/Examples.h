@@ -0,0 +1,133 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#ifndef FL_TEST_EXAMPLES_H
+#define FL_TEST_EXAMPLES_H
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fuzzylite/Headers.h"
+
+#ifdef FL_WINDOWS
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+namespace fuzzylite {
+    namespace test {
+
+        /**
+          Gets the path of the examples, relative to the directory of this file
+          @return the path of the examples, ending with a separator
+         */
+        inline std::string examplesPath() {
+            const std::string here(__FILE__);
+            std::string test;
+            std::size_t index = here.find_last_of("/\\");
+            if (index != std::string::npos)
+                test = here.substr(0, index + 1);
+            return test + "../examples/";
+        }
+
+        /**
+          Loads the engine of the example from its FLL file
+          @param example is the path of the example relative to the examples, without extension
+          @return the engine of the example
+         */
+        inline Engine* loadExample(const std::string& example) {
+            return FllImporter().fromFile(examplesPath() + example + ".fll");
+        }
+
+        /**
+          Gets the entries of the directory, and whether each entry is a directory
+         */
+        inline std::vector<std::pair<std::string, bool> > entriesOf(const std::string& directory) {
+            std::vector<std::pair<std::string, bool> > entries;
+#ifdef FL_WINDOWS
+            WIN32_FIND_DATAA entry;
+            HANDLE handle = FindFirstFileA((directory + "*").c_str(), &entry);
+            if (handle == INVALID_HANDLE_VALUE)
+                return entries;
+            do {
+                entries.push_back(std::make_pair(
+                    std::string(entry.cFileName), (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0
+                ));
+            } while (FindNextFileA(handle, &entry));
+            FindClose(handle);
+#else
+            DIR* handle = opendir(directory.c_str());
+            if (not handle)
+                return entries;
+            while (const dirent* entry = readdir(handle)) {
+                const std::string name(entry->d_name);
+                struct stat status;
+                const bool isDirectory = stat((directory + name).c_str(), &status) == 0 and S_ISDIR(status.st_mode);
+                entries.push_back(std::make_pair(name, isDirectory));
+            }
+            closedir(handle);
+#endif
+            return entries;
+        }
+
+        /**
+          Finds the examples under the directory that have a file with the extension
+          @param directory is the directory relative to the examples, ending with a separator
+          @param extension is the extension of the files, including the dot
+          @param examples is the vector where the examples are added, relative to the examples and without extension
+         */
+        inline void findExamples(
+            const std::string& directory, const std::string& extension, std::vector<std::string>& examples
+        ) {
+            const std::vector<std::pair<std::string, bool> > entries = entriesOf(examplesPath() + directory);
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                const std::string& name = entries.at(i).first;
+                if (name == "." or name == "..")
+                    continue;
+                if (entries.at(i).second)
+                    findExamples(directory + name + "/", extension, examples);
+                else if (name.size() > extension.size()
+                         and name.compare(name.size() - extension.size(), extension.size(), extension) == 0)
+                    examples.push_back(directory + name.substr(0, name.size() - extension.size()));
+            }
+        }
+
+        /**
+          Gets the examples that have a file with the extension, sorted by path
+          @param extension is the extension of the files, including the dot
+          @return the examples relative to the examples and without extension
+         */
+        inline std::vector<std::string> examplesWith(const std::string& extension) {
+            std::vector<std::string> examples;
+            findExamples("", extension, examples);
+            std::sort(examples.begin(), examples.end());
+            return examples;
+        }
+
+        /**
+          Indicates whether both values are equal or both are fl::nan
+         */
+        inline bool isIdentical(scalar a, scalar b) {
+            return a == b or (Op::isNaN(a) and Op::isNaN(b));
+        }
+    }
+}
+#endif  // FL_TEST_EXAMPLES_H
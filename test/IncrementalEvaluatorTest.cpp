@@ -0,0 +1,253 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <vector>
+
+#include "Examples.h"
+#include "Headers.h"
+
+namespace fuzzylite {
+
+    static std::size_t differences(const Engine* expected, const Engine* obtained) {
+        std::size_t result = 0;
+        for (std::size_t o = 0; o < expected->numberOfOutputVariables(); ++o) {
+            const OutputVariable* a = expected->getOutputVariable(o);
+            const OutputVariable* b = obtained->getOutputVariable(o);
+            result += not isIdentical(a->getValue(), b->getValue());
+            result += not isIdentical(a->getPreviousValue(), b->getPreviousValue());
+            result += a->fuzzyOutput()->toString() != b->fuzzyOutput()->toString();
+        }
+        for (std::size_t b = 0; b < expected->numberOfRuleBlocks(); ++b) {
+            for (std::size_t r = 0; r < expected->getRuleBlock(b)->numberOfRules(); ++r) {
+                const Rule* x = expected->getRuleBlock(b)->getRule(r);
+                const Rule* y = obtained->getRuleBlock(b)->getRule(r);
+                result += not isIdentical(x->getActivationDegree(), y->getActivationDegree());
+                result += x->isTriggered() != y->isTriggered();
+            }
+        }
+        return result;
+    }
+
+    TEST_CASE("Incremental processing produces the same results as full processing", "[engine][incremental]") {
+        const std::string examples[] = {
+            "mamdani/Laundry",
+            "mamdani/matlab/tank",
+            "mamdani/octave/investment_portfolio",
+            "mamdani/SimpleDimmerChained",
+            "takagi-sugeno/matlab/fpeaks",
+            "takagi-sugeno/octave/heart_disease_risk",
+            "hybrid/ObstacleAvoidance",
+        };
+        for (std::size_t e = 0; e < sizeof(examples) / sizeof(examples[0]); ++e) {
+            CAPTURE(examples[e]);
+            FL_unique_ptr<Engine> expected(loadExample(examples[e]));
+            FL_unique_ptr<Engine> obtained(expected->clone());
+            obtained->setIncremental(true);
+            CHECK(obtained->isIncremental());
+
+            std::size_t mismatches = 0;
+            for (std::size_t tick = 0; tick < 200; ++tick) {
+                // changes one input variable per tick, and none every fifth tick
+                if (tick % 5 != 0) {
+                    const std::size_t i = tick % expected->numberOfInputVariables();
+                    const InputVariable* input = expected->getInputVariable(i);
+                    const scalar value = input->getMinimum() + scalar((tick * 37) % 101) / 100 * input->range();
+                    expected->getInputVariable(i)->setValue(value);
+                    obtained->getInputVariable(i)->setValue(value);
+                }
+                expected->process();
+                obtained->process();
+                mismatches += differences(expected.get(), obtained.get());
+            }
+            CHECK(mismatches == 0);
+        }
+    }
+
+    TEST_CASE("Incremental processing evaluates the rules of the changed inputs", "[engine][incremental]") {
+        FL_unique_ptr<Engine> engine(loadExample("mamdani/matlab/tank"));
+        engine->setIncremental(true);
+        const IncrementalEvaluator& evaluator = engine->incrementalEvaluator();
+        engine->getInputVariable(0)->setValue(0.1);
+        engine->getInputVariable(1)->setValue(0.01);
+        engine->process();
+        CHECK(evaluator.isRecorded());
+
+        // only two rules depend on the rate of change
+        engine->getInputVariable(1)->setValue(-0.02);
+        engine->process();
+        CHECK(evaluator.numberOfEvaluatedRules() == 2);
+        engine->process();
+        CHECK(evaluator.numberOfEvaluatedRules() == 0);
+
+        // changing the rules processes the engine fully
+        engine->getRuleBlock(0)->addRule(Rule::parse("if level is high then valve is close_slow", engine.get()));
+        engine->process();
+        CHECK(evaluator.isRecorded());
+        CHECK(evaluator.numberOfEvaluatedRules() == 0);
+
+        // chained rule blocks are always processed fully
+        FL_unique_ptr<Engine> chained(loadExample("mamdani/SimpleDimmerChained"));
+        chained->setIncremental(true);
+        chained->process();
+        chained->process();
+        CHECK(chained->incrementalEvaluator().numberOfEvaluatedRules() == 0);
+
+        engine->restart();
+        CHECK_FALSE(evaluator.isRecorded());
+        engine->setIncremental(false);
+        engine->process();
+        CHECK_FALSE(evaluator.isRecorded());
+    }
+
+    TEST_CASE("Incremental processing is not affected by loading other engines", "[engine][incremental]") {
+        FL_unique_ptr<Engine> engine(loadExample("mamdani/matlab/tank"));
+        engine->setIncremental(true);
+        const IncrementalEvaluator& evaluator = engine->incrementalEvaluator();
+        engine->getInputVariable(0)->setValue(0.1);
+        engine->getInputVariable(1)->setValue(0.01);
+        engine->process();
+
+        FL_unique_ptr<Engine> other(loadExample("mamdani/matlab/tank"));
+        for (int step = 1; step <= 3; ++step) {
+            // cloning and reloading the other engine loads and unloads its rules
+            FL_unique_ptr<Engine> clone(other->clone());
+            clone->getRuleBlock(0)->reloadRules(clone.get());
+            engine->getInputVariable(1)->setValue(-0.01 * step);
+            engine->process();
+            CHECK(evaluator.numberOfEvaluatedRules() == 2);
+        }
+
+        // reloading the rules of the engine processes the engine fully
+        engine->getRuleBlock(0)->reloadRules(engine.get());
+        engine->getInputVariable(1)->setValue(0.02);
+        engine->process();
+        CHECK(evaluator.numberOfEvaluatedRules() == 0);
+        engine->getInputVariable(1)->setValue(0.01);
+        engine->process();
+        CHECK(evaluator.numberOfEvaluatedRules() == 2);
+    }
+
+    TEST_CASE("Incremental processing tracks the inputs read by the terms of the consequents", "[engine][incremental]") {
+        const std::string fll = "Engine: linear\n"
+                                "InputVariable: a\n"
+                                "  range: 0 10\n"
+                                "  term: A Ramp 0 10\n"
+                                "InputVariable: b\n"
+                                "  range: 0 10\n"
+                                "  term: B Ramp 0 10\n"
+                                "OutputVariable: z\n"
+                                "  range: -100 100\n"
+                                "  aggregation: none\n"
+                                "  defuzzifier: WeightedAverage Automatic\n"
+                                "  default: nan\n"
+                                "  term: L Linear 1 0 0\n"
+                                "RuleBlock: rules\n"
+                                "  activation: General\n"
+                                "  rule: if b is B then z is L\n";
+        FL_unique_ptr<Engine> expected(FllImporter().fromString(fll));
+        FL_unique_ptr<Engine> obtained(expected->clone());
+        obtained->setIncremental(true);
+        expected->setInputValue("b", 5.0);
+        obtained->setInputValue("b", 5.0);
+        for (int step = 1; step <= 3; ++step) {
+            // only the input variable read by the Linear term changes
+            expected->setInputValue("a", step);
+            obtained->setInputValue("a", step);
+            expected->process();
+            obtained->process();
+            CHECK(Op::isEq(obtained->getOutputValue("z"), step));
+            CHECK(Op::isEq(obtained->getOutputValue("z"), expected->getOutputValue("z")));
+        }
+        CHECK(obtained->incrementalEvaluator().numberOfEvaluatedRules() == 0);
+    }
+
+    TEST_CASE("Incremental processing tracks the components replaced in the engine", "[engine][incremental]") {
+        FL_unique_ptr<Engine> expected(loadExample("mamdani/matlab/tank"));
+        FL_unique_ptr<Engine> obtained(expected->clone());
+        obtained->setIncremental(true);
+        const std::vector<Engine*> engines = {expected.get(), obtained.get()};
+        for (Engine* engine : engines) {
+            engine->setInputValue("level", 0.1);
+            engine->setInputValue("rate", 0.01);
+            engine->process();
+        }
+
+        SECTION("the defuzzifier") {
+            for (Engine* engine : engines)
+                engine->getOutputVariable(0)->setDefuzzifier(new Bisector(200));
+        }
+        SECTION("the aggregation operator") {
+            for (Engine* engine : engines)
+                engine->getOutputVariable(0)->fuzzyOutput()->setAggregation(new AlgebraicSum);
+        }
+        SECTION("the conjunction operator") {
+            for (Engine* engine : engines)
+                engine->getRuleBlock(0)->setConjunction(new Minimum);
+        }
+        expected->process();
+        obtained->process();
+        CHECK(differences(expected.get(), obtained.get()) == 0);
+    }
+
+    TEST_CASE("Incremental processing is cleared after the changes that are not tracked", "[engine][incremental]") {
+        FL_unique_ptr<Engine> expected(loadExample("mamdani/matlab/tank"));
+        expected->getRuleBlock(0)->setConjunction(new TNormFunction("a * b"));
+        FL_unique_ptr<Engine> obtained(expected->clone());
+        obtained->setIncremental(true);
+        const std::vector<Engine*> engines = {expected.get(), obtained.get()};
+        for (Engine* engine : engines) {
+            engine->setInputValue("level", 0.1);
+            engine->setInputValue("rate", 0.01);
+            engine->process();
+        }
+        REQUIRE(differences(expected.get(), obtained.get()) == 0);
+
+        SECTION("the parameters of the terms") {
+            for (Engine* engine : engines)
+                dynamic_cast<Gaussian*>(engine->getInputVariable(0)->getTerm("okay"))->setMean(0.3);
+        }
+        SECTION("the parameters of the defuzzifiers") {
+            for (Engine* engine : engines)
+                dynamic_cast<Centroid*>(engine->getOutputVariable(0)->getDefuzzifier())->setResolution(37);
+        }
+        SECTION("the parameters of the norms") {
+            for (Engine* engine : engines)
+                dynamic_cast<TNormFunction*>(engine->getRuleBlock(0)->getConjunction())->setFormula("min(a, b)");
+        }
+        SECTION("the weights of the rules") {
+            for (Engine* engine : engines)
+                engine->getRuleBlock(0)->getRule(0)->setWeight(0.5);
+        }
+        SECTION("the enabled state of the rules") {
+            for (Engine* engine : engines)
+                engine->getRuleBlock(0)->getRule(0)->setEnabled(false);
+        }
+        SECTION("the range of the output variables") {
+            for (Engine* engine : engines)
+                engine->getOutputVariable(0)->setRange(-0.5, 0.5);
+        }
+        expected->process();
+        obtained->process();
+        // the state of the last evaluation is stale until it is cleared
+        CHECK(differences(expected.get(), obtained.get()) > 0);
+        obtained->rebuildIndexes();
+        CHECK_FALSE(obtained->incrementalEvaluator().isRecorded());
+        obtained->process();
+        CHECK(differences(expected.get(), obtained.get()) == 0);
+    }
+
+}
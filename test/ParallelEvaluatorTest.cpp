@@ -0,0 +1,114 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <vector>
+
+#include "Examples.h"
+#include "Headers.h"
+
+namespace fuzzylite {
+
+    static std::vector<scalar> gridOf(const Engine* engine, std::size_t rows) {
+        std::vector<scalar> inputs;
+        for (std::size_t r = 0; r < rows; ++r) {
+            for (std::size_t i = 0; i < engine->numberOfInputVariables(); ++i) {
+                const InputVariable* input = engine->getInputVariable(i);
+                const scalar fraction = scalar((r * (i + 3)) % 101) / 100;
+                inputs.push_back(input->getMinimum() + fraction * input->range());
+            }
+        }
+        return inputs;
+    }
+
+    static std::size_t differences(const std::vector<scalar>& a, const std::vector<scalar>& b) {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < a.size(); ++i)
+            result += not(a.at(i) == b.at(i) or (Op::isNaN(a.at(i)) and Op::isNaN(b.at(i))));
+        return result + (a.size() > b.size() ? a.size() - b.size() : b.size() - a.size());
+    }
+
+    TEST_CASE("ParallelEvaluator produces the same results as Engine", "[parallel]") {
+        const std::string examples[]
+            = {"mamdani/SimpleDimmerChained", "takagi-sugeno/matlab/fpeaks", "hybrid/ObstacleAvoidance"};
+        for (std::size_t e = 0; e < 3; ++e) {
+            CAPTURE(examples[e]);
+            FL_unique_ptr<Engine> engine(loadExample(examples[e]));
+            const std::size_t rows = 1000;
+            const std::vector<scalar> inputs = gridOf(engine.get(), rows);
+
+            std::vector<scalar> expected(rows * engine->numberOfOutputVariables());
+            FL_unique_ptr<Engine>(engine->clone())->processBatch(&inputs.at(0), rows, &expected.at(0));
+
+            for (std::size_t threads = 1; threads <= 4; ++threads) {
+                CAPTURE(threads);
+                std::vector<scalar> obtained(expected.size(), fl::nan);
+                ParallelEvaluator(threads, 37).process(engine.get(), &inputs.at(0), rows, &obtained.at(0));
+                CHECK(differences(expected, obtained) == 0);
+            }
+        }
+    }
+
+    TEST_CASE("ParallelEvaluator is deterministic regardless of the number of threads", "[parallel]") {
+        FL_unique_ptr<Engine> engine(loadExample("mamdani/SimpleDimmer"));
+        engine->getOutputVariable(0)->setLockPreviousValue(true);
+        FL_unique_ptr<CompiledEngine> compiled(engine->compile());
+        const std::size_t rows = 500;
+        std::vector<scalar> inputs = gridOf(engine.get(), rows);
+        for (std::size_t r = 0; r < rows; r += 3)
+            inputs.at(r) = fl::nan;  // falls back to the previous value
+
+        std::vector<scalar> expected(rows, fl::nan);
+        ParallelEvaluator(1, 16).process(compiled.get(), &inputs.at(0), rows, &expected.at(0));
+        for (std::size_t threads = 2; threads <= 8; threads *= 2) {
+            CAPTURE(threads);
+            std::vector<scalar> obtained(rows, fl::nan);
+            ParallelEvaluator(threads, 16).process(compiled.get(), &inputs.at(0), rows, &obtained.at(0));
+            CHECK(differences(expected, obtained) == 0);
+        }
+
+        SECTION("rows of vectors") {
+            std::vector<std::vector<scalar> > inputRows, outputRows;
+            for (std::size_t r = 0; r < rows; ++r)
+                inputRows.push_back(std::vector<scalar>(1, inputs.at(r)));
+            ParallelEvaluator(4, 16).process(engine.get(), inputRows, outputRows);
+            REQUIRE(outputRows.size() == rows);
+            std::vector<scalar> obtained;
+            for (std::size_t r = 0; r < rows; ++r)
+                obtained.push_back(outputRows.at(r).at(0));
+            CHECK(differences(expected, obtained) == 0);
+        }
+
+        SECTION("column major") {
+            std::vector<scalar> obtained(rows, fl::nan);
+            // a single input and output variable has the same layout in both cases
+            ParallelEvaluator(4, 16).process(compiled.get(), &inputs.at(0), rows, &obtained.at(0), Engine::ColumnMajor);
+            CHECK(differences(expected, obtained) == 0);
+        }
+    }
+
+    TEST_CASE("ParallelEvaluator rethrows the exception of the first row that fails", "[parallel]") {
+        FL_unique_ptr<Engine> engine(loadExample("mamdani/SimpleDimmer"));
+        engine->getOutputVariable(0)->setDefuzzifier(fl::null);
+        const std::size_t rows = 100;
+        const std::vector<scalar> inputs = gridOf(engine.get(), rows);
+        std::vector<scalar> outputs(rows, 0.0);
+        CHECK_THROWS_AS(ParallelEvaluator(4, 10).process(engine.get(), &inputs.at(0), rows, &outputs.at(0)), Exception);
+        for (std::size_t c = 0; c < rows; c += 10)
+            CHECK(Op::isNaN(outputs.at(c)));
+    }
+
+}
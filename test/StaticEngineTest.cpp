@@ -0,0 +1,284 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <vector>
+
+#include "Examples.h"
+#include "Headers.h"
+
+namespace fuzzylite {
+
+    namespace {
+        using statics::Value;
+
+        typedef statics::Triangle<Value<0>, Value<25, 100>, Value<50, 100> > Low;
+        typedef statics::Triangle<Value<25, 100>, Value<50, 100>, Value<75, 100> > Medium;
+        typedef statics::Triangle<Value<50, 100>, Value<75, 100>, Value<1> > High;
+
+        // examples/mamdani/SimpleDimmer.fll
+        template <typename Defuzzifier>
+        struct SimpleDimmer {
+            typedef statics::StaticEngine<
+                statics::Inputs<statics::Input<Low, Medium, High> >,
+                statics::Outputs<
+                    statics::Output<Value<0>, Value<1>, Defuzzifier, statics::Maximum, Low, Medium, High> >,
+                statics::Rules<
+                    statics::None,
+                    statics::None,
+                    statics::Minimum,
+                    statics::General,
+                    statics::Rule<statics::Is<0, 0>, statics::Then<0, 2> >,
+                    statics::Rule<statics::Is<0, 1>, statics::Then<0, 1> >,
+                    statics::Rule<statics::Is<0, 2>, statics::Then<0, 0> > > >
+                type;
+        };
+
+        typedef statics::Trapezoid<Value<0>, Value<1>, Value<3>, Value<7> > Bad;
+        typedef statics::Trapezoid<Value<3>, Value<7>, Value<10>, Value<11> > Good;
+
+        // examples/takagi-sugeno/octave/linear_tip_calculator.fll
+        template <typename Defuzzifier>
+        struct LinearTipCalculator {
+            typedef statics::StaticEngine<
+                statics::Inputs<statics::Input<Bad, Good>, statics::Input<Bad, Good> >,
+                statics::Outputs<statics::Output<
+                    Value<10>,
+                    Value<20>,
+                    Defuzzifier,
+                    statics::None,
+                    statics::Linear<Value<0>, Value<0>, Value<10> >,
+                    statics::Linear<Value<0>, Value<0>, Value<15> >,
+                    statics::Linear<Value<0>, Value<0>, Value<20> > > >,
+                statics::Rules<
+                    statics::Minimum,
+                    statics::None,
+                    statics::None,
+                    statics::General,
+                    statics::Rule<statics::And<statics::Is<0, 0>, statics::Is<1, 0> >, statics::Then<0, 0> >,
+                    statics::Rule<statics::And<statics::Is<0, 0>, statics::Is<1, 1> >, statics::Then<0, 1> >,
+                    statics::Rule<statics::And<statics::Is<0, 1>, statics::Is<1, 0> >, statics::Then<0, 1> >,
+                    statics::Rule<statics::And<statics::Is<0, 1>, statics::Is<1, 1> >, statics::Then<0, 2> > > >
+                type;
+        };
+
+        const char* hybrid = "Engine: hybrid\n"
+                             "InputVariable: a\n"
+                             "  range: 0.000 1.000\n"
+                             "  term: low Ramp 1.000 0.000\n"
+                             "  term: high Ramp 0.000 1.000\n"
+                             "  term: mid Gaussian 0.500 0.200\n"
+                             "InputVariable: b\n"
+                             "  range: 0.000 1.000\n"
+                             "  term: low ZShape 0.000 1.000\n"
+                             "  term: high SShape 0.000 1.000\n"
+                             "OutputVariable: y\n"
+                             "  range: 0.000 1.000\n"
+                             "  aggregation: AlgebraicSum\n"
+                             "  defuzzifier: MeanOfMaximum 100\n"
+                             "  term: small Triangle 0.000 0.250 0.500\n"
+                             "  term: medium Bell 0.500 0.250 3.000\n"
+                             "  term: large Trapezoid 0.500 0.750 1.000 1.000 0.800\n"
+                             "OutputVariable: z\n"
+                             "  range: 0.000 10.000\n"
+                             "  aggregation: Maximum\n"
+                             "  defuzzifier: WeightedAverage TakagiSugeno\n"
+                             "  term: c Constant 2.000\n"
+                             "  term: l Linear 1.000 2.000 3.000\n"
+                             "RuleBlock: first\n"
+                             "  conjunction: AlgebraicProduct\n"
+                             "  disjunction: Maximum\n"
+                             "  implication: Minimum\n"
+                             "  activation: General\n"
+                             "  rule: if a is very low or b is not high then y is small\n"
+                             "  rule: if a is mid and b is somewhat high then y is medium and z is c\n"
+                             "  rule: if a is extremely high then y is large and z is very l\n"
+                             "RuleBlock: second\n"
+                             "  conjunction: Minimum\n"
+                             "  disjunction: BoundedSum\n"
+                             "  implication: AlgebraicProduct\n"
+                             "  activation: Highest 2\n"
+                             "  rule: if a is seldom low then y is large\n"
+                             "  rule: if b is low or a is high then z is l\n";
+
+        template <typename Activation>
+        struct Hybrid {
+            typedef statics::StaticEngine<
+                statics::Inputs<
+                    statics::Input<
+                        statics::Ramp<Value<1>, Value<0> >,
+                        statics::Ramp<Value<0>, Value<1> >,
+                        statics::Gaussian<Value<5, 10>, Value<2, 10> > >,
+                    statics::Input<statics::ZShape<Value<0>, Value<1> >, statics::SShape<Value<0>, Value<1> > > >,
+                statics::Outputs<
+                    statics::Output<
+                        Value<0>,
+                        Value<1>,
+                        statics::MeanOfMaximum<100>,
+                        statics::AlgebraicSum,
+                        statics::Triangle<Value<0>, Value<25, 100>, Value<50, 100> >,
+                        statics::Bell<Value<5, 10>, Value<25, 100>, Value<3> >,
+                        statics::Trapezoid<Value<5, 10>, Value<75, 100>, Value<1>, Value<1>, Value<8, 10> > >,
+                    statics::Output<
+                        Value<0>,
+                        Value<10>,
+                        statics::WeightedAverage,
+                        statics::Maximum,
+                        statics::Constant<Value<2> >,
+                        statics::Linear<Value<1>, Value<2>, Value<3> > > >,
+                statics::Rules<
+                    statics::AlgebraicProduct,
+                    statics::Maximum,
+                    statics::Minimum,
+                    Activation,
+                    statics::Rule<
+                        statics::Or<statics::Is<0, 0, statics::Very>, statics::Is<1, 1, statics::Not> >,
+                        statics::Then<0, 0> >,
+                    statics::Rule<
+                        statics::And<statics::Is<0, 2>, statics::Is<1, 1, statics::Somewhat> >,
+                        statics::Then<0, 1>,
+                        statics::Then<1, 0> >,
+                    statics::Rule<
+                        statics::Is<0, 1, statics::Extremely>,
+                        statics::Then<0, 2>,
+                        statics::Then<1, 1, statics::Very> > >,
+                statics::Rules<
+                    statics::Minimum,
+                    statics::BoundedSum,
+                    statics::AlgebraicProduct,
+                    statics::Highest<2>,
+                    statics::Rule<statics::Is<0, 0, statics::Seldom>, statics::Then<0, 2> >,
+                    statics::Rule<statics::Or<statics::Is<1, 0>, statics::Is<0, 1> >, statics::Then<1, 1> > > >
+                type;
+        };
+
+        bool isClose(scalar expected, scalar obtained) {
+            if (Op::isNaN(expected) or Op::isNaN(obtained))
+                return Op::isNaN(expected) and Op::isNaN(obtained);
+            return expected == obtained or std::fabs(expected - obtained) <= 1e-9 * std::max(1.0, std::fabs(expected));
+        }
+
+        // the engines are processed on a grid over the ranges of the input variables, including values out of range
+        template <typename Static>
+        void checkSameResults(Engine* engine) {
+            REQUIRE(Static::numberOfInputVariables == engine->numberOfInputVariables());
+            REQUIRE(Static::numberOfOutputVariables == engine->numberOfOutputVariables());
+            std::vector<scalar> inputs(engine->numberOfInputVariables());
+            std::vector<scalar> outputs(engine->numberOfOutputVariables());
+            std::size_t differences = 0;
+            std::string firstDifference;
+            const int samples = 240;
+            for (int sample = 0; sample < samples; ++sample) {
+                for (std::size_t v = 0; v < inputs.size(); ++v) {
+                    const InputVariable* inputVariable = engine->getInputVariable(v);
+                    const scalar position = sample * (v + 1) * 0.618034;
+                    inputs.at(v) = inputVariable->getMinimum()
+                                   + ((position - int(position)) * 1.2 - 0.1) * inputVariable->range();
+                    engine->getInputVariable(v)->setValue(inputs.at(v));
+                }
+                engine->process();
+                Static::process(&inputs.front(), &outputs.front());
+                for (std::size_t v = 0; v < outputs.size(); ++v) {
+                    const scalar expected = engine->getOutputVariable(v)->getValue();
+                    if (not isClose(expected, outputs.at(v)) and differences++ == 0)
+                        firstDifference = "sample " + Op::str(sample) + ": " + engine->getOutputVariable(v)->getName()
+                                          + " expected " + Op::str(expected, 17) + " but obtained "
+                                          + Op::str(outputs.at(v), 17);
+                }
+            }
+            CAPTURE(firstDifference);
+            CHECK(differences == 0);
+        }
+    }
+
+    TEST_CASE("StaticEngine produces the same results as Engine with integral defuzzifiers", "[engine][static]") {
+        FL_unique_ptr<Engine> engine(loadExample("mamdani/SimpleDimmer"));
+        OutputVariable* power = engine->getOutputVariable(0);
+
+        SECTION("Centroid") {
+            checkSameResults<SimpleDimmer<statics::Centroid<200> >::type>(engine.get());
+        }
+        SECTION("Bisector") {
+            power->setDefuzzifier(new Bisector(200));
+            checkSameResults<SimpleDimmer<statics::Bisector<200> >::type>(engine.get());
+        }
+        SECTION("SmallestOfMaximum") {
+            power->setDefuzzifier(new SmallestOfMaximum(200));
+            checkSameResults<SimpleDimmer<statics::SmallestOfMaximum<200> >::type>(engine.get());
+        }
+        SECTION("MeanOfMaximum") {
+            power->setDefuzzifier(new MeanOfMaximum(200));
+            checkSameResults<SimpleDimmer<statics::MeanOfMaximum<200> >::type>(engine.get());
+        }
+        SECTION("LargestOfMaximum") {
+            power->setDefuzzifier(new LargestOfMaximum(200));
+            checkSameResults<SimpleDimmer<statics::LargestOfMaximum<200> >::type>(engine.get());
+        }
+    }
+
+    TEST_CASE("StaticEngine produces the same results as Engine with weighted defuzzifiers", "[engine][static]") {
+        FL_unique_ptr<Engine> engine(loadExample("takagi-sugeno/octave/linear_tip_calculator"));
+
+        SECTION("WeightedAverage") {
+            checkSameResults<LinearTipCalculator<statics::WeightedAverage>::type>(engine.get());
+        }
+        SECTION("WeightedSum") {
+            engine->getOutputVariable(0)->setDefuzzifier(new WeightedSum);
+            checkSameResults<LinearTipCalculator<statics::WeightedSum>::type>(engine.get());
+        }
+    }
+
+    TEST_CASE("StaticEngine produces the same results as Engine with the activation methods", "[engine][static]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(hybrid));
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+
+        SECTION("General") {
+            checkSameResults<Hybrid<statics::General>::type>(engine.get());
+        }
+        SECTION("Proportional") {
+            ruleBlock->setActivation(new Proportional);
+            checkSameResults<Hybrid<statics::Proportional>::type>(engine.get());
+        }
+        SECTION("First") {
+            ruleBlock->setActivation(new First(2, 0.1));
+            checkSameResults<Hybrid<statics::First<2, Value<1, 10> > >::type>(engine.get());
+        }
+        SECTION("Last") {
+            ruleBlock->setActivation(new Last(2, 0.1));
+            checkSameResults<Hybrid<statics::Last<2, Value<1, 10> > >::type>(engine.get());
+        }
+        SECTION("Highest") {
+            ruleBlock->setActivation(new Highest(1));
+            checkSameResults<Hybrid<statics::Highest<1> >::type>(engine.get());
+        }
+        SECTION("Lowest") {
+            ruleBlock->setActivation(new Lowest(2));
+            checkSameResults<Hybrid<statics::Lowest<2> >::type>(engine.get());
+        }
+        SECTION("Threshold") {
+            ruleBlock->setActivation(new Threshold(Threshold::GreaterThan, 0.3));
+            checkSameResults<Hybrid<statics::Threshold<Threshold::GreaterThan, Value<3, 10> > >::type>(engine.get());
+        }
+    }
+
+    TEST_CASE("StaticEngine returns nan for output variables without activated terms", "[engine][static]") {
+        const scalar input = fl::nan;
+        scalar output = 0.0;
+        SimpleDimmer<statics::Centroid<200> >::type::process(&input, &output);
+        CHECK(Op::isNaN(output));
+    }
+
+}
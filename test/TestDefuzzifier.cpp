@@ -14,6 +14,8 @@
  fuzzylite is a registered trademark of FuzzyLite Limited.
  */
 
+#include <thread>
+
 #include "Headers.h"
 
 namespace fuzzylite {
@@ -202,6 +204,228 @@ namespace fuzzylite {
         DefuzzifierAssert<Centroid>().defuzzifies(-1, 1, {{new NaN(), nan}});
     }
 
+    TEST_CASE("Centroid exact", "[defuzzifier][centroid]") {
+        Centroid exact(Centroid::defaultResolution(), true);
+        CHECK(FllExporter().toString(&exact) == "Centroid exact");
+        exact.setResolution(200);
+        CHECK(FllExporter().toString(&exact) == "Centroid exact 200");
+        CHECK(CppExporter().toString(&exact) == "new Centroid(200, true)");
+        FL_unique_ptr<Centroid> clone(exact.clone());
+        CHECK(clone->isExact());
+
+        const Centroid sampled(100000);
+        FL_unique_ptr<Minimum> minimum(new Minimum);
+        FL_unique_ptr<AlgebraicProduct> product(new AlgebraicProduct);
+        FL_unique_ptr<Triangle> low(new Triangle("Low", 0.0, 0.25, 0.5));
+        FL_unique_ptr<Triangle> medium(new Triangle("Medium", 0.25, 0.5, 0.75));
+        FL_unique_ptr<Trapezoid> high(new Trapezoid("High", 0.5, 0.75, 1.0, 1.25));
+        FL_unique_ptr<Rectangle> step(new Rectangle("Step", 0.1, 0.6));
+        std::vector<Term*> terms = {
+            new Triangle("", -1, 0, 1),
+            new Triangle("", -0.5, 0.75, 1.0),
+            new Trapezoid("", -0.8, -0.2, 0.1, 0.9),
+            new Rectangle("", -0.3, 0.4),
+            new Ramp("", -0.5, 0.5),
+            new Ramp("", 0.75, -0.25),
+            new Constant("", 0.5),
+            new Discrete("", {{-1.0, 0.0}, {-0.5, 1.0}, {0.25, 0.5}, {1.0, 0.0}}),
+            new Activated(medium.get(), 0.4, minimum.get()),
+            new Activated(high.get(), 0.6, product.get()),
+            new Aggregated(
+                "",
+                0,
+                1,
+                new Maximum(),
+                {Activated(medium.get(), 0.2, minimum.get()), Activated(high.get(), 0.8, minimum.get())}
+            ),
+            new Aggregated(
+                "",
+                0,
+                1,
+                new Maximum(),
+                {Activated(low.get(), 0.7, product.get()),
+                 Activated(medium.get(), 0.5, minimum.get()),
+                 Activated(step.get(), 0.3, minimum.get()),
+                 Activated(high.get(), 0.9, product.get()),
+                 Activated(medium.get(), 0.6, minimum.get())}
+            ),
+        };
+        for (Term* term : terms) {
+            CAPTURE(term->toString());
+            scalar centroid = fl::nan, area = fl::nan;
+            CHECK(exact.exactCentroid(term, -1, 1, centroid, area));
+            CHECK_THAT(exact.defuzzify(term, -1, 1), Approximates(centroid));
+            CHECK_THAT(centroid, Approximates(sampled.defuzzify(term, -1, 1), 1e-5));
+            delete term;
+        }
+
+        SECTION("exact centroid of a triangle") {
+            scalar centroid = fl::nan, area = fl::nan;
+            Triangle triangle("", 0.0, 1.0, 5.0);
+            CHECK(exact.exactCentroid(&triangle, 0.0, 5.0, centroid, area));
+            CHECK_THAT(centroid, Approximates(2.0, 1e-12));
+            CHECK_THAT(area, Approximates(2.5, 1e-12));
+        }
+
+        SECTION("other fuzzy sets are sampled") {
+            Gaussian gaussian("", 0.2, 0.3);
+            scalar centroid = fl::nan, area = fl::nan;
+            CHECK_FALSE(exact.exactCentroid(&gaussian, -1, 1, centroid, area));
+            CHECK(exact.defuzzify(&gaussian, -1, 1) == Centroid(200).defuzzify(&gaussian, -1, 1));
+
+            FL_unique_ptr<Gaussian> bump(new Gaussian("Bump", 0.5, 0.1));
+            Aggregated aggregated("", 0, 1, new Maximum(), {Activated(bump.get(), 0.5, minimum.get())});
+            CHECK_FALSE(exact.exactCentroid(&aggregated, 0, 1, centroid, area));
+
+            Aggregated bounded("", 0, 1, new BoundedSum(), {Activated(medium.get(), 0.5, minimum.get())});
+            CHECK_FALSE(exact.exactCentroid(&bounded, 0, 1, centroid, area));
+        }
+
+        SECTION("imports from fll") {
+            FL_unique_ptr<Engine> engine(FllImporter().fromString(
+                "Engine: test\n"
+                "OutputVariable: y\n"
+                "  range: 0.000 1.000\n"
+                "  defuzzifier: Centroid exact 200\n"
+                "  term: A Triangle 0.000 0.500 1.000\n"
+            ));
+            const Centroid* centroid = dynamic_cast<const Centroid*>(engine->getOutputVariable(0)->getDefuzzifier());
+            REQUIRE(centroid);
+            CHECK(centroid->isExact());
+            CHECK(centroid->getResolution() == 200);
+            CHECK(FllExporter().toString(centroid) == "Centroid exact 200");
+        }
+    }
+
+    static Defuzzifier* importDefuzzifier(const std::string& fll) {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(
+            "Engine: test\n"
+            "OutputVariable: y\n"
+            "  defuzzifier: "
+            + fll + "\n"
+        ));
+        return engine->getOutputVariable(0)->getDefuzzifier()->clone();
+    }
+
+    TEST_CASE("Adaptive quadrature", "[defuzzifier][adaptive]") {
+        SECTION("adaptive defuzzifiers in FLL and C++") {
+            FL_unique_ptr<Defuzzifier> centroid(importDefuzzifier("Centroid adaptive 1e-06"));
+            CHECK(FllExporter().toString(centroid.get()) == "Centroid adaptive 1e-06");
+            CHECK(CppExporter().toString(centroid.get()) == "new Centroid(1000, false, 1e-06)");
+            CHECK(dynamic_cast<Centroid*>(centroid.get())->getTolerance() == 1e-6);
+
+            centroid.reset(importDefuzzifier("Centroid exact adaptive 1e-05 200"));
+            CHECK(FllExporter().toString(centroid.get()) == "Centroid exact adaptive 1e-05 200");
+            CHECK(CppExporter().toString(centroid.get()) == "new Centroid(200, true, 1e-05)");
+            FL_unique_ptr<Defuzzifier> clone(centroid->clone());
+            CHECK(dynamic_cast<Centroid*>(clone.get())->getTolerance() == 1e-5);
+
+            FL_unique_ptr<Defuzzifier> bisector(importDefuzzifier("Bisector adaptive 1e-06 200"));
+            CHECK(FllExporter().toString(bisector.get()) == "Bisector adaptive 1e-06 200");
+            CHECK(CppExporter().toString(bisector.get()) == "new Bisector(200, 1e-06)");
+            CHECK(FllExporter().toString(FL_unique_ptr<Defuzzifier>(new Bisector(500)).get()) == "Bisector 500");
+
+            CHECK_THROWS_AS(importDefuzzifier("Centroid adaptive"), fl::Exception);
+        }
+
+        FL_unique_ptr<Minimum> minimum(new Minimum);
+        FL_unique_ptr<AlgebraicProduct> product(new AlgebraicProduct);
+        FL_unique_ptr<Triangle> medium(new Triangle("Medium", 0.25, 0.5, 0.75));
+        FL_unique_ptr<Trapezoid> high(new Trapezoid("High", 0.5, 0.75, 1.0, 1.25));
+        FL_unique_ptr<Rectangle> step(new Rectangle("Step", 0.1, 0.6));
+        FL_unique_ptr<Triangle> spike(new Triangle("Spike", -0.901, -0.9, -0.899));
+        SECTION("adaptive centroid is within the tolerance of the exact centroid") {
+            const Centroid exact(Centroid::defaultResolution(), true);
+            const Centroid adaptive(Centroid::defaultResolution(), false, 1e-8);
+            std::vector<Term*> terms = {
+                new Triangle("", -1, 0, 1),
+                new Trapezoid("", -0.8, -0.2, 0.1, 0.9),
+                new Rectangle("", -0.3, 0.4),
+                new Ramp("", -0.5, 0.5),
+                new Triangle("", -0.901, -0.9, -0.899),
+                new Activated(high.get(), 0.6, product.get()),
+                new Aggregated(
+                    "",
+                    0,
+                    1,
+                    new Maximum(),
+                    {Activated(medium.get(), 0.5, minimum.get()),
+                     Activated(step.get(), 0.3, minimum.get()),
+                     Activated(high.get(), 0.9, product.get()),
+                     Activated(spike.get(), 1.0, minimum.get())}
+                ),
+            };
+            for (Term* term : terms) {
+                CAPTURE(term->toString());
+                scalar centroid = fl::nan, area = fl::nan;
+                REQUIRE(exact.exactCentroid(term, -1, 1, centroid, area));
+                CHECK_THAT(adaptive.defuzzify(term, -1, 1), Approximates(centroid, 1e-6));
+                // the edges of the rectangle are within macheps
+                CHECK_THAT(adaptive.adaptiveStatistics(term, -1, 1, 1e-8).area, Approximates(area, 1e-5));
+                CHECK(adaptive.defuzzification(term, -1, 1).samples > 0);
+                delete term;
+            }
+        }
+
+        SECTION("adaptive bisector is close to the sampled bisector") {
+            const Bisector sampled(100000);
+            const Bisector adaptive(Bisector::defaultResolution(), 1e-8);
+            std::vector<Term*> terms = {
+                new Triangle("", -1, 0, 1),
+                new Trapezoid("", -0.8, -0.2, 0.1, 0.9),
+                new Gaussian("", 0.2, 0.3),
+                new SShape("", -0.5, 0.5),
+                new Aggregated(
+                    "",
+                    0,
+                    1,
+                    new Maximum(),
+                    {Activated(medium.get(), 0.5, minimum.get()), Activated(high.get(), 0.9, product.get())}
+                ),
+            };
+            for (Term* term : terms) {
+                CAPTURE(term->toString());
+                CHECK_THAT(adaptive.defuzzify(term, -1, 1), Approximates(sampled.defuzzify(term, -1, 1), 1e-4));
+                delete term;
+            }
+            // the bisector of separate fuzzy sets of equal area is in the middle of the gap between them
+            Rectangle left("", -0.8, -0.6), right("", 0.2, 0.4);
+            Aggregated gap("", -1, 1, new Maximum());
+            gap.addTerm(&left, 1.0, minimum.get());
+            gap.addTerm(&right, 1.0, minimum.get());
+            CHECK_THAT(adaptive.defuzzify(&gap, -1, 1), Approximates(-0.2, 1e-6));
+        }
+
+        SECTION("adaptive quadrature takes fewer samples for the same accuracy") {
+            Aggregated aggregated(
+                "",
+                0,
+                1,
+                new Maximum(),
+                {Activated(medium.get(), 0.5, minimum.get()), Activated(high.get(), 0.9, minimum.get())}
+            );
+            scalar centroid = fl::nan, area = fl::nan;
+            REQUIRE(Centroid().exactCentroid(&aggregated, 0, 1, centroid, area));
+
+            const Centroid adaptive(Centroid::defaultResolution(), false, 1e-6);
+            CHECK_THAT(adaptive.defuzzify(&aggregated, 0, 1), Approximates(centroid, 1e-6));
+            const Centroid sampled(10000);
+            CHECK_THAT(sampled.defuzzify(&aggregated, 0, 1), Approximates(centroid, 1e-6));
+            CHECK(sampled.defuzzification(&aggregated, 0, 1).samples == 10000);
+            CHECK(adaptive.defuzzification(&aggregated, 0, 1).samples < 10000);
+            CHECK(Centroid(10000, true).defuzzification(&aggregated, 0, 1).samples == 0);
+        }
+
+        SECTION("adaptive statistics over infinite ranges are nan") {
+            const Triangle triangle("", 0.0, 0.5, 1.0);
+            const IntegralDefuzzifier::Statistics statistics
+                = Centroid().adaptiveStatistics(&triangle, -fl::inf, 1.0, 1e-6);
+            CHECK(Op::isNaN(statistics.area));
+            CHECK(Op::isNaN(statistics.centroid));
+            CHECK(Op::isNaN(statistics.bisector));
+        }
+    }
+
     TEST_CASE("SmallestOfMaximum", "[defuzzifier][som]") {
         SECTION("SmallestOfMaximum") {
             DefuzzifierAssert<SmallestOfMaximum>()
@@ -343,6 +567,206 @@ namespace fuzzylite {
         DefuzzifierAssert<MeanOfMaximum>().defuzzifies(-1, 1, {{new NaN(), fl::nan}});
     }
 
+    TEST_CASE("IntegralDefuzzifier statistics", "[defuzzifier][statistics]") {
+        const Centroid centroid(200);
+        const Bisector bisector(200);
+        const SmallestOfMaximum som(200);
+        const MeanOfMaximum mom(200);
+        const LargestOfMaximum lom(200);
+
+        FL_unique_ptr<Minimum> minimum(new Minimum);
+        FL_unique_ptr<Triangle> medium(new Triangle("Medium", 0.25, 0.5, 0.75));
+        FL_unique_ptr<Trapezoid> high(new Trapezoid("High", 0.5, 0.75, 1.0, 1.25));
+        std::vector<Term*> terms = {
+            new Triangle("", -1, 0, 1),
+            new Trapezoid("", -0.8, -0.2, 0.1, 0.9),
+            new Gaussian("", 0.2, 0.3),
+            new Constant("", 0.5),
+            new NaN(),
+            new Aggregated(
+                "",
+                0,
+                1,
+                new Maximum(),
+                {Activated(medium.get(), 0.2, minimum.get()), Activated(high.get(), 0.8, minimum.get())}
+            ),
+        };
+        for (Term* term : terms) {
+            CAPTURE(term->toString());
+            const IntegralDefuzzifier::Statistics statistics = centroid.statistics(term, -1, 1);
+            CHECK_THAT(statistics.centroid, Approximates(centroid.defuzzify(term, -1, 1)));
+            CHECK_THAT(statistics.bisector, Approximates(bisector.defuzzify(term, -1, 1)));
+            CHECK_THAT(statistics.smallestOfMaximum, Approximates(som.defuzzify(term, -1, 1)));
+            CHECK_THAT(statistics.meanOfMaximum, Approximates(mom.defuzzify(term, -1, 1)));
+            CHECK_THAT(statistics.largestOfMaximum, Approximates(lom.defuzzify(term, -1, 1)));
+
+            // Sampled one value at a time
+            const scalar dx = 2.0 / 200;
+            scalar area = 0.0, moment = 0.0;
+            for (int i = 0; i < 200; ++i) {
+                const scalar x = -1 + (i + 0.5) * dx;
+                area += term->membership(x);
+                moment += term->membership(x) * x;
+            }
+            CHECK_THAT(statistics.area, Approximates(area * dx));
+            CHECK_THAT(statistics.centroid, Approximates(moment / area));
+            delete term;
+        }
+
+        SECTION("statistics of a trapezoid") {
+            const Trapezoid trapezoid("", 0.0, 0.4, 0.6, 1.0);
+            const IntegralDefuzzifier::Statistics statistics = centroid.statistics(&trapezoid, 0.0, 1.0);
+            CHECK_THAT(statistics.area, Approximates(0.6, 1e-4));
+            CHECK_THAT(statistics.centroid, Approximates(0.5));
+            CHECK_THAT(statistics.bisector, Approximates(0.5, 0.005));
+            CHECK_THAT(statistics.smallestOfMaximum, Approximates(0.4025));
+            CHECK_THAT(statistics.meanOfMaximum, Approximates(0.5));
+            CHECK_THAT(statistics.largestOfMaximum, Approximates(0.5975));
+        }
+
+        SECTION("statistics not requested are nan") {
+            const Trapezoid trapezoid("", 0.0, 0.4, 0.6, 1.0);
+            const IntegralDefuzzifier::Statistics statistics = centroid.statistics(
+                &trapezoid,
+                0.0,
+                1.0,
+                IntegralDefuzzifier::AreaStatistic | IntegralDefuzzifier::MeanOfMaximumStatistic
+            );
+            CHECK_THAT(statistics.area, Approximates(0.6, 1e-4));
+            CHECK_THAT(statistics.meanOfMaximum, Approximates(0.5));
+            CHECK(Op::isNaN(statistics.centroid));
+            CHECK(Op::isNaN(statistics.bisector));
+            CHECK(Op::isNaN(statistics.smallestOfMaximum));
+            CHECK(Op::isNaN(statistics.largestOfMaximum));
+        }
+
+        SECTION("statistics over infinite ranges are nan") {
+            const Triangle triangle("", 0.0, 0.5, 1.0);
+            const IntegralDefuzzifier::Statistics statistics = centroid.statistics(&triangle, -fl::inf, 1.0);
+            CHECK(Op::isNaN(statistics.area));
+            CHECK(Op::isNaN(statistics.centroid));
+            CHECK(Op::isNaN(statistics.bisector));
+            CHECK(Op::isNaN(statistics.smallestOfMaximum));
+            CHECK(Op::isNaN(statistics.meanOfMaximum));
+            CHECK(Op::isNaN(statistics.largestOfMaximum));
+        }
+    }
+
+    TEST_CASE("IntegralDefuzzifier is shared between threads", "[defuzzifier][statistics]") {
+        const Triangle triangle("", 0.0, 0.25, 1.0);
+        const Gaussian gaussian("", 0.6, 0.1);
+        const Centroid centroid(1000, false, 0.0, true);
+        const scalar expected[] = {centroid.defuzzify(&triangle, 0, 1), centroid.defuzzify(&gaussian, 0, 1)};
+        std::vector<int> differences(4, 0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < differences.size(); ++t) {
+            threads.push_back(std::thread([&, t]() {
+                const Term* term = t % 2 == 0 ? static_cast<const Term*>(&triangle) : &gaussian;
+                for (int i = 0; i < 200; ++i) {
+                    const IntegralDefuzzifier::Statistics statistics = centroid.defuzzification(term, 0, 1);
+                    if (statistics.centroid != expected[t % 2] or statistics.samples != 1000)
+                        ++differences.at(t);
+                }
+            }));
+        }
+        for (std::size_t t = 0; t < threads.size(); ++t)
+            threads.at(t).join();
+        CHECK(differences == std::vector<int>(4, 0));
+    }
+
+    TEST_CASE("Integration restricted to the support", "[defuzzifier][support]") {
+        SECTION("restricted defuzzifiers in FLL and C++") {
+            FL_unique_ptr<Defuzzifier> centroid(importDefuzzifier("Centroid support 200"));
+            CHECK(dynamic_cast<IntegralDefuzzifier*>(centroid.get())->isRestrictedToSupport());
+            CHECK(FllExporter().toString(centroid.get()) == "Centroid support 200");
+            CHECK(CppExporter().toString(centroid.get()) == "new Centroid(200, false, 0, true)");
+
+            centroid.reset(importDefuzzifier("Centroid exact support adaptive 1e-06"));
+            CHECK(FllExporter().toString(centroid.get()) == "Centroid exact support adaptive 1e-06");
+            CHECK(CppExporter().toString(centroid.get()) == "new Centroid(1000, true, 1e-06, true)");
+
+            FL_unique_ptr<Defuzzifier> bisector(importDefuzzifier("Bisector support adaptive 1e-06"));
+            CHECK(FllExporter().toString(bisector.get()) == "Bisector support adaptive 1e-06");
+            CHECK(CppExporter().toString(bisector.get()) == "new Bisector(1000, 1e-06, true)");
+
+            FL_unique_ptr<Defuzzifier> mom(importDefuzzifier("MeanOfMaximum support 500"));
+            CHECK(FllExporter().toString(mom.get()) == "MeanOfMaximum support 500");
+            CHECK(CppExporter().toString(mom.get()) == "new MeanOfMaximum(500, true)");
+            FL_unique_ptr<Defuzzifier> clone(mom->clone());
+            CHECK(dynamic_cast<IntegralDefuzzifier*>(clone.get())->isRestrictedToSupport());
+            CHECK(FllExporter().toString(FL_unique_ptr<Defuzzifier>(new MeanOfMaximum(500)).get())
+                  == "MeanOfMaximum 500");
+        }
+
+        FL_unique_ptr<Minimum> minimum(new Minimum);
+        FL_unique_ptr<Triangle> low(new Triangle("Low", -0.9, -0.85, -0.8));
+        FL_unique_ptr<Trapezoid> high(new Trapezoid("High", 0.7, 0.72, 0.78, 0.8));
+        Aggregated narrow(
+            "",
+            -10,
+            10,
+            new Maximum(),
+            {Activated(low.get(), 0.5, minimum.get()), Activated(high.get(), 0.8, minimum.get())}
+        );
+
+        SECTION("restricted statistics converge to the same statistics") {
+            const Centroid sampled(100000);
+            Centroid restricted(100000);
+            restricted.setRestrictedToSupport(true);
+            const IntegralDefuzzifier::Statistics expected = sampled.statistics(&narrow, -10, 10);
+            const IntegralDefuzzifier::Statistics obtained = restricted.statistics(&narrow, -10, 10);
+            CHECK_THAT(obtained.area, Approximates(expected.area, 1e-6));
+            CHECK_THAT(obtained.centroid, Approximates(expected.centroid, 1e-6));
+            CHECK_THAT(obtained.bisector, Approximates(expected.bisector, 1e-3));
+            CHECK_THAT(obtained.smallestOfMaximum, Approximates(expected.smallestOfMaximum, 1e-3));
+            CHECK_THAT(obtained.meanOfMaximum, Approximates(expected.meanOfMaximum, 1e-3));
+            CHECK_THAT(obtained.largestOfMaximum, Approximates(expected.largestOfMaximum, 1e-3));
+        }
+
+        SECTION("restricted integration is more accurate at the same resolution") {
+            scalar centroid = fl::nan, area = fl::nan;
+            REQUIRE(Centroid().exactCentroid(&narrow, -10, 10, centroid, area));
+
+            const Centroid sampled(1000);
+            const Centroid restricted(1000, false, 0.0, true);
+            CHECK_THAT(restricted.defuzzify(&narrow, -10, 10), Approximates(centroid, 1e-5));
+            CHECK(
+                std::abs(restricted.defuzzify(&narrow, -10, 10) - centroid)
+                < std::abs(sampled.defuzzify(&narrow, -10, 10) - centroid)
+            );
+            CHECK(restricted.defuzzification(&narrow, -10, 10).samples == 1000);
+
+            const Centroid adaptive(Centroid::defaultResolution(), false, 1e-6);
+            const Centroid restrictedAdaptive(Centroid::defaultResolution(), false, 1e-6, true);
+            CHECK_THAT(restrictedAdaptive.defuzzify(&narrow, -10, 10), Approximates(centroid, 1e-6));
+            CHECK(
+                restrictedAdaptive.defuzzification(&narrow, -10, 10).samples
+                < adaptive.defuzzification(&narrow, -10, 10).samples
+            );
+        }
+
+        SECTION("restricted bisector of separate fuzzy sets of equal area is in the middle of the gap") {
+            Rectangle left("", -0.8, -0.6), right("", 0.2, 0.4);
+            Aggregated gap("", -1, 1, new Maximum());
+            gap.addTerm(&left, 1.0, minimum.get());
+            gap.addTerm(&right, 1.0, minimum.get());
+            CHECK_THAT(Bisector(1000, 0.0, true).defuzzify(&gap, -1, 1), Approximates(-0.2, 1e-3));
+            CHECK_THAT(Bisector(1000, 1e-8, true).defuzzify(&gap, -1, 1), Approximates(-0.2, 1e-6));
+        }
+
+        SECTION("restricted statistics without supports in the range are nan") {
+            Centroid restricted(1000, false, 0.0, true);
+            const IntegralDefuzzifier::Statistics statistics
+                = restricted.statistics(&narrow, 2.0, 3.0, IntegralDefuzzifier::AllStatistics);
+            CHECK(statistics.samples == 0);
+            CHECK(Op::isNaN(statistics.centroid));
+            CHECK(Op::isNaN(statistics.bisector));
+            CHECK(Op::isNaN(statistics.meanOfMaximum));
+            const Aggregated empty;
+            CHECK(Op::isNaN(restricted.defuzzify(&empty, -1, 1)));
+        }
+    }
+
     TEST_CASE("Infer defuzzifier type", "[defuzzifier][weighted]") {
         std::vector<fl::Term*> takagiSugenoTerms = {
             new fl::Constant(),
@@ -14,6 +14,9 @@
  fuzzylite is a registered trademark of FuzzyLite Limited.
  */
 
+#include <thread>
+#include <vector>
+
 #include "Headers.h"
 
 namespace fuzzylite {
@@ -616,4 +619,39 @@ namespace fuzzylite {
         }
     }
 
+    TEST_CASE("NormFunction binds the operands to the arguments of the function", "[norm][function]") {
+        TNormFunction tnorm("a * b");
+        SNormFunction snorm("a + b - (a * b)");
+        REQUIRE(tnorm.function().program().size() == 3);
+        CHECK(tnorm.function().program().at(0).opcode == Function::Instruction::OpArgument);
+        CHECK(tnorm.function().program().at(1).opcode == Function::Instruction::OpArgument);
+
+        CHECK(tnorm.compute(0.5, 0.25) == 0.125);
+        CHECK(snorm.compute(0.5, 0.25) == 0.625);
+        // the operands are not loaded into the map of variables
+        CHECK(Op::isNaN(tnorm.function().variables["a"]));
+        CHECK(Op::isNaN(snorm.function().variables["b"]));
+
+        FL_unique_ptr<TNormFunction> clone(tnorm.clone());
+        CHECK(clone->compute(0.5, 0.5) == 0.25);
+
+        // the norms and hedges are computed concurrently without interfering with each other
+        const HedgeFunction hedge("x^2");
+        std::vector<int> mismatches(4, 0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < mismatches.size(); ++t) {
+            threads.push_back(std::thread([&, t]() {
+                for (int i = 0; i < 10000; ++i) {
+                    const scalar a = scalar((i + t) % 100) / 100, b = scalar(i % 37) / 37;
+                    if (tnorm.compute(a, b) != a * b or snorm.compute(a, b) != a + b - (a * b)
+                        or hedge.hedge(a) != std::pow(a, 2))
+                        ++mismatches.at(t);
+                }
+            }));
+        }
+        for (std::size_t t = 0; t < threads.size(); ++t)
+            threads.at(t).join();
+        CHECK(mismatches == std::vector<int>(4, 0));
+    }
+
 }
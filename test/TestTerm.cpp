@@ -13,6 +13,10 @@
 
  fuzzylite is a registered trademark of FuzzyLite Limited.
  */
+#include <chrono>
+#include <set>
+
+#include "Examples.h"
 #include "Headers.h"
 
 namespace fuzzylite {
@@ -146,6 +150,16 @@ namespace fuzzylite {
                     CAPTURE(height);
                     CHECK_THAT(obtained_y, Approximates(expected_y));
                 }
+
+                std::vector<scalar> x, y(values.size(), fl::nan);
+                for (const auto& value : values)
+                    x.push_back(value.front());
+                this->actual->membershipBatch(x.data(), y.data(), x.size());
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    CAPTURE(x.at(i));
+                    CAPTURE(height);
+                    CHECK_THAT(y.at(i), Approximates(height * values.at(i).back()));
+                }
             }
             return *this;
         }
@@ -238,6 +252,9 @@ namespace fuzzylite {
         Ramp ramp("ramp", 0, 1);
         CHECK(Activated(&ramp).isMonotonic());
 
+        CHECK(Activated(&term, 0.5, &algebraicProduct).support() == std::pair<scalar, scalar>(-0.4, 0.4));
+        CHECK(Activated().support() == std::pair<scalar, scalar>(-inf, inf));
+
         CHECK_THROWS_AS(Activated().membership(0.0), fl::Exception);
         CHECK_THROWS_WITH(
             Activated().membership(0.0), Catch::Matchers::StartsWith("[activation error] no term available to activate")
@@ -293,6 +310,8 @@ namespace fuzzylite {
         CHECK_THAT(aggregated.activationDegree(&low), Catch::Matchers::WithinAbs(0.6, fuzzylite::macheps()));
         CHECK_THAT(aggregated.activationDegree(&medium), Catch::Matchers::WithinAbs(0.4, fuzzylite::macheps()));
         CHECK(aggregated.highestActivatedTerm().getTerm() == &low);
+        CHECK(aggregated.support() == std::pair<scalar, scalar>(-1.0, 0.5));
+        CHECK(Aggregated().support() == std::pair<scalar, scalar>(inf, -inf));
 
         aggregated.setRange(-2, 2);
         CHECK(aggregated.range() == 4);
@@ -390,6 +409,106 @@ namespace fuzzylite {
         CHECK(grouped.at(2).getDegree() == scalar(0.1));
     }
 
+    TEST_CASE("Aggregated: slots follow the activated terms", "[term][aggregated]") {
+        FL_unique_ptr<Term> low(new Triangle("LOW", 0.000, 0.250, 0.500));
+        FL_unique_ptr<Term> high(new Triangle("HIGH", 0.500, 0.750, 1.000));
+        FL_unique_ptr<Term> otherLow(new Triangle("LOW", 0.000, 0.100, 0.200));
+
+        Aggregated aggregated("", 0.0, 1.0, new Maximum);
+        CHECK(aggregated.activationDegree(low.get()) == 0.0);
+
+        aggregated.addTerm(low.get(), 0.2, fl::null);
+        aggregated.addTerm(high.get(), 0.4, fl::null);
+        CHECK(aggregated.activationDegree(low.get()) == 0.2);
+        CHECK(aggregated.activationDegree(high.get()) == 0.4);
+
+        // the terms added after the last computation are accumulated
+        aggregated.addTerm(low.get(), 0.3, fl::null);
+        aggregated.addTerm(otherLow.get(), 0.9, fl::null);
+        CHECK(aggregated.activationDegree(low.get()) == 0.3);
+        CHECK(aggregated.activationDegree(otherLow.get()) == 0.9);
+        REQUIRE(aggregated.groupedTerms().size() == 2);
+        CHECK(aggregated.groupedTerms().at(0).getTerm() == high.get());
+        CHECK(aggregated.groupedTerms().at(1).getTerm() == low.get());
+        CHECK(aggregated.groupedTerms().at(1).getDegree() == 0.9);
+
+        // the modifications of the terms are reflected
+        aggregated.terms().at(0).setDegree(0.5);
+        CHECK(aggregated.activationDegree(low.get()) == 0.5);
+        aggregated.removeTerm(0);
+        CHECK(aggregated.activationDegree(low.get()) == 0.3);
+        aggregated.setAggregation(fl::null);
+        CHECK(aggregated.groupedTerms().at(1).getDegree() == Approx(1.2));
+
+        aggregated.clear();
+        CHECK(aggregated.activationDegree(low.get()) == 0.0);
+        CHECK(aggregated.groupedTerms().empty());
+        aggregated.addTerm(high.get(), 0.1, fl::null);
+        CHECK(aggregated.activationDegree(high.get()) == scalar(0.1));
+        CHECK(aggregated.activationDegree(low.get()) == 0.0);
+
+        const Aggregated copy(aggregated);
+        CHECK(copy.activationDegree(high.get()) == scalar(0.1));
+        CHECK(copy.groupedTerms().size() == 1);
+    }
+
+    TEST_CASE("Aggregated: slots of the indexed terms are kept after clearing", "[term][aggregated]") {
+        OutputVariable variable("output", 0.0, 1.0);
+        variable.setAggregation(new Maximum);
+        variable.addTerm(new Triangle("MEDIUM", 0.250, 0.500, 0.750));
+        variable.addTerm(new Triangle("LOW", 0.000, 0.250, 0.500));
+        variable.addTerm(new Triangle("HIGH", 0.500, 0.750, 1.000));
+        FL_unique_ptr<Term> other(new Triangle("LOW", 0.000, 0.100, 0.200));
+        Aggregated* fuzzyOutput = variable.fuzzyOutput();
+
+        for (int iteration = 0; iteration < 3; ++iteration) {
+            fuzzyOutput->clear();
+            CHECK(fuzzyOutput->activationDegree(variable.getTerm("LOW")) == 0.0);
+            std::vector<Activated> buffer;
+            CHECK(&fuzzyOutput->groupedTerms(buffer) != &buffer);
+            CHECK(fuzzyOutput->groupedTerms(buffer).empty());
+
+            fuzzyOutput->addTerm(variable.getTerm("MEDIUM"), 0.6, fl::null);
+            fuzzyOutput->addTerm(other.get(), 0.7, fl::null);
+            fuzzyOutput->addTerm(variable.getTerm("LOW"), 0.2, fl::null);
+            fuzzyOutput->addTerm(variable.getTerm("MEDIUM"), 0.4, fl::null);
+            CHECK(fuzzyOutput->activationDegree(variable.getTerm("MEDIUM")) == 0.6);
+            CHECK(fuzzyOutput->activationDegree(variable.getTerm("LOW")) == 0.2);
+            CHECK(fuzzyOutput->activationDegree(variable.getTerm("HIGH")) == 0.0);
+            CHECK(fuzzyOutput->activationDegree(other.get()) == 0.7);
+
+            // the groups are returned without copying them
+            const std::vector<Activated>& grouped = fuzzyOutput->groupedTerms(buffer);
+            CHECK(&grouped != &buffer);
+            REQUIRE(grouped.size() == 2);
+            CHECK(grouped.at(0).getTerm() == other.get());
+            CHECK(grouped.at(0).getDegree() == 0.7);
+            CHECK(grouped.at(1).getTerm() == variable.getTerm("MEDIUM"));
+            CHECK(grouped.at(1).getDegree() == 0.6);
+        }
+
+        // the slots follow the terms of the variable
+        fuzzyOutput->clear();
+        delete variable.removeTerm(0);
+        fuzzyOutput->addTerm(other.get(), 0.7, fl::null);
+        fuzzyOutput->addTerm(variable.getTerm("HIGH"), 0.3, fl::null);
+        CHECK(fuzzyOutput->activationDegree(variable.getTerm("HIGH")) == 0.3);
+        REQUIRE(fuzzyOutput->groupedTerms().size() == 2);
+        CHECK(fuzzyOutput->groupedTerms().at(0).getTerm() == variable.getTerm("HIGH"));
+        CHECK(fuzzyOutput->groupedTerms().at(1).getTerm() == other.get());
+
+        // the mutable activated terms are grouped into the buffer
+        fuzzyOutput->terms().at(0).setDegree(0.9);
+        std::vector<Activated> buffer;
+        CHECK(&fuzzyOutput->groupedTerms(buffer) == &buffer);
+        CHECK(buffer.at(1).getDegree() == 0.9);
+
+        const FL_unique_ptr<OutputVariable> clone(variable.clone());
+        clone->fuzzyOutput()->clear();
+        clone->fuzzyOutput()->addTerm(clone->getTerm("HIGH"), 0.5, fl::null);
+        CHECK(clone->fuzzyOutput()->activationDegree(clone->getTerm("HIGH")) == 0.5);
+    }
+
     TEST_CASE("Bell", "[term][bell]") {
         TermAssert(new Bell("bell"))
             .takes_parameters(3)
@@ -2173,6 +2292,149 @@ namespace fuzzylite {
         CHECK(f.parse(text)->toPrefix() == "/ * ~ 5.000 4.000 sin / ~ pi 2.000");
     }
 
+    TEST_CASE("Function resolves the sources of its variables", "[term][function]") {
+        Engine engine("A", "", {new InputVariable("i_A"), new InputVariable("x")}, {new OutputVariable("o_A")});
+        Function f("f", "2*i_A + o_A + x + y", {{"y", 0.5}}, &engine);
+        f.load();
+        const Function::Node* root = f.root();
+        CHECK(root->right->variable == "y");
+        CHECK(root->right->source == Function::Node::Map);
+        CHECK(root->left->right->variable == "x");
+        CHECK(root->left->right->source == Function::Node::X);
+        CHECK(root->left->left->right->variable == "o_A");
+        CHECK(root->left->left->right->source == Function::Node::Output);
+        CHECK(root->left->left->right->index == 0);
+        CHECK(root->left->left->left->right->variable == "i_A");
+        CHECK(root->left->left->left->right->source == Function::Node::Input);
+        CHECK(root->left->left->left->right->index == 0);
+
+        // the values are read from the engine without loading them into the map
+        engine.getInputVariable("i_A")->setValue(3.0);
+        engine.getInputVariable("x")->setValue(100.0);
+        engine.getOutputVariable("o_A")->setValue(1.0);
+        CHECK(f.membership(1.0) == 8.5);
+        engine.getInputVariable("i_A")->setValue(4.0);
+        CHECK(f.membership(1.0) == 10.5);
+        CHECK(f.variables.size() == 1);
+
+        // the sources follow the engine
+        Engine copy(engine);
+        Function* clone = f.clone();
+        clone->updateReference(&copy);
+        copy.getInputVariable("i_A")->setValue(0.0);
+        CHECK(clone->membership(1.0) == 2.5);
+        CHECK(f.membership(1.0) == 10.5);
+        clone->setEngine(fl::null);
+        CHECK(clone->root()->left->left->left->right->source == Function::Node::Map);
+        CHECK_THROWS_WITH(
+            clone->membership(1.0), Catch::Matchers::StartsWith("[function error] unknown variable")
+        );
+        delete clone;
+    }
+
+    TEST_CASE("Function follows the variables inserted in front of the one it reads", "[term][function]") {
+        Engine engine("A", "", {new InputVariable("a"), new InputVariable("b")}, {new OutputVariable("o")});
+        engine.getInputVariable("a")->setValue(1.0);
+        engine.getInputVariable("b")->setValue(2.0);
+        Function* f = new Function("f", "b", {}, &engine, true);
+        engine.getOutputVariable("o")->addTerm(f);
+        REQUIRE_FALSE(f->program().empty());
+        CHECK(f->membership(0.0) == 2.0);
+        CHECK(f->root()->evaluate(0.0, &engine, &f->variables) == 2.0);
+
+        // the engine resolves the sources of its functions again once it processes after modifying its variables
+        InputVariable* z = new InputVariable("z");
+        z->setValue(99.0);
+        engine.insertInputVariable(z, 0);
+        engine.process();
+        CHECK(f->membership(0.0) == 2.0);
+        CHECK(f->root()->evaluate(0.0, &engine, &f->variables) == 2.0);
+
+        delete engine.removeInputVariable("a");
+        engine.process();
+        CHECK(f->membership(0.0) == 2.0);
+        CHECK(f->root()->evaluate(0.0, &engine, &f->variables) == 2.0);
+
+        // the mutable vector of variables is not tracked until the indexes are rebuilt
+        std::swap(engine.inputVariables().at(0), engine.inputVariables().at(1));
+        engine.rebuildIndexes();
+        CHECK(f->membership(0.0) == 2.0);
+
+        delete engine.removeInputVariable("b");
+        engine.rebuildIndexes();
+        CHECK_THROWS_WITH(f->membership(0.0), Catch::Matchers::StartsWith("[function error] unknown variable <b>"));
+    }
+
+    static std::string programOf(const Function& function) {
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i < function.program().size(); ++i)
+            result.push_back(function.program().at(i).toString());
+        return Op::join(result, " ");
+    }
+
+    TEST_CASE("Function compiles the formula into a program", "[term][function][program]") {
+        SECTION("constants are folded and identities are removed") {
+            CHECK(programOf(Function("f", "2*3 + x", {}, fl::null, true)) == "6.000 x +");
+            CHECK(programOf(Function("f", "x * 1 + 0/1 - 0", {}, fl::null, true)) == "x 0.000 +");
+            CHECK(programOf(Function("f", "1 * (x / 1) - (3 - 3)", {}, fl::null, true)) == "x");
+            CHECK(programOf(Function("f", "cos atan(1) * 4", {}, fl::null, true)) == "-1.000");
+            CHECK(Function("f", "2*3 + x", {}, fl::null, true).root()->toPrefix() == "+ * 2.000 3.000 x");
+        }
+
+        SECTION("common subexpressions are computed once") {
+            CHECK(
+                programOf(Function("f", "sin(x)*sin(x) + sin(x)", {}, fl::null, true))
+                == "x sin store(0) load(0) * load(0) +"
+            );
+            CHECK(programOf(Function("f", "(x+y)*(x+y)", {{"y", 1.0}}, fl::null, true)) == "x y + store(0) load(0) *");
+        }
+
+        SECTION("the program computes the same values as the expression tree") {
+            Engine engine("A", "", {new InputVariable("inputX")}, {new OutputVariable("outputFx")});
+            engine.getInputVariable(0)->setValue(0.7);
+            engine.getOutputVariable(0)->setValue(-0.3);
+            const std::vector<std::string> formulas = {
+                "sin(inputX)/inputX",
+                "fabs(outputFx-inputX)",
+                "2*x^3 +2*y - 3",
+                "x*x+(x-x)/x+log(x)",
+                "~5 *4/sin(~pi/2) * x",
+                "max(x, 0.5) * min(x, 0.2) % 3 + ge(x, 0.1)",
+                "sin(x)*sin(x) + sin(x) * (x + y) / (x + y)",
+                "x / 1 * 1 - 0 + 0",
+            };
+            for (const std::string& formula : formulas) {
+                CAPTURE(formula);
+                Function f("f", formula, {{"y", 1.5}, {"pi", 3.14}}, &engine, true);
+                CHECK(not f.program().empty());
+                for (scalar x : {-1.0, -0.5, 0.0, 0.25, 1.0, 3.0, nan, inf, -inf}) {
+                    CAPTURE(x);
+                    CHECK_THAT(f.membership(x), Approximates(f.root()->evaluate(x, &engine, &f.variables), 0.0));
+                }
+                FL_unique_ptr<Function> clone(f.clone());
+                CHECK(programOf(*clone) == programOf(f));
+            }
+        }
+
+        SECTION("formulas that do not fit in the stack are evaluated on the tree") {
+            std::string formula = "x";
+            for (int i = 0; i < 80; ++i)
+                formula = "x + (" + formula + ")";
+            Function f("f", formula, {}, fl::null, true);
+            CHECK(f.program().empty());
+            CHECK(f.membership(1.0) == 81.0);
+        }
+
+        SECTION("unknown variables are reported") {
+            Function f("f", "x + y", {{"y", 1.0}}, fl::null, true);
+            CHECK(f.membership(1.0) == 2.0);
+            f.variables.clear();
+            CHECK_THROWS_WITH(f.membership(1.0), Catch::Matchers::StartsWith("[function error] unknown variable <y>"));
+            f.unload();
+            CHECK(f.program().empty());
+        }
+    }
+
     TEST_CASE("Function is clonable", "[term][function]") {
         Function* f = new Function;
         std::string text = "2+2";
@@ -2203,4 +2465,158 @@ namespace fuzzylite {
         CHECK(f.root()->treeSize(Function::Element::Operator) == 5);
     }
 
+    // the timings are hidden from the default run; run them with the tag [benchmark]
+    TEST_CASE("Benchmark evaluates the functions of the examples", "[.benchmark][term][function]") {
+        const std::vector<std::string> examples = examplesWith(".fll");
+        std::set<std::string> formulas;
+        const int evaluations = 1000000;
+        for (std::size_t e = 0; e < examples.size(); ++e) {
+            FL_unique_ptr<Engine> engine(loadExample(examples.at(e)));
+            const std::vector<Variable*> variables = engine->variables();
+            for (std::size_t v = 0; v < variables.size(); ++v)
+                variables.at(v)->setValue(variables.at(v)->getMinimum() + 0.37 * variables.at(v)->range());
+            for (std::size_t v = 0; v < variables.size(); ++v) {
+                for (std::size_t t = 0; t < variables.at(v)->numberOfTerms(); ++t) {
+                    Function* f = dynamic_cast<Function*>(variables.at(v)->getTerm(t));
+                    if (not f or not formulas.insert(f->getFormula()).second)
+                        continue;
+                    CAPTURE(examples.at(e), f->getFormula());
+                    REQUIRE_FALSE(f->program().empty());
+
+                    // before: the values of the variables are loaded into the map to evaluate the tree
+                    scalar map = 0.0;
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    for (int i = 0; i < evaluations; ++i) {
+                        for (std::size_t k = 0; k < variables.size(); ++k)
+                            f->variables[variables.at(k)->getName()] = variables.at(k)->getValue();
+                        f->variables["x"] = scalar(i);
+                        map += f->root()->evaluate(&f->variables);
+                    }
+                    const std::chrono::steady_clock::time_point mapEnd = std::chrono::steady_clock::now();
+                    f->variables.clear();
+
+                    // the tree reads the variables from the sources resolved when loaded
+                    scalar tree = 0.0;
+                    for (int i = 0; i < evaluations; ++i)
+                        tree += f->root()->evaluate(scalar(i), engine.get(), &f->variables);
+                    const std::chrono::steady_clock::time_point treeEnd = std::chrono::steady_clock::now();
+
+                    // after: the program is evaluated on a stack
+                    scalar program = 0.0;
+                    for (int i = 0; i < evaluations; ++i)
+                        program += f->membership(scalar(i));
+                    const std::chrono::steady_clock::time_point programEnd = std::chrono::steady_clock::now();
+
+                    const double mapTime = std::chrono::duration<double, std::nano>(mapEnd - start).count();
+                    const double treeTime = std::chrono::duration<double, std::nano>(treeEnd - mapEnd).count();
+                    const double programTime = std::chrono::duration<double, std::nano>(programEnd - treeEnd).count();
+                    FL_LOG(
+                        f->getFormula() << ": " << mapTime / evaluations << " ns/eval with the map, "
+                                        << treeTime / evaluations << " ns/eval with the tree, and "
+                                        << programTime / evaluations << " ns/eval with the program"
+                    );
+                    CHECK_THAT(program, Approximates(map));
+                    CHECK_THAT(program, Approximates(tree));
+                    CHECK(programTime < mapTime);
+                }
+            }
+        }
+        CHECK_FALSE(formulas.empty());
+    }
+
+    TEST_CASE("Batch memberships are the memberships", "[term][batch]") {
+        const std::vector<Term*> terms = {
+            new Triangle("", -0.5, 0.0, 0.5),
+            new Triangle("", -fl::inf, 0.0, 0.5),
+            new Triangle("", -0.5, 0.0, fl::inf),
+            new Triangle("", 0.0, 0.0, 0.5),
+            new Trapezoid("", -0.75, -0.25, 0.25, 0.75),
+            new Trapezoid("", -fl::inf, -0.25, 0.25, 0.75),
+            new Trapezoid("", -0.75, -0.25, 0.25, fl::inf),
+            new Trapezoid("", -0.5, -0.5, 0.5, 0.5),
+            new Gaussian("", 0.25, 0.3),
+            new GaussianProduct("", -0.25, 0.2, 0.25, 0.4),
+            new Bell("", 0.0, 0.25, 3.0),
+            new Sigmoid("", 0.0, 10.0),
+            new Sigmoid("", 0.25, -20.0),
+            new SShape("", -0.5, 0.5),
+            new ZShape("", -0.5, 0.5),
+            new PiShape("", -0.75, -0.25, 0.25, 0.75),
+            new Ramp("", -0.5, 0.5),
+            new Ramp("", 0.5, -0.5),
+            new Ramp("", 0.25, 0.25),
+            new Cosine("", 0.0, 1.0),
+        };
+        std::vector<scalar> x = Op::midpoints(-1.0, 1.0, 200);
+        for (scalar vertex : {-0.75, -0.5, -0.25, 0.0, 0.25, 0.5, 0.75}) {
+            x.push_back(vertex);
+            x.push_back(vertex - 0.5 * fuzzylite::macheps());
+            x.push_back(vertex + 0.5 * fuzzylite::macheps());
+            x.push_back(vertex - 2.0 * fuzzylite::macheps());
+            x.push_back(vertex + 2.0 * fuzzylite::macheps());
+        }
+        x.insert(x.end(), {-fl::inf, fl::inf, fl::nan});
+
+        for (Term* term : terms) {
+            for (scalar height : {0.0, 0.5, 1.0}) {
+                term->setHeight(height);
+                CAPTURE(term->toString());
+                std::vector<scalar> y(x.size(), -1.0);
+                term->membershipBatch(x.data(), y.data(), x.size());
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    CAPTURE(x.at(i));
+                    CHECK_THAT(y.at(i), Approximates(term->membership(x.at(i)), 0.0));
+                }
+
+                std::vector<scalar> inPlace(x);
+                term->membershipBatch(inPlace.data(), inPlace.data(), inPlace.size());
+                for (std::size_t i = 0; i < x.size(); ++i)
+                    CHECK_THAT(inPlace.at(i), Approximates(y.at(i), 0.0));
+            }
+            delete term;
+        }
+    }
+
+    TEST_CASE("Terms are zero outside of their support", "[term][support]") {
+        CHECK(Triangle("t", 0.0, 1.0, 2.0).support() == std::make_pair(0.0, 2.0));
+        CHECK(Trapezoid("t", 0.0, 1.0, 2.0, 3.0).support() == std::make_pair(0.0, 3.0));
+        CHECK(Rectangle("t", 0.0, 1.0).support() == std::make_pair(0.0, 1.0));
+        CHECK(Cosine("t", 1.0, 2.0).support() == std::make_pair(0.0, 2.0));
+        CHECK(PiShape("t", 0.0, 1.0, 2.0, 3.0).support() == std::make_pair(0.0, 3.0));
+        CHECK(SShape("t", 0.0, 1.0).support() == std::make_pair(0.0, fl::inf));
+        CHECK(ZShape("t", 0.0, 1.0).support() == std::make_pair(-fl::inf, 1.0));
+        CHECK(Ramp("t", 0.0, 1.0).support() == std::make_pair(0.0, fl::inf));
+        CHECK(Ramp("t", 1.0, 0.0).support() == std::make_pair(-fl::inf, 1.0));
+        CHECK(Binary("t", 1.0, fl::inf).support() == std::make_pair(1.0, fl::inf));
+        CHECK(Binary("t", 1.0, -fl::inf).support() == std::make_pair(-fl::inf, 1.0));
+        CHECK(Discrete("t", Discrete::toPairs({0.0, 0.0, 1.0, 1.0, 2.0, 0.0})).support() == std::make_pair(0.0, 2.0));
+        CHECK(
+            Discrete("t", Discrete::toPairs({0.0, 0.5, 1.0, 1.0, 2.0, 0.0})).support() == std::make_pair(-fl::inf, 2.0)
+        );
+        // the membership of the remaining terms is non-zero almost everywhere
+        CHECK(Spike("t", 0.0, 1.0).support() == std::make_pair(-fl::inf, fl::inf));
+        CHECK(Gaussian("t", 0.0, 1.0).support() == std::make_pair(-fl::inf, fl::inf));
+        CHECK(Constant("t", 0.0).support() == std::make_pair(-fl::inf, fl::inf));
+
+        const Term* terms[] = {
+            new Triangle("t", 0.0, 1.0, 2.0),
+            new Trapezoid("t", 0.0, 1.0, 2.0, 3.0),
+            new Rectangle("t", 0.0, 1.0),
+            new Cosine("t", 1.0, 2.0),
+            new PiShape("t", 0.0, 1.0, 2.0, 3.0),
+            new SShape("t", 0.0, 1.0),
+            new ZShape("t", 0.0, 1.0),
+            new Ramp("t", 1.0, 0.0),
+            new Binary("t", 1.0, fl::inf),
+        };
+        for (std::size_t i = 0; i < sizeof(terms) / sizeof(terms[0]); ++i) {
+            const std::pair<scalar, scalar> support = terms[i]->support();
+            for (scalar x = -5.0; x <= 5.0; x += 0.125) {
+                if (x < support.first or x > support.second)
+                    CHECK(terms[i]->membership(x) == 0.0);
+            }
+            delete terms[i];
+        }
+    }
+
 }  // namespace fl
@@ -0,0 +1,265 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+#include "../Examples.h"
+#include "../Headers.h"
+
+namespace fuzzylite {
+
+    static std::vector<std::string> binaryExamples() {
+        std::vector<std::string> examples;
+        examples.push_back("hybrid/ObstacleAvoidance");
+        examples.push_back("hybrid/tipper");
+        examples.push_back("mamdani/AllTerms");
+        examples.push_back("mamdani/Laundry");
+        examples.push_back("mamdani/ObstacleAvoidance");
+        examples.push_back("mamdani/SimpleDimmer");
+        examples.push_back("mamdani/SimpleDimmerChained");
+        examples.push_back("mamdani/SimpleDimmerInverse");
+        examples.push_back("mamdani/matlab/mam21");
+        examples.push_back("mamdani/matlab/mam22");
+        examples.push_back("mamdani/matlab/shower");
+        examples.push_back("mamdani/matlab/tank");
+        examples.push_back("mamdani/matlab/tank2");
+        examples.push_back("mamdani/matlab/tipper");
+        examples.push_back("mamdani/matlab/tipper1");
+        examples.push_back("mamdani/octave/investment_portfolio");
+        examples.push_back("mamdani/octave/mamdani_tip_calculator");
+        examples.push_back("takagi-sugeno/ObstacleAvoidance");
+        examples.push_back("takagi-sugeno/SimpleDimmer");
+        examples.push_back("takagi-sugeno/approximation");
+        examples.push_back("takagi-sugeno/matlab/fpeaks");
+        examples.push_back("takagi-sugeno/matlab/invkine1");
+        examples.push_back("takagi-sugeno/matlab/invkine2");
+        examples.push_back("takagi-sugeno/matlab/juggler");
+        examples.push_back("takagi-sugeno/matlab/membrn1");
+        examples.push_back("takagi-sugeno/matlab/membrn2");
+        examples.push_back("takagi-sugeno/matlab/slbb");
+        examples.push_back("takagi-sugeno/matlab/slcp");
+        examples.push_back("takagi-sugeno/matlab/slcp1");
+        examples.push_back("takagi-sugeno/matlab/slcpp1");
+        examples.push_back("takagi-sugeno/matlab/sltbu_fl");
+        examples.push_back("takagi-sugeno/matlab/sugeno1");
+        examples.push_back("takagi-sugeno/matlab/tanksg");
+        examples.push_back("takagi-sugeno/matlab/tippersg");
+        examples.push_back("takagi-sugeno/octave/cubic_approximator");
+        examples.push_back("takagi-sugeno/octave/heart_disease_risk");
+        examples.push_back("takagi-sugeno/octave/linear_tip_calculator");
+        examples.push_back("takagi-sugeno/octave/sugeno_tip_calculator");
+        examples.push_back("tsukamoto/tsukamoto");
+        return examples;
+    }
+
+    class Cubed : public Hedge {
+      public:
+        std::string name() const FL_IOVERRIDE {
+            return "cubed";
+        }
+
+        scalar hedge(scalar x) const FL_IOVERRIDE {
+            return x * x * x;
+        }
+
+        Cubed* clone() const FL_IOVERRIDE {
+            return new Cubed(*this);
+        }
+
+        static Hedge* constructor() {
+            return new Cubed;
+        }
+    };
+
+    TEST_CASE("BinaryImporter loads the same engines as FllImporter", "[imex][binary]") {
+        const std::vector<std::string> examples = binaryExamples();
+        for (std::size_t e = 0; e < examples.size(); ++e) {
+            const std::string example = examples.at(e);
+            CAPTURE(example);
+            FL_unique_ptr<Engine> expected(FllImporter().fromFile(examplesPath() + example + ".fll"));
+            const std::string binary = BinaryExporter().toString(expected.get());
+            FL_unique_ptr<Engine> obtained(BinaryImporter().fromString(binary));
+
+            CHECK(FllExporter().toString(obtained.get()) == FllExporter().toString(expected.get()));
+            CHECK(BinaryExporter().toString(obtained.get()) == binary);
+            for (std::size_t b = 0; b < obtained->numberOfRuleBlocks(); ++b) {
+                for (std::size_t r = 0; r < obtained->getRuleBlock(b)->numberOfRules(); ++r)
+                    CHECK(obtained->getRuleBlock(b)->getRule(r)->isLoaded());
+            }
+
+            std::size_t differences = 0;
+            for (int row = 0; row < 64; ++row) {
+                for (std::size_t v = 0; v < expected->numberOfInputVariables(); ++v) {
+                    const InputVariable* inputVariable = expected->getInputVariable(v);
+                    const scalar position = (row * 0.618034 - int(row * 0.618034)) * 1.2 - 0.1;
+                    const scalar value = inputVariable->getMinimum() + position * inputVariable->range();
+                    expected->getInputVariable(v)->setValue(value);
+                    obtained->getInputVariable(v)->setValue(value);
+                }
+                expected->process();
+                obtained->process();
+                for (std::size_t v = 0; v < expected->numberOfOutputVariables(); ++v) {
+                    const scalar value = obtained->getOutputVariable(v)->getValue();
+                    if (not isIdentical(expected->getOutputVariable(v)->getValue(), value))
+                        ++differences;
+                }
+            }
+            CHECK(differences == 0);
+        }
+    }
+
+    TEST_CASE("BinaryImporter round trips a rule block with many rules", "[imex][binary]") {
+        const int variables = 4, terms = 6, rules = 500;
+        std::ostringstream fll;
+        fll << "Engine: many\n";
+        for (int v = 0; v < variables; ++v) {
+            fll << "InputVariable: input" << v << "\n  range: 0.000 1.000\n";
+            for (int t = 0; t < terms; ++t)
+                fll << "  term: term" << t << " Triangle " << (t - 1.0) / terms << " " << scalar(t) / terms << " "
+                    << (t + 1.0) / terms << "\n";
+        }
+        fll << "OutputVariable: output\n  range: 0.000 1.000\n  aggregation: Maximum\n  defuzzifier: Centroid 100\n";
+        for (int t = 0; t < terms; ++t)
+            fll << "  term: term" << t << " Triangle " << (t - 1.0) / terms << " " << scalar(t) / terms << " "
+                << (t + 1.0) / terms << "\n";
+        fll << "RuleBlock: rules\n  conjunction: Minimum\n  disjunction: Maximum\n  implication: Minimum\n"
+            << "  activation: General\n";
+        unsigned long seed = 1;
+        for (int r = 0; r < rules; ++r) {
+            fll << "  rule: if";
+            for (int p = 0; p < 3; ++p) {
+                seed = (seed * 1103515245ul + 12345ul) % 2147483648ul;
+                fll << (p == 0 ? " " : (p == 1 ? " and " : " or ")) << "input" << (seed / 7) % variables
+                    << " is " << ((seed / 71) % 3 == 0 ? "very " : "") << "term" << (seed / 13) % terms;
+            }
+            fll << " then output is term" << r % terms << "\n";
+        }
+
+        FL_unique_ptr<Engine> expected(FllImporter().fromString(fll.str()));
+        const std::string binary = BinaryExporter().toString(expected.get());
+        FL_unique_ptr<Engine> obtained(BinaryImporter().fromString(binary));
+        const RuleBlock* ruleBlock = obtained->getRuleBlock(0);
+        REQUIRE(ruleBlock->numberOfRules() == std::size_t(rules));
+        for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r)
+            CHECK(ruleBlock->getRule(r)->isLoaded());
+        CHECK(BinaryExporter().toString(obtained.get()) == binary);
+        CHECK(FllExporter().toString(obtained.get()) == FllExporter().toString(expected.get()));
+    }
+
+    TEST_CASE("BinaryImporter loads the rules that were not loaded from their text", "[imex][binary]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll"));
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+        ruleBlock->getRule(0)->unload();
+        ruleBlock->addRule(new Rule("if service is good then tip is cheap with 0.5"));
+        ruleBlock->addRule(new Rule("if service is unknown then tip is cheap"));
+        ruleBlock->getRule(1)->setEnabled(false);
+
+        FL_unique_ptr<Engine> imported(BinaryImporter().fromString(BinaryExporter().toString(engine.get())));
+        const RuleBlock* importedBlock = imported->getRuleBlock(0);
+        REQUIRE(importedBlock->numberOfRules() == ruleBlock->numberOfRules());
+        CHECK(importedBlock->getRule(0)->isLoaded());
+        CHECK_FALSE(importedBlock->getRule(1)->isEnabled());
+        CHECK(importedBlock->getRule(3)->isLoaded());
+        CHECK(importedBlock->getRule(3)->getWeight() == 0.5);
+        CHECK_FALSE(importedBlock->getRule(4)->isLoaded());
+        CHECK(importedBlock->getRule(4)->getText() == "if service is unknown then tip is cheap");
+    }
+
+    TEST_CASE("BinaryImporter loads the hedges and rule blocks of the engine", "[imex][binary]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll"));
+        FactoryManager::instance()->hedge()->registerConstructor("cubed", &Cubed::constructor);
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+        ruleBlock->setActivation(new Threshold(Threshold::LessThan, 0.75));
+        ruleBlock->addRule(Rule::parse(
+            "if service is not cubed poor or food is any and food is somewhat extremely seldom rancid "
+            "then tip is very cheap and tip is not average",
+            engine.get()
+        ));
+        engine->getOutputVariable(0)->setDefuzzifier(new Centroid(200, true));
+        engine->getOutputVariable(0)->getTerm(0)->setHeight(0.5);
+
+        FL_unique_ptr<Engine> imported(BinaryImporter().fromString(BinaryExporter().toString(engine.get())));
+        CHECK(FllExporter().toString(imported.get()) == FllExporter().toString(engine.get()));
+        const Rule* rule = imported->getRuleBlock(0)->getRule(3);
+        CHECK(rule->getAntecedent()->toPostfix() == engine->getRuleBlock(0)->getRule(3)->getAntecedent()->toPostfix());
+        CHECK(rule->getConsequent()->toString() == engine->getRuleBlock(0)->getRule(3)->getConsequent()->toString());
+        FactoryManager::instance()->hedge()->deregisterConstructor("cubed");
+    }
+
+    TEST_CASE("BinaryImporter fails on invalid binary engines", "[imex][binary]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll"));
+        const std::string binary = BinaryExporter().toString(engine.get());
+        CHECK(binary.substr(0, 4) == BinaryExporter::magic());
+
+        CHECK_THROWS_AS(BinaryImporter().fromString(""), Exception);
+        CHECK_THROWS_AS(BinaryImporter().fromString(FllExporter().toString(engine.get())), Exception);
+        CHECK_THROWS_AS(BinaryImporter().fromString(binary.substr(0, binary.size() - 1)), Exception);
+        CHECK_THROWS_AS(BinaryImporter().fromString(binary + "?"), Exception);
+        std::string unsupported(binary);
+        unsupported[4] = char(BinaryExporter::version() + 1);
+        CHECK_THROWS_AS(BinaryImporter().fromString(unsupported), Exception);
+        for (std::size_t size = 0; size < binary.size(); size += 7)
+            CHECK_THROWS_AS(BinaryImporter().fromMemory(binary.data(), size), Exception);
+    }
+
+    TEST_CASE("BinaryImporter fails on hedges and defuzzifiers that are not recognized", "[imex][binary]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll"));
+        SECTION("hedges") {
+            FactoryManager::instance()->hedge()->registerConstructor("cubed", &Cubed::constructor);
+            engine->getRuleBlock(0)->addRule(Rule::parse("if service is cubed poor then tip is cheap", engine.get()));
+            const std::string binary = BinaryExporter().toString(engine.get());
+            FactoryManager::instance()->hedge()->deregisterConstructor("cubed");
+            CHECK_THROWS_WITH(
+                BinaryImporter().fromString(binary), Catch::Matchers::StartsWith("[import error] hedge <cubed>")
+            );
+            FactoryManager::instance()->hedge()->registerConstructor("cubed", fl::null);
+            CHECK_THROWS_WITH(
+                BinaryImporter().fromString(binary), Catch::Matchers::StartsWith("[import error] hedge <cubed>")
+            );
+            FactoryManager::instance()->hedge()->deregisterConstructor("cubed");
+        }
+        SECTION("defuzzifiers") {
+            std::string binary = BinaryExporter().toString(engine.get());
+            const std::size_t index = binary.find("Centroid");
+            REQUIRE(index != std::string::npos);
+            binary.replace(index, 8, "Centroix");
+            CHECK_THROWS_WITH(
+                BinaryImporter().fromString(binary),
+                Catch::Matchers::StartsWith("[import error] defuzzifier <Centroix>")
+            );
+            FactoryManager::instance()->defuzzifier()->registerConstructor("Centroix", fl::null);
+            CHECK_THROWS_WITH(
+                BinaryImporter().fromString(binary),
+                Catch::Matchers::StartsWith("[import error] defuzzifier <Centroix>")
+            );
+            FactoryManager::instance()->defuzzifier()->deregisterConstructor("Centroix");
+        }
+    }
+
+    TEST_CASE("BinaryImporter loads the engine from a file", "[imex][binary]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/AllTerms.fll"));
+        const std::string path = "BinaryImporterTest.flb";
+        BinaryExporter().toFile(path, engine.get());
+        FL_unique_ptr<Engine> imported(BinaryImporter().fromFile(path));
+        std::remove(path.c_str());
+        CHECK(FllExporter().toString(imported.get()) == FllExporter().toString(engine.get()));
+        CHECK_THROWS_AS(BinaryImporter().fromFile(path), Exception);
+    }
+
+}
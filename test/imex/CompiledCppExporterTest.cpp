@@ -0,0 +1,194 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#include "../Examples.h"
+#include "../Headers.h"
+
+#ifdef FL_UNIX
+#include <unistd.h>
+#endif
+
+namespace fuzzylite {
+
+    static bool isClose(scalar expected, scalar obtained) {
+        if (Op::isNaN(expected) or Op::isNaN(obtained))
+            return Op::isNaN(expected) and Op::isNaN(obtained);
+        return expected == obtained or std::fabs(expected - obtained) <= 1e-9 * std::max(1.0, std::fabs(expected));
+    }
+
+    TEST_CASE("CompiledCppExporter exports the name of the function", "[imex][compiled]") {
+        CompiledCppExporter exporter;
+        CHECK(exporter.name() == "CompiledCppExporter");
+        CHECK(exporter.getFunctionName() == "evaluate");
+        exporter.setFunctionName("tipper");
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll"));
+        const std::string code = exporter.toString(engine.get());
+        CHECK(code.find("void tipper(const double* in, double* out) {") != std::string::npos);
+        CHECK(code.find("#include \"fuzzylite/") == std::string::npos);
+    }
+
+    TEST_CASE("CompiledCppExporter fails on engines that cannot be translated", "[imex][compiled]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll"));
+        CompiledCppExporter exporter;
+        CHECK_NOTHROW(exporter.toString(engine.get()));
+
+        SECTION("exact integration") {
+            engine->getOutputVariable(0)->setDefuzzifier(new Centroid(100, true));
+            CHECK_THROWS_AS(exporter.toString(engine.get()), Exception);
+        }
+        SECTION("missing aggregation") {
+            engine->getOutputVariable(0)->setAggregation(fl::null);
+            CHECK_THROWS_AS(exporter.toString(engine.get()), Exception);
+        }
+        SECTION("missing defuzzifier") {
+            engine->getOutputVariable(0)->setDefuzzifier(fl::null);
+            CHECK_THROWS_AS(exporter.toString(engine.get()), Exception);
+        }
+    }
+
+#ifdef FL_UNIX
+    TEST_CASE("CompiledCppExporter produces the same results as Engine", "[imex][compiled]") {
+        if (std::system("c++ --version > /dev/null 2>&1") != 0) {
+            WARN("skipped: a C++ compiler is not available");
+            return;
+        }
+        char directoryTemplate[] = "/tmp/fl-compiled-cpp-XXXXXX";
+        const char* created = ::mkdtemp(directoryTemplate);
+        REQUIRE(created != fl::null);
+        const std::string directory(created);
+
+        std::vector<std::string> names = examplesWith(".fll");
+        CHECK(std::find(names.begin(), names.end(), "original/mamdani/SimpleDimmer") != names.end());
+        std::vector<Engine*> engines;
+        for (std::size_t i = 0; i < names.size(); ++i)
+            engines.push_back(FllImporter().fromFile(examplesPath() + names.at(i) + ".fll"));
+        std::vector<Activation*> activations;
+        activations.push_back(new First(2, 0.1));
+        activations.push_back(new Last(2, 0.1));
+        activations.push_back(new Highest(2));
+        activations.push_back(new Lowest(2));
+        activations.push_back(new Proportional);
+        activations.push_back(new Threshold(Threshold::GreaterThan, 0.3));
+        for (std::size_t i = 0; i < activations.size(); ++i) {
+            Engine* engine = FllImporter().fromFile(examplesPath() + "mamdani/matlab/tipper.fll");
+            engine->getRuleBlock(0)->setActivation(activations.at(i));
+            engines.push_back(engine);
+            names.push_back("mamdani/matlab/tipper with " + activations.at(i)->className());
+        }
+
+        // each engine is exported to its own file, and a driver evaluates the inputs of all the engines
+        std::string sources;
+        std::ostringstream driver;
+        std::ostringstream table;
+        std::ofstream inputs((directory + "/inputs.txt").c_str());
+        const int rows = 64;
+        for (std::size_t e = 0; e < engines.size(); ++e) {
+            const std::string function = "evaluate_" + Op::str(e);
+            const std::string source = directory + "/" + function + ".cpp";
+            std::ofstream(source.c_str()) << CompiledCppExporter(function).toString(engines.at(e));
+            sources += " " + source;
+            driver << "void " << function << "(const double* in, double* out);\n";
+            table << (e ? ", " : "") << function;
+
+            const Engine* engine = engines.at(e);
+            inputs << engine->numberOfInputVariables() << " " << engine->numberOfOutputVariables() << "\n";
+            for (int row = 0; row < rows; ++row) {
+                for (std::size_t v = 0; v < engine->numberOfInputVariables(); ++v) {
+                    const InputVariable* inputVariable = engine->getInputVariable(v);
+                    // the last rows are out of range to exercise the locks in range
+                    const scalar position = (row * 0.618034 - int(row * 0.618034)) * 1.2 - 0.1;
+                    inputs << Op::str(inputVariable->getMinimum() + position * inputVariable->range(), 17) << " ";
+                }
+                inputs << "\n";
+            }
+        }
+        inputs.close();
+        driver << "#include <cmath>\n#include <cstdio>\n#include <limits>\n"
+               << "typedef void (*Function)(const double*, double*);\n"
+               << "int main(int, char** argv) {\n"
+               << "    const Function functions[] = {" << table.str() << "};\n"
+               << "    std::FILE* file = std::fopen(argv[1], \"r\");\n"
+               << "    double in[64], out[64];\n"
+               << "    int inputs, outputs;\n"
+               << "    for (unsigned e = 0; e < sizeof(functions) / sizeof(functions[0]); ++e) {\n"
+               << "        if (std::fscanf(file, \"%d %d\", &inputs, &outputs) != 2) return 1;\n"
+               << "        for (int o = 0; o < outputs; ++o) out[o] = std::numeric_limits<double>::quiet_NaN();\n"
+               << "        for (int row = 0; row < " << rows << "; ++row) {\n"
+               << "            for (int i = 0; i < inputs; ++i) if (std::fscanf(file, \"%lf\", &in[i]) != 1) return 1;\n"
+               << "            functions[e](in, out);\n"
+               << "            for (int o = 0; o < outputs; ++o) std::printf(\"%.17g\\n\", out[o]);\n"
+               << "        }\n"
+               << "    }\n"
+               << "    std::fclose(file);\n"
+               << "    return 0;\n"
+               << "}\n";
+        std::ofstream((directory + "/main.cpp").c_str()) << driver.str();
+
+        const std::string program = directory + "/evaluate";
+        const std::string command = "c++ -O1 -Wall -Wextra -Werror -o " + program + " " + directory + "/main.cpp"
+                                    + sources + " > " + directory + "/compiler.log 2>&1";
+        const bool compiled = std::system(command.c_str()) == 0;
+        std::ifstream log((directory + "/compiler.log").c_str());
+        const std::string compilerLog((std::istreambuf_iterator<char>(log)), std::istreambuf_iterator<char>());
+        CAPTURE(compilerLog);
+        REQUIRE(compiled);
+        REQUIRE(
+            std::system((program + " " + directory + "/inputs.txt > " + directory + "/outputs.txt").c_str()) == 0
+        );
+
+        std::ifstream values((directory + "/inputs.txt").c_str());
+        std::ifstream outputs((directory + "/outputs.txt").c_str());
+        for (std::size_t e = 0; e < engines.size(); ++e) {
+            const std::string example = names.at(e);
+            CAPTURE(example);
+            Engine* engine = engines.at(e);
+            std::size_t numberOfInputs, numberOfOutputs;
+            values >> numberOfInputs >> numberOfOutputs;
+            std::size_t differences = 0;
+            std::string firstDifference;
+            for (int row = 0; row < rows; ++row) {
+                for (std::size_t v = 0; v < numberOfInputs; ++v) {
+                    std::string token;
+                    values >> token;
+                    engine->getInputVariable(v)->setValue(Op::toScalar(token));
+                }
+                engine->process();
+                for (std::size_t v = 0; v < numberOfOutputs; ++v) {
+                    std::string token;
+                    outputs >> token;
+                    const scalar expected = engine->getOutputVariable(v)->getValue();
+                    const scalar obtained = Op::toScalar(token, fl::nan);
+                    if (not isClose(expected, obtained) and differences++ == 0)
+                        firstDifference = "row " + Op::str(row) + ": " + engine->getOutputVariable(v)->getName()
+                                          + " expected " + Op::str(expected, 17) + " but obtained " + token;
+                }
+            }
+            CAPTURE(firstDifference);
+            CHECK(differences == 0);
+        }
+
+        for (std::size_t e = 0; e < engines.size(); ++e)
+            delete engines.at(e);
+        std::system(("rm -rf " + directory).c_str());
+    }
+#endif
+}
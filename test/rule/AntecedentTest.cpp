@@ -0,0 +1,163 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <thread>
+
+#include "../Headers.h"
+
+namespace fuzzylite {
+
+    /**
+     * Tests: rule/Antecedent
+     *
+     * @author Juan Rada-Vilela, Ph.D.
+     *
+     */
+
+    TEST_CASE("Antecedent computes the same activation degree as the expression tree", "[rule][antecedent]") {
+        Engine engine;
+        InputVariable* a = new InputVariable("A", 0.0, 1.0);
+        a->addTerm(new Ramp("high", 0.0, 1.0));
+        engine.addInputVariable(a);
+        InputVariable* b = new InputVariable("B", 0.0, 1.0);
+        b->addTerm(new Ramp("low", 1.0, 0.0));
+        engine.addInputVariable(b);
+        OutputVariable* c = new OutputVariable("C", 0.0, 1.0);
+        c->addTerm(new Triangle("mid", 0.0, 0.5, 1.0));
+        c->fuzzyOutput()->addTerm(c->getTerm(0), 0.4, fl::null);
+        engine.addOutputVariable(c);
+
+        AlgebraicProduct conjunction;
+        Maximum disjunction;
+        const std::string texts[] = {
+            "A is high and B is low",
+            "A is very high or B is not low and C is mid",
+            "(A is somewhat high or B is low) and (A is any or B is not any)",
+            "A is extremely seldom high",
+        };
+        for (std::size_t t = 0; t < sizeof(texts) / sizeof(texts[0]); ++t) {
+            Antecedent antecedent;
+            antecedent.load(texts[t], &engine);
+            for (scalar x = 0.0; x <= 1.0; x += 0.25) {
+                a->setValue(x);
+                b->setValue(1.0 - x / 2);
+                const scalar expected = antecedent.activationDegree(&conjunction, &disjunction, antecedent.getExpression());
+                CHECK(antecedent.activationDegree(&conjunction, &disjunction) == expected);
+            }
+            a->setEnabled(false);
+            CHECK(antecedent.activationDegree(&conjunction, &disjunction)
+                  == antecedent.activationDegree(&conjunction, &disjunction, antecedent.getExpression()));
+            a->setEnabled(true);
+        }
+    }
+
+    TEST_CASE("Antecedent computes the activation degree of deep expressions concurrently", "[rule][antecedent]") {
+        Engine engine;
+        InputVariable* a = new InputVariable("A", 0.0, 1.0);
+        a->addTerm(new Ramp("high", 0.0, 1.0));
+        a->setValue(0.8);
+        engine.addInputVariable(a);
+        InputVariable* b = new InputVariable("B", 0.0, 1.0);
+        b->addTerm(new Ramp("low", 1.0, 0.0));
+        b->setValue(0.3);
+        engine.addInputVariable(b);
+
+        // the nested parentheses are deeper than the stack that is not allocated
+        std::string text = "A is high";
+        for (int depth = 0; depth < 40; ++depth)
+            text = (depth % 2 == 0 ? "B is low or (" : "A is very high and (") + text + ")";
+        Antecedent antecedent;
+        antecedent.load(text, &engine);
+        AlgebraicProduct conjunction;
+        AlgebraicSum disjunction;
+        const scalar expected = antecedent.activationDegree(&conjunction, &disjunction, antecedent.getExpression());
+        CHECK(antecedent.activationDegree(&conjunction, &disjunction) == expected);
+
+        std::vector<int> differences(4, 0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < differences.size(); ++t) {
+            threads.push_back(std::thread([&, t]() {
+                for (int i = 0; i < 1000; ++i) {
+                    if (antecedent.activationDegree(&conjunction, &disjunction) != expected)
+                        ++differences.at(t);
+                }
+            }));
+        }
+        for (std::size_t t = 0; t < threads.size(); ++t)
+            threads.at(t).join();
+        CHECK(differences == std::vector<int>(4, 0));
+    }
+
+    TEST_CASE("Antecedent requires the operators of the expression", "[rule][antecedent]") {
+        Engine engine;
+        InputVariable* a = new InputVariable("A", 0.0, 1.0);
+        a->addTerm(new Ramp("high", 0.0, 1.0));
+        a->setValue(0.5);
+        engine.addInputVariable(a);
+
+        Antecedent antecedent;
+        antecedent.load("A is high or A is not high", &engine);
+        Minimum minimum;
+        CHECK_THROWS_WITH(
+            antecedent.activationDegree(&minimum, fl::null),
+            Catch::Matchers::StartsWith("[disjunction error] the following rule requires a disjunction operator")
+        );
+        Maximum maximum;
+        CHECK(antecedent.activationDegree(fl::null, &maximum) == 0.5);
+
+        antecedent.unload();
+        CHECK_THROWS_WITH(
+            antecedent.activationDegree(fl::null, &maximum),
+            Catch::Matchers::StartsWith("[antecedent error] antecedent <A is high or A is not high> is not loaded")
+        );
+    }
+
+    TEST_CASE("Antecedent loads the precedence of the logical operators and parentheses", "[rule][antecedent]") {
+        Engine engine;
+        InputVariable* a = new InputVariable("A", 0.0, 1.0);
+        a->addTerm(new Ramp("high", 0.0, 1.0));
+        engine.addInputVariable(a);
+        OutputVariable* b = new OutputVariable("B", 0.0, 1.0);
+        b->addTerm(new Ramp("low", 1.0, 0.0));
+        engine.addOutputVariable(b);
+
+        Antecedent antecedent;
+        antecedent.load("A is high or B is low and A is very high", &engine);
+        CHECK(antecedent.toPostfix() == "A is high B is low A is very high and  or ");
+        antecedent.load("A is high and B is low or A is very high", &engine);
+        CHECK(antecedent.toPostfix() == "A is high B is low and  A is very high or ");
+        antecedent.load("A is high or B is low or A is very high", &engine);
+        CHECK(antecedent.toPostfix() == "A is high B is low or  A is very high or ");
+        antecedent.load("(A is high or B is low)and(A is very high)", &engine);
+        CHECK(antecedent.toPostfix() == "A is high B is low or  A is very high and ");
+        antecedent.load("\tA is high\nand ((B is not low))", &engine);
+        CHECK(antecedent.toPostfix() == "A is high B is not low and ");
+
+        CHECK_THROWS_WITH(
+            antecedent.load("(A is high or B is low", &engine),
+            Catch::Matchers::StartsWith("[parsing error] mismatching parentheses")
+        );
+        CHECK_THROWS_WITH(
+            antecedent.load("A is high) or B is low", &engine),
+            Catch::Matchers::StartsWith("[parsing error] mismatching parentheses")
+        );
+        CHECK_THROWS_AS(antecedent.load("A is high or", &engine), Exception);
+        CHECK_THROWS_AS(antecedent.load("A is unknown", &engine), Exception);
+        CHECK_FALSE(antecedent.isLoaded());
+    }
+
+}
@@ -0,0 +1,220 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "../Headers.h"
+
+namespace fuzzylite {
+
+    /**
+     * Tests: rule/RuleBlockScheduler
+     *
+     * @author Juan Rada-Vilela, Ph.D.
+     *
+     */
+
+    namespace {
+        std::string variables() {
+            std::ostringstream fll;
+            const std::string inputs[] = {"A", "B"};
+            for (int i = 0; i < 2; ++i) {
+                fll << "InputVariable: " << inputs[i] << "\n"
+                    << "  range: 0.000 1.000\n"
+                    << "  term: low Ramp 1.000 0.000\n"
+                    << "  term: high Ramp 0.000 1.000\n";
+            }
+            const std::string outputs[] = {"X", "Y", "Z"};
+            for (int i = 0; i < 3; ++i) {
+                fll << "OutputVariable: " << outputs[i] << "\n"
+                    << "  range: 0.000 1.000\n"
+                    << "  aggregation: Maximum\n"
+                    << "  defuzzifier: Centroid 100\n"
+                    << "  term: low Triangle 0.000 0.250 0.500\n"
+                    << "  term: high Triangle 0.500 0.750 1.000\n";
+            }
+            return fll.str();
+        }
+
+        std::string tree() {
+            return "Engine: tree\n" + variables();
+        }
+
+        std::string ruleBlock(const std::string& name, const std::string& rules) {
+            return "RuleBlock: " + name
+                   + "\n"
+                     "  conjunction: Minimum\n"
+                     "  disjunction: Maximum\n"
+                     "  implication: Minimum\n"
+                     "  activation: General\n"
+                   + rules;
+        }
+
+        const std::string blockX = ruleBlock(
+            "x",
+            "  rule: if A is low then X is low\n"
+            "  rule: if A is high then X is high\n"
+        );
+        const std::string blockY = ruleBlock(
+            "y",
+            "  rule: if B is low then Y is low\n"
+            "  rule: if B is high then Y is high\n"
+        );
+        const std::string blockZ = ruleBlock(
+            "z",
+            "  rule: if X is high and Y is low then Z is high\n"
+            "  rule: if X is low or Y is high then Z is low\n"
+        );
+    }
+
+    TEST_CASE("RuleBlockScheduler activates the rule blocks after their dependencies", "[rule][scheduler]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(tree() + blockZ + blockX + blockY));
+        FL_unique_ptr<Engine> declared(FllImporter().fromString(tree() + blockX + blockY + blockZ));
+
+        const RuleBlockScheduler& scheduler = engine->ruleBlockScheduler();
+        REQUIRE(scheduler.cycles().empty());
+        CHECK(scheduler.order() == std::vector<std::size_t>{1, 2, 0});
+        CHECK(scheduler.dependencies(0) == std::vector<std::size_t>{1, 2});
+        CHECK(scheduler.dependencies(1).empty());
+        CHECK(scheduler.dependencies(2).empty());
+        CHECK(scheduler.width() == 2);
+        CHECK(scheduler.isConcurrent(2));
+        CHECK_FALSE(scheduler.isConcurrent(1));
+        CHECK(engine->isReady());
+
+        for (std::size_t threads = 1; threads <= 4; threads += 3) {
+            engine->setNumberOfThreads(threads);
+            for (int a = 0; a <= 4; ++a) {
+                for (int b = 0; b <= 4; ++b) {
+                    engine->setInputValue("A", a / 4.0);
+                    engine->setInputValue("B", b / 4.0);
+                    engine->process();
+                    declared->setInputValue("A", a / 4.0);
+                    declared->setInputValue("B", b / 4.0);
+                    declared->process();
+                    for (std::size_t o = 0; o < engine->numberOfOutputVariables(); ++o) {
+                        const scalar expected = declared->getOutputVariable(o)->getValue();
+                        const scalar obtained = engine->getOutputVariable(o)->getValue();
+                        CHECK((obtained == expected or (Op::isNaN(obtained) and Op::isNaN(expected))));
+                    }
+                }
+            }
+        }
+
+        // the schedule is rebuilt when the rule blocks change
+        engine->getRuleBlock(0)->setEnabled(false);
+        engine->process();
+        CHECK(scheduler.order() == std::vector<std::size_t>{1, 2});
+        CHECK(Op::isNaN(engine->getOutputValue("Z")));
+        // the schedule is kept while other engines load their rules
+        CHECK(scheduler.isBuiltFor(engine.get()));
+        FL_unique_ptr<Engine> other(declared->clone());
+        other->getRuleBlock(0)->reloadRules(other.get());
+        CHECK(scheduler.isBuiltFor(engine.get()));
+        engine->getRuleBlock(1)->reloadRules(engine.get());
+        CHECK_FALSE(scheduler.isBuiltFor(engine.get()));
+    }
+
+    TEST_CASE("RuleBlockScheduler activates the rule blocks that read the same output variable", "[rule][scheduler]") {
+        // the rule blocks have enough rules to be activated by different threads at the same time
+        std::string rulesY, rulesZ;
+        for (int i = 0; i < 50; ++i) {
+            rulesY += "  rule: if X is low and A is high then Y is low\n"
+                      "  rule: if X is high or A is low then Y is high\n";
+            rulesZ += "  rule: if X is high and A is high then Z is high\n"
+                      "  rule: if X is low or A is low then Z is low\n";
+        }
+        const std::string readerY = ruleBlock("y", rulesY);
+        const std::string readerZ = ruleBlock("z", rulesZ);
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(tree() + blockX + readerY + readerZ));
+        FL_unique_ptr<Engine> serial(engine->clone());
+
+        const RuleBlockScheduler& scheduler = engine->ruleBlockScheduler();
+        REQUIRE(scheduler.cycles().empty());
+        CHECK(scheduler.dependencies(1) == std::vector<std::size_t>{0});
+        CHECK(scheduler.dependencies(2) == std::vector<std::size_t>{0});
+        CHECK(scheduler.width() == 2);
+
+        // the rule blocks read the fuzzy output of X and the memberships of A concurrently
+        engine->setNumberOfThreads(4);
+        std::size_t mismatches = 0;
+        for (int i = 0; i <= 100; ++i) {
+            engine->setInputValue("A", i / 100.0);
+            engine->process();
+            serial->setInputValue("A", i / 100.0);
+            serial->process();
+            for (std::size_t o = 0; o < engine->numberOfOutputVariables(); ++o) {
+                const scalar expected = serial->getOutputVariable(o)->getValue();
+                const scalar obtained = engine->getOutputVariable(o)->getValue();
+                mismatches += not(obtained == expected or (Op::isNaN(obtained) and Op::isNaN(expected)));
+            }
+        }
+        CHECK(mismatches == 0);
+    }
+
+    TEST_CASE("RuleBlockScheduler orders the rule blocks that modify the same output variable", "[rule][scheduler]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(
+            "Engine: shared\n" + variables()
+            + ruleBlock("first", "  rule: if A is low then X is low\n")
+            + ruleBlock("reader", "  rule: if X is low then Z is high\n")
+            + ruleBlock("second", "  rule: if B is high then X is high\n")
+        ));
+        const RuleBlockScheduler& scheduler = engine->ruleBlockScheduler();
+        REQUIRE(scheduler.cycles().empty());
+        CHECK(scheduler.order() == std::vector<std::size_t>{0, 2, 1});
+        CHECK(scheduler.dependencies(1) == std::vector<std::size_t>{0, 2});
+        CHECK(scheduler.dependencies(2) == std::vector<std::size_t>{0});
+        CHECK(scheduler.width() == 1);
+    }
+
+    TEST_CASE("RuleBlockScheduler reports cycles and activates the rule blocks in order", "[rule][scheduler]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(
+            "Engine: cycle\n" + variables()
+            + ruleBlock("x", "  rule: if Y is low then X is high\n  rule: if A is high then X is low\n")
+            + ruleBlock("y", "  rule: if X is high then Y is high\n  rule: if B is high then Y is low\n")
+            + blockZ
+        ));
+        const RuleBlockScheduler& scheduler = engine->ruleBlockScheduler();
+        REQUIRE(scheduler.cycles().size() == 1);
+        CHECK(scheduler.cycles().front() == std::vector<std::size_t>{0, 1});
+        CHECK(scheduler.order() == std::vector<std::size_t>{0, 1, 2});
+        CHECK_FALSE(scheduler.isConcurrent(4));
+
+        std::string status;
+        CHECK_FALSE(engine->isReady(&status));
+        CHECK(status == "- Rule blocks 1 <x>, 2 <y> depend on each other through their output variables\n");
+
+        engine->setNumberOfThreads(4);
+        engine->setInputValue("A", 1.0);
+        engine->setInputValue("B", 1.0);
+        engine->process();
+        // the first rule block reads Y before it is modified
+        CHECK(engine->getRuleBlock(0)->getRule(0)->getActivationDegree() == 0.0);
+        CHECK(engine->getRuleBlock(0)->getRule(1)->getActivationDegree() == 1.0);
+    }
+
+    TEST_CASE("RuleBlockScheduler rethrows the exceptions of the rule blocks", "[rule][scheduler]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(tree() + blockX + blockY + blockZ));
+        engine->getRuleBlock(1)->setImplication(fl::null);
+        engine->setInputValue("A", 0.5);
+        engine->setInputValue("B", 0.5);
+        for (std::size_t threads = 1; threads <= 4; threads += 3) {
+            engine->setNumberOfThreads(threads);
+            CHECK_THROWS_AS(engine->process(), fl::Exception);
+            CHECK_FALSE(engine->getInputVariable(0)->isCachingMemberships());
+        }
+    }
+
+}
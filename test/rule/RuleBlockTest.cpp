@@ -0,0 +1,195 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include <thread>
+
+#include "../Headers.h"
+
+namespace fuzzylite {
+
+    /**
+     * Tests: rule/RuleBlock
+     *
+     * @author Juan Rada-Vilela, Ph.D.
+     *
+     */
+
+    namespace {
+        Engine* gridEngine(int numberOfInputs, int numberOfTerms) {
+            Engine* engine = new Engine("grid");
+            for (int i = 0; i < numberOfInputs; ++i) {
+                InputVariable* input = new InputVariable("in" + Op::str(i), 0.0, 1.0);
+                const scalar step = 1.0 / (numberOfTerms - 1);
+                for (int t = 0; t < numberOfTerms; ++t)
+                    input->addTerm(new Triangle("t" + Op::str(t), (t - 1) * step, t * step, (t + 1) * step));
+                engine->addInputVariable(input);
+            }
+            OutputVariable* output = new OutputVariable("out", 0.0, 1.0);
+            output->setAggregation(new Maximum);
+            output->setDefuzzifier(new Centroid(100));
+            for (int t = 0; t < numberOfTerms; ++t)
+                output->addTerm(new Triangle("t" + Op::str(t), t - 1.0, t * 1.0, t + 1.0));
+            engine->addOutputVariable(output);
+
+            RuleBlock* ruleBlock = new RuleBlock;
+            ruleBlock->setConjunction(new AlgebraicProduct);
+            ruleBlock->setDisjunction(new Maximum);
+            ruleBlock->setImplication(new Minimum);
+            ruleBlock->setActivation(new General);
+            std::vector<int> terms(numberOfInputs, 0);
+            while (true) {
+                std::ostringstream rule;
+                int sum = 0;
+                for (int i = 0; i < numberOfInputs; ++i) {
+                    rule << (i == 0 ? "if " : " and ") << "in" << i << " is t" << terms.at(i);
+                    sum += terms.at(i);
+                }
+                rule << " then out is t" << (sum % numberOfTerms);
+                ruleBlock->addRule(Rule::parse(rule.str(), engine));
+                int i = 0;
+                while (i < numberOfInputs and ++terms.at(i) == numberOfTerms)
+                    terms.at(i++) = 0;
+                if (i == numberOfInputs)
+                    break;
+            }
+            engine->addRuleBlock(ruleBlock);
+            return engine;
+        }
+    }
+
+    TEST_CASE("RuleBlock evaluates the candidate rules of a grid-partitioned rule base", "[rule][index]") {
+        FL_unique_ptr<Engine> engine(gridEngine(3, 5));
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+        REQUIRE(ruleBlock->numberOfRules() == 125);
+
+        const scalar values[] = {0.0, 0.1, 0.25, 0.3, 0.6, 0.75, 0.9, 1.0};
+        const std::size_t n = sizeof(values) / sizeof(values[0]);
+        for (std::size_t a = 0; a < n; ++a) {
+            for (std::size_t b = 0; b < n; ++b) {
+                engine->getInputVariable(0)->setValue(values[a]);
+                engine->getInputVariable(1)->setValue(values[b]);
+                engine->getInputVariable(2)->setValue(values[n - a - 1]);
+                std::vector<Rule*> buffer;
+                const std::vector<Rule*>& candidates = ruleBlock->candidateRules(buffer);
+                // each input is within the supports of at most two terms, or three at the vertices
+                const bool vertex = std::fmod(values[a] * 4, 1.0) == 0.0 or std::fmod(values[b] * 4, 1.0) == 0.0;
+                CHECK(candidates.size() <= std::size_t(vertex ? 27 : 8));
+                for (std::size_t r = 0; r < ruleBlock->numberOfRules(); ++r) {
+                    Rule* rule = ruleBlock->getRule(r);
+                    if (std::find(candidates.begin(), candidates.end(), rule) == candidates.end())
+                        CHECK(rule->activateWith(ruleBlock->getConjunction(), ruleBlock->getDisjunction()) == 0.0);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("RuleBlock finds the candidate rules from multiple threads", "[rule][index]") {
+        FL_unique_ptr<Engine> engine(gridEngine(3, 5));
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+        engine->getInputVariable(0)->setValue(0.1);
+        engine->getInputVariable(1)->setValue(0.6);
+        engine->getInputVariable(2)->setValue(0.9);
+        std::vector<Rule*> buffer;
+        const std::vector<Rule*> expected = ruleBlock->candidateRules(buffer);
+        REQUIRE(expected.size() == 8);
+
+        // once the index is built, each thread only fills its own buffer
+        std::vector<int> matches(4, 0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < matches.size(); ++t) {
+            threads.push_back(std::thread([&, t]() {
+                std::vector<Rule*> candidates;
+                for (int i = 0; i < 1000; ++i)
+                    matches.at(t) += ruleBlock->candidateRules(candidates) == expected;
+            }));
+        }
+        for (std::size_t t = 0; t < threads.size(); ++t)
+            threads.at(t).join();
+        for (std::size_t t = 0; t < matches.size(); ++t)
+            CHECK(matches.at(t) == 1000);
+    }
+
+    TEST_CASE("RuleBlock rebuilds the index when the rules or terms change", "[rule][index]") {
+        FL_unique_ptr<Engine> engine(gridEngine(2, 3));
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+        InputVariable* in0 = engine->getInputVariable(0);
+        InputVariable* in1 = engine->getInputVariable(1);
+        in0->setValue(-0.25);
+        in1->setValue(-0.25);
+        std::vector<Rule*> buffer;
+        CHECK(ruleBlock->candidateRules(buffer).size() == 1);
+
+        // the supports of the terms changed, which is not tracked by the rule block
+        Triangle* t1 = dynamic_cast<Triangle*>(in0->getTerm("t1"));
+        t1->setVertexA(-1.0);
+        CHECK(ruleBlock->candidateRules(buffer).size() == 1);
+        ruleBlock->rebuildIndex();
+        CHECK(ruleBlock->candidateRules(buffer).size() == 2);
+
+        // a rule swapped in the mutable vector of rules does not change the revision of the rule block, but
+        // accessing the mutable vector clears the index
+        const std::size_t revision = ruleBlock->revision();
+        Rule* swapped = Rule::parse("if in0 is t2 and in1 is t2 then out is t0", engine.get());
+        REQUIRE(swapped->revision() == ruleBlock->getRule(0)->revision());
+        FL_unique_ptr<Rule> replaced(ruleBlock->getRule(0));
+        ruleBlock->rules().at(0) = swapped;
+        CHECK(ruleBlock->revision() == revision);
+        std::vector<Rule*> candidates = ruleBlock->candidateRules(buffer);
+        CHECK(std::find(candidates.begin(), candidates.end(), replaced.get()) == candidates.end());
+        CHECK(candidates.size() == 1);
+
+        // propositions with hedges other than very, somewhat, extremely, and seldom do not constrain the rules
+        ruleBlock->addRule(Rule::parse("if in0 is not t2 and in1 is t2 then out is t0", engine.get()));
+        ruleBlock->addRule(Rule::parse("if in0 is t2 or in1 is any then out is t0", engine.get()));
+        CHECK(ruleBlock->candidateRules(buffer).size() == 2);
+
+        // rules that cannot be indexed are always candidates, so the missing operators are reported
+        ruleBlock->setDisjunction(fl::null);
+        CHECK(ruleBlock->candidateRules(buffer).size() == 2);
+        CHECK_THROWS_WITH(ruleBlock->activate(), Catch::Matchers::StartsWith("[disjunction error]"));
+
+        // input variables without value do not constrain the rules
+        in0->setValue(fl::nan);
+        CHECK(ruleBlock->candidateRules(buffer).size() == 3);
+    }
+
+    TEST_CASE("RuleBlock changes its revision only when its rules change", "[rule][index]") {
+        FL_unique_ptr<Engine> engine(gridEngine(2, 3));
+        RuleBlock* ruleBlock = engine->getRuleBlock(0);
+        const std::size_t loaded = ruleBlock->revision();
+
+        // other engines loading their rules do not change the revision
+        FL_unique_ptr<Engine> clone(engine->clone());
+        clone->getRuleBlock(0)->reloadRules(clone.get());
+        FL_unique_ptr<Engine> other(gridEngine(2, 3));
+        CHECK(ruleBlock->revision() == loaded);
+
+        ruleBlock->getRule(0)->unload();
+        const std::size_t unloaded = ruleBlock->revision();
+        CHECK(unloaded > loaded);
+        ruleBlock->getRule(0)->getAntecedent()->load(engine.get());
+        CHECK(ruleBlock->revision() > unloaded);
+
+        // removing a rule does not revert the revision
+        const std::size_t before = ruleBlock->revision();
+        FL_unique_ptr<Rule> removed(ruleBlock->removeRule(0));
+        CHECK(ruleBlock->revision() > before);
+        ruleBlock->addRule(Rule::parse("if in0 is t0 then out is t0", engine.get()));
+        CHECK(ruleBlock->revision() > before);
+    }
+
+}
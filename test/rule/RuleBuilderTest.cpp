@@ -0,0 +1,178 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "../Headers.h"
+
+namespace fuzzylite {
+
+    /**
+     * Tests: rule/RuleBuilder
+     *
+     * @author Juan Rada-Vilela, Ph.D.
+     *
+     */
+
+    static Engine* tipper() {
+        Engine* engine = new Engine("tipper");
+        InputVariable* service = new InputVariable("service", 0.0, 10.0);
+        service->addTerm(new Gaussian("poor", 0.0, 1.5));
+        service->addTerm(new Gaussian("good", 5.0, 1.5));
+        service->addTerm(new Gaussian("excellent", 10.0, 1.5));
+        engine->addInputVariable(service);
+        InputVariable* food = new InputVariable("food", 0.0, 10.0);
+        food->addTerm(new Trapezoid("rancid", -2.0, 0.0, 1.0, 3.0));
+        food->addTerm(new Trapezoid("delicious", 7.0, 9.0, 10.0, 12.0));
+        engine->addInputVariable(food);
+        OutputVariable* tip = new OutputVariable("tip", 0.0, 30.0);
+        tip->setAggregation(new Maximum);
+        tip->setDefuzzifier(new Centroid(200));
+        tip->setDefaultValue(fl::nan);
+        tip->addTerm(new Triangle("cheap", 0.0, 5.0, 10.0));
+        tip->addTerm(new Triangle("average", 10.0, 15.0, 20.0));
+        tip->addTerm(new Triangle("generous", 20.0, 25.0, 30.0));
+        engine->addOutputVariable(tip);
+        RuleBlock* ruleBlock = new RuleBlock;
+        ruleBlock->setConjunction(new Minimum);
+        ruleBlock->setDisjunction(new Maximum);
+        ruleBlock->setImplication(new Minimum);
+        ruleBlock->setActivation(new General);
+        engine->addRuleBlock(ruleBlock);
+        return engine;
+    }
+
+    TEST_CASE("RuleBuilder builds loaded rules whose text loads the same rules", "[rule][builder]") {
+        FL_unique_ptr<Engine> engine(tipper());
+        InputVariable* service = engine->getInputVariable(0);
+        InputVariable* food = engine->getInputVariable(1);
+        OutputVariable* tip = engine->getOutputVariable(0);
+
+        RuleBuilder builder;
+        std::vector<Rule*> rules;
+        rules.push_back(builder.when(service, service->getTerm("poor")).orWhen(food, food->getTerm("rancid"))
+                            .then(tip, tip->getTerm("cheap"))
+                            .build());
+        rules.push_back(builder.when(RuleBuilder::proposition(service, new Very, service->getTerm("good")))
+                            .then(tip, tip->getTerm("average"))
+                            .with(0.5)
+                            .build());
+        rules.push_back(
+            builder
+                .when(RuleBuilder::conjunction(
+                    RuleBuilder::proposition(service, service->getTerm("excellent")),
+                    RuleBuilder::disjunction(
+                        RuleBuilder::proposition(food, new Any, fl::null),
+                        RuleBuilder::proposition(food, new Not, food->getTerm("delicious"))
+                    )
+                ))
+                .andWhen(service, service->getTerm("good"))
+                .then(tip, tip->getTerm("generous"))
+                .then(RuleBuilder::proposition(tip, new Somewhat, tip->getTerm("average")))
+                .with(0.123456789)
+                .build()
+        );
+
+        const std::string texts[] = {
+            "if service is poor or food is rancid then tip is cheap",
+            "if service is very good then tip is average with 0.500",
+            "if service is excellent and (food is any or food is not delicious) and service is good "
+            "then tip is generous and tip is somewhat average with 0.123456789",
+        };
+        for (std::size_t i = 0; i < rules.size(); ++i) {
+            CAPTURE(i);
+            Rule* rule = rules.at(i);
+            CHECK(rule->isLoaded());
+            CHECK(rule->getText() == texts[i]);
+            FL_unique_ptr<Rule> parsed(Rule::parse(rule->getText(), engine.get()));
+            CHECK(parsed->getAntecedent()->toPostfix() == rule->getAntecedent()->toPostfix());
+            CHECK(parsed->getConsequent()->toString() == rule->getConsequent()->toString());
+            CHECK(parsed->getWeight() == rule->getWeight());
+            engine->getRuleBlock(0)->addRule(rule);
+        }
+
+        FL_unique_ptr<Engine> copy(engine->clone());
+        CHECK(FllExporter().toString(copy.get()) == FllExporter().toString(engine.get()));
+        for (std::size_t r = 0; r < copy->getRuleBlock(0)->numberOfRules(); ++r)
+            CHECK(copy->getRuleBlock(0)->getRule(r)->isLoaded());
+
+        engine->getRuleBlock(0)->reloadRules(engine.get());
+        CHECK(engine->getRuleBlock(0)->getRule(2)->isLoaded());
+        CHECK(engine->getRuleBlock(0)->getRule(2)->getText() == texts[2]);
+        for (scalar x = 0.0; x <= 10.0; x += 0.5) {
+            service->setValue(x);
+            food->setValue(10.0 - x);
+            copy->getInputVariable(0)->setValue(x);
+            copy->getInputVariable(1)->setValue(10.0 - x);
+            engine->process();
+            copy->process();
+            CHECK(Op::isEq(engine->getOutputValue("tip"), copy->getOutputValue("tip")));
+        }
+    }
+
+    TEST_CASE("RuleBuilder builds the cartesian product of the terms", "[rule][builder]") {
+        FL_unique_ptr<Engine> built(tipper());
+        FL_unique_ptr<Engine> parsed(tipper());
+        InputVariable* service = built->getInputVariable(0);
+        InputVariable* food = built->getInputVariable(1);
+        OutputVariable* tip = built->getOutputVariable(0);
+        RuleBuilder builder;
+        for (std::size_t s = 0; s < service->numberOfTerms(); ++s) {
+            for (std::size_t f = 0; f < food->numberOfTerms(); ++f) {
+                Term* conclusion = tip->getTerm((s + f) % tip->numberOfTerms());
+                built->getRuleBlock(0)->addRule(builder.when(service, service->getTerm(s))
+                                                    .andWhen(food, food->getTerm(f))
+                                                    .then(tip, conclusion)
+                                                    .build());
+                parsed->getRuleBlock(0)->addRule(Rule::parse(
+                    "if service is " + service->getTerm(s)->getName() + " and food is " + food->getTerm(f)->getName()
+                        + " then tip is " + conclusion->getName(),
+                    parsed.get()
+                ));
+            }
+        }
+        CHECK(FllExporter().toString(built.get()) == FllExporter().toString(parsed.get()));
+        for (scalar x = 0.0; x <= 10.0; x += 0.25) {
+            built->setInputValue("service", x);
+            built->setInputValue("food", 10.0 - x);
+            parsed->setInputValue("service", x);
+            parsed->setInputValue("food", 10.0 - x);
+            built->process();
+            parsed->process();
+            CHECK(Op::isEq(built->getOutputValue("tip"), parsed->getOutputValue("tip")));
+        }
+    }
+
+    TEST_CASE("RuleBuilder fails on incomplete rules", "[rule][builder]") {
+        FL_unique_ptr<Engine> engine(tipper());
+        InputVariable* service = engine->getInputVariable(0);
+        OutputVariable* tip = engine->getOutputVariable(0);
+
+        RuleBuilder builder;
+        CHECK_THROWS_AS(builder.then(tip, tip->getTerm(0)).build(), Exception);
+        builder.clear();
+        CHECK_THROWS_AS(builder.when(service, service->getTerm(0)).build(), Exception);
+        CHECK_THROWS_AS(builder.when(service, fl::null).then(tip, tip->getTerm(0)).build(), Exception);
+        CHECK_THROWS_AS(builder.when(fl::null, service->getTerm(0)).build(), Exception);
+        CHECK_THROWS_AS(builder.when(service, service->getTerm(0)).andWhen(fl::null).build(), Exception);
+        builder.clear();
+        builder.when(service, service->getTerm(0)).then(RuleBuilder::proposition(service, service->getTerm(0)));
+        CHECK_THROWS_AS(builder.build(), Exception);
+        builder.clear();
+        FL_unique_ptr<Rule> rule(builder.when(service, service->getTerm(0)).then(tip, tip->getTerm(0)).build());
+        CHECK(rule->getText() == "if service is poor then tip is cheap");
+    }
+
+}
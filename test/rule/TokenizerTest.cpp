@@ -0,0 +1,68 @@
+/*
+fuzzylite (R), a fuzzy logic control library in C++.
+
+Copyright (C) 2010-2024 FuzzyLite Limited. All rights reserved.
+Author: Juan Rada-Vilela, PhD <jcrada@fuzzylite.com>.
+
+This file is part of fuzzylite.
+
+fuzzylite is free software: you can redistribute it and/or modify it under
+the terms of the FuzzyLite License included with the software.
+
+You should have received a copy of the FuzzyLite License along with
+fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
+
+fuzzylite is a registered trademark of FuzzyLite Limited.
+*/
+
+#include "../Headers.h"
+
+namespace fuzzylite {
+
+    /**
+     * Tests: rule/Tokenizer
+     *
+     * @author Juan Rada-Vilela, Ph.D.
+     *
+     */
+
+    static std::vector<std::string> tokenize(Tokenizer tokenizer) {
+        std::vector<std::string> tokens;
+        std::string token;
+        while (tokenizer.next(token))
+            tokens.push_back(token);
+        return tokens;
+    }
+
+    TEST_CASE("Tokenizer splits the text by whitespace", "[rule][tokenizer]") {
+        const std::string text = " if\tA is  high\nthen B is low\r\n";
+        CHECK(Op::join(tokenize(Tokenizer(text)), "|") == "if|A|is|high|then|B|is|low");
+        CHECK(tokenize(Tokenizer("")).empty());
+        CHECK(tokenize(Tokenizer(" \t\n ")).empty());
+
+        Tokenizer tokenizer(text);
+        std::size_t begin = 0, size = 0;
+        REQUIRE(tokenizer.next(begin, size));
+        CHECK(begin == 1);
+        CHECK(size == 2);
+        REQUIRE(tokenizer.next(begin, size));
+        CHECK(text.substr(begin, size) == "A");
+    }
+
+    TEST_CASE("Tokenizer splits the range of the text", "[rule][tokenizer]") {
+        const std::string text = "if A is high then B is low # comment";
+        CHECK(Op::join(tokenize(Tokenizer(text, 3, text.find('#'))), "|") == "A|is|high|then|B|is|low");
+        CHECK(Op::join(tokenize(Tokenizer(text, 0, 6)), "|") == "if|A|i");
+        CHECK(tokenize(Tokenizer(text, text.size(), std::string::npos)).empty());
+    }
+
+    TEST_CASE("Tokenizer splits the parentheses", "[rule][tokenizer]") {
+        const std::string text = "(A is high or(B is low))and C";
+        CHECK(Op::join(tokenize(Tokenizer(text)), "|") == "(A|is|high|or(B|is|low))and|C");
+        CHECK(
+            Op::join(tokenize(Tokenizer(text, 0, std::string::npos, true)), "|")
+            == "(|A|is|high|or|(|B|is|low|)|)|and|C"
+        );
+    }
+
+}
@@ -15,6 +15,7 @@ fuzzylite. If not, see <https://github.com/fuzzylite/fuzzylite/>.
 fuzzylite is a registered trademark of FuzzyLite Limited.
 */
 
+#include <algorithm>
 #include <random>
 
 #include "../Headers.h"
@@ -63,4 +64,212 @@ namespace fuzzylite {
         FL_DBG(variable.toString());
     }
 
+    TEST_CASE("input variable caches the memberships of its terms", "[variable][input]") {
+        InputVariable variable("Variable", 0, 1);
+        Triangle* low = new Triangle("low", 0, 0.25, 0.5);
+        Triangle* high = new Triangle("high", 0.5, 0.75, 1.0);
+        variable.addTerm(low);
+        variable.addTerm(high);
+        variable.setValue(0.3);
+        Triangle other("other", 0, 0.5, 1.0);
+
+        CHECK(variable.membership(low) == low->membership(0.3));
+        CHECK(variable.membership(low) == low->membership(0.3));
+        CHECK(variable.getSavedMembershipCalls() == 0);
+
+        variable.cacheMemberships();
+        CHECK(variable.isCachingMemberships());
+        CHECK(variable.membership(low) == low->membership(0.3));
+        CHECK(variable.membership(low) == low->membership(0.3));
+        CHECK(variable.membership(high) == high->membership(0.3));
+        CHECK(variable.membership(low) == low->membership(0.3));
+        CHECK(variable.getSavedMembershipCalls() == 2);
+
+        // terms that do not belong to the variable are not cached
+        CHECK(variable.membership(&other) == other.membership(0.3));
+        CHECK(variable.membership(&other) == other.membership(0.3));
+        CHECK(variable.getSavedMembershipCalls() == 2);
+
+        // the position of the term finds the cached value, and otherwise the term is searched for
+        CHECK(variable.membership(high, 1) == high->membership(0.3));
+        CHECK(variable.membership(high, 0) == high->membership(0.3));
+        CHECK(variable.membership(low, 5) == low->membership(0.3));
+        CHECK(variable.getSavedMembershipCalls() == 5);
+        CHECK(variable.membership(&other, 0) == other.membership(0.3));
+        CHECK(variable.getSavedMembershipCalls() == 5);
+
+        // the cache is not used for a different value
+        variable.setValue(0.6);
+        CHECK(variable.membership(high) == high->membership(0.6));
+        CHECK(variable.getSavedMembershipCalls() == 5);
+
+        variable.clearMembershipCache();
+        CHECK_FALSE(variable.isCachingMemberships());
+        variable.resetSavedMembershipCalls();
+        CHECK(variable.getSavedMembershipCalls() == 0);
+    }
+
+    TEST_CASE("engine computes the memberships of the input variables once per process", "[variable][input]") {
+        FL_unique_ptr<Engine> engine(FllImporter().fromString(
+            "Engine: Dimmer\n"
+            "InputVariable: Ambient\n"
+            "  range: 0.000 1.000\n"
+            "  term: DARK Triangle 0.000 0.250 0.500\n"
+            "  term: BRIGHT Triangle 0.500 0.750 1.000\n"
+            "OutputVariable: Power\n"
+            "  range: 0.000 1.000\n"
+            "  aggregation: Maximum\n"
+            "  defuzzifier: Centroid 200\n"
+            "  term: LOW Triangle 0.000 0.250 0.500\n"
+            "  term: HIGH Triangle 0.500 0.750 1.000\n"
+            "RuleBlock: \n"
+            "  conjunction: Minimum\n"
+            "  disjunction: Maximum\n"
+            "  implication: Minimum\n"
+            "  rule: if Ambient is DARK then Power is HIGH\n"
+            "  rule: if Ambient is very DARK then Power is HIGH\n"
+            "  rule: if Ambient is DARK or Ambient is BRIGHT then Power is LOW\n"
+            "  rule: if Ambient is not BRIGHT then Power is LOW\n"
+        ));
+        InputVariable* ambient = engine->getInputVariable(0);
+        FL_unique_ptr<Engine> uncached(engine->clone());
+
+        std::size_t savedCalls = 0;
+        for (int i = 0; i <= 10; ++i) {
+            ambient->setValue(i / 10.0);
+            engine->process();
+            CHECK_FALSE(ambient->isCachingMemberships());
+            // beyond the support of DARK, the first two rules are not evaluated
+            savedCalls += i <= 5 ? 3 : 1;
+            CHECK(ambient->getSavedMembershipCalls() == savedCalls);
+
+            // evaluating the rules outside Engine::process does not use the cache
+            uncached->getInputVariable(0)->setValue(i / 10.0);
+            uncached->getOutputVariable(0)->fuzzyOutput()->clear();
+            uncached->getRuleBlock(0)->activate();
+            uncached->getOutputVariable(0)->defuzzify();
+            CHECK(uncached->getInputVariable(0)->getSavedMembershipCalls() == 0);
+            CHECK(engine->getOutputVariable(0)->getValue() == uncached->getOutputVariable(0)->getValue());
+        }
+    }
+
+    TEST_CASE("variable finds the terms by name after they change", "[variable][variable]") {
+        Variable variable("Variable", 0, 1);
+        for (int i = 0; i < 10; ++i)
+            variable.addTerm(new Constant("t" + Op::str(i), i));
+        CHECK(variable.getTerm("t3") == variable.getTerm(3));
+        CHECK_FALSE(variable.hasTerm("t10"));
+
+        variable.getTerm(3)->setName("renamed");
+        CHECK_FALSE(variable.hasTerm("t3"));
+        CHECK(variable.getTerm("renamed") == variable.getTerm(3));
+
+        delete variable.removeTerm(0);
+        variable.insertTerm(new Constant("t10", 10), 0);
+        CHECK(variable.getTerm("t10") == variable.getTerm(0));
+        CHECK_FALSE(variable.hasTerm("t0"));
+
+        std::swap(variable.terms().at(1), variable.terms().at(2));
+        CHECK(variable.getTerm("t1") == variable.getTerm(2));
+        CHECK(variable.getTerm("t2") == variable.getTerm(1));
+
+        variable.addTerm(new Constant("t10", 11));
+        CHECK(variable.getTerm("t10") == variable.getTerm(0));
+        CHECK_THROWS_AS(variable.getTerm("t0"), Exception);
+
+        // the terms added directly to the vector are found before the index is updated
+        variable.terms().push_back(new Constant("pushed", 12));
+        CHECK(variable.getTerm("pushed") == variable.getTerm(11));
+        variable.addTerm(new Constant("added", 13));
+        CHECK(variable.getTerm("pushed") == variable.getTerm(11));
+        CHECK(variable.getTerm("added") == variable.getTerm(12));
+
+        Variable copy(variable);
+        CHECK(copy.getTerm("renamed") == copy.getTerm(3));
+    }
+
+    class CountingConstant : public Constant {
+      public:
+        static int namesRead;
+
+        CountingConstant(const std::string& name, scalar value) : Constant(name, value) {}
+
+        std::string getName() const FL_IOVERRIDE {
+            ++namesRead;
+            return Constant::getName();
+        }
+    };
+
+    int CountingConstant::namesRead = 0;
+
+    TEST_CASE("variable finds the terms by index after it is rebuilt", "[variable][variable]") {
+        OutputVariable variable("Variable", 0, 10);
+        for (int i = 0; i < 10; ++i)
+            variable.addTerm(new CountingConstant("t" + Op::str(i), i));
+        std::reverse(variable.terms().begin(), variable.terms().end());
+        variable.getTerm(0)->setName("renamed");
+
+        // the out-of-date index falls back to a linear scan
+        CountingConstant::namesRead = 0;
+        CHECK(variable.getTerm("renamed") == variable.getTerm(0));
+        CHECK(variable.getTerm("t0") == variable.getTerm(9));
+        CHECK(CountingConstant::namesRead > 2);
+
+        variable.rebuildIndex();
+        CountingConstant::namesRead = 0;
+        CHECK(variable.getTerm("renamed") == variable.getTerm(0));
+        CHECK(variable.getTerm("t0") == variable.getTerm(9));
+        CHECK(CountingConstant::namesRead == 2);
+
+        // the fuzzy output follows the rebuilt index
+        variable.fuzzyOutput()->clear();
+        variable.fuzzyOutput()->addTerm(variable.getTerm(0), 0.5, fl::null);
+        CHECK(variable.fuzzyOutput()->activationDegree(variable.getTerm(0)) == 0.5);
+
+        Engine engine;
+        engine.addOutputVariable(new OutputVariable("o"));
+        engine.getOutputVariable(0)->addTerm(new CountingConstant("a", 0));
+        engine.getOutputVariable(0)->addTerm(new CountingConstant("b", 1));
+        engine.getOutputVariable(0)->getTerm(0)->setName("c");
+        engine.getOutputVariable(0)->setName("p");
+        engine.rebuildIndexes();
+        CountingConstant::namesRead = 0;
+        CHECK(engine.getOutputVariable("p")->getTerm("c") == engine.getOutputVariable(0)->getTerm(0));
+        CHECK(CountingConstant::namesRead == 1);
+    }
+
+    TEST_CASE("engine finds the variables by name after they change", "[variable][engine]") {
+        Engine engine;
+        for (int i = 0; i < 10; ++i) {
+            engine.addInputVariable(new InputVariable("i" + Op::str(i)));
+            engine.addOutputVariable(new OutputVariable("o" + Op::str(i)));
+        }
+        CHECK(engine.getInputVariable("i4") == engine.getInputVariable(4));
+        CHECK(engine.getOutputVariable("o4") == engine.getOutputVariable(4));
+        CHECK_FALSE(engine.hasInputVariable("o4"));
+        CHECK_FALSE(engine.hasOutputVariable("i4"));
+
+        engine.getInputVariable(4)->setName("renamed");
+        CHECK_FALSE(engine.hasInputVariable("i4"));
+        CHECK(engine.getInputVariable("renamed") == engine.getInputVariable(4));
+
+        delete engine.removeOutputVariable("o4");
+        CHECK_FALSE(engine.hasOutputVariable("o4"));
+        CHECK(engine.getOutputVariable("o5") == engine.getOutputVariable(4));
+
+        std::vector<InputVariable*>& inputVariables = engine.inputVariables();
+        std::swap(inputVariables.at(0), inputVariables.at(1));
+        CHECK(engine.getInputVariable("i0") == engine.getInputVariable(1));
+        CHECK(engine.getInputVariable("i1") == engine.getInputVariable(0));
+        CHECK_THROWS_AS(engine.getInputVariable("i4"), Exception);
+
+        // the variables added directly to the vector are found before the index is updated
+        inputVariables.push_back(new InputVariable("pushed"));
+        CHECK(engine.getInputVariable("pushed") == engine.getInputVariable(10));
+
+        Engine copy(engine);
+        CHECK(copy.getInputVariable("renamed") == copy.getInputVariable(4));
+        CHECK(copy.getOutputVariable("o9") == copy.getOutputVariable(8));
+    }
+
 }